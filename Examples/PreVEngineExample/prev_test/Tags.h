@@ -36,6 +36,7 @@ constexpr auto TAG_LENS_FLARE_RENDER_COMPONENT{ "LensFlareRenderComponent" };
 constexpr auto TAG_SUN_RENDER_COMPONENT{ "SunRenderComponent" };
 constexpr auto TAG_BOUNDING_VOLUME_COMPONENT{ "BoundingVolumeComponent" };
 constexpr auto TAG_SELECTABLE_COMPONENT{ "SelectableComponent" };
+constexpr auto TAG_SCENE_QUERY_COMPONENT{ "SceneQueryComponent" };
 constexpr auto TAG_PARTICLE_SYSTEM_COMPONENT{ "ParticleSystemComponent" };
 constexpr auto TAG_SKY_RENDER_COMPONENT{ "SkyRenderComponent" };
 constexpr auto TAG_TIME_COMPONENT{ "TimeComponent" };
@@ -0,0 +1,58 @@
+#include "BenchApp.h"
+
+#include "BenchRoot.h"
+
+#include "../render/renderer/DrawStatistics.h"
+#include "../render/renderer/MasterRenderer.h"
+
+#include <prev/profile/AllocationTracker.h>
+#include <prev/scene/Scene.h>
+
+namespace prev_test::bench {
+BenchApp::BenchApp(const prev::core::engine::Config& config, const BenchScenario& scenario)
+    : prev::App{ config }
+    , m_scenario{ scenario }
+    , m_results{ scenario }
+{
+    m_engine->SetFrameEndCallback([this]() {
+        SampleFrame();
+    });
+}
+
+BenchResults& BenchApp::GetResults()
+{
+    return m_results;
+}
+
+std::unique_ptr<prev::scene::IScene> BenchApp::CreateScene() const
+{
+    return std::make_unique<prev::scene::Scene>(std::make_shared<BenchRoot>(this->m_engine->GetDevice(), this->m_engine->GetConfig().colorManaged, m_scenario));
+}
+
+std::unique_ptr<prev::render::IRootRenderer> BenchApp::CreateRootRenderer() const
+{
+    return std::make_unique<prev_test::render::renderer::MasterRenderer>(this->m_engine->GetDevice(), this->m_engine->GetRenderPass(), this->m_engine->GetScene(), this->m_engine->GetSwapchain().GetImageCount(), this->m_engine->GetViewCount());
+}
+
+void BenchApp::SampleFrame()
+{
+    const auto drawCallCount{ prev_test::render::renderer::DrawStatistics::Instance().Reset() };
+    if (m_engine->GetFrameCount() <= m_scenario.warmupFrameCount) {
+        return;
+    }
+
+    const auto frameTiming{ m_engine->GetFrameTimingStatistics() };
+    const auto frameSamples{ m_engine->GetFrameStatistics().GetSamples(1) };
+
+    BenchFrameSample sample{};
+    sample.updateTime = frameTiming.updateTime;
+    sample.renderTime = frameTiming.renderTime;
+    sample.cpuTime = !frameSamples.empty() ? frameSamples.back().cpuTime : 0.0f;
+    sample.gpuTime = !frameSamples.empty() ? frameSamples.back().gpuTime : -1.0f;
+    sample.drawCallCount = static_cast<uint32_t>(drawCallCount);
+    if (prev::profile::AllocationTracker::IsAvailable()) {
+        sample.allocationCount = static_cast<int64_t>(prev::profile::AllocationTracker::Instance().GetLastFrame().count);
+    }
+    m_results.AddFrame(sample);
+}
+} // namespace prev_test::bench
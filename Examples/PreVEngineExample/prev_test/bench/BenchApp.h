@@ -0,0 +1,35 @@
+#ifndef __BENCH_APP_H__
+#define __BENCH_APP_H__
+
+#include "BenchResults.h"
+#include "BenchScenario.h"
+
+#include <prev/App.h>
+
+namespace prev_test::bench {
+// Runs a scenario headless for its frame count and samples every measured frame.
+class BenchApp final : public prev::App {
+public:
+    BenchApp(const prev::core::engine::Config& config, const BenchScenario& scenario);
+
+    ~BenchApp() = default;
+
+public:
+    BenchResults& GetResults();
+
+protected:
+    std::unique_ptr<prev::scene::IScene> CreateScene() const override;
+
+    std::unique_ptr<prev::render::IRootRenderer> CreateRootRenderer() const override;
+
+private:
+    void SampleFrame();
+
+private:
+    BenchScenario m_scenario;
+
+    BenchResults m_results;
+};
+} // namespace prev_test::bench
+
+#endif // !__BENCH_APP_H__
@@ -0,0 +1,74 @@
+#include "BenchCamera.h"
+
+#include "../Tags.h"
+#include "../component/camera/CameraComponentFactory.h"
+#include "../component/transform/TransformComponentFactory.h"
+
+#include <prev/scene/component/NodeComponentHelper.h>
+
+namespace prev_test::bench {
+BenchCamera::BenchCamera(const std::vector<glm::vec3>& path, const float speed)
+    : SceneNode({ TAG_MAIN_CAMERA, TAG_PLAYER })
+    , m_path{ path }
+    , m_speed{ speed }
+{
+}
+
+void BenchCamera::Init()
+{
+    m_transformComponent = prev_test::component::transform::TrasnformComponentFactory{}.Create();
+    prev::scene::component::NodeComponentHelper::AddComponent<prev_test::component::transform::ITransformComponent>(GetThis(), m_transformComponent, { TAG_TRANSFORM_COMPONENT });
+
+    m_cameraComponent = prev_test::component::camera::CameraComponentFactory{}.Create(glm::quat{}, m_path.front(), true);
+    prev::scene::component::NodeComponentHelper::AddComponent<prev_test::component::camera::ICameraComponent>(GetThis(), m_cameraComponent, { TAG_CAMERA_COMPONENT });
+
+    m_segmentIndex = 0;
+    m_segmentProgress = 0.0f;
+
+    SceneNode::Init();
+}
+
+void BenchCamera::Update(float deltaTime)
+{
+    glm::vec3 position{ m_path.front() };
+    glm::vec3 direction{ 0.0f, 0.0f, -1.0f };
+    if (m_path.size() > 1) {
+        // the same distance each frame with a fixed time step - the camera sees the same at the same frame
+        float distance{ m_speed * deltaTime };
+        while (true) {
+            const auto& from{ m_path[m_segmentIndex] };
+            const auto& to{ m_path[(m_segmentIndex + 1) % m_path.size()] };
+            const float segmentLength{ glm::distance(from, to) };
+            if (m_segmentProgress + distance < segmentLength || segmentLength <= 0.0f) {
+                m_segmentProgress = segmentLength > 0.0f ? m_segmentProgress + distance : 0.0f;
+                position = segmentLength > 0.0f ? glm::mix(from, to, m_segmentProgress / segmentLength) : from;
+                direction = segmentLength > 0.0f ? glm::normalize(to - from) : direction;
+                break;
+            }
+            distance -= segmentLength - m_segmentProgress;
+            m_segmentProgress = 0.0f;
+            m_segmentIndex = (m_segmentIndex + 1) % m_path.size();
+        }
+    }
+
+    m_cameraComponent->SetOrientation(glm::quatLookAt(direction, m_cameraComponent->GetDefaultUpDirection()));
+    m_cameraComponent->SetPosition(position);
+    m_cameraComponent->SetViewFrustum(prev_test::render::ViewFrustum{ m_cameraComponent->GetViewFrustum().GetVerticalFov(), static_cast<float>(m_viewPortSize.x) / static_cast<float>(m_viewPortSize.y), m_cameraComponent->GetViewFrustum().GetNearClippingPlane(), m_cameraComponent->GetViewFrustum().GetFarClippingPlane() });
+
+    m_transformComponent->SetPosition(m_cameraComponent->GetPosition());
+    m_transformComponent->SetOrientation(m_cameraComponent->GetOrientation());
+    m_transformComponent->Update(deltaTime);
+
+    SceneNode::Update(deltaTime);
+}
+
+void BenchCamera::ShutDown()
+{
+    SceneNode::ShutDown();
+}
+
+void BenchCamera::operator()(const prev::core::NewIterationEvent& newIterationEvent)
+{
+    m_viewPortSize = glm::uvec2(newIterationEvent.windowWidth, newIterationEvent.windowHeight);
+}
+} // namespace prev_test::bench
@@ -0,0 +1,51 @@
+#ifndef __BENCH_CAMERA_H__
+#define __BENCH_CAMERA_H__
+
+#include "../component/camera/ICameraComponent.h"
+#include "../component/transform/ITransformComponent.h"
+
+#include <prev/core/CoreEvents.h>
+#include <prev/event/EventHandler.h>
+#include <prev/scene/graph/SceneNode.h>
+
+#include <vector>
+
+namespace prev_test::bench {
+// Main camera flying through a looped path at a constant speed, no input involved.
+class BenchCamera final : public prev::scene::graph::SceneNode {
+public:
+    BenchCamera(const std::vector<glm::vec3>& path, const float speed);
+
+    ~BenchCamera() = default;
+
+public:
+    void Init() override;
+
+    void Update(float deltaTime) override;
+
+    void ShutDown() override;
+
+public:
+    void operator()(const prev::core::NewIterationEvent& newIterationEvent);
+
+private:
+    prev::event::EventHandler<BenchCamera, prev::core::NewIterationEvent> m_newIterationEventHandler{ *this };
+
+private:
+    std::vector<glm::vec3> m_path;
+
+    float m_speed{};
+
+    size_t m_segmentIndex{};
+
+    float m_segmentProgress{};
+
+    glm::uvec2 m_viewPortSize{ 1920, 1080 };
+
+    std::shared_ptr<prev_test::component::transform::ITransformComponent> m_transformComponent{};
+
+    std::shared_ptr<prev_test::component::camera::ICameraComponent> m_cameraComponent{};
+};
+} // namespace prev_test::bench
+
+#endif // !__BENCH_CAMERA_H__
@@ -0,0 +1,73 @@
+#include "BenchCharacter.h"
+
+#include "../Tags.h"
+#include "../common/AssetManager.h"
+#include "../component/ray_casting/BoundingVolumeComponentFactory.h"
+#include "../component/render/RenderComponentFactory.h"
+#include "../component/terrain/ITerrainManagerComponent.h"
+#include "../component/transform/TransformComponentFactory.h"
+
+#include <prev/scene/component/NodeComponentHelper.h>
+
+#include <algorithm>
+#include <cmath>
+
+namespace prev_test::bench {
+BenchCharacter::BenchCharacter(prev::core::device::Device& device, bool colorManaged, const glm::vec3& center, const float radius, const float phase)
+    : SceneNode()
+    , m_device{ device }
+    , m_colorManaged{ colorManaged }
+    , m_center{ center }
+    , m_radius{ radius }
+    , m_angle{ phase }
+{
+}
+
+void BenchCharacter::Init()
+{
+    m_transformComponent = prev_test::component::transform::TrasnformComponentFactory{}.Create(m_center, glm::quat(1.0f, 0.0f, 0.0f, 0.0f), glm::vec3(0.06f));
+    prev::scene::component::NodeComponentHelper::AddComponent<prev_test::component::transform::ITransformComponent>(GetThis(), m_transformComponent, { TAG_TRANSFORM_COMPONENT });
+
+    prev_test::component::render::RenderComponentFactory renderComponentFactory{ m_device, m_colorManaged };
+    m_animationRenderComponent = renderComponentFactory.CreateAnimatedModelRenderComponent(prev_test::common::AssetManager::Instance().GetAssetPath("Models/Archer/erika_archer_bow_arrow.fbx"), { prev_test::common::AssetManager::Instance().GetAssetPath("Models/Archer/Walking.fbx") }, true, true);
+    prev::scene::component::NodeComponentHelper::AddComponent<prev_test::component::render::IAnimationRenderComponent>(GetThis(), m_animationRenderComponent, { TAG_ANIMATION_NORMAL_MAPPED_RENDER_COMPONENT });
+
+    prev_test::component::ray_casting::BoundingVolumeComponentFactory bondingVolumeFactory{ m_device };
+    m_boundingVolumeComponent = bondingVolumeFactory.CreateOBB(m_animationRenderComponent->GetModel()->GetMesh(), glm::vec3(0.4f, 1.0f, 0.4f));
+    prev::scene::component::NodeComponentHelper::AddComponent<prev_test::component::ray_casting::IBoundingVolumeComponent>(GetThis(), m_boundingVolumeComponent, { TAG_BOUNDING_VOLUME_COMPONENT });
+
+    SceneNode::Init();
+}
+
+void BenchCharacter::Update(float deltaTime)
+{
+    const auto terrain{ prev::scene::component::NodeComponentHelper::Find<prev_test::component::terrain::ITerrainManagerComponent>(GetRoot(), { TAG_TERRAIN_MANAGER_COMPONENT }) };
+
+    m_angle += deltaTime * WALK_SPEED / std::max(m_radius, 1.0f);
+
+    glm::vec3 position{ m_center.x + std::cos(m_angle) * m_radius, 0.0f, m_center.z + std::sin(m_angle) * m_radius };
+    if (terrain) {
+        terrain->GetHeightAt(position, position.y);
+    }
+
+    // facing along the circle
+    m_transformComponent->SetPosition(position);
+    m_transformComponent->SetOrientation(glm::angleAxis(-m_angle, glm::vec3(0.0f, 1.0f, 0.0f)));
+    m_transformComponent->Update(deltaTime);
+
+    auto walkingAnimation{ m_animationRenderComponent->GetAnimation(WALKING_ANIMATION_INDEX) };
+    walkingAnimation->SetState(prev_test::render::AnimationState::RUNNING);
+    walkingAnimation->Update(deltaTime);
+
+    if (m_transformComponent->IsWorldTransformChanged()) {
+        m_boundingVolumeComponent->Update(m_transformComponent->GetWorldTransformScaled());
+    }
+
+    SceneNode::Update(deltaTime);
+}
+
+void BenchCharacter::ShutDown()
+{
+    SceneNode::ShutDown();
+}
+} // namespace prev_test::bench
@@ -0,0 +1,50 @@
+#ifndef __BENCH_CHARACTER_H__
+#define __BENCH_CHARACTER_H__
+
+#include "../component/ray_casting/IBoundingVolumeComponent.h"
+#include "../component/render/IAnimationRenderComponent.h"
+#include "../component/transform/ITransformComponent.h"
+
+#include <prev/core/device/Device.h>
+#include <prev/scene/graph/SceneNode.h>
+
+namespace prev_test::bench {
+// Animated character walking in a circle on the terrain.
+class BenchCharacter final : public prev::scene::graph::SceneNode {
+public:
+    BenchCharacter(prev::core::device::Device& device, bool colorManaged, const glm::vec3& center, const float radius, const float phase);
+
+    ~BenchCharacter() = default;
+
+public:
+    void Init() override;
+
+    void Update(float deltaTime) override;
+
+    void ShutDown() override;
+
+private:
+    static const inline float WALK_SPEED{ 4.0f };
+
+    static const inline uint32_t WALKING_ANIMATION_INDEX{ 0 };
+
+private:
+    prev::core::device::Device& m_device;
+
+    const bool m_colorManaged;
+
+    glm::vec3 m_center;
+
+    float m_radius;
+
+    float m_angle;
+
+    std::shared_ptr<prev_test::component::transform::ITransformComponent> m_transformComponent{};
+
+    std::shared_ptr<prev_test::component::render::IAnimationRenderComponent> m_animationRenderComponent{};
+
+    std::shared_ptr<prev_test::component::ray_casting::IBoundingVolumeComponent> m_boundingVolumeComponent{};
+};
+} // namespace prev_test::bench
+
+#endif // !__BENCH_CHARACTER_H__
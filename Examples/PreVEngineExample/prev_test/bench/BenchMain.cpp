@@ -0,0 +1,169 @@
+#include "BenchApp.h"
+
+#include <prev/common/Logger.h>
+#include <prev/util/Utils.h>
+
+#include <chrono>
+#include <cstring>
+#include <string>
+
+namespace {
+struct BenchOptions {
+    std::string scenarioPath{};
+
+    std::string outputPath{ "bench_results.json" };
+
+    std::string baselinePath{};
+
+    float tolerance{ 0.1f };
+};
+
+void PrintUsage(const char* programName)
+{
+    printf("Usage: %s [options]\n", programName);
+    printf("Options:\n");
+    printf("  --scenario <path>      Scenario file (default: built-in scenario)\n");
+    printf("  --set <key=value>      Overrides a scenario value, e.g. --set stones=100\n");
+    printf("  --output <path>        Results JSON (default: bench_results.json)\n");
+    printf("  --baseline <path>      Results JSON to compare with, exits with 2 on a regression\n");
+    printf("  --tolerance <float>    Allowed slowdown against the baseline (default: 0.1 = 10 %%)\n");
+    printf("  --width <int>          Render width (default: 1600)\n");
+    printf("  --height <int>         Render height (default: 900)\n");
+    printf("  --validation <0|1>     Enable validation layers (default: 0)\n");
+    printf("  --gpu-timing <0|1>     Measure GPU frame time with timestamp queries (default: 0)\n");
+    printf("  --gpu <int>            GPU index to use (default: auto)\n");
+    printf("  --backend <string>     Render backend: vulkan, webgpu (default: vulkan)\n");
+    printf("  --help                 Print this help message\n");
+}
+
+prev::core::engine::Config GetDefaultConfig()
+{
+    prev::core::engine::Config config{};
+    config.renderBackend = prev::core::engine::RenderBackend::Vulkan;
+    config.appName = "PreVEngine Bench";
+    config.headless = true;
+    config.windowSize = { 1600, 900 };
+    config.validation = false;
+    config.VSync = false;
+    config.samplesCount = 4;
+    config.swapchainFrameCount = 3;
+    config.maxFramesInFlight = 2;
+    config.colorManaged = true;
+    config.frameStatisticsReportInterval = 0.0f;
+    return config;
+}
+
+bool ParseArgs(int argc, char** argv, prev::core::engine::Config& config, prev_test::bench::BenchScenario& scenario, BenchOptions& options)
+{
+    config = GetDefaultConfig();
+
+    // the scenario file first, so that --set overrides it regardless of the order
+    for (int i = 1; i < argc; ++i) {
+        if (strcmp(argv[i], "--scenario") == 0 && i + 1 < argc) {
+            options.scenarioPath = argv[++i];
+            if (!prev_test::bench::LoadBenchScenario(options.scenarioPath, scenario)) {
+                return false;
+            }
+        }
+    }
+
+    for (int i = 1; i < argc; ++i) {
+        if (strcmp(argv[i], "--scenario") == 0 && i + 1 < argc) {
+            ++i;
+        } else if (strcmp(argv[i], "--set") == 0 && i + 1 < argc) {
+            const std::string entry{ argv[++i] };
+            const auto separator{ entry.find('=') };
+            if (separator == std::string::npos || !prev_test::bench::SetBenchScenarioValue(entry.substr(0, separator), entry.substr(separator + 1), scenario)) {
+                printf("Invalid scenario value: %s\n", entry.c_str());
+                return false;
+            }
+        } else if (strcmp(argv[i], "--output") == 0 && i + 1 < argc) {
+            options.outputPath = argv[++i];
+        } else if (strcmp(argv[i], "--baseline") == 0 && i + 1 < argc) {
+            options.baselinePath = argv[++i];
+        } else if (strcmp(argv[i], "--tolerance") == 0 && i + 1 < argc) {
+            options.tolerance = std::stof(argv[++i]);
+        } else if (strcmp(argv[i], "--width") == 0 && i + 1 < argc) {
+            config.windowSize.x = std::stoi(argv[++i]);
+        } else if (strcmp(argv[i], "--height") == 0 && i + 1 < argc) {
+            config.windowSize.y = std::stoi(argv[++i]);
+        } else if (strcmp(argv[i], "--validation") == 0 && i + 1 < argc) {
+            config.validation = std::stoi(argv[++i]) != 0;
+        } else if (strcmp(argv[i], "--gpu-timing") == 0 && i + 1 < argc) {
+            config.gpuFrameTiming = std::stoi(argv[++i]) != 0;
+        } else if (strcmp(argv[i], "--gpu") == 0 && i + 1 < argc) {
+            config.gpuIndex = std::stoi(argv[++i]);
+        } else if (strcmp(argv[i], "--backend") == 0 && i + 1 < argc) {
+            const std::string backend{ argv[++i] };
+            if (backend == "vulkan") {
+                config.renderBackend = prev::core::engine::RenderBackend::Vulkan;
+            } else if (backend == "webgpu") {
+                config.renderBackend = prev::core::engine::RenderBackend::WebGPU;
+            } else {
+                printf("Unknown backend: %s\n", backend.c_str());
+                PrintUsage(argv[0]);
+                return false;
+            }
+        } else if (strcmp(argv[i], "--help") == 0) {
+            PrintUsage(argv[0]);
+            return false;
+        } else {
+            printf("Unknown option: %s\n", argv[i]);
+            PrintUsage(argv[0]);
+            return false;
+        }
+    }
+
+    // deterministic: the same simulation steps and the same random numbers every run
+    config.fixedDeltaTime = scenario.deltaTime;
+    config.maxFrameCount = scenario.warmupFrameCount + scenario.frameCount;
+    return true;
+}
+} // namespace
+
+int main(int argc, char** argv)
+{
+    prev::core::engine::Config config{};
+    prev_test::bench::BenchScenario scenario{};
+    BenchOptions options{};
+    if (!ParseArgs(argc, argv, config, scenario, options)) {
+        return 1;
+    }
+
+    prev::util::RandomNumberGenerator::SetDefaultSeed(scenario.seed);
+
+    try {
+        prev_test::bench::BenchApp app{ config, scenario };
+
+        const auto initStart{ std::chrono::steady_clock::now() };
+        app.Init();
+        app.GetResults().SetInitTime(std::chrono::duration<float>(std::chrono::steady_clock::now() - initStart).count());
+
+        app.Run();
+        app.ShutDown();
+
+        auto& results{ app.GetResults() };
+        if (!results.WriteJson(options.outputPath)) {
+            return 1;
+        }
+        LOGI("Benchmark '%s' results written to %s", scenario.name.c_str(), options.outputPath.c_str());
+
+        if (!options.baselinePath.empty()) {
+            std::vector<prev_test::bench::BenchMetric> baseline;
+            if (!prev_test::bench::BenchResults::LoadMetrics(options.baselinePath, baseline)) {
+                return 1;
+            }
+
+            const auto regressions{ results.CompareWithBaseline(baseline, options.tolerance) };
+            if (!regressions.empty()) {
+                LOGE("Benchmark '%s' regressed in %zu metrics against %s", scenario.name.c_str(), regressions.size(), options.baselinePath.c_str());
+                return 2;
+            }
+        }
+    } catch (const std::exception& err) {
+        LOGE("Fatal error: %s", err.what());
+        return 1;
+    }
+
+    return 0;
+}
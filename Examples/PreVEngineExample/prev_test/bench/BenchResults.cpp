@@ -0,0 +1,201 @@
+#include "BenchResults.h"
+
+#include <prev/common/Logger.h>
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+
+namespace prev_test::bench {
+namespace {
+    void AddPercentileMetrics(const std::string& name, std::vector<double> values, std::vector<BenchMetric>& inOutMetrics)
+    {
+        if (values.empty()) {
+            return;
+        }
+
+        std::sort(values.begin(), values.end());
+
+        double sum{ 0.0 };
+        for (const auto value : values) {
+            sum += value;
+        }
+
+        // nearest rank
+        const auto percentile = [&values](const double p) {
+            const auto rank{ static_cast<size_t>(std::ceil(p * static_cast<double>(values.size()))) };
+            return values[std::clamp<size_t>(rank, 1, values.size()) - 1];
+        };
+
+        inOutMetrics.push_back({ name + ".mean", sum / static_cast<double>(values.size()) });
+        inOutMetrics.push_back({ name + ".p50", percentile(0.5) });
+        inOutMetrics.push_back({ name + ".p90", percentile(0.9) });
+        inOutMetrics.push_back({ name + ".p99", percentile(0.99) });
+        inOutMetrics.push_back({ name + ".max", values.back() });
+    }
+
+    std::string EscapeJson(const std::string& text)
+    {
+        std::string escaped;
+        escaped.reserve(text.size());
+        for (const char c : text) {
+            if (c == '"' || c == '\\') {
+                escaped.push_back('\\');
+            }
+            escaped.push_back(c);
+        }
+        return escaped;
+    }
+} // namespace
+
+BenchResults::BenchResults(const BenchScenario& scenario)
+    : m_scenario{ scenario }
+{
+    m_frames.reserve(scenario.frameCount);
+}
+
+void BenchResults::SetInitTime(const float initTime)
+{
+    m_initTime = initTime;
+}
+
+void BenchResults::AddFrame(const BenchFrameSample& sample)
+{
+    m_frames.push_back(sample);
+}
+
+std::vector<BenchMetric> BenchResults::ComputeMetrics() const
+{
+    std::vector<double> updateTimes;
+    std::vector<double> renderTimes;
+    std::vector<double> cpuTimes;
+    std::vector<double> gpuTimes;
+    std::vector<double> drawCallCounts;
+    std::vector<double> allocationCounts;
+    for (const auto& frame : m_frames) {
+        updateTimes.push_back(frame.updateTime * 1000.0);
+        renderTimes.push_back(frame.renderTime * 1000.0);
+        cpuTimes.push_back(frame.cpuTime * 1000.0);
+        if (frame.gpuTime >= 0.0f) {
+            gpuTimes.push_back(frame.gpuTime * 1000.0);
+        }
+        drawCallCounts.push_back(frame.drawCallCount);
+        if (frame.allocationCount >= 0) {
+            allocationCounts.push_back(static_cast<double>(frame.allocationCount));
+        }
+    }
+
+    std::vector<BenchMetric> metrics;
+    metrics.push_back({ "initMs", m_initTime * 1000.0 });
+    AddPercentileMetrics("updateMs", updateTimes, metrics);
+    AddPercentileMetrics("renderMs", renderTimes, metrics);
+    AddPercentileMetrics("cpuMs", cpuTimes, metrics);
+    AddPercentileMetrics("gpuMs", gpuTimes, metrics);
+    AddPercentileMetrics("drawCalls", drawCallCounts, metrics);
+    AddPercentileMetrics("allocations", allocationCounts, metrics);
+    return metrics;
+}
+
+bool BenchResults::WriteJson(const std::string& path) const
+{
+    std::ofstream file{ path };
+    if (!file.is_open()) {
+        LOGE("Could not open benchmark results file: %s", path.c_str());
+        return false;
+    }
+
+    file << std::setprecision(6) << std::fixed;
+    file << "{\n";
+    file << "  \"scenario\": \"" << EscapeJson(m_scenario.name) << "\",\n";
+    file << "  \"seed\": " << m_scenario.seed << ",\n";
+    file << "  \"deltaTime\": " << m_scenario.deltaTime << ",\n";
+    file << "  \"frameCount\": " << m_frames.size() << ",\n";
+
+    file << "  \"metrics\": {\n";
+    const auto metrics{ ComputeMetrics() };
+    for (size_t i = 0; i < metrics.size(); ++i) {
+        file << "    \"" << metrics[i].name << "\": " << metrics[i].value << (i + 1 < metrics.size() ? ",\n" : "\n");
+    }
+    file << "  },\n";
+
+    // per frame, milliseconds
+    file << "  \"frames\": [\n";
+    for (size_t i = 0; i < m_frames.size(); ++i) {
+        const auto& frame{ m_frames[i] };
+        file << "    { \"update\": " << frame.updateTime * 1000.0f << ", \"render\": " << frame.renderTime * 1000.0f << ", \"cpu\": " << frame.cpuTime * 1000.0f << ", \"gpu\": " << (frame.gpuTime >= 0.0f ? frame.gpuTime * 1000.0f : -1.0f) << ", \"drawCalls\": " << frame.drawCallCount << ", \"allocations\": " << frame.allocationCount << " }" << (i + 1 < m_frames.size() ? ",\n" : "\n");
+    }
+    file << "  ]\n";
+    file << "}\n";
+    return file.good();
+}
+
+std::vector<BenchRegression> BenchResults::CompareWithBaseline(const std::vector<BenchMetric>& baseline, const float tolerance) const
+{
+    std::vector<BenchRegression> regressions;
+    for (const auto& metric : ComputeMetrics()) {
+        const auto baselineMetric{ std::find_if(baseline.cbegin(), baseline.cend(), [&](const auto& m) { return m.name == metric.name; }) };
+        if (baselineMetric == baseline.cend()) {
+            continue;
+        }
+
+        const double limit{ baselineMetric->value * (1.0 + tolerance) };
+        const bool regressed{ metric.value > limit && metric.value > baselineMetric->value };
+        LOGI("%-16s baseline %10.3f current %10.3f %s", metric.name.c_str(), baselineMetric->value, metric.value, regressed ? "REGRESSED" : "");
+        if (regressed) {
+            regressions.push_back({ metric.name, baselineMetric->value, metric.value });
+        }
+    }
+    return regressions;
+}
+
+bool BenchResults::LoadMetrics(const std::string& path, std::vector<BenchMetric>& outMetrics)
+{
+    std::ifstream file{ path };
+    if (!file.is_open()) {
+        LOGE("Could not open benchmark baseline: %s", path.c_str());
+        return false;
+    }
+
+    std::stringstream buffer;
+    buffer << file.rdbuf();
+    const std::string content{ buffer.str() };
+
+    // only the flat "metrics" object is read, as written by WriteJson
+    const auto metricsKey{ content.find("\"metrics\"") };
+    const auto begin{ metricsKey != std::string::npos ? content.find('{', metricsKey) : std::string::npos };
+    const auto end{ begin != std::string::npos ? content.find('}', begin) : std::string::npos };
+    if (end == std::string::npos) {
+        LOGE("Benchmark baseline %s has no metrics", path.c_str());
+        return false;
+    }
+
+    std::vector<BenchMetric> metrics;
+    size_t position{ begin + 1 };
+    while (true) {
+        const auto nameBegin{ content.find('"', position) };
+        if (nameBegin == std::string::npos || nameBegin > end) {
+            break;
+        }
+        const auto nameEnd{ content.find('"', nameBegin + 1) };
+        const auto colon{ content.find(':', nameEnd) };
+        if (nameEnd == std::string::npos || colon == std::string::npos || colon > end) {
+            return false;
+        }
+
+        try {
+            size_t parsedLength{ 0 };
+            const double value{ std::stod(content.substr(colon + 1, end - colon - 1), &parsedLength) };
+            metrics.push_back({ content.substr(nameBegin + 1, nameEnd - nameBegin - 1), value });
+            position = colon + 1 + parsedLength;
+        } catch (const std::exception&) {
+            LOGE("Benchmark baseline %s has an invalid metric", path.c_str());
+            return false;
+        }
+    }
+
+    outMetrics = metrics;
+    return true;
+}
+} // namespace prev_test::bench
@@ -0,0 +1,73 @@
+#ifndef __BENCH_RESULTS_H__
+#define __BENCH_RESULTS_H__
+
+#include "BenchScenario.h"
+
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace prev_test::bench {
+// Seconds, of a single frame.
+struct BenchFrameSample {
+    float updateTime{};
+
+    float renderTime{};
+
+    float cpuTime{};
+
+    // negative when not measured
+    float gpuTime{ -1.0f };
+
+    uint32_t drawCallCount{};
+
+    // heap allocations, negative unless the engine was built with ENABLE_ALLOCATION_TRACKING
+    int64_t allocationCount{ -1 };
+};
+
+struct BenchMetric {
+    std::string name;
+
+    double value{};
+};
+
+struct BenchRegression {
+    std::string name;
+
+    double baseline{};
+
+    double current{};
+};
+
+class BenchResults final {
+public:
+    BenchResults(const BenchScenario& scenario);
+
+    ~BenchResults() = default;
+
+public:
+    void SetInitTime(const float initTime);
+
+    void AddFrame(const BenchFrameSample& sample);
+
+    // Percentiles of the frame samples, lower is better for all of them.
+    std::vector<BenchMetric> ComputeMetrics() const;
+
+    bool WriteJson(const std::string& path) const;
+
+    // Metrics worse than in the baseline by more than the tolerance (0.1 = 10 %).
+    std::vector<BenchRegression> CompareWithBaseline(const std::vector<BenchMetric>& baseline, const float tolerance) const;
+
+    // Metrics of a file written by WriteJson.
+    static bool LoadMetrics(const std::string& path, std::vector<BenchMetric>& outMetrics);
+
+private:
+    BenchScenario m_scenario;
+
+    float m_initTime{};
+
+    std::vector<BenchFrameSample> m_frames;
+};
+} // namespace prev_test::bench
+
+#endif // !__BENCH_RESULTS_H__
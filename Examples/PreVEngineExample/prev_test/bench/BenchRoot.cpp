@@ -0,0 +1,96 @@
+#include "BenchRoot.h"
+
+#include "BenchCamera.h"
+#include "BenchCharacter.h"
+
+#include "../common/AssetManager.h"
+#include "../component/terrain/TerrainCommon.h"
+#include "../component/transform/TransformSystem.h"
+#include "../scene/Fire.h"
+#include "../scene/Stone.h"
+#include "../scene/Time.h"
+#include "../scene/light/MainLight.h"
+#include "../scene/robot/CubeRobot.h"
+#include "../scene/shadow/Shadow.h"
+#include "../scene/sky/LensFlare.h"
+#include "../scene/sky/Sky.h"
+#include "../scene/sky/Sun.h"
+#include "../scene/terrain/TerrainManager.h"
+#include "../scene/water/WaterManager.h"
+
+#include <prev/util/Utils.h>
+
+namespace prev_test::bench {
+BenchRoot::BenchRoot(prev::core::device::Device& device, bool colorManaged, const BenchScenario& scenario)
+    : SceneNode()
+    , m_device{ device }
+    , m_colorManaged{ colorManaged }
+    , m_scenario{ scenario }
+{
+}
+
+void BenchRoot::Init()
+{
+    AddChild(std::make_shared<prev_test::scene::Time>());
+    AddChild(std::make_shared<prev_test::scene::sky::Sky>(m_device, m_colorManaged));
+    AddChild(std::make_shared<prev_test::scene::light::MainLight>(glm::vec3(15000.0f, 5000.0f, 15000.0f)));
+    AddChild(std::make_shared<prev_test::scene::shadow::Shadows>(m_device));
+    AddChild(std::make_shared<BenchCamera>(m_scenario.cameraPath, m_scenario.cameraSpeed));
+    AddChild(std::make_shared<prev_test::scene::terrain::TerrainManager>(m_device, m_colorManaged, m_scenario.terrainSize, m_scenario.terrainSize));
+    AddChild(std::make_shared<prev_test::scene::water::WaterManager>(m_device, m_colorManaged, m_scenario.terrainSize, m_scenario.terrainSize));
+    AddChild(std::make_shared<prev_test::scene::sky::Sun>(m_device, m_colorManaged));
+
+    const float ITEMS_TERRAIN_BORDER_PADDING{ 10.0f };
+    const float terrainExtent{ prev_test::component::terrain::TERRAIN_TILE_SIZE * m_scenario.terrainSize };
+
+    // a generator of its own, the placement does not depend on what else draws random numbers
+    prev::util::RandomNumberGenerator rng{ m_scenario.seed };
+    std::uniform_real_distribution<float> positionDistribution(ITEMS_TERRAIN_BORDER_PADDING, terrainExtent - ITEMS_TERRAIN_BORDER_PADDING);
+    std::uniform_real_distribution<float> scaleDistribution(0.005f, 0.01f);
+    std::uniform_real_distribution<float> angleDistribution(0.0f, glm::two_pi<float>());
+
+    for (uint32_t i = 0; i < m_scenario.stoneCount; ++i) {
+        const glm::vec3 position{ positionDistribution(rng.GetRandomEngine()), 0.0f, positionDistribution(rng.GetRandomEngine()) };
+        AddChild(std::make_shared<prev_test::scene::Stone>(m_device, m_colorManaged, position, glm::quat(glm::radians(glm::vec3(90.0f, 0.0f, 0.0f))), glm::vec3(scaleDistribution(rng.GetRandomEngine()))));
+    }
+
+    for (uint32_t i = 0; i < m_scenario.robotCount; ++i) {
+        const glm::vec3 position{ positionDistribution(rng.GetRandomEngine()), 20.0f, positionDistribution(rng.GetRandomEngine()) };
+        AddChild(std::make_shared<prev_test::scene::robot::CubeRobot>(m_device, m_colorManaged, position, glm::quat(1.0f, 0.0f, 0.0f, 0.0f), glm::vec3(1.0f), prev_test::common::AssetManager::Instance().GetAssetPath("Textures/texture.jpg")));
+    }
+
+    for (uint32_t i = 0; i < m_scenario.characterCount; ++i) {
+        const glm::vec3 center{ positionDistribution(rng.GetRandomEngine()), 0.0f, positionDistribution(rng.GetRandomEngine()) };
+        AddChild(std::make_shared<BenchCharacter>(m_device, m_colorManaged, center, 8.0f, angleDistribution(rng.GetRandomEngine())));
+    }
+
+    for (uint32_t i = 0; i < m_scenario.fireCount; ++i) {
+        const glm::vec3 position{ positionDistribution(rng.GetRandomEngine()), 0.0f, positionDistribution(rng.GetRandomEngine()) };
+        AddChild(std::make_shared<prev_test::scene::Fire>(m_device, m_colorManaged, position));
+    }
+
+    AddChild(std::make_shared<prev_test::scene::sky::LensFlare>(m_device, m_colorManaged));
+
+    // the renderers cull against it, as in the example scene
+    m_sceneQuery = std::make_shared<prev_test::scene::ray_casting::SceneQuery>();
+    AddChild(m_sceneQuery);
+
+    SceneNode::Init();
+}
+
+void BenchRoot::Update(float deltaTime)
+{
+    prev_test::component::transform::TransformSystem::Instance().Update(m_device.GetWorkerThreadPool());
+
+    SceneNode::Update(deltaTime);
+
+    m_sceneQuery->Refit();
+}
+
+void BenchRoot::ShutDown()
+{
+    SceneNode::ShutDown();
+
+    m_sceneQuery = nullptr;
+}
+} // namespace prev_test::bench
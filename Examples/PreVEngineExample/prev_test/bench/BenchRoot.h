@@ -0,0 +1,37 @@
+#ifndef __BENCH_ROOT_H__
+#define __BENCH_ROOT_H__
+
+#include "BenchScenario.h"
+
+#include "../scene/ray_casting/SceneQuery.h"
+
+#include <prev/core/device/Device.h>
+#include <prev/scene/graph/SceneNode.h>
+
+namespace prev_test::bench {
+// The example scene as a scenario describes it, without the input driven nodes.
+class BenchRoot final : public prev::scene::graph::SceneNode {
+public:
+    BenchRoot(prev::core::device::Device& device, bool colorManaged, const BenchScenario& scenario);
+
+    ~BenchRoot() = default;
+
+public:
+    void Init() override;
+
+    void Update(float deltaTime) override;
+
+    void ShutDown() override;
+
+private:
+    prev::core::device::Device& m_device;
+
+    const bool m_colorManaged;
+
+    BenchScenario m_scenario;
+
+    std::shared_ptr<prev_test::scene::ray_casting::SceneQuery> m_sceneQuery;
+};
+} // namespace prev_test::bench
+
+#endif // !__BENCH_ROOT_H__
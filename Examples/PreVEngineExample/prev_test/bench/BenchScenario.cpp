@@ -0,0 +1,112 @@
+#include "BenchScenario.h"
+
+#include <prev/common/Logger.h>
+
+#include <fstream>
+#include <sstream>
+
+namespace prev_test::bench {
+namespace {
+    std::string Trim(const std::string& text)
+    {
+        const auto first{ text.find_first_not_of(" \t\r\n") };
+        if (first == std::string::npos) {
+            return {};
+        }
+        const auto last{ text.find_last_not_of(" \t\r\n") };
+        return text.substr(first, last - first + 1);
+    }
+
+    bool ParseCameraPath(const std::string& value, std::vector<glm::vec3>& outPath)
+    {
+        std::vector<glm::vec3> path;
+        std::stringstream pointsStream{ value };
+        std::string point;
+        while (std::getline(pointsStream, point, ';')) {
+            if (Trim(point).empty()) {
+                continue;
+            }
+            std::stringstream pointStream{ point };
+            glm::vec3 position{};
+            if (!(pointStream >> position.x >> position.y >> position.z)) {
+                return false;
+            }
+            path.push_back(position);
+        }
+
+        if (path.empty()) {
+            return false;
+        }
+        outPath = path;
+        return true;
+    }
+} // namespace
+
+bool LoadBenchScenario(const std::string& path, BenchScenario& outScenario)
+{
+    std::ifstream file{ path };
+    if (!file.is_open()) {
+        LOGE("Could not open benchmark scenario: %s", path.c_str());
+        return false;
+    }
+
+    std::string line;
+    uint32_t lineNumber{ 0 };
+    while (std::getline(file, line)) {
+        ++lineNumber;
+
+        line = Trim(line);
+        if (line.empty() || line[0] == '#') {
+            continue;
+        }
+
+        const auto separator{ line.find('=') };
+        if (separator == std::string::npos) {
+            LOGE("Benchmark scenario %s:%u: expected key = value", path.c_str(), lineNumber);
+            return false;
+        }
+
+        if (!SetBenchScenarioValue(Trim(line.substr(0, separator)), Trim(line.substr(separator + 1)), outScenario)) {
+            LOGE("Benchmark scenario %s:%u: invalid entry '%s'", path.c_str(), lineNumber, line.c_str());
+            return false;
+        }
+    }
+    return true;
+}
+
+bool SetBenchScenarioValue(const std::string& key, const std::string& value, BenchScenario& inOutScenario)
+{
+    try {
+        if (key == "name") {
+            inOutScenario.name = value;
+        } else if (key == "frames") {
+            inOutScenario.frameCount = static_cast<uint32_t>(std::stoul(value));
+        } else if (key == "warmupFrames") {
+            inOutScenario.warmupFrameCount = static_cast<uint32_t>(std::stoul(value));
+        } else if (key == "deltaTime") {
+            inOutScenario.deltaTime = std::stof(value);
+        } else if (key == "seed") {
+            inOutScenario.seed = std::stoul(value);
+        } else if (key == "stones") {
+            inOutScenario.stoneCount = static_cast<uint32_t>(std::stoul(value));
+        } else if (key == "robots") {
+            inOutScenario.robotCount = static_cast<uint32_t>(std::stoul(value));
+        } else if (key == "characters") {
+            inOutScenario.characterCount = static_cast<uint32_t>(std::stoul(value));
+        } else if (key == "fires") {
+            inOutScenario.fireCount = static_cast<uint32_t>(std::stoul(value));
+        } else if (key == "terrainSize") {
+            inOutScenario.terrainSize = static_cast<uint32_t>(std::stoul(value));
+        } else if (key == "cameraSpeed") {
+            inOutScenario.cameraSpeed = std::stof(value);
+        } else if (key == "cameraPath") {
+            return ParseCameraPath(value, inOutScenario.cameraPath);
+        } else {
+            return false;
+        }
+    } catch (const std::exception&) {
+        return false;
+    }
+    return inOutScenario.frameCount > 0 && inOutScenario.deltaTime > 0.0f && inOutScenario.terrainSize > 0;
+}
+} // namespace prev_test::bench
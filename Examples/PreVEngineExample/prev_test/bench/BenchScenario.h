@@ -0,0 +1,65 @@
+#ifndef __BENCH_SCENARIO_H__
+#define __BENCH_SCENARIO_H__
+
+#include <prev/common/Common.h>
+
+#include <string>
+#include <vector>
+
+namespace prev_test::bench {
+// What a benchmark run builds and how long it runs, loaded from a "key = value" text file:
+//
+//   name = terrain_heavy
+//   frames = 600
+//   warmupFrames = 60
+//   deltaTime = 0.016667
+//   seed = 1
+//   stones = 64
+//   robots = 8
+//   characters = 4
+//   fires = 2
+//   terrainSize = 4
+//   cameraSpeed = 20
+//   cameraPath = 40 25 40; 280 35 40; 280 35 280; 40 25 280
+//
+// Lines starting with '#' are comments, keys not present keep their defaults.
+struct BenchScenario {
+    std::string name{ "default" };
+
+    // measured
+    uint32_t frameCount{ 600 };
+
+    // run before the measured ones, e.g. while the assets stream in
+    uint32_t warmupFrameCount{ 60 };
+
+    float deltaTime{ 1.0f / 60.0f };
+
+    unsigned long seed{ 1 };
+
+    uint32_t stoneCount{ 12 };
+
+    uint32_t robotCount{ 0 };
+
+    // animated
+    uint32_t characterCount{ 1 };
+
+    // particle emitters
+    uint32_t fireCount{ 1 };
+
+    // terrain tiles per side
+    uint32_t terrainSize{ 3 };
+
+    // units per second along the path
+    float cameraSpeed{ 20.0f };
+
+    // the camera loops through the points, looking ahead to the next one
+    std::vector<glm::vec3> cameraPath{ { 40.0f, 25.0f, 40.0f }, { 200.0f, 35.0f, 40.0f }, { 200.0f, 35.0f, 200.0f }, { 40.0f, 25.0f, 200.0f } };
+};
+
+bool LoadBenchScenario(const std::string& path, BenchScenario& outScenario);
+
+// Applies a single "key = value" pair, e.g. a command line override.
+bool SetBenchScenarioValue(const std::string& key, const std::string& value, BenchScenario& inOutScenario);
+} // namespace prev_test::bench
+
+#endif // !__BENCH_SCENARIO_H__
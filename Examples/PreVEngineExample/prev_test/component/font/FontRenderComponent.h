@@ -35,11 +35,8 @@ public:
 
     bool IsReady() const override
     {
-        if (m_fontMetaData) {
-            const auto imageBuffer{ m_fontMetaData->GetImageBuffer() };
-            if (imageBuffer && !imageBuffer->IsReady()) {
-                return false;
-            }
+        if (m_fontMetaData && !m_fontMetaData->IsReady()) {
+            return false;
         }
         for (const auto& [key, renderableText] : m_renderableTexts) {
             if (renderableText.model && !renderableText.model->IsReady()) {
@@ -1,16 +1,15 @@
 #include "AbstractParticleFactory.h"
 
 namespace prev_test::component::particle {
-AbstractParticleFactory::AbstractParticleFactory(const std::shared_ptr<prev_test::render::IMaterial>& mt, const float gravityComp, const float avgSpeed, const float avgLifeLength, const float avgScale)
-    : m_material(mt)
-    , m_gravityCompliment(gravityComp)
+AbstractParticleFactory::AbstractParticleFactory(const float gravityComp, const float avgSpeed, const float avgLifeLength, const float avgScale)
+    : m_gravityCompliment(gravityComp)
     , m_averageSpeed(avgSpeed)
     , m_averageLifeLength(avgLifeLength)
     , m_averageScale(avgScale)
 {
 }
 
-std::unique_ptr<Particle> AbstractParticleFactory::EmitParticle(const glm::vec3& centerPosition) const
+bool AbstractParticleFactory::EmitParticle(const glm::vec3& centerPosition, prev::scene::particle::ParticlePool& pool) const
 {
     glm::vec3 velocity = GenerateVelocty();
     velocity = glm::normalize(velocity);
@@ -19,7 +18,7 @@ std::unique_ptr<Particle> AbstractParticleFactory::EmitParticle(const glm::vec3&
     float rotation = m_randomRotation ? GenerateRotation() : 0.0f;
     float scale = GenerateValue(m_averageScale, m_scaleError);
     glm::vec3 radiusOffset = GenerateRadiusOffset();
-    return std::make_unique<Particle>(m_material, centerPosition + radiusOffset, velocity, m_gravityCompliment, lifeLength, rotation, scale);
+    return pool.Emit(centerPosition + radiusOffset, velocity, m_gravityCompliment, lifeLength, rotation, scale);
 }
 
 void AbstractParticleFactory::SetSpeedError(const float err)
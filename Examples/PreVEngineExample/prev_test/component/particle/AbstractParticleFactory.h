@@ -8,7 +8,7 @@
 namespace prev_test::component::particle {
 class AbstractParticleFactory : public IParticleFactory {
 public:
-    AbstractParticleFactory(const std::shared_ptr<prev_test::render::IMaterial>& mt, const float gravityComp, const float avgSpeed, const float avgLifeLength, const float avgScale);
+    AbstractParticleFactory(const float gravityComp, const float avgSpeed, const float avgLifeLength, const float avgScale);
 
     virtual ~AbstractParticleFactory() = default;
 
@@ -18,7 +18,7 @@ protected:
     virtual glm::vec3 GenerateRadiusOffset() const = 0;
 
 public:
-    std::unique_ptr<Particle> EmitParticle(const glm::vec3& centerPosition) const override;
+    bool EmitParticle(const glm::vec3& centerPosition, prev::scene::particle::ParticlePool& pool) const override;
 
 public:
     void SetSpeedError(const float err);
@@ -47,8 +47,6 @@ protected:
     float GenerateValue(const float average, const float errorMargin) const;
 
 protected:
-    const std::shared_ptr<prev_test::render::IMaterial> m_material;
-
     const float m_gravityCompliment;
 
     const float m_averageSpeed;
@@ -0,0 +1,177 @@
+#include "GpuParticleSystemComponent.h"
+
+namespace prev_test::component::particle {
+namespace {
+    // box around the ballistic trajectory of a particle over its whole life, grown by its billboard size
+    prev::util::intersection::AABB ComputeTrajectoryBoundingBox(const prev::scene::particle::ParticlePool& particles, const uint32_t index)
+    {
+        const glm::vec3 position{ particles.GetPosition(index) };
+        const glm::vec3 velocity{ particles.GetVelocity(index) };
+        const float acceleration{ prev::scene::particle::ParticlePool::GRAVITY_Y * particles.GetGravityEffect(index) };
+        const float lifeLength{ particles.GetLifeLength(index) };
+
+        const glm::vec3 endPosition{ position + velocity * lifeLength + glm::vec3(0.0f, 0.5f * acceleration * lifeLength * lifeLength, 0.0f) };
+
+        prev::util::intersection::AABB boundingBox{ glm::min(position, endPosition), glm::max(position, endPosition) };
+        if (acceleration != 0.0f) {
+            const float apexTime{ -velocity.y / acceleration };
+            if (apexTime > 0.0f && apexTime < lifeLength) {
+                const float apexY{ position.y + velocity.y * apexTime + 0.5f * acceleration * apexTime * apexTime };
+                boundingBox.minExtents.y = std::min(boundingBox.minExtents.y, apexY);
+                boundingBox.maxExtents.y = std::max(boundingBox.maxExtents.y, apexY);
+            }
+        }
+
+        const glm::vec3 margin{ particles.GetScale(index) };
+        boundingBox.minExtents -= margin;
+        boundingBox.maxExtents += margin;
+        return boundingBox;
+    }
+} // namespace
+
+GpuParticleSystemComponent::GpuParticleSystemComponent(const std::shared_ptr<prev_test::render::IModel>& model, const std::shared_ptr<prev::render::buffer::Buffer>& instanceBuffer, const prev::render::particle::ParticleSimulationState& simulationState, const std::vector<std::shared_ptr<prev::render::buffer::Buffer>>& emittedParticlesBuffers, const std::shared_ptr<prev_test::render::IMaterial>& material, const std::shared_ptr<IParticleFactory>& particleFactory, const float particlesPerSecond, const uint32_t maxEmittedPerFrame)
+    : m_model(model)
+    , m_instanceBuffer(instanceBuffer)
+    , m_simulationState(simulationState)
+    , m_emittedParticlesBuffers(emittedParticlesBuffers)
+    , m_material(material)
+    , m_particleFactory(particleFactory)
+    , m_particlesPerSecond(particlesPerSecond)
+    , m_emittedParticles(maxEmittedPerFrame)
+    , m_emittedParticlesData(maxEmittedPerFrame)
+{
+    // the first Update flips the input to the first particle buffer
+    m_simulationState.inputIndex = 1;
+}
+
+void GpuParticleSystemComponent::Update(const float deltaTime, const glm::vec3& centerPosition)
+{
+    m_time += deltaTime;
+
+    m_emittedParticles.Clear();
+    AddNewParticles(deltaTime, centerPosition);
+    UploadEmittedParticles();
+    UpdateBoundingBox();
+
+    m_simulationState.inputIndex = 1 - m_simulationState.inputIndex;
+    m_simulationState.deltaTime = deltaTime;
+}
+
+void GpuParticleSystemComponent::SetParticlesPerSecond(const float pps)
+{
+    m_particlesPerSecond = pps;
+}
+
+float GpuParticleSystemComponent::GetParticlesPerSecond() const
+{
+    return m_particlesPerSecond;
+}
+
+std::shared_ptr<IParticleFactory> GpuParticleSystemComponent::GetParticleFactory() const
+{
+    return m_particleFactory;
+}
+
+std::shared_ptr<prev_test::render::IModel> GpuParticleSystemComponent::GetModel() const
+{
+    return m_model;
+}
+
+std::shared_ptr<prev_test::render::IMaterial> GpuParticleSystemComponent::GetMaterial() const
+{
+    return m_material;
+}
+
+bool GpuParticleSystemComponent::IsReady() const
+{
+    return (!m_model || m_model->IsReady()) && (!m_material || m_material->IsReady());
+}
+
+uint32_t GpuParticleSystemComponent::GetParticleCount() const
+{
+    return m_maxAliveCount;
+}
+
+std::shared_ptr<prev::render::buffer::Buffer> GpuParticleSystemComponent::GetVertexBuffer() const
+{
+    return m_instanceBuffer;
+}
+
+const prev::scene::particle::ParticleInstance* GpuParticleSystemComponent::GetInstances() const
+{
+    return nullptr;
+}
+
+const prev::render::particle::ParticleSimulationState* GpuParticleSystemComponent::GetSimulationState() const
+{
+    return &m_simulationState;
+}
+
+const prev::util::intersection::AABB& GpuParticleSystemComponent::GetBoundingBox() const
+{
+    return m_boundingBox;
+}
+
+void GpuParticleSystemComponent::AddNewParticles(const float deltaTime, const glm::vec3& centerPosition)
+{
+    const float particlesToCreate{ m_particlesPerSecond * deltaTime };
+    const int particlesToCreateCount{ static_cast<int>(std::floor(particlesToCreate)) };
+    for (int i = 0; i < particlesToCreateCount; ++i) {
+        if (!m_particleFactory->EmitParticle(centerPosition, m_emittedParticles)) {
+            return;
+        }
+    }
+
+    std::uniform_real_distribution<float> dist(0.0, 1.0);
+    const float partialCount{ fmodf(particlesToCreate, 1.0f) };
+    if (dist(m_rng.GetRandomEngine()) < partialCount) {
+        m_particleFactory->EmitParticle(centerPosition, m_emittedParticles);
+    }
+}
+
+void GpuParticleSystemComponent::UploadEmittedParticles()
+{
+    if (m_emissionBuckets.empty() || m_time - m_emissionBuckets.back().startTime >= EMISSION_BUCKET_DURATION) {
+        m_emissionBuckets.push_back({ {}, m_time, m_time, 0 });
+    }
+    auto& bucket{ m_emissionBuckets.back() };
+
+    const uint32_t emittedCount{ m_emittedParticles.GetCount() };
+    for (uint32_t i = 0; i < emittedCount; ++i) {
+        const glm::vec3 position{ m_emittedParticles.GetPosition(i) };
+        const glm::vec3 velocity{ m_emittedParticles.GetVelocity(i) };
+        const float lifeLength{ m_emittedParticles.GetLifeLength(i) };
+        m_emittedParticlesData[i] = prev::render::particle::GpuParticle{ glm::vec4(position, m_emittedParticles.GetGravityEffect(i)), glm::vec4(velocity, lifeLength), glm::vec4(0.0f, m_emittedParticles.GetRotation(i), m_emittedParticles.GetScale(i), 0.0f) };
+
+        const auto trajectoryBoundingBox{ ComputeTrajectoryBoundingBox(m_emittedParticles, i) };
+        bucket.boundingBox.minExtents = glm::min(bucket.boundingBox.minExtents, trajectoryBoundingBox.minExtents);
+        bucket.boundingBox.maxExtents = glm::max(bucket.boundingBox.maxExtents, trajectoryBoundingBox.maxExtents);
+        bucket.expirationTime = std::max(bucket.expirationTime, m_time + lifeLength);
+        ++bucket.count;
+    }
+
+    m_currentBufferIndex = (m_currentBufferIndex + 1) % static_cast<uint32_t>(m_emittedParticlesBuffers.size());
+    m_simulationState.emittedParticles = m_emittedParticlesBuffers[m_currentBufferIndex];
+    m_simulationState.emittedCount = emittedCount;
+    if (emittedCount > 0) {
+        m_simulationState.emittedParticles->Write(m_emittedParticlesData.data(), sizeof(prev::render::particle::GpuParticle) * emittedCount);
+    }
+}
+
+void GpuParticleSystemComponent::UpdateBoundingBox()
+{
+    while (m_emissionBuckets.size() > 1 && m_emissionBuckets.front().expirationTime < m_time) {
+        m_emissionBuckets.pop_front();
+    }
+
+    prev::util::intersection::AABB boundingBox{};
+    uint32_t maxAliveCount{ 0 };
+    for (const auto& bucket : m_emissionBuckets) {
+        boundingBox.minExtents = glm::min(boundingBox.minExtents, bucket.boundingBox.minExtents);
+        boundingBox.maxExtents = glm::max(boundingBox.maxExtents, bucket.boundingBox.maxExtents);
+        maxAliveCount += bucket.count;
+    }
+    m_boundingBox = boundingBox;
+    m_maxAliveCount = std::min(maxAliveCount, m_simulationState.capacity);
+}
+} // namespace prev_test::component::particle
\ No newline at end of file
@@ -0,0 +1,105 @@
+#ifndef __GPU_PARTICLE_SYSTEM_COMPONENT_H__
+#define __GPU_PARTICLE_SYSTEM_COMPONENT_H__
+
+#include "IParticleSystemComponent.h"
+
+#include <prev/scene/particle/ParticlePool.h>
+#include <prev/util/Utils.h>
+#include <prev/util/intersection/AABB.h>
+
+#include <deque>
+#include <vector>
+
+namespace prev_test::component::particle {
+// Particle system simulated by ParticlesSimulationRenderer in compute. Particles are emitted on CPU by the same
+// factories as the CPU path and only the new ones are uploaded every frame.
+class GpuParticleSystemComponent final : public IParticleSystemComponent {
+public:
+    GpuParticleSystemComponent(const std::shared_ptr<prev_test::render::IModel>& model, const std::shared_ptr<prev::render::buffer::Buffer>& instanceBuffer, const prev::render::particle::ParticleSimulationState& simulationState, const std::vector<std::shared_ptr<prev::render::buffer::Buffer>>& emittedParticlesBuffers, const std::shared_ptr<prev_test::render::IMaterial>& material, const std::shared_ptr<IParticleFactory>& particleFactory, const float particlesPerSecond, const uint32_t maxEmittedPerFrame);
+
+    ~GpuParticleSystemComponent() = default;
+
+public:
+    // Has to be followed by exactly one simulation of the system.
+    void Update(const float deltaTime, const glm::vec3& centerPosition) override;
+
+    void SetParticlesPerSecond(const float pps) override;
+
+    float GetParticlesPerSecond() const override;
+
+    std::shared_ptr<IParticleFactory> GetParticleFactory() const override;
+
+    std::shared_ptr<prev_test::render::IModel> GetModel() const override;
+
+    std::shared_ptr<prev_test::render::IMaterial> GetMaterial() const override;
+
+    bool IsReady() const override;
+
+    uint32_t GetParticleCount() const override;
+
+    std::shared_ptr<prev::render::buffer::Buffer> GetVertexBuffer() const override;
+
+    const prev::scene::particle::ParticleInstance* GetInstances() const override;
+
+    const prev::render::particle::ParticleSimulationState* GetSimulationState() const override;
+
+    // Conservative - built from the whole trajectories of particles that may still be alive.
+    const prev::util::intersection::AABB& GetBoundingBox() const override;
+
+private:
+    // particles emitted within one time slice
+    struct EmissionBucket {
+        prev::util::intersection::AABB boundingBox{};
+
+        float startTime{};
+
+        float expirationTime{};
+
+        uint32_t count{};
+    };
+
+private:
+    void AddNewParticles(const float deltaTime, const glm::vec3& centerPosition);
+
+    void UploadEmittedParticles();
+
+    void UpdateBoundingBox();
+
+private:
+    static const inline float EMISSION_BUCKET_DURATION{ 0.25f };
+
+private:
+    std::shared_ptr<prev_test::render::IModel> m_model;
+
+    std::shared_ptr<prev::render::buffer::Buffer> m_instanceBuffer;
+
+    prev::render::particle::ParticleSimulationState m_simulationState;
+
+    std::vector<std::shared_ptr<prev::render::buffer::Buffer>> m_emittedParticlesBuffers;
+
+    std::shared_ptr<prev_test::render::IMaterial> m_material;
+
+    std::shared_ptr<IParticleFactory> m_particleFactory;
+
+    float m_particlesPerSecond;
+
+    // staging of the particles emitted this frame
+    prev::scene::particle::ParticlePool m_emittedParticles;
+
+    std::vector<prev::render::particle::GpuParticle> m_emittedParticlesData;
+
+    uint32_t m_currentBufferIndex{};
+
+    std::deque<EmissionBucket> m_emissionBuckets;
+
+    float m_time{};
+
+    uint32_t m_maxAliveCount{};
+
+    prev::util::intersection::AABB m_boundingBox{};
+
+    prev::util::RandomNumberGenerator m_rng{};
+};
+} // namespace prev_test::component::particle
+
+#endif // !__GPU_PARTICLE_SYSTEM_COMPONENT_H__
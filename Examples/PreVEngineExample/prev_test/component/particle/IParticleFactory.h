@@ -1,12 +1,14 @@
 #ifndef __IPARTICLE_FACTORY_H__
 #define __IPARTICLE_FACTORY_H__
 
-#include "Particle.h"
+#include <prev/common/Common.h>
+#include <prev/scene/particle/ParticlePool.h>
 
 namespace prev_test::component::particle {
 class IParticleFactory {
 public:
-    virtual std::unique_ptr<Particle> EmitParticle(const glm::vec3& centerPosition) const = 0;
+    // Returns false when the pool is full.
+    virtual bool EmitParticle(const glm::vec3& centerPosition, prev::scene::particle::ParticlePool& pool) const = 0;
 
 public:
     virtual ~IParticleFactory() = default;
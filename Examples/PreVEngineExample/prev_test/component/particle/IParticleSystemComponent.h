@@ -3,14 +3,15 @@
 
 #include "IParticleFactory.h"
 
+#include "../../render/IMaterial.h"
 #include "../../render/IModel.h"
 
 #include <prev/render/buffer/Buffer.h>
+#include <prev/render/particle/ParticleSimulation.h>
 #include <prev/scene/component/IComponent.h>
+#include <prev/scene/particle/ParticlePool.h>
 #include <prev/util/intersection/AABB.h>
 
-#include <list>
-
 namespace prev_test::component::particle {
 class IParticleSystemComponent : public prev::scene::component::IComponent {
 public:
@@ -28,10 +29,18 @@ public:
 
     virtual bool IsReady() const = 0;
 
-    virtual std::list<std::shared_ptr<Particle>> GetParticles() const = 0;
+    // Particles alive after the last Update, GPU simulated systems report an upper bound.
+    virtual uint32_t GetParticleCount() const = 0;
 
+    // Instances written by the GPU simulation, null for systems simulated on CPU.
     virtual std::shared_ptr<prev::render::buffer::Buffer> GetVertexBuffer() const = 0;
 
+    // The GetParticleCount() instances of a CPU simulated system, null for GPU simulated systems.
+    virtual const prev::scene::particle::ParticleInstance* GetInstances() const = 0;
+
+    // Null for systems simulated on CPU, otherwise the instance count lives in the indirect draw buffer.
+    virtual const prev::render::particle::ParticleSimulationState* GetSimulationState() const = 0;
+
     virtual const prev::util::intersection::AABB& GetBoundingBox() const = 0;
 
 public:
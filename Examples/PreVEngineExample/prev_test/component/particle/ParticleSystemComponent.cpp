@@ -1,37 +1,26 @@
 #include "ParticleSystemComponent.h"
 
-#include "../../render/VertexDataBuffer.h"
-
 namespace prev_test::component::particle {
-ParticleSystemComponent::ParticleSystemComponent(const std::shared_ptr<prev_test::render::IModel>& model, const std::vector<std::shared_ptr<prev::render::buffer::Buffer>>& vertexBuffers, const std::shared_ptr<prev_test::render::IMaterial>& material, const std::shared_ptr<IParticleFactory>& particleFactory, const float particlesPerSecond)
+ParticleSystemComponent::ParticleSystemComponent(const std::shared_ptr<prev_test::render::IModel>& model, const std::shared_ptr<prev_test::render::IMaterial>& material, const std::shared_ptr<IParticleFactory>& particleFactory, const float particlesPerSecond, const uint32_t maxParticleCount)
     : m_model(model)
-    , m_vertexBuffers(vertexBuffers)
     , m_material(material)
     , m_particleFactory(particleFactory)
     , m_particlesPerSecond(particlesPerSecond)
-    , m_currentBufferIndex(0)
+    , m_particles(maxParticleCount)
+    , m_instances(maxParticleCount)
 {
 }
 
 void ParticleSystemComponent::Update(const float deltaTime, const glm::vec3& centerPosition)
 {
     AddNewParticles(deltaTime, centerPosition);
-    UpdateParticles(deltaTime);
-
-    m_currentBufferIndex = (m_currentBufferIndex + 1) % static_cast<uint32_t>(m_vertexBuffers.size());
-
-    prev_test::render::VertexDataBuffer instanceDataBuffer(GetParticleDataStride() * m_particles.size());
-    for (const auto& particle : m_particles) {
-        instanceDataBuffer.Add(particle->GetPosition());
-        instanceDataBuffer.Add(glm::vec2(particle->GetScale())); // TODO do we want non-square particles ??
-        instanceDataBuffer.Add(particle->GetRotation());
-        instanceDataBuffer.Add(particle->GetCurrentStageTextureOffset());
-        instanceDataBuffer.Add(particle->GetNextStageTextureOffset());
-        instanceDataBuffer.Add(particle->GetStagesBlendFactor());
+    m_particles.Update(deltaTime);
+
+    if (m_particles.GetCount() == 0) {
+        return;
     }
 
-    auto& currentVetexBuffer{ m_vertexBuffers[m_currentBufferIndex] };
-    currentVetexBuffer->Write(instanceDataBuffer.GetData(), GetParticleDataStride() * m_particles.size());
+    m_particles.WriteInstances(m_material->GetAtlasNumberOfRows(), m_instances.data());
 }
 
 void ParticleSystemComponent::SetParticlesPerSecond(const float pps)
@@ -64,14 +53,24 @@ bool ParticleSystemComponent::IsReady() const
     return (!m_model || m_model->IsReady()) && (!m_material || m_material->IsReady());
 }
 
-std::list<std::shared_ptr<Particle>> ParticleSystemComponent::GetParticles() const
+uint32_t ParticleSystemComponent::GetParticleCount() const
 {
-    return m_particles;
+    return m_particles.GetCount();
 }
 
 std::shared_ptr<prev::render::buffer::Buffer> ParticleSystemComponent::GetVertexBuffer() const
 {
-    return m_vertexBuffers[m_currentBufferIndex];
+    return nullptr;
+}
+
+const prev::scene::particle::ParticleInstance* ParticleSystemComponent::GetInstances() const
+{
+    return m_instances.data();
+}
+
+const prev::render::particle::ParticleSimulationState* ParticleSystemComponent::GetSimulationState() const
+{
+    return nullptr;
 }
 
 void ParticleSystemComponent::AddNewParticles(const float deltaTime, const glm::vec3& centerPosition)
@@ -79,41 +78,26 @@ void ParticleSystemComponent::AddNewParticles(const float deltaTime, const glm::
     const float particlesToCreate{ m_particlesPerSecond * deltaTime };
     const int particlesToCreateCount{ static_cast<int>(std::floor(particlesToCreate)) };
     for (int i = 0; i < particlesToCreateCount; ++i) {
-        m_particles.emplace_back(m_particleFactory->EmitParticle(centerPosition));
+        if (!m_particleFactory->EmitParticle(centerPosition, m_particles)) {
+            return;
+        }
     }
 
     std::uniform_real_distribution<float> dist(0.0, 1.0);
     const float partialCount{ fmodf(particlesToCreate, 1.0f) };
     if (dist(m_rng.GetRandomEngine()) < partialCount) {
-        m_particles.emplace_back(m_particleFactory->EmitParticle(centerPosition));
-    }
-}
-
-void ParticleSystemComponent::UpdateParticles(const float deltaTime)
-{
-    prev::util::intersection::AABB boundingBox{};
-    for (auto pi = m_particles.begin(); pi != m_particles.end();) {
-        auto& particle{ *pi };
-        particle->Update(deltaTime);
-        if (!particle->IsAlive()) {
-            pi = m_particles.erase(pi);
-        } else {
-            boundingBox.minExtents = glm::min(boundingBox.minExtents, particle->GetPosition());
-            boundingBox.maxExtents = glm::max(boundingBox.maxExtents, particle->GetPosition());
-            ++pi;
-        }
+        m_particleFactory->EmitParticle(centerPosition, m_particles);
     }
-    m_boundingBox = boundingBox;
 }
 
 const prev::util::intersection::AABB& ParticleSystemComponent::GetBoundingBox() const
 {
-    return m_boundingBox;
+    return m_particles.GetBoundingBox();
 }
 
 size_t ParticleSystemComponent::GetParticleDataStride()
 {
     // position + scale + rotation + currentTextureOffset + nextTextureOffset + blendFactor
-    return sizeof(glm::vec3) + sizeof(glm::vec2) + sizeof(float) + sizeof(glm::vec2) + sizeof(glm::vec2) + sizeof(float);
+    return sizeof(prev::scene::particle::ParticleInstance);
 }
 } // namespace prev_test::component::particle
\ No newline at end of file
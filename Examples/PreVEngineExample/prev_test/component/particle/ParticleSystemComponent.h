@@ -3,6 +3,7 @@
 
 #include "IParticleSystemComponent.h"
 
+#include <prev/scene/particle/ParticlePool.h>
 #include <prev/util/Utils.h>
 #include <prev/util/intersection/AABB.h>
 
@@ -11,7 +12,7 @@
 namespace prev_test::component::particle {
 class ParticleSystemComponent : public IParticleSystemComponent {
 public:
-    ParticleSystemComponent(const std::shared_ptr<prev_test::render::IModel>& model, const std::vector<std::shared_ptr<prev::render::buffer::Buffer>>& vertexBuffers, const std::shared_ptr<prev_test::render::IMaterial>& material, const std::shared_ptr<IParticleFactory>& particleFactory, const float particlesPerSecond);
+    ParticleSystemComponent(const std::shared_ptr<prev_test::render::IModel>& model, const std::shared_ptr<prev_test::render::IMaterial>& material, const std::shared_ptr<IParticleFactory>& particleFactory, const float particlesPerSecond, const uint32_t maxParticleCount);
 
     virtual ~ParticleSystemComponent() = default;
 
@@ -30,10 +31,14 @@ public:
 
     bool IsReady() const override;
 
-    std::list<std::shared_ptr<Particle>> GetParticles() const override;
+    uint32_t GetParticleCount() const override;
 
     std::shared_ptr<prev::render::buffer::Buffer> GetVertexBuffer() const override;
 
+    const prev::scene::particle::ParticleInstance* GetInstances() const override;
+
+    const prev::render::particle::ParticleSimulationState* GetSimulationState() const override;
+
     const prev::util::intersection::AABB& GetBoundingBox() const override;
 
 public:
@@ -42,24 +47,19 @@ public:
 private:
     void AddNewParticles(const float deltaTime, const glm::vec3& centerPosition);
 
-    void UpdateParticles(const float deltaTime);
-
 private:
     std::shared_ptr<prev_test::render::IModel> m_model;
 
-    std::vector<std::shared_ptr<prev::render::buffer::Buffer>> m_vertexBuffers;
-
     std::shared_ptr<prev_test::render::IMaterial> m_material;
 
     std::shared_ptr<IParticleFactory> m_particleFactory;
 
     float m_particlesPerSecond;
 
-    std::list<std::shared_ptr<Particle>> m_particles;
-
-    uint32_t m_currentBufferIndex{};
+    prev::scene::particle::ParticlePool m_particles;
 
-    prev::util::intersection::AABB m_boundingBox{};
+    // sorted with the other visible systems and uploaded by the renderer
+    std::vector<prev::scene::particle::ParticleInstance> m_instances;
 
     prev::util::RandomNumberGenerator m_rng{};
 };
@@ -1,4 +1,5 @@
 #include "ParticleSystemComponentFactory.h"
+#include "GpuParticleSystemComponent.h"
 #include "ParticleSystemComponent.h"
 #include "RandomDirectionParticleFactory.h"
 #include "RandomInConeParticleFactory.h"
@@ -10,25 +11,27 @@
 
 #include <prev/render/buffer/BufferBuilder.h>
 
+#include <map>
+
 namespace prev_test::component::particle {
 
 static const inline uint32_t BufferCount{ 2 };
 
 static const inline uint32_t MaxParticleCount{ 100000 };
 
-ParticleSystemComponentFactory::ParticleSystemComponentFactory(prev::core::device::Device& device, bool colorManaged, bool async)
+static const inline uint32_t MaxEmittedParticleCountPerFrame{ 1024 };
+
+ParticleSystemComponentFactory::ParticleSystemComponentFactory(prev::core::device::Device& device, bool colorManaged, bool async, bool gpuSimulated)
     : m_device{ device }
     , m_colorManaged{ colorManaged }
     , m_async{ async }
+    , m_gpuSimulated{ gpuSimulated }
 {
 }
 
 std::unique_ptr<IParticleSystemComponent> ParticleSystemComponentFactory::CreateRandom() const
 {
-    prev_test::render::material::MaterialFactory materialFactory{ m_device, m_colorManaged };
-
-    std::shared_ptr<prev_test::render::IMaterial> material{ materialFactory.Create({ glm::vec4{ 1.0f }, 0.0f, 0.0f }, prev_test::common::AssetManager::Instance().GetAssetPath("Textures/fire-ember-particles-png-4-transparent.png"), m_async) };
-    material->SetAtlasNumberOfRows(8);
+    const auto material{ GetOrCreateMaterial(prev_test::common::AssetManager::Instance().GetAssetPath("Textures/fire-ember-particles-png-4-transparent.png"), 8) };
 
     prev_test::render::mesh::MeshFactory meshFactory{};
     auto mesh{ meshFactory.CreateQuad() };
@@ -36,29 +39,18 @@ std::unique_ptr<IParticleSystemComponent> ParticleSystemComponentFactory::Create
     prev_test::render::model::ModelFactory modelFactory{ m_device };
     auto model{ modelFactory.Create(std::move(mesh), m_async) };
 
-    std::vector<std::shared_ptr<prev::render::buffer::Buffer>> vertexBuffers(BufferCount);
-    for (uint32_t i = 0; i < BufferCount; ++i) {
-        vertexBuffers[i] = prev::render::buffer::BufferBuilder{ m_device, m_device.GetQueue(prev::core::device::QueueType::GRAPHICS) }
-                               .SetSize(ParticleSystemComponent::GetParticleDataStride() * MaxParticleCount)
-                               .SetUsageFlags(GFX_BUFFER_USAGE_VERTEX | GFX_BUFFER_USAGE_MAP_WRITE)
-                               .SetMemoryProperties(GFX_MEMORY_PROPERTY_HOST_VISIBLE | GFX_MEMORY_PROPERTY_HOST_COHERENT)
-                               .Build();
-    }
-
-    auto particleFactory{ std::make_shared<RandomDirectionParticleFactory>(material, 0.1f, 5.0f, 4.0f, 10.0f) };
+    auto particleFactory{ std::make_shared<RandomDirectionParticleFactory>(0.1f, 5.0f, 4.0f, 10.0f) };
     particleFactory->SetRandomRotationEnabled(true);
     particleFactory->SetLifeLengthError(0.1f);
     particleFactory->SetSpeedError(0.25f);
     particleFactory->SetScaleError(0.1f);
 
-    return std::make_unique<ParticleSystemComponent>(std::move(model), vertexBuffers, material, particleFactory, 10.0f);
+    return CreateParticleSystem(std::move(model), material, particleFactory, 10.0f);
 }
 
 std::unique_ptr<IParticleSystemComponent> ParticleSystemComponentFactory::CreateRandomInCone(const glm::vec3& coneDirection, const float angle) const
 {
-    prev_test::render::material::MaterialFactory materialFactory{ m_device, m_colorManaged };
-    std::shared_ptr<prev_test::render::IMaterial> material{ materialFactory.Create({ glm::vec4{ 1.0f }, 0.0f, 0.0f }, prev_test::common::AssetManager::Instance().GetAssetPath("Textures/fire-texture-atlas.png"), m_async) };
-    material->SetAtlasNumberOfRows(4);
+    const auto material{ GetOrCreateMaterial(prev_test::common::AssetManager::Instance().GetAssetPath("Textures/fire-texture-atlas.png"), 4) };
 
     prev_test::render::mesh::MeshFactory meshFactory{};
     auto mesh{ meshFactory.CreateQuad() };
@@ -66,16 +58,7 @@ std::unique_ptr<IParticleSystemComponent> ParticleSystemComponentFactory::Create
     prev_test::render::model::ModelFactory modelFactory{ m_device };
     auto model{ modelFactory.Create(std::move(mesh), m_async) };
 
-    std::vector<std::shared_ptr<prev::render::buffer::Buffer>> vertexBuffers(BufferCount);
-    for (uint32_t i = 0; i < BufferCount; ++i) {
-        vertexBuffers[i] = prev::render::buffer::BufferBuilder{ m_device, m_device.GetQueue(prev::core::device::QueueType::GRAPHICS) }
-                               .SetSize(ParticleSystemComponent::GetParticleDataStride() * MaxParticleCount)
-                               .SetUsageFlags(GFX_BUFFER_USAGE_VERTEX | GFX_BUFFER_USAGE_MAP_WRITE)
-                               .SetMemoryProperties(GFX_MEMORY_PROPERTY_HOST_VISIBLE | GFX_MEMORY_PROPERTY_HOST_COHERENT)
-                               .Build();
-    }
-
-    auto particleFactory{ std::make_shared<RandomInConeParticleFactory>(material, -0.1f, 4.0f, 4.0f, 7.0f) };
+    auto particleFactory{ std::make_shared<RandomInConeParticleFactory>(-0.1f, 4.0f, 4.0f, 7.0f) };
     particleFactory->SetConeDirection(coneDirection);
     particleFactory->SetConeDirectionDeviation(angle);
     // particleFactory->SetRandomRotationEnabled(true);
@@ -84,6 +67,77 @@ std::unique_ptr<IParticleSystemComponent> ParticleSystemComponentFactory::Create
     particleFactory->SetScaleError(2.0f);
     particleFactory->SetRadius(10.0f);
 
-    return std::make_unique<ParticleSystemComponent>(std::move(model), vertexBuffers, material, particleFactory, 100.0f);
+    return CreateParticleSystem(std::move(model), material, particleFactory, 100.0f);
+}
+
+std::shared_ptr<prev_test::render::IMaterial> ParticleSystemComponentFactory::GetOrCreateMaterial(const std::string& texturePath, const uint32_t atlasNumberOfRows) const
+{
+    // systems of one kind share the material, the renderer draws their depth sorted particles at once
+    static std::map<std::string, std::weak_ptr<prev_test::render::IMaterial>> s_materials;
+
+    auto& sharedMaterial{ s_materials[texturePath + (m_colorManaged ? ":linear" : ":gamma")] };
+    auto material{ sharedMaterial.lock() };
+    if (!material) {
+        prev_test::render::material::MaterialFactory materialFactory{ m_device, m_colorManaged };
+        material = materialFactory.Create({ glm::vec4{ 1.0f }, 0.0f, 0.0f }, texturePath, m_async);
+        material->SetAtlasNumberOfRows(atlasNumberOfRows);
+        sharedMaterial = material;
+    }
+    return material;
+}
+
+std::unique_ptr<IParticleSystemComponent> ParticleSystemComponentFactory::CreateParticleSystem(std::shared_ptr<prev_test::render::IModel>&& model, const std::shared_ptr<prev_test::render::IMaterial>& material, const std::shared_ptr<IParticleFactory>& particleFactory, const float particlesPerSecond) const
+{
+    // the renderer uploads the sorted instances of all CPU simulated systems itself
+    if (!m_gpuSimulated) {
+        return std::make_unique<ParticleSystemComponent>(std::move(model), material, particleFactory, particlesPerSecond, MaxParticleCount);
+    }
+
+    auto& queue{ m_device.GetQueue(prev::core::device::QueueType::GRAPHICS) };
+
+    // instances are written by the simulation and consumed directly as the instance vertex buffer
+    auto instanceBuffer{ prev::render::buffer::BufferBuilder{ m_device, queue }
+                             .SetSize(ParticleSystemComponent::GetParticleDataStride() * MaxParticleCount)
+                             .SetUsageFlags(GFX_BUFFER_USAGE_VERTEX | GFX_BUFFER_USAGE_STORAGE)
+                             .SetMemoryProperties(GFX_MEMORY_PROPERTY_DEVICE_LOCAL)
+                             .Build() };
+
+    prev::render::particle::ParticleSimulationState simulationState{};
+    for (auto& particlesBuffer : simulationState.particles) {
+        particlesBuffer = prev::render::buffer::BufferBuilder{ m_device, queue }
+                              .SetSize(sizeof(prev::render::particle::GpuParticle) * MaxParticleCount)
+                              .SetUsageFlags(GFX_BUFFER_USAGE_STORAGE)
+                              .SetMemoryProperties(GFX_MEMORY_PROPERTY_DEVICE_LOCAL)
+                              .Build();
+    }
+
+    const std::array<uint32_t, 2> counters{ 0, 0 };
+    simulationState.counters = prev::render::buffer::BufferBuilder{ m_device, queue }
+                                   .SetSize(sizeof(counters))
+                                   .SetUsageFlags(GFX_BUFFER_USAGE_STORAGE | GFX_BUFFER_USAGE_COPY_DST)
+                                   .SetMemoryProperties(GFX_MEMORY_PROPERTY_DEVICE_LOCAL)
+                                   .SetData(counters.data(), sizeof(counters))
+                                   .Build();
+
+    // indexCount, instanceCount, firstIndex, baseVertex, firstInstance - instanceCount is written by the simulation
+    const std::array<uint32_t, 5> drawArgs{ model->GetMesh()->GetIndicesCount(), 0, 0, 0, 0 };
+    simulationState.indirectDraw = prev::render::buffer::BufferBuilder{ m_device, queue }
+                                       .SetSize(sizeof(drawArgs))
+                                       .SetUsageFlags(GFX_BUFFER_USAGE_STORAGE | GFX_BUFFER_USAGE_INDIRECT | GFX_BUFFER_USAGE_COPY_DST)
+                                       .SetMemoryProperties(GFX_MEMORY_PROPERTY_DEVICE_LOCAL)
+                                       .SetData(drawArgs.data(), sizeof(drawArgs))
+                                       .Build();
+    simulationState.capacity = MaxParticleCount;
+
+    std::vector<std::shared_ptr<prev::render::buffer::Buffer>> emittedParticlesBuffers(BufferCount);
+    for (uint32_t i = 0; i < BufferCount; ++i) {
+        emittedParticlesBuffers[i] = prev::render::buffer::BufferBuilder{ m_device, queue }
+                                         .SetSize(sizeof(prev::render::particle::GpuParticle) * MaxEmittedParticleCountPerFrame)
+                                         .SetUsageFlags(GFX_BUFFER_USAGE_STORAGE | GFX_BUFFER_USAGE_MAP_WRITE)
+                                         .SetMemoryProperties(GFX_MEMORY_PROPERTY_HOST_VISIBLE | GFX_MEMORY_PROPERTY_HOST_COHERENT)
+                                         .Build();
+    }
+
+    return std::make_unique<GpuParticleSystemComponent>(std::move(model), instanceBuffer, simulationState, emittedParticlesBuffers, material, particleFactory, particlesPerSecond, MaxEmittedParticleCountPerFrame);
 }
 } // namespace prev_test::component::particle
\ No newline at end of file
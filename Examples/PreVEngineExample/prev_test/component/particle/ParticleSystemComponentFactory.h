@@ -8,7 +8,7 @@
 namespace prev_test::component::particle {
 class ParticleSystemComponentFactory final {
 public:
-    ParticleSystemComponentFactory(prev::core::device::Device& device, bool colorManaged, bool async = true);
+    ParticleSystemComponentFactory(prev::core::device::Device& device, bool colorManaged, bool async = true, bool gpuSimulated = false);
 
     ~ParticleSystemComponentFactory() = default;
 
@@ -17,12 +17,19 @@ public:
 
     std::unique_ptr<IParticleSystemComponent> CreateRandomInCone(const glm::vec3& coneDirection, const float angle) const;
 
+private:
+    std::shared_ptr<prev_test::render::IMaterial> GetOrCreateMaterial(const std::string& texturePath, const uint32_t atlasNumberOfRows) const;
+
+    std::unique_ptr<IParticleSystemComponent> CreateParticleSystem(std::shared_ptr<prev_test::render::IModel>&& model, const std::shared_ptr<prev_test::render::IMaterial>& material, const std::shared_ptr<IParticleFactory>& particleFactory, const float particlesPerSecond) const;
+
 private:
     prev::core::device::Device& m_device;
 
     const bool m_colorManaged;
 
     bool m_async{ true };
+
+    bool m_gpuSimulated{ false };
 };
 } // namespace prev_test::component::particle
 
@@ -1,8 +1,8 @@
 #include "RandomDirectionParticleFactory.h"
 
 namespace prev_test::component::particle {
-RandomDirectionParticleFactory::RandomDirectionParticleFactory(const std::shared_ptr<prev_test::render::IMaterial>& mt, const float gravityComp, const float avgSpeed, const float avgLifeLength, const float avgScale)
-    : AbstractParticleFactory(mt, gravityComp, avgSpeed, avgLifeLength, avgScale)
+RandomDirectionParticleFactory::RandomDirectionParticleFactory(const float gravityComp, const float avgSpeed, const float avgLifeLength, const float avgScale)
+    : AbstractParticleFactory(gravityComp, avgSpeed, avgLifeLength, avgScale)
 {
 }
 
@@ -6,7 +6,7 @@
 namespace prev_test::component::particle {
 class RandomDirectionParticleFactory final : public AbstractParticleFactory {
 public:
-    RandomDirectionParticleFactory(const std::shared_ptr<prev_test::render::IMaterial>& mt, const float gravityComp, const float avgSpeed, const float avgLifeLength, const float avgScale);
+    RandomDirectionParticleFactory(const float gravityComp, const float avgSpeed, const float avgLifeLength, const float avgScale);
 
     ~RandomDirectionParticleFactory() = default;
 
@@ -1,8 +1,8 @@
 #include "RandomInConeParticleFactory.h"
 
 namespace prev_test::component::particle {
-RandomInConeParticleFactory::RandomInConeParticleFactory(const std::shared_ptr<prev_test::render::IMaterial>& mt, const float gravityComp, const float avgSpeed, const float avgLifeLength, const float avgScale)
-    : AbstractParticleFactory(mt, gravityComp, avgSpeed, avgLifeLength, avgScale)
+RandomInConeParticleFactory::RandomInConeParticleFactory(const float gravityComp, const float avgSpeed, const float avgLifeLength, const float avgScale)
+    : AbstractParticleFactory(gravityComp, avgSpeed, avgLifeLength, avgScale)
 {
 }
 
@@ -8,7 +8,7 @@
 namespace prev_test::component::particle {
 class RandomInConeParticleFactory final : public AbstractParticleFactory {
 public:
-    RandomInConeParticleFactory(const std::shared_ptr<prev_test::render::IMaterial>& mt, const float gravityComp, const float avgSpeed, const float avgLifeLength, const float avgScale);
+    RandomInConeParticleFactory(const float gravityComp, const float avgSpeed, const float avgLifeLength, const float avgScale);
 
     ~RandomInConeParticleFactory() = default;
 
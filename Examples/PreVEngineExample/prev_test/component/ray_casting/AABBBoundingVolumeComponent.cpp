@@ -26,12 +26,12 @@ AABBBoundingVolumeComponent::AABBBoundingVolumeComponent(const prev::core::devic
 #endif
 }
 
-bool AABBBoundingVolumeComponent::IsInFrustum(const prev::util::intersection::Frustum& frustum)
+bool AABBBoundingVolumeComponent::IsInFrustum(const prev::util::intersection::Frustum& frustum) const
 {
     return prev::util::intersection::tester::Intersects(frustum, m_working);
 }
 
-bool AABBBoundingVolumeComponent::Intersects(const prev::util::intersection::Ray& ray, prev::util::intersection::RayCastResult& result)
+bool AABBBoundingVolumeComponent::Intersects(const prev::util::intersection::Ray& ray, prev::util::intersection::RayCastResult& result) const
 {
     return prev::util::intersection::tester::Intersects(ray, m_working, result);
 }
@@ -54,6 +54,10 @@ void AABBBoundingVolumeComponent::Update(const glm::mat4& worldTransform)
     }
 
     m_working = prev::util::intersection::AABB(glm::vec3(translation + minBound), glm::vec3(translation + maxBound));
+    if (m_updateCallback) {
+        m_updateCallback();
+    }
+
 #ifdef RENDER_BOUNDING_VOLUMES
     m_model = BoundingVolumeModelFactory{ m_device }.CreateAABBModel(m_working, m_model);
 #endif
@@ -64,6 +68,16 @@ BoundingVolumeType AABBBoundingVolumeComponent::GetType() const
     return BoundingVolumeType::AABB;
 }
 
+prev::util::intersection::AABB AABBBoundingVolumeComponent::GetAABB() const
+{
+    return m_working;
+}
+
+void AABBBoundingVolumeComponent::SetUpdateCallback(const std::function<void()>& callback)
+{
+    m_updateCallback = callback;
+}
+
 #ifdef RENDER_BOUNDING_VOLUMES
 std::shared_ptr<prev_test::render::IModel> AABBBoundingVolumeComponent::GetModel() const
 {
@@ -18,14 +18,18 @@ public:
     ~AABBBoundingVolumeComponent() = default;
 
 public:
-    bool IsInFrustum(const prev::util::intersection::Frustum& frustum) override;
+    bool IsInFrustum(const prev::util::intersection::Frustum& frustum) const override;
 
-    bool Intersects(const prev::util::intersection::Ray& ray, prev::util::intersection::RayCastResult& result) override;
+    bool Intersects(const prev::util::intersection::Ray& ray, prev::util::intersection::RayCastResult& result) const override;
 
     void Update(const glm::mat4& worldTransform) override;
 
     BoundingVolumeType GetType() const override;
 
+    prev::util::intersection::AABB GetAABB() const override;
+
+    void SetUpdateCallback(const std::function<void()>& callback) override;
+
 #ifdef RENDER_BOUNDING_VOLUMES
     std::shared_ptr<prev_test::render::IModel> GetModel() const override;
 #endif
@@ -51,6 +55,8 @@ private:
     prev::util::intersection::AABB m_working;
 
     std::vector<glm::vec3> m_vorkingAABBPoints;
+
+    std::function<void()> m_updateCallback;
 };
 } // namespace prev_test::component::ray_casting
 
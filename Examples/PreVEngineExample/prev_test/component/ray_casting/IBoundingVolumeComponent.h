@@ -4,10 +4,13 @@
 #include "../../render/IModel.h"
 
 #include <prev/scene/component/IComponent.h>
+#include <prev/util/intersection/AABB.h>
 #include <prev/util/intersection/Frustum.h>
 #include <prev/util/intersection/Ray.h>
 #include <prev/util/intersection/RayCastResult.h>
 
+#include <functional>
+
 namespace prev_test::component::ray_casting {
 enum class BoundingVolumeType {
     SPHERE = 0,
@@ -17,14 +20,20 @@ enum class BoundingVolumeType {
 
 class IBoundingVolumeComponent : public prev::scene::component::IComponent {
 public:
-    virtual bool IsInFrustum(const prev::util::intersection::Frustum& frustum) = 0;
+    virtual bool IsInFrustum(const prev::util::intersection::Frustum& frustum) const = 0;
 
-    virtual bool Intersects(const prev::util::intersection::Ray& ray, prev::util::intersection::RayCastResult& result) = 0;
+    virtual bool Intersects(const prev::util::intersection::Ray& ray, prev::util::intersection::RayCastResult& result) const = 0;
 
     virtual void Update(const glm::mat4& worldTransform) = 0;
 
     virtual BoundingVolumeType GetType() const = 0;
 
+    // World space box enclosing the current volume.
+    virtual prev::util::intersection::AABB GetAABB() const = 0;
+
+    // Called at the end of every Update - the scene query refits only the volumes it was told about.
+    virtual void SetUpdateCallback(const std::function<void()>& callback) = 0;
+
 #ifdef RENDER_BOUNDING_VOLUMES
     virtual std::shared_ptr<prev_test::render::IModel> GetModel() const = 0;
 #endif
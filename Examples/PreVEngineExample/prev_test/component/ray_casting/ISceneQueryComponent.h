@@ -0,0 +1,78 @@
+#ifndef __ISCENE_QUERY_COMPONENT_H__
+#define __ISCENE_QUERY_COMPONENT_H__
+
+#include <prev/scene/component/IComponent.h>
+#include <prev/scene/graph/ISceneNode.h>
+#include <prev/util/intersection/AABB.h>
+#include <prev/util/intersection/BVH.h>
+#include <prev/util/intersection/Frustum.h>
+#include <prev/util/intersection/FrustumCuller.h>
+#include <prev/util/intersection/Ray.h>
+#include <prev/util/intersection/RayCastResult.h>
+#include <prev/util/intersection/Sphere.h>
+
+#include <functional>
+#include <memory>
+#include <optional>
+#include <vector>
+
+namespace prev_test::component::ray_casting {
+struct SceneRayCastResult {
+    prev::util::intersection::RayCastResult result{};
+
+    std::shared_ptr<prev::scene::graph::ISceneNode> node{};
+};
+
+// Culling output of one pass - keep it across frames, static volumes test the plane that rejected them last time first.
+struct SceneCullingResult {
+    // indexed by the flat culler slot
+    prev::util::intersection::VisibilityBitset dynamicVisibility{};
+
+    // indexed by the static tree proxy id
+    prev::util::intersection::VisibilityBitset staticVisibility{};
+
+    // one per view
+    std::vector<prev::util::intersection::BVH::PlaneCache> planeCaches{};
+
+    prev::util::intersection::BVH::CullingStats staticStats{};
+};
+
+// Acceleration structure over all nodes with a bounding volume component.
+class ISceneQueryComponent : public prev::scene::component::IComponent {
+public:
+    using NodeFilter = std::function<bool(const std::shared_ptr<prev::scene::graph::ISceneNode>& node)>;
+
+public:
+    // Starts tracking the bounding volume component of the node.
+    virtual void Add(const std::shared_ptr<prev::scene::graph::ISceneNode>& node) = 0;
+
+    virtual void Remove(const uint64_t nodeId) = 0;
+
+    // Refits the volumes updated since the last call - call once per frame after all of them were updated.
+    virtual void Update() = 0;
+
+    virtual std::optional<SceneRayCastResult> RayCastClosest(const prev::util::intersection::Ray& ray, const NodeFilter& filter = {}) const = 0;
+
+    virtual std::optional<SceneRayCastResult> RayCastAny(const prev::util::intersection::Ray& ray, const NodeFilter& filter = {}) const = 0;
+
+    virtual std::vector<std::shared_ptr<prev::scene::graph::ISceneNode>> FindOverlapping(const prev::util::intersection::AABB& box, const NodeFilter& filter = {}) const = 0;
+
+    virtual std::vector<std::shared_ptr<prev::scene::graph::ISceneNode>> FindOverlapping(const prev::util::intersection::Sphere& sphere, const NodeFilter& filter = {}) const = 0;
+
+    virtual std::vector<std::shared_ptr<prev::scene::graph::ISceneNode>> FindInFrustum(const prev::util::intersection::Frustum& frustum, const NodeFilter& filter = {}) const = 0;
+
+    virtual std::vector<std::shared_ptr<prev::scene::graph::ISceneNode>> FindNearest(const glm::vec3& point, const uint32_t count) const = 0;
+
+    // Tests all tracked volumes against all frustums, one bitset row per frustum. Moving volumes are tested in SIMD batches,
+    // volumes with a static transform go through a separate tree culled hierarchically.
+    virtual void Cull(const prev::util::intersection::Frustum* frustums, const uint32_t frustumCount, SceneCullingResult& inOutResult) const = 0;
+
+    // Reads the node's bits from a Cull result - nodes that are not tracked are reported visible.
+    virtual bool IsVisible(const SceneCullingResult& cullingResult, const uint32_t firstView, const uint32_t viewCount, const prev::scene::graph::ISceneNode& node) const = 0;
+
+public:
+    virtual ~ISceneQueryComponent() = default;
+};
+} // namespace prev_test::component::ray_casting
+
+#endif // !__ISCENE_QUERY_COMPONENT_H__
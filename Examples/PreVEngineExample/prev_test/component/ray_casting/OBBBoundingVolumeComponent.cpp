@@ -24,12 +24,12 @@ OBBBoundingVolumeComponent::OBBBoundingVolumeComponent(const prev::core::device:
 #endif
 }
 
-bool OBBBoundingVolumeComponent::IsInFrustum(const prev::util::intersection::Frustum& frustum)
+bool OBBBoundingVolumeComponent::IsInFrustum(const prev::util::intersection::Frustum& frustum) const
 {
     return prev::util::intersection::tester::Intersects(m_working, frustum);
 }
 
-bool OBBBoundingVolumeComponent::Intersects(const prev::util::intersection::Ray& ray, prev::util::intersection::RayCastResult& result)
+bool OBBBoundingVolumeComponent::Intersects(const prev::util::intersection::Ray& ray, prev::util::intersection::RayCastResult& result) const
 {
     return prev::util::intersection::tester::Intersects(ray, m_working, result);
 }
@@ -42,6 +42,10 @@ void OBBBoundingVolumeComponent::Update(const glm::mat4& worldTransform)
 
     m_working = prev::util::intersection::OBB{ rotation, m_original.position * scale + translation, m_original.GetHalfSize() * scale };
 
+    if (m_updateCallback) {
+        m_updateCallback();
+    }
+
 #ifdef RENDER_BOUNDING_VOLUMES
     m_model = BoundingVolumeModelFactory{ m_device }.CreateOBBModel(m_working, m_model);
 #endif
@@ -52,6 +56,20 @@ BoundingVolumeType OBBBoundingVolumeComponent::GetType() const
     return BoundingVolumeType::OBB;
 }
 
+prev::util::intersection::AABB OBBBoundingVolumeComponent::GetAABB() const
+{
+    // project the rotated half extents onto world axes
+    const glm::mat3 rotation{ glm::mat3_cast(m_working.orientation) };
+    const glm::mat3 absRotation{ glm::abs(rotation[0]), glm::abs(rotation[1]), glm::abs(rotation[2]) };
+    const glm::vec3 halfSize{ absRotation * m_working.halfExtents };
+    return prev::util::intersection::AABB{ m_working.position - halfSize, m_working.position + halfSize };
+}
+
+void OBBBoundingVolumeComponent::SetUpdateCallback(const std::function<void()>& callback)
+{
+    m_updateCallback = callback;
+}
+
 #ifdef RENDER_BOUNDING_VOLUMES
 std::shared_ptr<prev_test::render::IModel> OBBBoundingVolumeComponent::GetModel() const
 {
@@ -0,0 +1,279 @@
+#include "SceneQueryComponent.h"
+
+#include <prev/util/intersection/IntersectionTester.h>
+
+namespace prev_test::component::ray_casting {
+SceneQueryComponent::~SceneQueryComponent()
+{
+    for (auto& [nodeId, proxy] : m_proxies) {
+        proxy.boundingVolume->SetUpdateCallback({});
+    }
+}
+
+void SceneQueryComponent::Add(const std::shared_ptr<prev::scene::graph::ISceneNode>& node)
+{
+    Remove(node->GetId());
+
+    // the node may still be in its Init, its transform could come after the volume
+    m_pendingNodes[node->GetId()] = node;
+}
+
+void SceneQueryComponent::Remove(const uint64_t nodeId)
+{
+    m_pendingNodes.erase(nodeId);
+
+    const auto proxyIter{ m_proxies.find(nodeId) };
+    if (proxyIter == m_proxies.end()) {
+        return;
+    }
+
+    auto& proxy{ proxyIter->second };
+    proxy.boundingVolume->SetUpdateCallback({});
+    m_bvh.Remove(proxy.proxyId);
+    RemoveFromCulling(proxy);
+    m_proxies.erase(proxyIter);
+}
+
+void SceneQueryComponent::Update()
+{
+    for (const auto& [nodeId, pendingNode] : m_pendingNodes) {
+        if (const auto node = pendingNode.lock()) {
+            Insert(node);
+        }
+    }
+    m_pendingNodes.clear();
+
+    // only the volumes that moved, a removed one may still be listed
+    for (const auto nodeId : m_dirtyNodeIds) {
+        const auto proxyIter{ m_proxies.find(nodeId) };
+        if (proxyIter != m_proxies.end() && proxyIter->second.dirty) {
+            Refit(proxyIter->second);
+        }
+    }
+    m_dirtyNodeIds.clear();
+
+    // a transform comes to rest by not changing, so its volume is not updated anymore - moving proxies only
+    for (const auto nodeId : m_movingNodeIds) {
+        const auto& proxy{ m_proxies.at(nodeId) };
+        if (proxy.transform && proxy.transform->IsStatic()) {
+            m_settledNodeIds.push_back(nodeId);
+        }
+    }
+    for (const auto nodeId : m_settledNodeIds) {
+        auto& proxy{ m_proxies.at(nodeId) };
+        RemoveFromCulling(proxy);
+        AddToCulling(nodeId, proxy, proxy.boundingVolume->GetAABB(), true);
+    }
+    m_settledNodeIds.clear();
+}
+
+std::optional<SceneRayCastResult> SceneQueryComponent::RayCastClosest(const prev::util::intersection::Ray& ray, const NodeFilter& filter) const
+{
+    return RayCast(ray, filter, false);
+}
+
+std::optional<SceneRayCastResult> SceneQueryComponent::RayCastAny(const prev::util::intersection::Ray& ray, const NodeFilter& filter) const
+{
+    return RayCast(ray, filter, true);
+}
+
+std::vector<std::shared_ptr<prev::scene::graph::ISceneNode>> SceneQueryComponent::FindOverlapping(const prev::util::intersection::AABB& box, const NodeFilter& filter) const
+{
+    return Query(box, [&](const IBoundingVolumeComponent& boundingVolume) { return prev::util::intersection::tester::Intersects(box, boundingVolume.GetAABB()); }, filter);
+}
+
+std::vector<std::shared_ptr<prev::scene::graph::ISceneNode>> SceneQueryComponent::FindOverlapping(const prev::util::intersection::Sphere& sphere, const NodeFilter& filter) const
+{
+    return Query(sphere, [&](const IBoundingVolumeComponent& boundingVolume) { return prev::util::intersection::tester::Intersects(sphere, boundingVolume.GetAABB()); }, filter);
+}
+
+std::vector<std::shared_ptr<prev::scene::graph::ISceneNode>> SceneQueryComponent::FindInFrustum(const prev::util::intersection::Frustum& frustum, const NodeFilter& filter) const
+{
+    return Query(frustum, [&](const IBoundingVolumeComponent& boundingVolume) { return boundingVolume.IsInFrustum(frustum); }, filter);
+}
+
+std::vector<std::shared_ptr<prev::scene::graph::ISceneNode>> SceneQueryComponent::FindNearest(const glm::vec3& point, const uint32_t count) const
+{
+    const auto nearest{ m_bvh.FindNearest(point, count, [this](const uint64_t nodeId, const glm::vec3& p) {
+        const auto box{ m_proxies.at(nodeId).boundingVolume->GetAABB() };
+        return glm::distance(glm::clamp(p, box.minExtents, box.maxExtents), p);
+    }) };
+
+    std::vector<std::shared_ptr<prev::scene::graph::ISceneNode>> result;
+    result.reserve(nearest.size());
+    for (const auto& item : nearest) {
+        if (auto node = m_proxies.at(item.userData).node.lock()) {
+            result.push_back(node);
+        }
+    }
+    return result;
+}
+
+void SceneQueryComponent::Cull(const prev::util::intersection::Frustum* frustums, const uint32_t frustumCount, SceneCullingResult& inOutResult) const
+{
+    m_culler.Cull(frustums, frustumCount, inOutResult.dynamicVisibility);
+
+    inOutResult.staticVisibility.Reset(frustumCount, m_staticTree.GetCapacity());
+    inOutResult.planeCaches.resize(frustumCount);
+    inOutResult.staticStats = {};
+    for (uint32_t view = 0; view < frustumCount; ++view) {
+        auto words{ inOutResult.staticVisibility.GetWords(view) };
+
+        prev::util::intersection::BVH::CullingStats stats{};
+        m_staticTree.Cull(frustums[view], inOutResult.planeCaches[view], [words](const uint32_t proxyId) { words[proxyId / 64] |= uint64_t{ 1 } << (proxyId % 64); }, &stats);
+
+        inOutResult.staticStats.nodeTests += stats.nodeTests;
+        inOutResult.staticStats.planeTests += stats.planeTests;
+    }
+}
+
+bool SceneQueryComponent::IsVisible(const SceneCullingResult& cullingResult, const uint32_t firstView, const uint32_t viewCount, const prev::scene::graph::ISceneNode& node) const
+{
+    const auto proxyIter{ m_proxies.find(node.GetId()) };
+    if (proxyIter == m_proxies.cend()) {
+        return true;
+    }
+
+    const auto& proxy{ proxyIter->second };
+    if (proxy.staticProxyId != prev::util::intersection::BVH::INVALID_ID) {
+        if (proxy.staticProxyId >= cullingResult.staticVisibility.GetObjectCount()) {
+            return true;
+        }
+        return cullingResult.staticVisibility.IsVisibleInAny(firstView, viewCount, proxy.staticProxyId);
+    }
+
+    if (proxy.cullingSlot >= cullingResult.dynamicVisibility.GetObjectCount()) {
+        return true;
+    }
+    return cullingResult.dynamicVisibility.IsVisibleInAny(firstView, viewCount, proxy.cullingSlot);
+}
+
+void SceneQueryComponent::Insert(const std::shared_ptr<prev::scene::graph::ISceneNode>& node)
+{
+    const auto boundingVolume{ node->GetComponentRepository().Find<IBoundingVolumeComponent>() };
+    if (!boundingVolume) {
+        return;
+    }
+
+    // volumes without a transform are driven by something else and always treated as moving
+    const auto transform{ node->GetComponentRepository().Find<prev_test::component::transform::ITransformComponent>() };
+    const bool isStatic{ transform && transform->IsStatic() };
+
+    const auto nodeId{ node->GetId() };
+    const auto box{ boundingVolume->GetAABB() };
+    auto& proxy{ m_proxies[nodeId] };
+    proxy.proxyId = m_bvh.Insert(box, nodeId);
+    proxy.node = node;
+    proxy.boundingVolume = boundingVolume;
+    proxy.transform = transform;
+    AddToCulling(nodeId, proxy, box, isStatic);
+
+    boundingVolume->SetUpdateCallback([this, nodeId]() { MarkDirty(nodeId); });
+}
+
+void SceneQueryComponent::MarkDirty(const uint64_t nodeId)
+{
+    auto& proxy{ m_proxies.at(nodeId) };
+    if (!proxy.dirty) {
+        proxy.dirty = true;
+        m_dirtyNodeIds.push_back(nodeId);
+    }
+}
+
+void SceneQueryComponent::Refit(Proxy& proxy)
+{
+    proxy.dirty = false;
+
+    // the tree is touched only when the volume left its fat box
+    const auto box{ proxy.boundingVolume->GetAABB() };
+    m_bvh.Update(proxy.proxyId, box);
+
+    const bool wasStatic{ proxy.staticProxyId != prev::util::intersection::BVH::INVALID_ID };
+    const bool isStatic{ proxy.transform && proxy.transform->IsStatic() };
+    if (wasStatic != isStatic) {
+        const auto nodeId{ m_bvh.GetUserData(proxy.proxyId) };
+        RemoveFromCulling(proxy);
+        AddToCulling(nodeId, proxy, box, isStatic);
+    } else if (isStatic) {
+        m_staticTree.Update(proxy.staticProxyId, box);
+    } else {
+        m_culler.Set(proxy.cullingSlot, box);
+    }
+}
+
+void SceneQueryComponent::AddToCulling(const uint64_t nodeId, Proxy& proxy, const prev::util::intersection::AABB& box, const bool isStatic)
+{
+    if (isStatic) {
+        proxy.staticProxyId = m_staticTree.Insert(box, nodeId);
+    } else {
+        proxy.cullingSlot = m_culler.Add(box);
+        proxy.movingIndex = static_cast<uint32_t>(m_movingNodeIds.size());
+        m_movingNodeIds.push_back(nodeId);
+    }
+}
+
+void SceneQueryComponent::RemoveFromCulling(Proxy& proxy)
+{
+    if (proxy.staticProxyId != prev::util::intersection::BVH::INVALID_ID) {
+        m_staticTree.Remove(proxy.staticProxyId);
+        proxy.staticProxyId = prev::util::intersection::BVH::INVALID_ID;
+    }
+    if (proxy.cullingSlot != prev::util::intersection::FrustumCuller::INVALID_SLOT) {
+        m_culler.Remove(proxy.cullingSlot);
+        proxy.cullingSlot = prev::util::intersection::FrustumCuller::INVALID_SLOT;
+
+        // swap remove
+        const auto lastNodeId{ m_movingNodeIds.back() };
+        m_movingNodeIds[proxy.movingIndex] = lastNodeId;
+        m_proxies.at(lastNodeId).movingIndex = proxy.movingIndex;
+        m_movingNodeIds.pop_back();
+        proxy.movingIndex = INVALID_INDEX;
+    }
+}
+
+std::optional<SceneRayCastResult> SceneQueryComponent::RayCast(const prev::util::intersection::Ray& ray, const NodeFilter& filter, const bool anyHit) const
+{
+    const auto rayCastCallback = [&](const uint64_t nodeId, prev::util::intersection::RayCastResult& result) {
+        const auto& proxy{ m_proxies.at(nodeId) };
+        if (filter) {
+            const auto node{ proxy.node.lock() };
+            if (!node || !filter(node)) {
+                return false;
+            }
+        }
+        return proxy.boundingVolume->Intersects(ray, result);
+    };
+
+    uint64_t nodeId{};
+    prev::util::intersection::RayCastResult rayCastResult{};
+    const bool hit{ anyHit ? m_bvh.RayCastAny(ray, rayCastCallback, nodeId, rayCastResult) : m_bvh.RayCastClosest(ray, rayCastCallback, nodeId, rayCastResult) };
+    if (!hit) {
+        return {};
+    }
+
+    const auto node{ m_proxies.at(nodeId).node.lock() };
+    if (!node) {
+        return {};
+    }
+    return SceneRayCastResult{ rayCastResult, node };
+}
+
+template <typename VolumeType>
+std::vector<std::shared_ptr<prev::scene::graph::ISceneNode>> SceneQueryComponent::Query(const VolumeType& volume, const std::function<bool(const IBoundingVolumeComponent&)>& exactTest, const NodeFilter& filter) const
+{
+    std::vector<std::shared_ptr<prev::scene::graph::ISceneNode>> result;
+    m_bvh.Query(volume, [&](const uint64_t nodeId) {
+        const auto& proxy{ m_proxies.at(nodeId) };
+        if (!exactTest(*proxy.boundingVolume)) {
+            return true;
+        }
+
+        auto node{ proxy.node.lock() };
+        if (node && (!filter || filter(node))) {
+            result.push_back(std::move(node));
+        }
+        return true;
+    });
+    return result;
+}
+} // namespace prev_test::component::ray_casting
\ No newline at end of file
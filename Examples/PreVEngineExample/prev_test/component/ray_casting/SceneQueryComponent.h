@@ -0,0 +1,110 @@
+#ifndef __SCENE_QUERY_COMPONENT_H__
+#define __SCENE_QUERY_COMPONENT_H__
+
+#include "IBoundingVolumeComponent.h"
+#include "ISceneQueryComponent.h"
+
+#include "../transform/ITransformComponent.h"
+
+#include <prev/util/intersection/BVH.h>
+
+#include <limits>
+#include <unordered_map>
+#include <vector>
+
+namespace prev_test::component::ray_casting {
+class SceneQueryComponent final : public ISceneQueryComponent {
+public:
+    SceneQueryComponent() = default;
+
+    ~SceneQueryComponent();
+
+public:
+    void Add(const std::shared_ptr<prev::scene::graph::ISceneNode>& node) override;
+
+    void Remove(const uint64_t nodeId) override;
+
+    void Update() override;
+
+    std::optional<SceneRayCastResult> RayCastClosest(const prev::util::intersection::Ray& ray, const NodeFilter& filter) const override;
+
+    std::optional<SceneRayCastResult> RayCastAny(const prev::util::intersection::Ray& ray, const NodeFilter& filter) const override;
+
+    std::vector<std::shared_ptr<prev::scene::graph::ISceneNode>> FindOverlapping(const prev::util::intersection::AABB& box, const NodeFilter& filter) const override;
+
+    std::vector<std::shared_ptr<prev::scene::graph::ISceneNode>> FindOverlapping(const prev::util::intersection::Sphere& sphere, const NodeFilter& filter) const override;
+
+    std::vector<std::shared_ptr<prev::scene::graph::ISceneNode>> FindInFrustum(const prev::util::intersection::Frustum& frustum, const NodeFilter& filter) const override;
+
+    std::vector<std::shared_ptr<prev::scene::graph::ISceneNode>> FindNearest(const glm::vec3& point, const uint32_t count) const override;
+
+    void Cull(const prev::util::intersection::Frustum* frustums, const uint32_t frustumCount, SceneCullingResult& inOutResult) const override;
+
+    bool IsVisible(const SceneCullingResult& cullingResult, const uint32_t firstView, const uint32_t viewCount, const prev::scene::graph::ISceneNode& node) const override;
+
+private:
+    struct Proxy {
+        uint32_t proxyId{ prev::util::intersection::BVH::INVALID_ID };
+
+        uint32_t cullingSlot{ prev::util::intersection::FrustumCuller::INVALID_SLOT };
+
+        uint32_t staticProxyId{ prev::util::intersection::BVH::INVALID_ID };
+
+        // into m_movingNodeIds
+        uint32_t movingIndex{ INVALID_INDEX };
+
+        // the volume was updated since the last refit
+        bool dirty{ false };
+
+        std::weak_ptr<prev::scene::graph::ISceneNode> node{};
+
+        std::shared_ptr<IBoundingVolumeComponent> boundingVolume{};
+
+        std::shared_ptr<prev_test::component::transform::ITransformComponent> transform{};
+    };
+
+private:
+    static const inline uint32_t INVALID_INDEX{ std::numeric_limits<uint32_t>::max() };
+
+private:
+    void Insert(const std::shared_ptr<prev::scene::graph::ISceneNode>& node);
+
+    void MarkDirty(const uint64_t nodeId);
+
+    void Refit(Proxy& proxy);
+
+    void AddToCulling(const uint64_t nodeId, Proxy& proxy, const prev::util::intersection::AABB& box, const bool isStatic);
+
+    void RemoveFromCulling(Proxy& proxy);
+
+    std::optional<SceneRayCastResult> RayCast(const prev::util::intersection::Ray& ray, const NodeFilter& filter, const bool anyHit) const;
+
+    template <typename VolumeType>
+    std::vector<std::shared_ptr<prev::scene::graph::ISceneNode>> Query(const VolumeType& volume, const std::function<bool(const IBoundingVolumeComponent&)>& exactTest, const NodeFilter& filter) const;
+
+private:
+    prev::util::intersection::BVH m_bvh{};
+
+    // moving volumes
+    prev::util::intersection::FrustumCuller m_culler{};
+
+    // volumes with a static transform, exact boxes
+    prev::util::intersection::BVH m_staticTree{ 0.0f };
+
+    // keyed by scene node id
+    std::unordered_map<uint64_t, Proxy> m_proxies;
+
+    // added since the last Update, inserted once their node finished its Init
+    std::unordered_map<uint64_t, std::weak_ptr<prev::scene::graph::ISceneNode>> m_pendingNodes;
+
+    // pushed by the update callbacks of the volumes
+    std::vector<uint64_t> m_dirtyNodeIds;
+
+    // the proxies in the culler, checked for transforms that came to rest
+    std::vector<uint64_t> m_movingNodeIds;
+
+    std::vector<uint64_t> m_settledNodeIds;
+};
+} // namespace prev_test::component::ray_casting
+
+#endif // !__SCENE_QUERY_COMPONENT_H__
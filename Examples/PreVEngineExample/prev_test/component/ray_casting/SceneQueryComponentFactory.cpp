@@ -0,0 +1,9 @@
+#include "SceneQueryComponentFactory.h"
+#include "SceneQueryComponent.h"
+
+namespace prev_test::component::ray_casting {
+std::unique_ptr<ISceneQueryComponent> SceneQueryComponentFactory::Create() const
+{
+    return std::make_unique<SceneQueryComponent>();
+}
+} // namespace prev_test::component::ray_casting
\ No newline at end of file
@@ -0,0 +1,15 @@
+#ifndef __SCENE_QUERY_COMPONENT_FACTORY_H__
+#define __SCENE_QUERY_COMPONENT_FACTORY_H__
+
+#include "ISceneQueryComponent.h"
+
+#include <memory>
+
+namespace prev_test::component::ray_casting {
+class SceneQueryComponentFactory final {
+public:
+    std::unique_ptr<ISceneQueryComponent> Create() const;
+};
+} // namespace prev_test::component::ray_casting
+
+#endif // !__SCENE_QUERY_COMPONENT_FACTORY_H__
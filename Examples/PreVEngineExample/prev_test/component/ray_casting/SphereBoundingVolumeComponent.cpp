@@ -23,12 +23,12 @@ SphereBoundingVolumeComponent::SphereBoundingVolumeComponent(const prev::core::d
 #endif
 }
 
-bool SphereBoundingVolumeComponent::IsInFrustum(const prev::util::intersection::Frustum& frustum)
+bool SphereBoundingVolumeComponent::IsInFrustum(const prev::util::intersection::Frustum& frustum) const
 {
     return prev::util::intersection::tester::Intersects(frustum, m_working);
 }
 
-bool SphereBoundingVolumeComponent::Intersects(const prev::util::intersection::Ray& ray, prev::util::intersection::RayCastResult& result)
+bool SphereBoundingVolumeComponent::Intersects(const prev::util::intersection::Ray& ray, prev::util::intersection::RayCastResult& result) const
 {
     return prev::util::intersection::tester::Intersects(ray, m_working, result);
 }
@@ -40,6 +40,10 @@ void SphereBoundingVolumeComponent::Update(const glm::mat4& worldTransform)
     prev::util::math::DecomposeTransform(worldTransform, rotation, translation, scale);
 
     m_working = prev::util::intersection::Sphere{ translation + m_original.position * scale, m_original.radius * glm::length(scale) };
+    if (m_updateCallback) {
+        m_updateCallback();
+    }
+
 #ifdef RENDER_BOUNDING_VOLUMES
     m_model = BoundingVolumeModelFactory{ m_device }.CreateSphereModel(m_working, m_model);
 #endif
@@ -50,6 +54,16 @@ BoundingVolumeType SphereBoundingVolumeComponent::GetType() const
     return BoundingVolumeType::SPHERE;
 }
 
+prev::util::intersection::AABB SphereBoundingVolumeComponent::GetAABB() const
+{
+    return prev::util::intersection::AABB{ m_working.position - glm::vec3(m_working.radius), m_working.position + glm::vec3(m_working.radius) };
+}
+
+void SphereBoundingVolumeComponent::SetUpdateCallback(const std::function<void()>& callback)
+{
+    m_updateCallback = callback;
+}
+
 #ifdef RENDER_BOUNDING_VOLUMES
 std::shared_ptr<prev_test::render::IModel> SphereBoundingVolumeComponent::GetModel() const
 {
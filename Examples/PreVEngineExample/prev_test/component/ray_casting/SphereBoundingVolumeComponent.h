@@ -18,14 +18,18 @@ public:
     ~SphereBoundingVolumeComponent() = default;
 
 public:
-    bool IsInFrustum(const prev::util::intersection::Frustum& frustum) override;
+    bool IsInFrustum(const prev::util::intersection::Frustum& frustum) const override;
 
-    bool Intersects(const prev::util::intersection::Ray& ray, prev::util::intersection::RayCastResult& result) override;
+    bool Intersects(const prev::util::intersection::Ray& ray, prev::util::intersection::RayCastResult& result) const override;
 
     void Update(const glm::mat4& worldTransform) override;
 
     BoundingVolumeType GetType() const override;
 
+    prev::util::intersection::AABB GetAABB() const override;
+
+    void SetUpdateCallback(const std::function<void()>& callback) override;
+
 #ifdef RENDER_BOUNDING_VOLUMES
     std::shared_ptr<prev_test::render::IModel> GetModel() const override;
 #endif
@@ -47,6 +51,8 @@ private:
     prev::util::intersection::Sphere m_original;
 
     prev::util::intersection::Sphere m_working;
+
+    std::function<void()> m_updateCallback;
 };
 } // namespace prev_test::component::ray_casting
 
@@ -132,7 +132,7 @@ std::unique_ptr<IRenderComponent> RenderComponentFactory::CreateModelRenderCompo
     for (const auto& color : colors) {
         materials.emplace_back(materialFactory.Create({ color, 2.0f, 0.3f }));
     }
-    auto mesh{ prev_test::render::mesh::ModelMeshFactory{}.Create(modelPath) };
+    auto mesh{ prev_test::render::mesh::ModelMeshFactory{ m_device }.Create(modelPath) };
     auto model{ prev_test::render::model::ModelFactory{ m_device }.Create(std::move(mesh), m_async) };
 
     return std::make_unique<DefaultRenderComponent>(std::move(model), materials, castsShadows, isCastedByShadows);
@@ -145,7 +145,7 @@ std::unique_ptr<IRenderComponent> RenderComponentFactory::CreateModelRenderCompo
     for (const auto& texturePath : texturePaths) {
         materials.emplace_back(materialFactory.Create({ glm::vec4(1.0f), 2.0f, 0.3f }, texturePath, m_async));
     }
-    auto mesh{ prev_test::render::mesh::ModelMeshFactory{}.Create(modelPath) };
+    auto mesh{ prev_test::render::mesh::ModelMeshFactory{ m_device }.Create(modelPath) };
     auto model{ prev_test::render::model::ModelFactory{ m_device }.Create(std::move(mesh), m_async) };
 
     return std::make_unique<DefaultRenderComponent>(std::move(model), materials, castsShadows, isCastedByShadows);
@@ -158,7 +158,7 @@ std::unique_ptr<IRenderComponent> RenderComponentFactory::CreateModelRenderCompo
     for (size_t i = 0; i < texturePaths.size(); ++i) {
         materials.emplace_back(materialFactory.Create({ glm::vec4(1.0f), 10.0f, 0.7f }, texturePaths[i], normalMapPaths[i], m_async));
     }
-    auto mesh{ prev_test::render::mesh::ModelMeshFactory{}.Create(modelPath, prev::common::FlagSet<prev_test::render::mesh::ModelMeshFactory::CreateFlags>{ prev_test::render::mesh::ModelMeshFactory::CreateFlags::TANGENT_BITANGENT }) };
+    auto mesh{ prev_test::render::mesh::ModelMeshFactory{ m_device }.Create(modelPath, prev::common::FlagSet<prev_test::render::mesh::ModelMeshFactory::CreateFlags>{ prev_test::render::mesh::ModelMeshFactory::CreateFlags::TANGENT_BITANGENT }) };
     auto model{ prev_test::render::model::ModelFactory{ m_device }.Create(std::move(mesh), m_async) };
 
     return std::make_unique<DefaultRenderComponent>(std::move(model), materials, castsShadows, isCastedByShadows);
@@ -171,7 +171,7 @@ std::unique_ptr<IRenderComponent> RenderComponentFactory::CreateModelRenderCompo
     for (size_t i = 0; i < texturePaths.size(); ++i) {
         materials.emplace_back(materialFactory.Create({ glm::vec4(1.0f), 10.0f, 0.7f }, texturePaths[i], normalMapPaths[i], heightOrConeMapPaths[i], m_async));
     }
-    auto mesh{ prev_test::render::mesh::ModelMeshFactory{}.Create(modelPath, prev::common::FlagSet<prev_test::render::mesh::ModelMeshFactory::CreateFlags>{ prev_test::render::mesh::ModelMeshFactory::CreateFlags::TANGENT_BITANGENT }) };
+    auto mesh{ prev_test::render::mesh::ModelMeshFactory{ m_device }.Create(modelPath, prev::common::FlagSet<prev_test::render::mesh::ModelMeshFactory::CreateFlags>{ prev_test::render::mesh::ModelMeshFactory::CreateFlags::TANGENT_BITANGENT }) };
     auto model{ prev_test::render::model::ModelFactory{ m_device }.Create(std::move(mesh), m_async) };
 
     return std::make_unique<DefaultRenderComponent>(std::move(model), materials, castsShadows, isCastedByShadows);
@@ -180,7 +180,7 @@ std::unique_ptr<IRenderComponent> RenderComponentFactory::CreateModelRenderCompo
 std::unique_ptr<IRenderComponent> RenderComponentFactory::CreateModelRenderComponent(const std::string& modelPath, const bool castsShadows, const bool isCastedByShadows) const
 {
     auto materials{ prev_test::render::material::MaterialFactory{ m_device, m_colorManaged }.Create(modelPath, m_async) };
-    auto mesh{ prev_test::render::mesh::ModelMeshFactory{}.Create(modelPath, materials.size() > 1 ? prev::common::FlagSet<prev_test::render::mesh::ModelMeshFactory::CreateFlags>{ prev_test::render::mesh::ModelMeshFactory::CreateFlags::TANGENT_BITANGENT } : prev::common::FlagSet<prev_test::render::mesh::ModelMeshFactory::CreateFlags>{}) };
+    auto mesh{ prev_test::render::mesh::ModelMeshFactory{ m_device }.Create(modelPath, materials.size() > 1 ? prev::common::FlagSet<prev_test::render::mesh::ModelMeshFactory::CreateFlags>{ prev_test::render::mesh::ModelMeshFactory::CreateFlags::TANGENT_BITANGENT } : prev::common::FlagSet<prev_test::render::mesh::ModelMeshFactory::CreateFlags>{}) };
     auto model{ prev_test::render::model::ModelFactory{ m_device }.Create(std::move(mesh), m_async) };
 
     return std::make_unique<DefaultRenderComponent>(std::move(model), std::move(materials), castsShadows, isCastedByShadows);
@@ -193,7 +193,7 @@ std::unique_ptr<IAnimationRenderComponent> RenderComponentFactory::CreateAnimate
     for (const auto& color : colors) {
         materials.emplace_back(materialFactory.Create({ color, 1.5f, 0.3f }));
     }
-    auto mesh{ prev_test::render::mesh::ModelMeshFactory{}.Create(modelPath, prev::common::FlagSet<prev_test::render::mesh::ModelMeshFactory::CreateFlags>{ prev_test::render::mesh::ModelMeshFactory::CreateFlags::ANIMATION }) };
+    auto mesh{ prev_test::render::mesh::ModelMeshFactory{ m_device }.Create(modelPath, prev::common::FlagSet<prev_test::render::mesh::ModelMeshFactory::CreateFlags>{ prev_test::render::mesh::ModelMeshFactory::CreateFlags::ANIMATION }) };
     auto model{ prev_test::render::model::ModelFactory{ m_device }.Create(std::move(mesh), m_async) };
 
     std::vector<std::shared_ptr<prev_test::render::IAnimation>> animations;
@@ -212,7 +212,7 @@ std::unique_ptr<IAnimationRenderComponent> RenderComponentFactory::CreateAnimate
     for (const auto& texturePath : texturePaths) {
         materials.emplace_back(materialFactory.Create({ glm::vec4(1.0f), 1.5f, 0.3f }, texturePath, m_async));
     }
-    auto mesh{ prev_test::render::mesh::ModelMeshFactory{}.Create(modelPath, prev::common::FlagSet<prev_test::render::mesh::ModelMeshFactory::CreateFlags>{ prev_test::render::mesh::ModelMeshFactory::CreateFlags::ANIMATION }) };
+    auto mesh{ prev_test::render::mesh::ModelMeshFactory{ m_device }.Create(modelPath, prev::common::FlagSet<prev_test::render::mesh::ModelMeshFactory::CreateFlags>{ prev_test::render::mesh::ModelMeshFactory::CreateFlags::ANIMATION }) };
     auto model{ prev_test::render::model::ModelFactory{ m_device }.Create(std::move(mesh), m_async) };
 
     std::vector<std::shared_ptr<prev_test::render::IAnimation>> animations;
@@ -231,7 +231,7 @@ std::unique_ptr<IAnimationRenderComponent> RenderComponentFactory::CreateAnimate
     for (size_t i = 0; i < texturePaths.size(); ++i) {
         materials.emplace_back(materialFactory.Create({ glm::vec4(1.0f), 1.5f, 0.3f }, texturePaths[i], normalMapPaths[i], m_async));
     }
-    auto mesh{ prev_test::render::mesh::ModelMeshFactory{}.Create(modelPath, prev::common::FlagSet<prev_test::render::mesh::ModelMeshFactory::CreateFlags>{ prev_test::render::mesh::ModelMeshFactory::CreateFlags::ANIMATION | prev_test::render::mesh::ModelMeshFactory::CreateFlags::TANGENT_BITANGENT }) };
+    auto mesh{ prev_test::render::mesh::ModelMeshFactory{ m_device }.Create(modelPath, prev::common::FlagSet<prev_test::render::mesh::ModelMeshFactory::CreateFlags>{ prev_test::render::mesh::ModelMeshFactory::CreateFlags::ANIMATION | prev_test::render::mesh::ModelMeshFactory::CreateFlags::TANGENT_BITANGENT }) };
     auto model{ prev_test::render::model::ModelFactory{ m_device }.Create(std::move(mesh), m_async) };
 
     std::vector<std::shared_ptr<prev_test::render::IAnimation>> animations;
@@ -250,7 +250,7 @@ std::unique_ptr<IAnimationRenderComponent> RenderComponentFactory::CreateAnimate
     for (size_t i = 0; i < texturePaths.size(); ++i) {
         materials.emplace_back(materialFactory.Create({ glm::vec4(1.0f), 1.5f, 0.3f }, texturePaths[i], normalMapPaths[i], heightOrConeMapPaths[i], m_async));
     }
-    auto mesh{ prev_test::render::mesh::ModelMeshFactory{}.Create(modelPath, prev::common::FlagSet<prev_test::render::mesh::ModelMeshFactory::CreateFlags>{ prev_test::render::mesh::ModelMeshFactory::CreateFlags::ANIMATION | prev_test::render::mesh::ModelMeshFactory::CreateFlags::TANGENT_BITANGENT }) };
+    auto mesh{ prev_test::render::mesh::ModelMeshFactory{ m_device }.Create(modelPath, prev::common::FlagSet<prev_test::render::mesh::ModelMeshFactory::CreateFlags>{ prev_test::render::mesh::ModelMeshFactory::CreateFlags::ANIMATION | prev_test::render::mesh::ModelMeshFactory::CreateFlags::TANGENT_BITANGENT }) };
     auto model{ prev_test::render::model::ModelFactory{ m_device }.Create(std::move(mesh), m_async) };
 
     std::vector<std::shared_ptr<prev_test::render::IAnimation>> animations;
@@ -265,7 +265,7 @@ std::unique_ptr<IAnimationRenderComponent> RenderComponentFactory::CreateAnimate
 std::unique_ptr<IAnimationRenderComponent> RenderComponentFactory::CreateAnimatedModelRenderComponent(const std::string& modelPath, const std::vector<std::string>& animationPaths, const bool castsShadows, const bool isCastedByShadows) const
 {
     auto materials{ prev_test::render::material::MaterialFactory{ m_device, m_colorManaged }.Create(modelPath, m_async) };
-    auto mesh{ prev_test::render::mesh::ModelMeshFactory{}.Create(modelPath, materials.size() > 1 ? prev::common::FlagSet<prev_test::render::mesh::ModelMeshFactory::CreateFlags>{ prev_test::render::mesh::ModelMeshFactory::CreateFlags::ANIMATION | prev_test::render::mesh::ModelMeshFactory::CreateFlags::TANGENT_BITANGENT } : prev::common::FlagSet<prev_test::render::mesh::ModelMeshFactory::CreateFlags>{ prev_test::render::mesh::ModelMeshFactory::CreateFlags::ANIMATION }) };
+    auto mesh{ prev_test::render::mesh::ModelMeshFactory{ m_device }.Create(modelPath, materials.size() > 1 ? prev::common::FlagSet<prev_test::render::mesh::ModelMeshFactory::CreateFlags>{ prev_test::render::mesh::ModelMeshFactory::CreateFlags::ANIMATION | prev_test::render::mesh::ModelMeshFactory::CreateFlags::TANGENT_BITANGENT } : prev::common::FlagSet<prev_test::render::mesh::ModelMeshFactory::CreateFlags>{ prev_test::render::mesh::ModelMeshFactory::CreateFlags::ANIMATION }) };
     auto model{ prev_test::render::model::ModelFactory{ m_device }.Create(std::move(mesh), m_async) };
 
     std::vector<std::shared_ptr<prev_test::render::IAnimation>> animations;
@@ -229,20 +229,16 @@ std::shared_ptr<prev::render::buffer::ImageBuffer> TerrainComponentFactory::Crea
 
     // Decoded (by path) and resized (by path + target size) images are identical across terrain tiles, so
     // cache them - the grid rebuilds the same texture arrays per tile. CPU-only IImages, safe to hold static.
+    // Both caches are bounded by the decoded size, the least recently used images go first.
     using ImageCache = prev::common::Cache<std::string, std::shared_ptr<prev::render::image::IImage>>;
-    static ImageCache s_decodedCache{};
-    static ImageCache s_resizedCache{};
+    const auto imageCost = [](const std::shared_ptr<prev::render::image::IImage>& image) { return image ? static_cast<size_t>(image->GetSize()) * image->GetPixelSize() : 0; };
+    static ImageCache s_decodedCache{ 256 * 1024 * 1024, imageCost };
+    static ImageCache s_resizedCache{ 128 * 1024 * 1024, imageCost };
 
     std::vector<std::shared_ptr<prev::render::image::IImage>> images;
     uint32_t maxWidth = 0, maxHeight = 0;
     for (const auto& path : paths) {
-        std::shared_ptr<prev::render::image::IImage> img;
-        if (auto cached = s_decodedCache.Find(path)) {
-            img = *cached;
-        } else {
-            img = imageFactory.CreateImage(path);
-            s_decodedCache.Add(path, img);
-        }
+        std::shared_ptr<prev::render::image::IImage> img = s_decodedCache.GetOrCreate(path, [&]() -> std::shared_ptr<prev::render::image::IImage> { return imageFactory.CreateImage(path); });
         maxWidth = std::max(maxWidth, img->GetWidth());
         maxHeight = std::max(maxHeight, img->GetHeight());
         images.push_back(img);
@@ -257,13 +253,7 @@ std::shared_ptr<prev::render::buffer::ImageBuffer> TerrainComponentFactory::Crea
             continue;
         }
         const std::string rkey = paths[i] + "@" + std::to_string(maxWidth) + "x" + std::to_string(maxHeight);
-        if (auto cached = s_resizedCache.Find(rkey)) {
-            finalImages.push_back(*cached);
-        } else {
-            std::shared_ptr<prev::render::image::IImage> resized = imageFactory.CreateResizedImage(*img, maxWidth, maxHeight);
-            s_resizedCache.Add(rkey, resized);
-            finalImages.push_back(resized);
-        }
+        finalImages.push_back(s_resizedCache.GetOrCreate(rkey, [&]() -> std::shared_ptr<prev::render::image::IImage> { return imageFactory.CreateResizedImage(*img, maxWidth, maxHeight); }));
     }
 
     std::vector<const uint8_t*> layersData;
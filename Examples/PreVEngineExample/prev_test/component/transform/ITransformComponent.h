@@ -41,10 +41,22 @@ public:
 
     virtual glm::mat4 GetWorldTransformScaled() const = 0;
 
+    // Inverse transpose of the scaled world transform, cached until the transform changes.
+    virtual glm::mat4 GetNormalMatrix() const = 0;
+
     virtual glm::vec3 GetScaler() const = 0;
 
     virtual bool IsRoot() const = 0;
 
+    // True when the last Update produced a different world transform (or scale).
+    virtual bool IsWorldTransformChanged() const = 0;
+
+    // Incremented on every world transform change, children compare it against the value they saw last.
+    virtual uint64_t GetWorldTransformVersion() const = 0;
+
+    // A transform that did not change for a number of updates is considered static.
+    virtual bool IsStatic() const = 0;
+
 public:
     virtual ~ITransformComponent() = default;
 };
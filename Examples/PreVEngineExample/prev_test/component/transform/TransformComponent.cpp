@@ -1,36 +1,58 @@
 #include "TransformComponent.h"
+#include "TransformSystem.h"
 
 #include <prev/util/MathUtils.h>
 
 namespace prev_test::component::transform {
 TransformComponent::TransformComponent()
-    : m_worldTransform(1.0f)
-    , m_position(glm::vec3(0.0f))
-    , m_orientation(glm::quat(1.0f, 0.0f, 0.0f, 0.0f))
-    , m_scaler(glm::vec3(1.0f))
+    : TransformComponent(glm::vec3(0.0f), glm::quat(1.0f, 0.0f, 0.0f, 0.0f), glm::vec3(1.0f))
 {
 }
 
 TransformComponent::TransformComponent(const glm::vec3& position, const glm::quat& orientation, const glm::vec3& scale)
-    : m_worldTransform(1.0f)
-    , m_position(position)
-    , m_orientation(orientation)
-    , m_scaler(scale)
+    : m_hierarchy(TransformSystem::Instance().GetHierarchy())
+    , m_handle(m_hierarchy->Create(position, orientation, scale))
 {
 }
 
+TransformComponent::~TransformComponent()
+{
+    m_hierarchy->Destroy(m_handle);
+}
+
 void TransformComponent::Update(float deltaTime)
 {
-    if (auto parent = m_parent.lock()) { // This node has a parent...
-        m_worldTransform = parent->GetWorldTransform() * GetTransform();
-    } else { // Root node, world transform is local transform!
-        m_worldTransform = GetTransform();
+    auto& hierarchy{ *m_hierarchy };
+
+    // nothing to recompute unless this transform or its parent changed
+    const auto parent{ m_parent.lock() };
+    const uint64_t parentWorldTransformVersion{ parent ? parent->GetWorldTransformVersion() : 0 };
+    if (m_localTransformChanged || parentWorldTransformVersion != m_parentWorldTransformVersion) {
+        hierarchy.UpdateNode(m_handle);
+        m_localTransformChanged = false;
+        m_parentWorldTransformVersion = parentWorldTransformVersion;
     }
+
+    // the world transform could have been recomputed by a batch update as well, so versions are compared
+    const uint64_t worldTransformVersion{ hierarchy.GetVersion(m_handle) };
+    m_worldTransformChanged = worldTransformVersion != m_worldTransformVersion;
+    if (!m_worldTransformChanged) {
+        if (m_unchangedUpdatesCount < STATIC_UPDATES_THRESHOLD) {
+            ++m_unchangedUpdatesCount;
+        }
+        return;
+    }
+
+    m_worldTransformVersion = worldTransformVersion;
+    m_unchangedUpdatesCount = 0;
 }
 
 void TransformComponent::SetParent(const std::shared_ptr<ITransformComponent>& parent)
 {
+    const auto parentTransform{ std::dynamic_pointer_cast<TransformComponent>(parent) };
+    m_hierarchy->SetParent(m_handle, parentTransform ? parentTransform->GetHandle() : prev::scene::transform::TransformHierarchy::INVALID_HANDLE);
     m_parent = parent;
+    m_localTransformChanged = true;
 }
 
 std::shared_ptr<ITransformComponent> TransformComponent::GetParent() const
@@ -40,81 +62,115 @@ std::shared_ptr<ITransformComponent> TransformComponent::GetParent() const
 
 void TransformComponent::Rotate(const glm::quat& rotationDiff)
 {
-    const auto prevOrientation{ m_orientation };
-    m_orientation = glm::normalize(m_orientation * rotationDiff);
+    const auto prevOrientation{ GetOrientation() };
+    auto orientation{ glm::normalize(prevOrientation * rotationDiff) };
 
-    if (glm::dot(prevOrientation, m_orientation) < 0.0f) {
-        m_orientation = glm::conjugate(m_orientation);
+    if (glm::dot(prevOrientation, orientation) < 0.0f) {
+        orientation = glm::conjugate(orientation);
     }
+
+    SetOrientation(orientation);
 }
 
 void TransformComponent::Translate(const glm::vec3& positionDiff)
 {
-    m_position += positionDiff;
+    if (positionDiff != glm::vec3(0.0f)) {
+        SetPosition(GetPosition() + positionDiff);
+    }
 }
 
 void TransformComponent::Scale(const glm::vec3& scaleDiff)
 {
-    m_scaler += scaleDiff;
+    if (scaleDiff != glm::vec3(0.0f)) {
+        SetScale(GetScale() + scaleDiff);
+    }
 }
 
 glm::quat TransformComponent::GetOrientation() const
 {
-    return m_orientation;
+    return m_hierarchy->GetOrientation(m_handle);
 }
 
 glm::vec3 TransformComponent::GetPosition() const
 {
-    return m_position;
+    return m_hierarchy->GetPosition(m_handle);
 }
 
 glm::vec3 TransformComponent::GetScale() const
 {
-    return m_scaler;
+    return m_hierarchy->GetScale(m_handle);
 }
 
 void TransformComponent::SetOrientation(const glm::quat& orientation)
 {
-    m_orientation = orientation;
+    m_hierarchy->SetOrientation(m_handle, orientation);
+    m_localTransformChanged = true;
 }
 
 void TransformComponent::SetPosition(const glm::vec3& position)
 {
-    m_position = position;
+    m_hierarchy->SetPosition(m_handle, position);
+    m_localTransformChanged = true;
 }
 
 void TransformComponent::SetScale(const glm::vec3& scale)
 {
-    m_scaler = scale;
+    m_hierarchy->SetScale(m_handle, scale);
+    m_localTransformChanged = true;
 }
 
 glm::mat4 TransformComponent::GetTransform() const
 {
-    return prev::util::math::CreateTransformationMatrix(m_position, m_orientation, glm::vec3(1.0f));
+    return prev::util::math::CreateTransformationMatrix(GetPosition(), GetOrientation(), glm::vec3(1.0f));
 }
 
 glm::mat4 TransformComponent::GetTransformScaled() const
 {
-    return prev::util::math::CreateTransformationMatrix(m_position, m_orientation, m_scaler);
+    return prev::util::math::CreateTransformationMatrix(GetPosition(), GetOrientation(), GetScale());
 }
 
 glm::mat4 TransformComponent::GetWorldTransform() const
 {
-    return m_worldTransform;
+    return m_hierarchy->GetWorldTransform(m_handle);
 }
 
 glm::mat4 TransformComponent::GetWorldTransformScaled() const
 {
-    return glm::scale(GetWorldTransform(), m_scaler);
+    return m_hierarchy->GetWorldTransformScaled(m_handle);
+}
+
+glm::mat4 TransformComponent::GetNormalMatrix() const
+{
+    return m_hierarchy->GetNormalMatrix(m_handle);
 }
 
 glm::vec3 TransformComponent::GetScaler() const
 {
-    return m_scaler;
+    return GetScale();
 }
 
 bool TransformComponent::IsRoot() const
 {
     return !m_parent.lock();
 }
+
+bool TransformComponent::IsWorldTransformChanged() const
+{
+    return m_worldTransformChanged;
+}
+
+uint64_t TransformComponent::GetWorldTransformVersion() const
+{
+    return m_worldTransformVersion;
+}
+
+bool TransformComponent::IsStatic() const
+{
+    return m_unchangedUpdatesCount >= STATIC_UPDATES_THRESHOLD;
+}
+
+uint32_t TransformComponent::GetHandle() const
+{
+    return m_handle;
+}
 } // namespace prev_test::component::transform
\ No newline at end of file
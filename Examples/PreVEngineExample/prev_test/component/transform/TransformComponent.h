@@ -3,6 +3,10 @@
 
 #include "ITransformComponent.h"
 
+#include <prev/scene/transform/TransformHierarchy.h>
+
+#include <memory>
+
 namespace prev_test::component::transform {
 class TransformComponent : public ITransformComponent {
 public:
@@ -10,7 +14,7 @@ public:
 
     TransformComponent(const glm::vec3& position, const glm::quat& orientation, const glm::vec3& scale);
 
-    ~TransformComponent() = default;
+    ~TransformComponent();
 
 public:
     void Update(float deltaTime) override;
@@ -45,20 +49,44 @@ public:
 
     glm::mat4 GetWorldTransformScaled() const override;
 
+    glm::mat4 GetNormalMatrix() const override;
+
     glm::vec3 GetScaler() const override;
 
     bool IsRoot() const override;
 
+    bool IsWorldTransformChanged() const override;
+
+    uint64_t GetWorldTransformVersion() const override;
+
+    bool IsStatic() const override;
+
+public:
+    uint32_t GetHandle() const;
+
+private:
+    static const inline uint32_t STATIC_UPDATES_THRESHOLD{ 30 };
+
 private:
     std::weak_ptr<ITransformComponent> m_parent;
 
-    glm::mat4 m_worldTransform;
+    // all state lives in the shared hierarchy, held so that it outlives the component at shutdown as well
+    std::shared_ptr<prev::scene::transform::TransformHierarchy> m_hierarchy;
+
+    uint32_t m_handle;
+
+    // set by the setters, a new transform starts dirty in the hierarchy
+    bool m_localTransformChanged{ true };
+
+    // parent version the world transform was last brought up to date with
+    uint64_t m_parentWorldTransformVersion{ 0 };
 
-    glm::vec3 m_position;
+    bool m_worldTransformChanged{ false };
 
-    glm::quat m_orientation;
+    // hierarchy version seen by the last Update
+    uint64_t m_worldTransformVersion{ 0 };
 
-    glm::vec3 m_scaler;
+    uint32_t m_unchangedUpdatesCount{ 0 };
 };
 } // namespace prev_test::component::transform
 
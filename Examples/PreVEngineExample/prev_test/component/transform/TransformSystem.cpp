@@ -0,0 +1,19 @@
+#include "TransformSystem.h"
+
+namespace prev_test::component::transform {
+TransformSystem::TransformSystem()
+    : m_hierarchy{ std::make_shared<prev::scene::transform::TransformHierarchy>() }
+{
+}
+
+const std::shared_ptr<prev::scene::transform::TransformHierarchy>& TransformSystem::GetHierarchy() const
+{
+    return m_hierarchy;
+}
+
+void TransformSystem::Update(prev::common::ThreadPool& threadPool)
+{
+    // small changes stay on the calling thread
+    m_hierarchy->Update(threadPool);
+}
+} // namespace prev_test::component::transform
@@ -0,0 +1,35 @@
+#ifndef __TRANSFORM_SYSTEM_H__
+#define __TRANSFORM_SYSTEM_H__
+
+#include <prev/common/ThreadPool.h>
+#include <prev/common/pattern/Singleton.h>
+#include <prev/scene/transform/TransformHierarchy.h>
+
+#include <memory>
+
+namespace prev_test::component::transform {
+// Storage shared by all transform components, components only keep a handle into it. They share the ownership
+// of the hierarchy, so it goes with the last of them whatever the order of destruction at shutdown.
+class TransformSystem : public prev::common::pattern::Singleton<TransformSystem> {
+public:
+    ~TransformSystem() = default;
+
+public:
+    const std::shared_ptr<prev::scene::transform::TransformHierarchy>& GetHierarchy() const;
+
+    // Brings transforms changed outside of the scene node update up to date - unchanged subtrees are skipped,
+    // large changed ones are spread over the worker threads.
+    void Update(prev::common::ThreadPool& threadPool);
+
+private:
+    friend class prev::common::pattern::Singleton<TransformSystem>;
+
+private:
+    TransformSystem();
+
+private:
+    std::shared_ptr<prev::scene::transform::TransformHierarchy> m_hierarchy;
+};
+} // namespace prev_test::component::transform
+
+#endif
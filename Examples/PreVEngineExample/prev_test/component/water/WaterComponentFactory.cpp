@@ -20,7 +20,8 @@ std::unique_ptr<IWaterComponent> WaterComponentFactory::Create(const int x, cons
     const std::string dudvMapPath{ prev_test::common::AssetManager::Instance().GetAssetPath("Textures/waterDUDV.png") };
     const std::string normalMapPath{ prev_test::common::AssetManager::Instance().GetAssetPath("Textures/matchingNormalMap.png") };
 
-    auto material{ prev_test::render::material::MaterialFactory{ m_device, m_colorManaged }.Create({ WATER_COLOR, 1.0f, 0.0f }, dudvMapPath, normalMapPath, m_async) };
+    // the water shader reads all three normal map channels, block compression would drop Z
+    auto material{ prev_test::render::material::MaterialFactory{ m_device, m_colorManaged, false }.Create({ WATER_COLOR, 1.0f, 0.0f }, dudvMapPath, normalMapPath, m_async) };
     auto mesh{ prev_test::render::mesh::MeshFactory{}.CreateQuad(prev_test::render::FlatMeshConstellation::ZERO_Y, false) };
     auto model{ prev_test::render::model::ModelFactory{ m_device }.Create(std::move(mesh), m_async) };
 
@@ -2,6 +2,7 @@
 #define __IMATERIAL_H__
 
 #include <prev/common/Common.h>
+#include <prev/core/AssetLoader.h>
 #include <prev/render/buffer/ImageBuffer.h>
 
 #include <memory>
@@ -21,6 +22,9 @@ public:
 
     virtual bool IsReady() const = 0;
 
+    // Lets the images still being loaded go before the rest, e.g. once the material is visible.
+    virtual void RaiseLoadPriority(const prev::core::AssetPriority priority) = 0;
+
     virtual float GetShineDamper() const = 0;
 
     virtual float GetReflectivity() const = 0;
@@ -1,7 +1,7 @@
 #include "FontMetadata.h"
 
 namespace prev_test::render::font {
-FontMetadata::FontMetadata(const std::shared_ptr<prev::render::buffer::ImageBuffer>& imageBuffer, const std::map<int, Character>& characterMetaData, const float spaceWidth, const float lineHeight)
+FontMetadata::FontMetadata(const prev::core::AssetHandle<prev::render::buffer::ImageBuffer>& imageBuffer, const std::map<int, Character>& characterMetaData, const float spaceWidth, const float lineHeight)
     : m_imageBuffer(imageBuffer)
     , m_characterMetaData(characterMetaData)
     , m_spaceWidth(spaceWidth)
@@ -21,7 +21,19 @@ float FontMetadata::GetLineHeight(const float fontSize) const
 
 std::shared_ptr<prev::render::buffer::ImageBuffer> FontMetadata::GetImageBuffer() const
 {
-    return m_imageBuffer;
+    return m_imageBuffer.Get();
+}
+
+bool FontMetadata::IsReady() const
+{
+    // nothing to draw the text with until the texture is uploaded, nor after it failed to load
+    const auto imageBuffer{ m_imageBuffer.Get() };
+    return imageBuffer && imageBuffer->IsReady();
+}
+
+void FontMetadata::RaiseLoadPriority(const prev::core::AssetPriority priority)
+{
+    m_imageBuffer.RaisePriority(priority);
 }
 
 bool FontMetadata::GetCharacter(const int charCode, Character& outCharacter) const
@@ -3,6 +3,7 @@
 
 #include "Character.h"
 
+#include <prev/core/AssetLoader.h>
 #include <prev/render/buffer/ImageBuffer.h>
 
 #include <map>
@@ -11,7 +12,7 @@
 namespace prev_test::render::font {
 class FontMetadata {
 public:
-    FontMetadata(const std::shared_ptr<prev::render::buffer::ImageBuffer>& imageBuffer, const std::map<int, Character>& characterMetaData, const float spaceWidth, const float lineHeight);
+    FontMetadata(const prev::core::AssetHandle<prev::render::buffer::ImageBuffer>& imageBuffer, const std::map<int, Character>& characterMetaData, const float spaceWidth, const float lineHeight);
 
     ~FontMetadata() = default;
 
@@ -22,6 +23,10 @@ public:
 
     std::shared_ptr<prev::render::buffer::ImageBuffer> GetImageBuffer() const;
 
+    bool IsReady() const;
+
+    void RaiseLoadPriority(const prev::core::AssetPriority priority);
+
     bool GetCharacter(const int charCode, Character& outCharacter) const;
 
 public:
@@ -34,7 +39,7 @@ public:
     inline static const int UNKNOWN_CHARACTER{ '?' };
 
 private:
-    std::shared_ptr<prev::render::buffer::ImageBuffer> m_imageBuffer{};
+    prev::core::AssetHandle<prev::render::buffer::ImageBuffer> m_imageBuffer{};
 
     std::map<int, Character> m_characterMetaData;
 
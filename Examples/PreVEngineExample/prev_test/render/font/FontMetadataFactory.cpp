@@ -7,6 +7,8 @@
 
 #include <prev/util/Utils.h>
 
+#include <stdexcept>
+
 namespace prev_test::render::font {
 namespace {
     std::string GetValueAsString(const std::map<std::string, std::string>& keyValuePairs, const std::string& variable)
@@ -96,9 +98,8 @@ namespace {
         std::vector<CharacterMetadataState> characters{};
     };
 
-    FontMetadataState ParseFontMetadataFile(const std::string& metadataFilePath)
+    FontMetadataState ParseFontMetadata(const std::string& allText)
     {
-        const std::string allText{ prev::util::file::ReadTextFile(metadataFilePath) };
         const std::vector<std::string> allLines{ prev::util::string::Split(allText, '\n') };
         const std::vector<std::map<std::string, std::string>> allLinesKeyValues{ GetAllLinesTokens(allLines) };
 
@@ -185,16 +186,26 @@ namespace {
         return characters;
     }
 
-    std::shared_ptr<prev::render::buffer::ImageBuffer> CreateImageBuffer(const prev::core::device::Device& device, const std::string& textureFilePath)
+    std::shared_ptr<prev::render::image::IImage> CreateImage(const std::string& textureFilePath, prev::core::AssetLoadContext& context)
+    {
+        if (!prev::util::file::Exists(textureFilePath)) {
+            LOGE("Font: Texture not found: %s", textureFilePath.c_str());
+            return nullptr;
+        }
+
+        const auto data{ context.Measure(prev::core::AssetLoadStage::Read, [&]() { return prev::util::file::ReadBinaryFile(textureFilePath); }) };
+        return context.Measure(prev::core::AssetLoadStage::Decode, [&]() { return prev::render::image::ImageFactory{}.CreateImageFromMemory(reinterpret_cast<const uint8_t*>(data.data()), static_cast<uint32_t>(data.size())); });
+    }
+
+    std::shared_ptr<prev::render::buffer::ImageBuffer> CreateImageBuffer(const prev::core::device::Device& device, const prev::render::image::IImage& image)
     {
-        const auto image{ prev::render::image::ImageFactory{}.CreateImage(textureFilePath) };
         auto imageBuffer = prev::render::buffer::ImageBufferBuilder{ device, device.GetQueue(prev::core::device::QueueType::GRAPHICS) }
-                               .SetExtent({ image->GetWidth(), image->GetHeight(), 1 })
-                               .SetFormat(prev::util::gfx::ToImageFormat(image->GetChannels(), image->GetBitDepth(), image->IsFloatingPoint()))
+                               .SetExtent({ image.GetWidth(), image.GetHeight(), 1 })
+                               .SetFormat(prev::util::gfx::ToImageFormat(image.GetChannels(), image.GetBitDepth(), image.IsFloatingPoint()))
                                .SetType(GFX_TEXTURE_TYPE_2D)
                                .SetMipMapEnabled(true)
                                .SetUsageFlags(GFX_TEXTURE_USAGE_COPY_SRC | GFX_TEXTURE_USAGE_COPY_DST | GFX_TEXTURE_USAGE_TEXTURE_BINDING)
-                               .SetLayerData({ image->GetRawDataPtr() }, static_cast<uint64_t>(image->GetSize()) * image->GetPixelSize())
+                               .SetLayerData({ image.GetRawDataPtr() }, static_cast<uint64_t>(image.GetSize()) * image.GetPixelSize())
                                .SetLayout(GFX_TEXTURE_LAYOUT_SHADER_READ_ONLY)
                                .BuildAsync();
         return imageBuffer;
@@ -208,10 +219,30 @@ FontMetadataFactory::FontMetadataFactory(prev::core::device::Device& device)
 
 std::unique_ptr<FontMetadata> FontMetadataFactory::CreateFontMetadata(const std::string& metadataFilePath, const std::string& textureFilePath, const float aspectRatio, const float lineHeight, const int extraPadding) const
 {
-    const FontMetadataState metaDataState{ ParseFontMetadataFile(metadataFilePath) };
+    auto& assetLoader{ m_device.GetAssetLoader() };
+
+    // the texture is only needed to draw, the characters are needed right away to build the text meshes
+    const auto imageBuffer{ assetLoader.Load<prev::render::buffer::ImageBuffer, prev::render::image::IImage>(
+        "font#" + textureFilePath, prev::core::AssetPriority::NORMAL,
+        [textureFilePath](prev::core::AssetLoadContext& context) {
+            return CreateImage(textureFilePath, context);
+        },
+        [device = &m_device](prev::render::image::IImage& image, prev::core::AssetLoadContext&) {
+            return CreateImageBuffer(*device, image);
+        }) };
+
+    const auto metaDataStateHandle{ assetLoader.Load<FontMetadataState>("font#" + metadataFilePath, prev::core::AssetPriority::HIGH, [metadataFilePath](prev::core::AssetLoadContext& context) {
+        const std::string allText{ context.Measure(prev::core::AssetLoadStage::Read, [&]() { return prev::util::file::ReadTextFile(metadataFilePath); }) };
+        return std::make_shared<FontMetadataState>(context.Measure(prev::core::AssetLoadStage::Decode, [&]() { return ParseFontMetadata(allText); }));
+    }) };
+    const auto metaDataStatePtr{ assetLoader.Wait(metaDataStateHandle) };
+    if (!metaDataStatePtr) {
+        throw std::runtime_error("Font - Could not load metadata: " + metadataFilePath);
+    }
+
+    const FontMetadataState& metaDataState{ *metaDataStatePtr };
     const glm::vec2 perPixelSize{ FindPerPixelSizes(metaDataState, aspectRatio, lineHeight) };
 
-    const std::shared_ptr<prev::render::buffer::ImageBuffer> imageBuffer{ CreateImageBuffer(m_device, textureFilePath) };
     const std::map<int, Character> characters{ CreateCharacters(metaDataState, perPixelSize, extraPadding) };
     const float spaceWidth{ FindSpaceWidth(metaDataState, perPixelSize) };
 
@@ -14,6 +14,16 @@ Material::Material(const MaterialProperties& materialProps, const std::vector<st
     : m_color(materialProps.color)
     , m_shineDamper(materialProps.shineDamper)
     , m_reflectivity(materialProps.reflectivity)
+{
+    for (const auto& image : images) {
+        m_images.push_back(prev::core::AssetHandle<prev::render::buffer::ImageBuffer>::FromValue(image));
+    }
+}
+
+Material::Material(const MaterialProperties& materialProps, const std::vector<prev::core::AssetHandle<prev::render::buffer::ImageBuffer>>& images)
+    : m_color(materialProps.color)
+    , m_shineDamper(materialProps.shineDamper)
+    , m_reflectivity(materialProps.reflectivity)
     , m_images(images)
 {
 }
@@ -23,7 +33,7 @@ std::shared_ptr<prev::render::buffer::ImageBuffer> Material::GetImageBuffer(uint
     if (index >= m_images.size()) {
         throw std::runtime_error("Invalid image buffer index: " + std::to_string(index));
     }
-    return m_images[index];
+    return m_images[index].Get();
 }
 
 bool Material::HasImageBuffer(uint32_t index)
@@ -33,7 +43,13 @@ bool Material::HasImageBuffer(uint32_t index)
 
 bool Material::IsReady() const
 {
-    for (const auto& image : m_images) {
+    for (const auto& imageHandle : m_images) {
+        // a failed load leaves its slot empty like a missing image
+        if (!imageHandle.IsDone()) {
+            return false;
+        }
+
+        const auto image{ imageHandle.Get() };
         if (image && !image->IsReady()) {
             return false;
         }
@@ -41,6 +57,13 @@ bool Material::IsReady() const
     return true;
 }
 
+void Material::RaiseLoadPriority(const prev::core::AssetPriority priority)
+{
+    for (const auto& imageHandle : m_images) {
+        imageHandle.RaisePriority(priority);
+    }
+}
+
 float Material::GetShineDamper() const
 {
     return m_shineDamper;
@@ -3,6 +3,8 @@
 
 #include "../IMaterial.h"
 
+#include <prev/core/AssetLoader.h>
+
 #include <vector>
 
 namespace prev_test::render::material {
@@ -12,6 +14,9 @@ public:
 
     Material(const MaterialProperties& materialProps, const std::vector<std::shared_ptr<prev::render::buffer::ImageBuffer>>& images);
 
+    // Images still being loaded by the asset loader; the material is not ready until all of them are done.
+    Material(const MaterialProperties& materialProps, const std::vector<prev::core::AssetHandle<prev::render::buffer::ImageBuffer>>& images);
+
     virtual ~Material() = default;
 
 public:
@@ -21,6 +26,8 @@ public:
 
     bool IsReady() const override;
 
+    void RaiseLoadPriority(const prev::core::AssetPriority priority) override;
+
     float GetShineDamper() const override;
 
     float GetReflectivity() const override;
@@ -46,7 +53,7 @@ private:
 
     float m_reflectivity{ 1.0f };
 
-    std::vector<std::shared_ptr<prev::render::buffer::ImageBuffer>> m_images;
+    std::vector<prev::core::AssetHandle<prev::render::buffer::ImageBuffer>> m_images;
 
     uint32_t m_atlasNumberOfRows{ 1 };
 
@@ -4,18 +4,31 @@
 #include "../util/assimp/AssimpSceneLoader.h"
 
 #include <prev/common/Cache.h>
+#include <prev/common/Logger.h>
+#include <prev/common/ThreadPool.h>
 #include <prev/render/buffer/ImageBufferBuilder.h>
 #include <prev/render/image/ImageFactory.h>
+#include <prev/render/image/Ktx2Serializer.h>
+#include <prev/render/image/TextureCooker.h>
 #include <prev/util/ColorSpace.h>
 #include <prev/util/GfxUtils.h>
+#include <prev/util/Utils.h>
 
+#include <cstdio>
+#include <filesystem>
+#include <optional>
 #include <stdexcept>
 
 namespace prev_test::render::material {
 namespace {
+    // decoded images are large, keep only the recently used ones around (the caches are shared with the asset loader threads)
     using ImageCache = prev::common::Cache<std::string, std::shared_ptr<prev::render::image::IImage>>;
 
-    static ImageCache s_imagesCache{};
+    static ImageCache s_imagesCache{ 256 * 1024 * 1024, [](const std::shared_ptr<prev::render::image::IImage>& image) { return image ? static_cast<size_t>(image->GetSize()) * image->GetPixelSize() : 0; } };
+
+    using CompressedImageCache = prev::common::Cache<std::string, std::shared_ptr<prev::render::image::CompressedImage>>;
+
+    static CompressedImageCache s_compressedImagesCache{ 128 * 1024 * 1024, [](const std::shared_ptr<prev::render::image::CompressedImage>& image) { return image ? image->GetSize() : 0; } };
 
     std::shared_ptr<prev::render::image::IImage> CreateImage(const aiTexture& texture)
     {
@@ -23,16 +36,30 @@ namespace {
         return image;
     }
 
-    std::shared_ptr<prev::render::image::IImage> CreateImage(const std::string& textureFilename)
+    std::shared_ptr<prev::render::image::IImage> CreateImage(const std::string& textureFilename, const std::vector<char>& data, prev::core::AssetLoadContext& context)
     {
-        std::shared_ptr<prev::render::image::IImage> image;
-        if (auto optValue = s_imagesCache.Find(textureFilename)) {
-            image = *optValue;
-        } else {
-            image = prev::render::image::ImageFactory{}.CreateImage(textureFilename);
-            s_imagesCache.Add(textureFilename, image);
+        return s_imagesCache.GetOrCreate(textureFilename, [&]() -> std::shared_ptr<prev::render::image::IImage> {
+            return context.Measure(prev::core::AssetLoadStage::Decode, [&]() { return prev::render::image::ImageFactory{}.CreateImageFromMemory(reinterpret_cast<const uint8_t*>(data.data()), static_cast<uint32_t>(data.size())); });
+        });
+    }
+
+    std::shared_ptr<prev::render::image::IImage> CreateImage(const std::string& textureFilename, prev::core::AssetLoadContext& context)
+    {
+        if (!prev::util::file::Exists(textureFilename)) {
+            LOGE("Image: File not found: %s", textureFilename.c_str());
+            return nullptr;
         }
-        return image;
+
+        return s_imagesCache.GetOrCreate(textureFilename, [&]() -> std::shared_ptr<prev::render::image::IImage> {
+            const auto data{ context.Measure(prev::core::AssetLoadStage::Read, [&]() { return prev::util::file::ReadBinaryFile(textureFilename); }) };
+            return context.Measure(prev::core::AssetLoadStage::Decode, [&]() { return prev::render::image::ImageFactory{}.CreateImageFromMemory(reinterpret_cast<const uint8_t*>(data.data()), static_cast<uint32_t>(data.size())); });
+        });
+    }
+
+    std::shared_ptr<prev::render::image::IImage> CreateImage(const std::string& textureFilename)
+    {
+        prev::core::AssetLoadContext context{};
+        return CreateImage(textureFilename, context);
     }
 
     std::shared_ptr<prev::render::image::IImage> CreateModelImage(const aiScene& scene, const aiMaterial& material, const aiTextureType textureType)
@@ -85,11 +112,243 @@ namespace {
         return async ? builder.BuildAsync() : builder.Build();
     }
 
+    std::shared_ptr<prev::render::buffer::ImageBuffer> CreateImageBuffer(const prev::core::device::Device& device, const prev::render::image::CompressedImage& image, const bool srgb, const bool async = false)
+    {
+        // levels are uploaded as rows of 4x4 blocks
+        std::vector<prev::render::buffer::ImageBufferBuilder::MipLevelData> levels{};
+        for (uint32_t level = 0; level < image.GetLevelCount(); ++level) {
+            const auto& levelData{ image.GetLevel(level) };
+            levels.push_back({ levelData.data.data(), prev::render::image::CompressedImage::GetBlockCount(levelData.width) * prev::render::image::CompressedImage::GetBlockByteSize(image.GetFormat()), prev::render::image::CompressedImage::GetBlockCount(levelData.height) });
+        }
+
+        auto builder = prev::render::buffer::ImageBufferBuilder{ device, device.GetQueue(prev::core::device::QueueType::GRAPHICS) }
+                           .SetExtent({ image.GetWidth(), image.GetHeight(), 1 })
+                           .SetFormat(prev::util::gfx::ToImageFormat(image.GetFormat(), srgb))
+                           .SetType(GFX_TEXTURE_TYPE_2D)
+                           .SetUsageFlags(GFX_TEXTURE_USAGE_COPY_DST | GFX_TEXTURE_USAGE_TEXTURE_BINDING)
+                           .SetMipLevelData({ levels })
+                           .SetViewType(GFX_TEXTURE_VIEW_TYPE_2D)
+                           .SetLayout(GFX_TEXTURE_LAYOUT_SHADER_READ_ONLY);
+        return async ? builder.BuildAsync() : builder.Build();
+    }
+
+    std::optional<prev::render::image::TextureCompressionFamily> FindTextureCompressionFamily(const prev::core::device::Device& device)
+    {
+        if (device.HasExtension(GFX_DEVICE_EXTENSION_TEXTURE_COMPRESSION_BC)) {
+            return prev::render::image::TextureCompressionFamily::BC;
+        }
+        if (device.HasExtension(GFX_DEVICE_EXTENSION_TEXTURE_COMPRESSION_ETC2)) {
+            return prev::render::image::TextureCompressionFamily::ETC2;
+        }
+        return {};
+    }
+
+    prev::common::ThreadPool& GetCookingThreadPool()
+    {
+        static prev::common::ThreadPool threadPool{ std::max(std::thread::hardware_concurrency(), 1u) };
+        return threadPool;
+    }
+
+    bool HasTranslucentPixels(const prev::render::image::IImage& image)
+    {
+        if (image.GetChannels() != 4) {
+            return false;
+        }
+
+        const uint8_t* data{ image.GetRawDataPtr() };
+        for (uint32_t i = 0; i < image.GetSize(); ++i) {
+            if (data[i * 4 + 3] != 255) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // FNV-1a
+    uint64_t HashBytes(const std::vector<char>& data)
+    {
+        uint64_t hash{ 14695981039346656037ull };
+        for (const auto byte : data) {
+            hash ^= static_cast<uint8_t>(byte);
+            hash *= 1099511628211ull;
+        }
+        return hash;
+    }
+
+    // The asset directory may be read only or packaged, cooked images go to the temp directory instead.
+    // Empty when there is no writable one - the textures are cooked on every run then.
+    const std::string& GetCookedImageDirectory()
+    {
+        static const std::string directory{ []() -> std::string {
+            std::error_code error{};
+            const auto path{ std::filesystem::temp_directory_path(error) / "PreVEngine" / "CookedTextures" };
+            if (error) {
+                LOGW("Cooked textures: No temp directory available: %s", error.message().c_str());
+                return {};
+            }
+
+            std::filesystem::create_directories(path, error);
+            if (error) {
+                LOGW("Cooked textures: Could not create directory %s: %s", path.string().c_str(), error.message().c_str());
+                return {};
+            }
+            return path.string();
+        }() };
+        return directory;
+    }
+
+    // The stored cooked image is keyed by everything its content depends on - the source content, the cooker version,
+    // compression family, usage and color space. The family, usage and source alpha select the block format.
+    std::string GetCookedImageFilename(const uint64_t sourceHash, const prev::render::image::TextureUsage usage, const prev::render::image::TextureCompressionFamily family, const bool srgb)
+    {
+        char name[96];
+        std::snprintf(name, sizeof(name), "%016llx_v%u_u%d_f%d%s.ktx2", static_cast<unsigned long long>(sourceHash), prev::render::image::TextureCooker::VERSION, static_cast<int>(usage), static_cast<int>(family), srgb ? "_srgb" : "");
+        return (std::filesystem::path(GetCookedImageDirectory()) / name).string();
+    }
+
+    // Cooked images are loaded from the cache directory when present, otherwise cooked once and stored there.
+    std::shared_ptr<prev::render::image::CompressedImage> CreateCompressedImage(const std::string& textureFilename, const prev::render::image::TextureUsage usage, const prev::render::image::TextureCompressionFamily family, const bool srgb, prev::core::AssetLoadContext& context)
+    {
+        if (!prev::util::file::Exists(textureFilename)) {
+            LOGE("Image: File not found: %s", textureFilename.c_str());
+            return nullptr;
+        }
+
+        const std::string key{ textureFilename + "#" + std::to_string(static_cast<int>(usage)) + "#" + std::to_string(static_cast<int>(family)) + (srgb ? "#srgb" : "") };
+        return s_compressedImagesCache.GetOrCreate(key, [&]() -> std::shared_ptr<prev::render::image::CompressedImage> {
+            const auto sourceData{ context.Measure(prev::core::AssetLoadStage::Read, [&]() { return prev::util::file::ReadBinaryFile(textureFilename); }) };
+            const std::string cookedFilename{ GetCookedImageDirectory().empty() ? std::string{} : GetCookedImageFilename(HashBytes(sourceData), usage, family, srgb) };
+
+            if (!cookedFilename.empty() && prev::util::file::Exists(cookedFilename)) {
+                const auto data{ context.Measure(prev::core::AssetLoadStage::Read, [&]() { return prev::util::file::ReadBinaryFile(cookedFilename); }) };
+                if (auto compressedImage = context.Measure(prev::core::AssetLoadStage::Decode, [&]() { return prev::render::image::Ktx2Serializer{}.Deserialize(reinterpret_cast<const uint8_t*>(data.data()), data.size()); })) {
+                    if (compressedImage->IsSrgb() == srgb) {
+                        return compressedImage;
+                    }
+                }
+                LOGW("Cooked texture: Invalid %s, cooking again", cookedFilename.c_str());
+            }
+
+            const auto image{ CreateImage(textureFilename, sourceData, context) };
+            if (!image) {
+                return nullptr;
+            }
+
+            const auto format{ prev::render::image::TextureCooker::SelectFormat(family, usage, HasTranslucentPixels(*image)) };
+            std::shared_ptr<prev::render::image::CompressedImage> compressedImage{ context.Measure(prev::core::AssetLoadStage::Cook, [&]() { return prev::render::image::TextureCooker{}.Cook(*image, usage, format, srgb, true, GetCookingThreadPool()); }) };
+            if (!compressedImage) {
+                return nullptr;
+            }
+
+            LOGI("Cooked texture: %s -> %s (%u -> %u bytes)", textureFilename.c_str(), cookedFilename.c_str(), image->GetSize() * image->GetPixelSize(), static_cast<uint32_t>(compressedImage->GetSize()));
+            if (!cookedFilename.empty()) {
+                prev::render::image::Ktx2Serializer{}.Save(*compressedImage, cookedFilename);
+            }
+            return compressedImage;
+        });
+    }
+
+    // The decoded (or cooked) texture waiting for its upload.
+    struct TextureData {
+        std::shared_ptr<prev::render::image::IImage> image{};
+
+        std::shared_ptr<prev::render::image::CompressedImage> compressedImage{};
+    };
+
+    std::shared_ptr<TextureData> CreateTextureData(const prev::core::device::Device& device, const std::string& textureFilename, const prev::render::image::TextureUsage usage, const bool colorManaged, const bool compressed, prev::core::AssetLoadContext& context)
+    {
+        const bool isColor{ usage == prev::render::image::TextureUsage::COLOR };
+        if (compressed) {
+            if (const auto family = FindTextureCompressionFamily(device)) {
+                if (auto compressedImage = CreateCompressedImage(textureFilename, usage, *family, isColor && colorManaged, context)) {
+                    return std::make_shared<TextureData>(TextureData{ nullptr, std::move(compressedImage) });
+                }
+            }
+        }
+
+        if (auto image = CreateImage(textureFilename, context)) {
+            return std::make_shared<TextureData>(TextureData{ std::move(image), nullptr });
+        }
+        return nullptr;
+    }
+
+    std::shared_ptr<prev::render::buffer::ImageBuffer> CreateTextureImageBuffer(const prev::core::device::Device& device, const TextureData& textureData, const prev::render::image::TextureUsage usage, const bool colorManaged, const bool async)
+    {
+        const bool isColor{ usage == prev::render::image::TextureUsage::COLOR };
+        if (textureData.compressedImage) {
+            return CreateImageBuffer(device, *textureData.compressedImage, isColor && colorManaged, async);
+        }
+        return CreateImageBuffer(device, { textureData.image }, ImageBufferViewType::REGULAR, isColor, true, colorManaged, async);
+    }
+
+    // Synchronous textures are ready right away, async ones are read, decoded and cooked by the device's asset loader
+    // and uploaded through the deferred resource uploader - nothing of it runs on the calling thread.
+    prev::core::AssetHandle<prev::render::buffer::ImageBuffer> CreateTextureImageBuffer(const prev::core::device::Device& device, const std::string& textureFilename, const prev::render::image::TextureUsage usage, const bool colorManaged, const bool compressed, const bool async = false)
+    {
+        if (!async) {
+            prev::core::AssetLoadContext context{};
+            const auto textureData{ CreateTextureData(device, textureFilename, usage, colorManaged, compressed, context) };
+            return prev::core::AssetHandle<prev::render::buffer::ImageBuffer>::FromValue(textureData ? CreateTextureImageBuffer(device, *textureData, usage, colorManaged, false) : nullptr);
+        }
+
+        const std::string key{ textureFilename + "#" + std::to_string(static_cast<int>(usage)) + (colorManaged ? "#managed" : "") + (compressed ? "#compressed" : "") };
+        return device.GetAssetLoader().Load<prev::render::buffer::ImageBuffer, TextureData>(
+            key, prev::core::AssetPriority::NORMAL,
+            [&device, textureFilename, usage, colorManaged, compressed](prev::core::AssetLoadContext& context) {
+                return CreateTextureData(device, textureFilename, usage, colorManaged, compressed, context);
+            },
+            [&device, usage, colorManaged](TextureData& textureData, prev::core::AssetLoadContext&) {
+                return CreateTextureImageBuffer(device, textureData, usage, colorManaged, true);
+            });
+    }
+
+    // The decoded faces of a cube map waiting for their upload.
+    struct CubeMapData {
+        std::vector<std::shared_ptr<prev::render::image::IImage>> images{};
+    };
+
+    std::shared_ptr<CubeMapData> CreateCubeMapData(const std::vector<std::string>& sidePaths, prev::core::AssetLoadContext& context)
+    {
+        auto cubeMapData{ std::make_shared<CubeMapData>() };
+        for (const auto& faceFilePath : sidePaths) {
+            auto image{ CreateImage(faceFilePath, context) };
+            if (!image) {
+                return nullptr;
+            }
+            cubeMapData->images.emplace_back(std::move(image));
+        }
+        return cubeMapData;
+    }
+
+    // Same as for the textures - async cube maps are decoded by the asset loader and uploaded deferred.
+    prev::core::AssetHandle<prev::render::buffer::ImageBuffer> CreateCubeMapImageBuffer(const prev::core::device::Device& device, const std::vector<std::string>& sidePaths, const bool colorManaged, const bool async)
+    {
+        if (!async) {
+            prev::core::AssetLoadContext context{};
+            const auto cubeMapData{ CreateCubeMapData(sidePaths, context) };
+            return prev::core::AssetHandle<prev::render::buffer::ImageBuffer>::FromValue(cubeMapData ? CreateImageBuffer(device, cubeMapData->images, ImageBufferViewType::CUBE_MAP, true, true, colorManaged, false) : nullptr);
+        }
+
+        std::string key{ "cubemap" };
+        for (const auto& faceFilePath : sidePaths) {
+            key += "#" + faceFilePath;
+        }
+        key += colorManaged ? "#managed" : "";
+        return device.GetAssetLoader().Load<prev::render::buffer::ImageBuffer, CubeMapData>(
+            key, prev::core::AssetPriority::NORMAL,
+            [sidePaths](prev::core::AssetLoadContext& context) {
+                return CreateCubeMapData(sidePaths, context);
+            },
+            [&device, colorManaged](CubeMapData& cubeMapData, prev::core::AssetLoadContext&) {
+                return CreateImageBuffer(device, cubeMapData.images, ImageBufferViewType::CUBE_MAP, true, true, colorManaged, true);
+            });
+    }
 } // namespace
 
-MaterialFactory::MaterialFactory(prev::core::device::Device& device, bool colorManaged)
+MaterialFactory::MaterialFactory(prev::core::device::Device& device, bool colorManaged, bool compressedTextures)
     : m_device{ device }
     , m_colorManaged{ colorManaged }
+    , m_compressedTextures{ compressedTextures }
 {
 }
 
@@ -100,49 +359,37 @@ std::unique_ptr<prev_test::render::IMaterial> MaterialFactory::Create(const Mate
 
 std::unique_ptr<prev_test::render::IMaterial> MaterialFactory::Create(const MaterialProperties& materialProps, const std::string& colorImagePath, bool async) const
 {
-    auto image{ CreateImage(colorImagePath) };
-    auto imageBuffer{ CreateImageBuffer(m_device, { image }, ImageBufferViewType::REGULAR, true, true, m_colorManaged, async) };
+    auto imageBuffer{ CreateTextureImageBuffer(m_device, colorImagePath, prev::render::image::TextureUsage::COLOR, m_colorManaged, m_compressedTextures, async) };
 
-    return std::make_unique<prev_test::render::material::Material>(materialProps, std::vector<std::shared_ptr<prev::render::buffer::ImageBuffer>>{ imageBuffer });
+    return std::make_unique<prev_test::render::material::Material>(materialProps, std::vector<prev::core::AssetHandle<prev::render::buffer::ImageBuffer>>{ imageBuffer });
 }
 
 std::unique_ptr<prev_test::render::IMaterial> MaterialFactory::Create(const MaterialProperties& materialProps, const std::string& colorImagePath, const std::string& normalMapPath, bool async) const
 {
-    auto image{ CreateImage(colorImagePath) };
-    auto imageBuffer{ CreateImageBuffer(m_device, { image }, ImageBufferViewType::REGULAR, true, true, m_colorManaged, async) };
+    auto imageBuffer{ CreateTextureImageBuffer(m_device, colorImagePath, prev::render::image::TextureUsage::COLOR, m_colorManaged, m_compressedTextures, async) };
 
-    auto normalImage{ CreateImage(normalMapPath) };
-    auto normalImageBuffer{ CreateImageBuffer(m_device, { normalImage }, ImageBufferViewType::REGULAR, false, true, m_colorManaged, async) };
+    auto normalImageBuffer{ CreateTextureImageBuffer(m_device, normalMapPath, prev::render::image::TextureUsage::NORMAL_MAP, m_colorManaged, m_compressedTextures, async) };
 
-    return std::make_unique<prev_test::render::material::Material>(materialProps, std::vector<std::shared_ptr<prev::render::buffer::ImageBuffer>>{ imageBuffer, normalImageBuffer });
+    return std::make_unique<prev_test::render::material::Material>(materialProps, std::vector<prev::core::AssetHandle<prev::render::buffer::ImageBuffer>>{ imageBuffer, normalImageBuffer });
 }
 
 std::unique_ptr<prev_test::render::IMaterial> MaterialFactory::Create(const MaterialProperties& materialProps, const std::string& colorImagePath, const std::string& normalMapPath, const std::string& heightMapPath, bool async) const
 {
-    auto image{ CreateImage(colorImagePath) };
-    auto imageBuffer{ CreateImageBuffer(m_device, { image }, ImageBufferViewType::REGULAR, true, true, m_colorManaged, async) };
+    auto imageBuffer{ CreateTextureImageBuffer(m_device, colorImagePath, prev::render::image::TextureUsage::COLOR, m_colorManaged, m_compressedTextures, async) };
 
-    auto normalImage{ CreateImage(normalMapPath) };
-    auto normalImageBuffer{ CreateImageBuffer(m_device, { normalImage }, ImageBufferViewType::REGULAR, false, true, m_colorManaged, async) };
+    auto normalImageBuffer{ CreateTextureImageBuffer(m_device, normalMapPath, prev::render::image::TextureUsage::NORMAL_MAP, m_colorManaged, m_compressedTextures, async) };
 
-    auto heightImage{ CreateImage(heightMapPath) };
-    auto heightImageBuffer{ CreateImageBuffer(m_device, { heightImage }, ImageBufferViewType::REGULAR, false, true, m_colorManaged, async) };
+    // the third texture is sampled by the cone step mapping shaders - height in R, cone ratio in G
+    auto heightImageBuffer{ CreateTextureImageBuffer(m_device, heightMapPath, prev::render::image::TextureUsage::CONE_MAP, m_colorManaged, m_compressedTextures, async) };
 
-    return std::make_unique<prev_test::render::material::Material>(materialProps, std::vector<std::shared_ptr<prev::render::buffer::ImageBuffer>>{ imageBuffer, normalImageBuffer, heightImageBuffer });
+    return std::make_unique<prev_test::render::material::Material>(materialProps, std::vector<prev::core::AssetHandle<prev::render::buffer::ImageBuffer>>{ imageBuffer, normalImageBuffer, heightImageBuffer });
 }
 
 std::unique_ptr<prev_test::render::IMaterial> MaterialFactory::CreateCubeMap(const MaterialProperties& materialProps, const std::vector<std::string>& sidePaths, bool async) const
 {
-    prev::render::image::ImageFactory imageFactory{};
-
-    std::vector<std::shared_ptr<prev::render::image::IImage>> images{};
-    for (const auto& faceFilePath : sidePaths) {
-        images.emplace_back(imageFactory.CreateImage(faceFilePath));
-    }
-
-    auto cubeMapImageBuffer{ CreateImageBuffer(m_device, images, ImageBufferViewType::CUBE_MAP, true, true, m_colorManaged, async) };
+    auto cubeMapImageBuffer{ CreateCubeMapImageBuffer(m_device, sidePaths, m_colorManaged, async) };
 
-    return std::make_unique<prev_test::render::material::Material>(materialProps, std::vector<std::shared_ptr<prev::render::buffer::ImageBuffer>>{ std::move(cubeMapImageBuffer) });
+    return std::make_unique<prev_test::render::material::Material>(materialProps, std::vector<prev::core::AssetHandle<prev::render::buffer::ImageBuffer>>{ cubeMapImageBuffer });
 }
 
 std::vector<std::shared_ptr<prev_test::render::IMaterial>> MaterialFactory::Create(const std::string& modelPath, bool async) const
@@ -11,15 +11,17 @@
 namespace prev_test::render::material {
 class MaterialFactory final {
 public:
-    MaterialFactory(prev::core::device::Device& device, bool colorManaged);
+    // With compressedTextures, textures loaded by path are block compressed when the device supports it - cooked on
+    // the first run and stored next to the source as .ktx2. Normal maps then keep only their X and Y.
+    MaterialFactory(prev::core::device::Device& device, bool colorManaged, bool compressedTextures = true);
 
     ~MaterialFactory() = default;
 
 public:
     std::unique_ptr<prev_test::render::IMaterial> Create(const MaterialProperties& materialProps) const;
 
-    // When async is true, the color texture is uploaded asynchronously (see ImageBufferBuilder::BuildAsync):
-    // the material's image buffer is not ready until a later frame, and renderers must skip it until then.
+    // When async is true, the textures are loaded by the device's asset loader and uploaded asynchronously (see
+    // ImageBufferBuilder::BuildAsync): the material is not ready until a later frame, and renderers must skip it until then.
     std::unique_ptr<prev_test::render::IMaterial> Create(const MaterialProperties& materialProps, const std::string& colorImagePath, bool async = false) const;
 
     std::unique_ptr<prev_test::render::IMaterial> Create(const MaterialProperties& materialProps, const std::string& colorImagePath, const std::string& normalMapPath, bool async = false) const;
@@ -34,6 +36,8 @@ private:
     prev::core::device::Device& m_device;
 
     const bool m_colorManaged;
+
+    const bool m_compressedTextures;
 };
 } // namespace prev_test::render::material
 
@@ -7,11 +7,13 @@
 #include "../util/assimp/AssimpGlmConvertor.h"
 #include "../util/assimp/AssimpSceneLoader.h"
 
+#include <prev/common/Logger.h>
 #include <prev/util/Utils.h>
 
 #include <assimp/scene.h>
 
 #include <map>
+#include <stdexcept>
 
 namespace prev_test::render::mesh {
 namespace {
@@ -195,22 +197,45 @@ namespace {
         }
         return { verticesBuffer, indices, meshParts };
     }
+
+    std::shared_ptr<prev_test::render::IMesh> CreateMesh(const std::string& modelPath, const prev::common::FlagSet<prev_test::render::mesh::ModelMeshFactory::CreateFlags>& flags, prev::core::AssetLoadContext& context)
+    {
+        Assimp::Importer importer{};
+        const aiScene* scene;
+
+        prev_test::render::util::assimp::AssimpSceneLoader assimpSceneLoader{};
+        if (!context.Measure(prev::core::AssetLoadStage::Decode, [&]() { return assimpSceneLoader.LoadScene(modelPath, importer, scene); })) {
+            LOGE("Model: Could not load model: %s", modelPath.c_str());
+            return nullptr;
+        }
+
+        return context.Measure(prev::core::AssetLoadStage::Cook, [&]() {
+            const auto vertexLayout{ GetVertexLayout(flags) };
+            const auto nodeHierarchy{ ReadNodeHierarchy(*scene) };
+            const auto [vertexDataBuffer, indices, meshParts]{ ReadMeshes(*scene, flags) };
+            return std::make_shared<Mesh>(vertexLayout, vertexDataBuffer, indices, nodeHierarchy, meshParts);
+        });
+    }
 } // namespace
 
-std::unique_ptr<prev_test::render::IMesh> ModelMeshFactory::Create(const std::string& modelPath, const prev::common::FlagSet<CreateFlags>& flags) const
+ModelMeshFactory::ModelMeshFactory(const prev::core::device::Device& device)
+    : m_device{ device }
 {
-    Assimp::Importer importer{};
-    const aiScene* scene;
+}
 
-    prev_test::render::util::assimp::AssimpSceneLoader assimpSceneLoader{};
-    if (!assimpSceneLoader.LoadScene(modelPath, importer, scene)) {
-        throw std::runtime_error("Model - Could not load model: " + modelPath);
-    }
+std::shared_ptr<prev_test::render::IMesh> ModelMeshFactory::Create(const std::string& modelPath, const prev::common::FlagSet<CreateFlags>& flags) const
+{
+    const std::string key{ modelPath + ((flags & CreateFlags::ANIMATION) ? "#animation" : "") + ((flags & CreateFlags::TANGENT_BITANGENT) ? "#tangents" : "") };
 
-    const auto vertexLayout{ GetVertexLayout(flags) };
-    const auto nodeHierarchy{ ReadNodeHierarchy(*scene) };
-    const auto [vertexDataBuffer, indices, meshParts]{ ReadMeshes(*scene, flags) };
+    auto& assetLoader{ m_device.GetAssetLoader() };
+    const auto meshHandle{ assetLoader.Load<prev_test::render::IMesh>(key, prev::core::AssetPriority::HIGH, [modelPath, flags](prev::core::AssetLoadContext& context) {
+        return CreateMesh(modelPath, flags, context);
+    }) };
 
-    return std::make_unique<Mesh>(vertexLayout, vertexDataBuffer, indices, nodeHierarchy, meshParts);
+    auto mesh{ assetLoader.Wait(meshHandle) };
+    if (!mesh) {
+        throw std::runtime_error("Model - Could not load model: " + modelPath);
+    }
+    return mesh;
 }
 } // namespace prev_test::render::mesh
\ No newline at end of file
@@ -4,6 +4,7 @@
 #include "../IMesh.h"
 
 #include <prev/common/FlagSet.h>
+#include <prev/core/device/Device.h>
 
 #include <memory>
 
@@ -17,7 +18,17 @@ public:
     };
 
 public:
-    std::unique_ptr<prev_test::render::IMesh> Create(const std::string& modelPath, const prev::common::FlagSet<CreateFlags>& flags = prev::common::FlagSet<ModelMeshFactory::CreateFlags>{}) const;
+    ModelMeshFactory(const prev::core::device::Device& device);
+
+    ~ModelMeshFactory() = default;
+
+public:
+    // Read and built by the device's asset loader - requests for the same model and flags share one mesh while it loads.
+    // Blocks until the mesh is there, the model buffers are created from it right away.
+    std::shared_ptr<prev_test::render::IMesh> Create(const std::string& modelPath, const prev::common::FlagSet<CreateFlags>& flags = prev::common::FlagSet<ModelMeshFactory::CreateFlags>{}) const;
+
+private:
+    const prev::core::device::Device& m_device;
 };
 
 } // namespace prev_test::render::mesh
@@ -0,0 +1,43 @@
+#ifndef __DRAW_STATISTICS_H__
+#define __DRAW_STATISTICS_H__
+
+#include <prev/common/pattern/Singleton.h>
+
+#include <atomic>
+#include <cstdint>
+
+namespace prev_test::render::renderer {
+// Draw calls recorded by the renderers, from any recording thread.
+class DrawStatistics final : public prev::common::pattern::Singleton<DrawStatistics> {
+public:
+    ~DrawStatistics() = default;
+
+public:
+    void AddDrawCall()
+    {
+        m_drawCallCount.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    // Draw calls since the last reset.
+    uint64_t GetDrawCallCount() const
+    {
+        return m_drawCallCount.load(std::memory_order_relaxed);
+    }
+
+    uint64_t Reset()
+    {
+        return m_drawCallCount.exchange(0, std::memory_order_relaxed);
+    }
+
+private:
+    friend class prev::common::pattern::Singleton<DrawStatistics>;
+
+private:
+    DrawStatistics() = default;
+
+private:
+    std::atomic<uint64_t> m_drawCallCount{};
+};
+} // namespace prev_test::render::renderer
+
+#endif // !__DRAW_STATISTICS_H__
@@ -0,0 +1,20 @@
+#ifndef __IVISIBILITY_RESULT_H__
+#define __IVISIBILITY_RESULT_H__
+
+#include <prev/scene/graph/ISceneNode.h>
+
+#include <cstdint>
+
+namespace prev_test::render::renderer {
+// Culling output of one pass as the renderers see it, whoever culled the scene.
+class IVisibilityResult {
+public:
+    // Whether the node passed in any of the views - nodes the culling did not cover are reported visible.
+    virtual bool IsVisible(const uint32_t firstView, const uint32_t viewCount, const prev::scene::graph::ISceneNode& node) const = 0;
+
+public:
+    virtual ~IVisibilityResult() = default;
+};
+} // namespace prev_test::render::renderer
+
+#endif // !__IVISIBILITY_RESULT_H__
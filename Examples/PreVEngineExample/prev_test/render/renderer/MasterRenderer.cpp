@@ -16,6 +16,7 @@
 #include "normal/NormalMappedRenderer.h"
 #include "normal/TexturelessRenderer.h"
 #include "particle/ParticlesRenderer.h"
+#include "particle/ParticlesSimulationRenderer.h"
 #include "shadow/AnimationBumpMappedShadowsRenderer.h"
 #include "shadow/AnimationShadowsRenderer.h"
 #include "shadow/BumpMappedShadowsRenderer.h"
@@ -37,6 +38,7 @@
 #include "../../Tags.h"
 #include "../../component/camera/ICameraComponent.h"
 #include "../../component/common/IOffScreenRenderPassComponent.h"
+#include "../../component/ray_casting/ISceneQueryComponent.h"
 #include "../../component/shadow/IShadowsComponent.h"
 #include "../../component/water/IWaterComponent.h"
 #include "../../component/water/WaterCommon.h"
@@ -56,6 +58,11 @@ MasterRenderer::MasterRenderer(prev::core::device::Device& device, prev::render:
 
 void MasterRenderer::Init()
 {
+#ifdef ENABLE_PROFILING
+    m_gpuProfiler = std::make_unique<prev::profile::GpuProfiler>(m_device, m_swapchainImageCount);
+#endif
+
+    InitCompute();
     InitDefault();
     InitDebug();
     InitShadows();
@@ -65,23 +72,59 @@ void MasterRenderer::Init()
 
 prev::render::FrameSubmitSync MasterRenderer::Render(const prev::render::RenderContext& renderContext, const prev::scene::IScene& scene)
 {
+#ifdef ENABLE_PROFILING
+    m_gpuProfiler->BeginFrame(renderContext.commandEncoder);
+#endif
+
+    // shared by all the passes culled this frame, the node is recreated when the scene reloads
+    m_sceneQuery = FindSceneQuery(scene.GetRootNode());
+
+    // Compute work the passes depend on
+    {
+        PREV_PROFILE_SCOPE("RenderCompute");
+        PREV_PROFILE_GPU_SCOPE(*m_gpuProfiler, renderContext.commandEncoder, "Compute");
+        RenderCompute(renderContext, scene.GetRootNode());
+    }
+
     // Shadows render pass
-    RenderShadows(renderContext, scene.GetRootNode());
+    {
+        PREV_PROFILE_SCOPE("RenderShadows");
+        PREV_PROFILE_GPU_SCOPE(*m_gpuProfiler, renderContext.commandEncoder, "Shadows");
+        RenderShadows(renderContext, scene.GetRootNode());
+    }
 
     // Reflection
-    RenderSceneReflection(renderContext, scene.GetRootNode());
+    {
+        PREV_PROFILE_SCOPE("RenderSceneReflection");
+        PREV_PROFILE_GPU_SCOPE(*m_gpuProfiler, renderContext.commandEncoder, "Reflection");
+        RenderSceneReflection(renderContext, scene.GetRootNode());
+    }
 
     // Refraction
-    RenderSceneRefraction(renderContext, scene.GetRootNode());
+    {
+        PREV_PROFILE_SCOPE("RenderSceneRefraction");
+        PREV_PROFILE_GPU_SCOPE(*m_gpuProfiler, renderContext.commandEncoder, "Refraction");
+        RenderSceneRefraction(renderContext, scene.GetRootNode());
+    }
 
     // Default Scene Render
-    RenderScene(renderContext, scene.GetRootNode());
+    {
+        PREV_PROFILE_SCOPE("RenderScene");
+        PREV_PROFILE_GPU_SCOPE(*m_gpuProfiler, renderContext.commandEncoder, "Scene");
+        RenderScene(renderContext, scene.GetRootNode());
+    }
 
 #ifndef ANDROID
     // Debug quad with shadowMap
     // RenderDebug(renderContext, scene->GetRootNode());
 #endif
 
+#ifdef ENABLE_PROFILING
+    m_gpuProfiler->EndFrame(renderContext.commandEncoder);
+#endif
+
+    m_sceneQuery = nullptr;
+
     return {};
 }
 
@@ -92,6 +135,11 @@ void MasterRenderer::ShutDown()
     ShutDownShadows();
     ShutDownDebug();
     ShutDownDefault();
+    ShutDownCompute();
+
+#ifdef ENABLE_PROFILING
+    m_gpuProfiler.reset();
+#endif
 }
 
 void MasterRenderer::operator()(const prev::input::keyboard::KeyEvent& keyEvent)
@@ -101,11 +149,44 @@ void MasterRenderer::operator()(const prev::input::keyboard::KeyEvent& keyEvent)
             m_device.WaitIdle();
 
             ShutDown();
+            // the changed shader files get new modules anyway, this drops the ones nobody uses anymore
+            m_device.GetPipelineCache().Clear();
             Init();
         }
+#ifdef ENABLE_PROFILING
+        if (keyEvent.keyCode == prev::input::keyboard::KeyCode::KEY_F12) {
+            auto& profiler{ prev::profile::Profiler::Instance() };
+            if (profiler.IsCapturing()) {
+                profiler.EndCapture();
+                profiler.ExportChromeTrace("profile_trace.json");
+                LOGI("Profile trace written to profile_trace.json");
+            } else {
+                profiler.BeginCapture();
+                LOGI("Profile capture started");
+            }
+        }
+#endif
     }
 }
 
+void MasterRenderer::InitCompute()
+{
+    m_computeRenderers.emplace_back(std::make_unique<prev_test::render::renderer::particle::ParticlesSimulationRenderer>(m_device, m_scene));
+
+    for (auto& renderer : m_computeRenderers) {
+        renderer->Init();
+    }
+}
+
+void MasterRenderer::ShutDownCompute()
+{
+    for (auto it = m_computeRenderers.rbegin(); it != m_computeRenderers.rend(); ++it) {
+        (*it)->ShutDown();
+    }
+
+    m_computeRenderers.clear();
+}
+
 void MasterRenderer::InitDefault()
 {
     m_defaultRenderers.emplace_back(std::make_unique<prev_test::render::renderer::sky::SkyBoxRenderer>(m_device, m_defaultRenderPass, m_scene));
@@ -242,7 +323,7 @@ void MasterRenderer::InitReflection()
     m_reflectionRenderers.emplace_back(std::make_unique<prev_test::render::renderer::animation::AnimationTexturelessRenderer>(m_device, *reflectionComponent->GetRenderPass(), m_scene));
     m_reflectionRenderers.emplace_back(std::make_unique<prev_test::render::renderer::animation::AnimationNormalMappedRenderer>(m_device, *reflectionComponent->GetRenderPass(), m_scene));
     m_reflectionRenderers.emplace_back(std::make_unique<prev_test::render::renderer::animation::AnimationConeStepMappedRenderer>(m_device, *reflectionComponent->GetRenderPass(), m_scene));
-    m_reflectionRenderers.emplace_back(std::make_unique<prev_test::render::renderer::particle::ParticlesRenderer>(m_device, *reflectionComponent->GetRenderPass(), m_scene));
+    m_reflectionRenderers.emplace_back(std::make_unique<prev_test::render::renderer::particle::ParticlesRenderer>(m_device, *reflectionComponent->GetRenderPass(), m_scene, prev::scene::particle::ParticleSortMode::BUCKET));
 
     for (auto& renderer : m_reflectionRenderers) {
         renderer->Init();
@@ -283,7 +364,7 @@ void MasterRenderer::InitRefraction()
     m_refractionRenderers.emplace_back(std::make_unique<prev_test::render::renderer::animation::AnimationTexturelessRenderer>(m_device, *refractionComponent->GetRenderPass(), m_scene));
     m_refractionRenderers.emplace_back(std::make_unique<prev_test::render::renderer::animation::AnimationNormalMappedRenderer>(m_device, *refractionComponent->GetRenderPass(), m_scene));
     m_refractionRenderers.emplace_back(std::make_unique<prev_test::render::renderer::animation::AnimationConeStepMappedRenderer>(m_device, *refractionComponent->GetRenderPass(), m_scene));
-    m_refractionRenderers.emplace_back(std::make_unique<prev_test::render::renderer::particle::ParticlesRenderer>(m_device, *refractionComponent->GetRenderPass(), m_scene));
+    m_refractionRenderers.emplace_back(std::make_unique<prev_test::render::renderer::particle::ParticlesRenderer>(m_device, *refractionComponent->GetRenderPass(), m_scene, prev::scene::particle::ParticleSortMode::BUCKET));
 
     for (auto& renderer : m_refractionRenderers) {
         renderer->Init();
@@ -307,23 +388,46 @@ void MasterRenderer::ShutDownRefraction()
     m_refractionRenderers.clear();
 }
 
+void MasterRenderer::RenderCompute(const prev::render::RenderContext& renderContext, const std::shared_ptr<prev::scene::graph::ISceneNode>& root)
+{
+    for (auto& renderer : m_computeRenderers) {
+        renderer->BeginFrame(renderContext);
+        renderer->PreRender(renderContext);
+
+        TraverseScene(renderContext, root, renderer);
+
+        renderer->PostRender(renderContext);
+        renderer->EndFrame(renderContext);
+    }
+}
+
 void MasterRenderer::RenderShadows(const prev::render::RenderContext& renderContext, const std::shared_ptr<prev::scene::graph::ISceneNode>& root)
 {
     const auto shadows{ prev::scene::component::NodeComponentHelper::Find<prev_test::component::shadow::IShadowsComponent>(m_scene.GetRootNode(), { TAG_SHADOW }) };
 
+    // For WebGPU: cancel the Vulkan Y-flip so the shadow map renders with correct orientation.
+    // The lookup (GetBiasedViewProjectionMatrix) still uses the original projection, so the UVs
+    // remain consistent with the Vulkan-oriented shadow map content.
+    glm::mat4 shadowProjections[prev_test::component::shadow::CASCADES_COUNT];
+    prev::util::intersection::Frustum cascadeFrustums[prev_test::component::shadow::CASCADES_COUNT];
+    for (uint32_t cascadeIndex = 0; cascadeIndex < prev_test::component::shadow::CASCADES_COUNT; ++cascadeIndex) {
+        const auto& cascadeFrameData{ shadows->GetCascadeFrameData(cascadeIndex) };
+        shadowProjections[cascadeIndex] = AdjustProjection(cascadeFrameData.projectionMatrix);
+        cascadeFrustums[cascadeIndex] = prev::util::intersection::Frustum{ shadowProjections[cascadeIndex], cascadeFrameData.viewMatrix };
+    }
+
+    // one batched pass over the scene for all cascades, each cascade reads its own bitset row
+    auto visibility{ Cull(cascadeFrustums, prev_test::component::shadow::CASCADES_COUNT, m_shadowsVisibility) };
+
     for (uint32_t cascadeIndex = 0; cascadeIndex < prev_test::component::shadow::CASCADES_COUNT; ++cascadeIndex) {
 
         const auto& cascadeRenderData{ shadows->GetCascadeRenderData(cascadeIndex) };
         const auto& cascadeFrameData{ shadows->GetCascadeFrameData(cascadeIndex) };
 
-        // For WebGPU: cancel the Vulkan Y-flip so the shadow map renders with correct orientation.
-        // The lookup (GetBiasedViewProjectionMatrix) still uses the original projection, so the UVs
-        // remain consistent with the Vulkan-oriented shadow map content.
-        auto shadowProjection{ cascadeFrameData.projectionMatrix };
-        shadowProjection = AdjustProjection(shadowProjection);
+        visibility.firstView = cascadeIndex;
 
         const prev::render::RenderContext customRenderContextBase{ *cascadeRenderData.framebuffer, renderContext.commandEncoder, renderContext.frameInFlightIndex, { { 0, 0 }, shadows->GetExtent() } };
-        const ShadowsRenderContext customRenderContext{ customRenderContextBase, cascadeFrameData.viewMatrix, shadowProjection, cascadeIndex, prev::util::intersection::Frustum{ shadowProjection, cascadeFrameData.viewMatrix } };
+        const ShadowsRenderContext customRenderContext{ customRenderContextBase, cascadeFrameData.viewMatrix, shadowProjections[cascadeIndex], cascadeIndex, cascadeFrustums[cascadeIndex], visibility };
 
 #ifdef PARALLEL_COMMAND_RECORDING
         const auto& cascadeCommandBuffers{ m_shadowsCommandBufferGroups[cascadeIndex]->GetEncoders(customRenderContext.frameInFlightIndex) };
@@ -372,6 +476,8 @@ void MasterRenderer::RenderSceneReflection(const prev::render::RenderContext& re
         customRenderContext.frustums[slot] = prev::util::intersection::Frustum{ projectionMatrix, viewMatrix };
     }
 
+    customRenderContext.visibility = Cull(customRenderContext.frustums, viewCount, m_reflectionVisibility);
+
 #ifdef PARALLEL_COMMAND_RECORDING
     const auto& commandBuffers{ m_reflectionCommandBufferGroups->GetEncoders(customRenderContext.frameInFlightIndex) };
     RenderParallel(*reflectionComponent->GetRenderPass(), customRenderContext, root, m_reflectionRenderers, commandBuffers);
@@ -408,6 +514,8 @@ void MasterRenderer::RenderSceneRefraction(const prev::render::RenderContext& re
         customRenderContext.frustums[slot] = prev::util::intersection::Frustum{ projectionMatrix, viewMatrix };
     }
 
+    customRenderContext.visibility = Cull(customRenderContext.frustums, viewCount, m_refractionVisibility);
+
 #ifdef PARALLEL_COMMAND_RECORDING
     const auto& commandBuffers{ m_refractionCommandBufferGroups->GetEncoders(customRenderContext.frameInFlightIndex) };
     RenderParallel(*refractionComponent->GetRenderPass(), customRenderContext, root, m_refractionRenderers, commandBuffers);
@@ -441,6 +549,8 @@ void MasterRenderer::RenderScene(const prev::render::RenderContext& renderContex
         customRenderContext.frustums[slot] = prev::util::intersection::Frustum{ projectionMatrix, viewMatrix };
     }
 
+    customRenderContext.visibility = Cull(customRenderContext.frustums, viewCount, m_defaultVisibility);
+
 #ifdef PARALLEL_COMMAND_RECORDING
     const auto& defaultCommandBuffers{ m_defaultCommandBuffersGroup->GetEncoders(customRenderContext.frameInFlightIndex) };
     RenderParallel(m_defaultRenderPass, customRenderContext, root, m_defaultRenderers, defaultCommandBuffers);
@@ -470,4 +580,23 @@ glm::mat4 MasterRenderer::AdjustProjection(const glm::mat4& projection) const
     }
     return projection;
 }
+
+std::shared_ptr<prev_test::component::ray_casting::ISceneQueryComponent> MasterRenderer::FindSceneQuery(const std::shared_ptr<prev::scene::graph::ISceneNode>& root) const
+{
+    const auto sceneQueryNode{ prev::scene::graph::GraphTraversal::FindByTags(root, { TAG_SCENE_QUERY_COMPONENT }) };
+    if (!sceneQueryNode) {
+        return nullptr;
+    }
+    return prev::scene::component::NodeComponentHelper::FindComponent<prev_test::component::ray_casting::ISceneQueryComponent>(sceneQueryNode);
+}
+
+VisibilityContext MasterRenderer::Cull(const prev::util::intersection::Frustum* frustums, const uint32_t frustumCount, SceneQueryVisibility& inOutVisibility) const
+{
+    if (!m_sceneQuery) {
+        return {};
+    }
+
+    inOutVisibility.Cull(m_sceneQuery, frustums, frustumCount);
+    return VisibilityContext{ &inOutVisibility, 0 };
+}
 } // namespace prev_test::render::renderer
\ No newline at end of file
@@ -4,11 +4,13 @@
 #include "CommandBuffersGroup.h"
 #include "IRenderer.h"
 #include "RenderContexts.h"
+#include "SceneQueryVisibility.h"
 
 #include <prev/common/ThreadPool.h>
 #include <prev/core/device/Device.h>
 #include <prev/event/EventHandler.h>
 #include <prev/input/keyboard/KeyboardEvents.h>
+#include <prev/profile/Profile.h>
 #include <prev/render/IRootRenderer.h>
 #include <prev/render/pass/RenderPass.h>
 #include <prev/scene/IScene.h>
@@ -32,6 +34,10 @@ public:
     void operator()(const prev::input::keyboard::KeyEvent& keyEvent);
 
 private:
+    void InitCompute();
+
+    void ShutDownCompute();
+
     void InitDefault();
 
     void ShutDownDefault();
@@ -52,6 +58,8 @@ private:
 
     void ShutDownRefraction();
 
+    void RenderCompute(const prev::render::RenderContext& renderContext, const std::shared_ptr<prev::scene::graph::ISceneNode>& root);
+
     void RenderShadows(const prev::render::RenderContext& renderContext, const std::shared_ptr<prev::scene::graph::ISceneNode>& root);
 
     void RenderSceneReflection(const prev::render::RenderContext& renderContext, const std::shared_ptr<prev::scene::graph::ISceneNode>& root);
@@ -64,6 +72,11 @@ private:
 
     glm::mat4 AdjustProjection(const glm::mat4& projection) const;
 
+    std::shared_ptr<prev_test::component::ray_casting::ISceneQueryComponent> FindSceneQuery(const std::shared_ptr<prev::scene::graph::ISceneNode>& root) const;
+
+    // Culls all tracked bounding volumes against all frustums of a pass at once, renderers then only read the bits.
+    VisibilityContext Cull(const prev::util::intersection::Frustum* frustums, const uint32_t frustumCount, SceneQueryVisibility& inOutVisibility) const;
+
     template <typename RenderContextType>
     void TraverseScene(const RenderContextType& renderContext, const std::shared_ptr<prev::scene::graph::ISceneNode>& node, const std::unique_ptr<IRenderer<RenderContextType>>& renderer);
 
@@ -88,7 +101,14 @@ private:
 
     uint32_t m_viewCount;
 
+#ifdef ENABLE_PROFILING
+    std::unique_ptr<prev::profile::GpuProfiler> m_gpuProfiler;
+#endif
+
 private:
+    // Compute - recorded outside of any render pass before all passes
+    std::vector<std::unique_ptr<IRenderer<prev::render::RenderContext>>> m_computeRenderers;
+
     // Default
     std::vector<std::unique_ptr<IRenderer<NormalRenderContext>>> m_defaultRenderers;
 
@@ -104,6 +124,18 @@ private:
     // Refraction
     std::vector<std::unique_ptr<IRenderer<NormalRenderContext>>> m_refractionRenderers;
 
+    // looked up once per frame in Render
+    std::shared_ptr<prev_test::component::ray_casting::ISceneQueryComponent> m_sceneQuery;
+
+    // Per pass culling results, kept across frames to reuse the storage and the plane coherency state
+    SceneQueryVisibility m_defaultVisibility;
+
+    SceneQueryVisibility m_shadowsVisibility;
+
+    SceneQueryVisibility m_reflectionVisibility;
+
+    SceneQueryVisibility m_refractionVisibility;
+
 #ifdef PARALLEL_COMMAND_RECORDING
     // Parallel stuff
     std::unique_ptr<CommandBuffersGroup> m_defaultCommandBuffersGroup;
@@ -1,11 +1,20 @@
 #ifndef __RENDER_CONTEXTS_H__
 #define __RENDER_CONTEXTS_H__
 
+#include "IVisibilityResult.h"
+
 #include <prev/core/Core.h>
 #include <prev/render/RenderContext.h>
 #include <prev/util/intersection/Frustum.h>
 
 namespace prev_test::render::renderer {
+// Result of the per pass batched culling - renderers fall back to per node tests when it is not set.
+struct VisibilityContext {
+    const IVisibilityResult* result{ nullptr };
+
+    uint32_t firstView{ 0 };
+};
+
 struct ShadowsRenderContext : prev::render::RenderContext {
     glm::mat4 viewMatrix;
 
@@ -15,12 +24,15 @@ struct ShadowsRenderContext : prev::render::RenderContext {
 
     prev::util::intersection::Frustum frustum;
 
-    ShadowsRenderContext(const RenderContext& ctx, const glm::mat4& vm, const glm::mat4& pm, const uint32_t index, const prev::util::intersection::Frustum& frstm)
+    VisibilityContext visibility;
+
+    ShadowsRenderContext(const RenderContext& ctx, const glm::mat4& vm, const glm::mat4& pm, const uint32_t index, const prev::util::intersection::Frustum& frstm, const VisibilityContext& vis = {})
         : RenderContext{ ctx }
         , viewMatrix{ vm }
         , projectionMatrix{ pm }
         , cascadeIndex{ index }
         , frustum{ frstm }
+        , visibility{ vis }
     {
     }
 };
@@ -40,6 +52,8 @@ struct NormalRenderContext : prev::render::RenderContext {
 
     prev::util::intersection::Frustum frustums[MAX_PER_PASS_VIEW_COUNT]{};
 
+    VisibilityContext visibility{};
+
     NormalRenderContext(const RenderContext& ctx, const glm::vec4& cp, const uint32_t cc)
         : RenderContext{ ctx }
         , clipPlane{ cp }
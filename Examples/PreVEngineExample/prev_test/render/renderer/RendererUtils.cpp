@@ -21,6 +21,14 @@ bool IsVisible(const prev::util::intersection::Frustum* frustums, const uint32_t
     return visible;
 }
 
+bool IsVisible(const VisibilityContext& visibility, const prev::util::intersection::Frustum* frustums, const uint32_t frustumCount, const std::shared_ptr<prev::scene::graph::ISceneNode>& node)
+{
+    if (visibility.result) {
+        return visibility.result->IsVisible(visibility.firstView, frustumCount, *node);
+    }
+    return IsVisible(frustums, frustumCount, node);
+}
+
 bool IsSelected(const std::shared_ptr<prev::scene::graph::ISceneNode>& node)
 {
     bool selected{ false };
@@ -29,4 +37,13 @@ bool IsSelected(const std::shared_ptr<prev::scene::graph::ISceneNode>& node)
     }
     return selected;
 }
+
+void RaiseLoadPriority(const std::vector<std::shared_ptr<prev_test::render::IMaterial>>& materials)
+{
+    for (const auto& material : materials) {
+        if (material) {
+            material->RaiseLoadPriority(prev::core::AssetPriority::HIGH);
+        }
+    }
+}
 } // namespace prev_test::render::renderer
\ No newline at end of file
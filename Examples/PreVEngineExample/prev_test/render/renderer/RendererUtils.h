@@ -1,18 +1,29 @@
 #ifndef __RENDERER_UTILS_H__
 #define __RENDERER_UTILS_H__
 
+#include "RenderContexts.h"
+
+#include "../IMaterial.h"
+
 #include <prev/scene/graph/ISceneNode.h>
 #include <prev/util/intersection/Frustum.h>
 
 #include <functional>
 #include <memory>
+#include <vector>
 
 namespace prev_test::render::renderer {
 
 bool IsVisible(const prev::util::intersection::Frustum* frustums, const uint32_t frustumCount, const std::shared_ptr<prev::scene::graph::ISceneNode>& node);
 
+// Uses the batched culling result when available, otherwise tests the node's bounding volume against the frustums.
+bool IsVisible(const VisibilityContext& visibility, const prev::util::intersection::Frustum* frustums, const uint32_t frustumCount, const std::shared_ptr<prev::scene::graph::ISceneNode>& node);
+
 bool IsSelected(const std::shared_ptr<prev::scene::graph::ISceneNode>& node);
 
+// Called for visible nodes that are not ready yet, so their textures get loaded before those of hidden nodes.
+void RaiseLoadPriority(const std::vector<std::shared_ptr<prev_test::render::IMaterial>>& materials);
+
 } // namespace prev_test::render::renderer
 
 #endif
\ No newline at end of file
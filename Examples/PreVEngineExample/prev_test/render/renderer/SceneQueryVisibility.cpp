@@ -0,0 +1,14 @@
+#include "SceneQueryVisibility.h"
+
+namespace prev_test::render::renderer {
+void SceneQueryVisibility::Cull(const std::shared_ptr<const prev_test::component::ray_casting::ISceneQueryComponent>& sceneQuery, const prev::util::intersection::Frustum* frustums, const uint32_t frustumCount)
+{
+    m_sceneQuery = sceneQuery;
+    m_sceneQuery->Cull(frustums, frustumCount, m_cullingResult);
+}
+
+bool SceneQueryVisibility::IsVisible(const uint32_t firstView, const uint32_t viewCount, const prev::scene::graph::ISceneNode& node) const
+{
+    return m_sceneQuery->IsVisible(m_cullingResult, firstView, viewCount, node);
+}
+} // namespace prev_test::render::renderer
@@ -0,0 +1,31 @@
+#ifndef __SCENE_QUERY_VISIBILITY_H__
+#define __SCENE_QUERY_VISIBILITY_H__
+
+#include "IVisibilityResult.h"
+
+#include "../../component/ray_casting/ISceneQueryComponent.h"
+
+#include <memory>
+
+namespace prev_test::render::renderer {
+// Visibility of one pass culled through the scene query, kept across frames to reuse the storage and the plane
+// coherency state.
+class SceneQueryVisibility final : public IVisibilityResult {
+public:
+    SceneQueryVisibility() = default;
+
+    ~SceneQueryVisibility() = default;
+
+public:
+    void Cull(const std::shared_ptr<const prev_test::component::ray_casting::ISceneQueryComponent>& sceneQuery, const prev::util::intersection::Frustum* frustums, const uint32_t frustumCount);
+
+    bool IsVisible(const uint32_t firstView, const uint32_t viewCount, const prev::scene::graph::ISceneNode& node) const override;
+
+private:
+    std::shared_ptr<const prev_test::component::ray_casting::ISceneQueryComponent> m_sceneQuery;
+
+    prev_test::component::ray_casting::SceneCullingResult m_cullingResult;
+};
+} // namespace prev_test::render::renderer
+
+#endif // !__SCENE_QUERY_VISIBILITY_H__
@@ -1,5 +1,7 @@
 #include "BoundingVolumeDebugRenderer.h"
 
+#include "../DrawStatistics.h"
+
 #ifdef RENDER_BOUNDING_VOLUMES
 
 #include "../../../Tags.h"
@@ -126,11 +128,12 @@ void BoundingVolumeDebugRenderer::Render(const NormalRenderContext& renderContex
     const GfxBindGroup descriptorSet = m_shader->UpdateNextBindGroup();
     const uint64_t vertexOffset = 0;
     const uint64_t vertexRange = boundingVolumeComponent->GetModel()->GetVertexBuffer()->GetSize() - vertexOffset;
-    gfxRenderPassEncoderSetVertexBuffer(renderContext.renderPassEncoder, 0, *boundingVolumeComponent->GetModel()->GetVertexBuffer(), vertexOffset, vertexRange);
-    gfxRenderPassEncoderSetIndexBuffer(renderContext.renderPassEncoder, *boundingVolumeComponent->GetModel()->GetIndexBuffer(), GFX_INDEX_FORMAT_UINT32, 0, boundingVolumeComponent->GetModel()->GetIndexBuffer()->GetSize());
+    gfxRenderPassEncoderSetVertexBuffer(renderContext.renderPassEncoder, 0, *boundingVolumeComponent->GetModel()->GetVertexBuffer(), boundingVolumeComponent->GetModel()->GetVertexBuffer()->GetOffset() + vertexOffset, vertexRange);
+    gfxRenderPassEncoderSetIndexBuffer(renderContext.renderPassEncoder, *boundingVolumeComponent->GetModel()->GetIndexBuffer(), GFX_INDEX_FORMAT_UINT32, boundingVolumeComponent->GetModel()->GetIndexBuffer()->GetOffset(), boundingVolumeComponent->GetModel()->GetIndexBuffer()->GetSize());
     gfxRenderPassEncoderSetBindGroup(renderContext.renderPassEncoder, 0, descriptorSet, nullptr, 0);
 
     gfxRenderPassEncoderDrawIndexed(renderContext.renderPassEncoder, boundingVolumeComponent->GetModel()->GetMesh()->GetIndicesCount(), 1, 0, 0, 0);
+    DrawStatistics::Instance().AddDrawCall();
 }
 
 void BoundingVolumeDebugRenderer::PostRender(const NormalRenderContext& renderContext)
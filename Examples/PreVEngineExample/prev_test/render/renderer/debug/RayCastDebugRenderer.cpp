@@ -1,5 +1,7 @@
 #include "RayCastDebugRenderer.h"
 
+#include "../DrawStatistics.h"
+
 #ifdef RENDER_RAYCASTS
 
 #include "../../../Tags.h"
@@ -141,11 +143,12 @@ void RayCastDebugRenderer::Render(const NormalRenderContext& renderContext, cons
     const GfxBindGroup descriptorSet = m_shader->UpdateNextBindGroup();
     const uint64_t vertexOffset = 0;
     const uint64_t vertexRange = rayCastingComponent->GetModel()->GetVertexBuffer()->GetSize() - vertexOffset;
-    gfxRenderPassEncoderSetVertexBuffer(renderContext.renderPassEncoder, 0, *rayCastingComponent->GetModel()->GetVertexBuffer(), vertexOffset, vertexRange);
-    gfxRenderPassEncoderSetIndexBuffer(renderContext.renderPassEncoder, *rayCastingComponent->GetModel()->GetIndexBuffer(), GFX_INDEX_FORMAT_UINT32, 0, rayCastingComponent->GetModel()->GetIndexBuffer()->GetSize());
+    gfxRenderPassEncoderSetVertexBuffer(renderContext.renderPassEncoder, 0, *rayCastingComponent->GetModel()->GetVertexBuffer(), rayCastingComponent->GetModel()->GetVertexBuffer()->GetOffset() + vertexOffset, vertexRange);
+    gfxRenderPassEncoderSetIndexBuffer(renderContext.renderPassEncoder, *rayCastingComponent->GetModel()->GetIndexBuffer(), GFX_INDEX_FORMAT_UINT32, rayCastingComponent->GetModel()->GetIndexBuffer()->GetOffset(), rayCastingComponent->GetModel()->GetIndexBuffer()->GetSize());
     gfxRenderPassEncoderSetBindGroup(renderContext.renderPassEncoder, 0, descriptorSet, nullptr, 0);
 
     gfxRenderPassEncoderDrawIndexed(renderContext.renderPassEncoder, rayCastingComponent->GetModel()->GetMesh()->GetIndicesCount(), 1, 0, 0, 0);
+    DrawStatistics::Instance().AddDrawCall();
 }
 
 void RayCastDebugRenderer::PostRender(const NormalRenderContext& renderContext)
@@ -1,5 +1,7 @@
 #include "SelectionDebugRenderer.h"
 
+#include "../DrawStatistics.h"
+
 #ifdef RENDER_SELECTION
 #include "../../../Tags.h"
 #include "../../../common/ShaderAssetManager.h"
@@ -132,11 +134,12 @@ void SelectionDebugRenderer::Render(const NormalRenderContext& renderContext, co
         const GfxBindGroup descriptorSet = m_shader->UpdateNextBindGroup();
         const uint64_t vertexOffset = 0;
         const uint64_t vertexRange = m_selectionPointModel->GetVertexBuffer()->GetSize() - vertexOffset;
-        gfxRenderPassEncoderSetVertexBuffer(renderContext.renderPassEncoder, 0, *m_selectionPointModel->GetVertexBuffer(), vertexOffset, vertexRange);
-        gfxRenderPassEncoderSetIndexBuffer(renderContext.renderPassEncoder, *m_selectionPointModel->GetIndexBuffer(), GFX_INDEX_FORMAT_UINT32, 0, m_selectionPointModel->GetIndexBuffer()->GetSize());
+        gfxRenderPassEncoderSetVertexBuffer(renderContext.renderPassEncoder, 0, *m_selectionPointModel->GetVertexBuffer(), m_selectionPointModel->GetVertexBuffer()->GetOffset() + vertexOffset, vertexRange);
+        gfxRenderPassEncoderSetIndexBuffer(renderContext.renderPassEncoder, *m_selectionPointModel->GetIndexBuffer(), GFX_INDEX_FORMAT_UINT32, m_selectionPointModel->GetIndexBuffer()->GetOffset(), m_selectionPointModel->GetIndexBuffer()->GetSize());
         gfxRenderPassEncoderSetBindGroup(renderContext.renderPassEncoder, 0, descriptorSet, nullptr, 0);
 
         gfxRenderPassEncoderDrawIndexed(renderContext.renderPassEncoder, m_selectionPointModel->GetMesh()->GetIndicesCount(), 1, 0, 0, 0);
+        DrawStatistics::Instance().AddDrawCall();
     }
 }
 
@@ -1,5 +1,7 @@
 #include "ShadowMapDebugRenderer.h"
 
+#include "../DrawStatistics.h"
+
 #include "../../../Tags.h"
 #include "../../../common/ShaderAssetManager.h"
 #include "../../../component/shadow/IShadowsComponent.h"
@@ -107,11 +109,12 @@ void ShadowMapDebugRenderer::Render(const prev::render::RenderContext& renderCon
     const GfxBindGroup descriptorSet = m_shader->UpdateNextBindGroup();
     const uint64_t vertexOffset = 0;
     const uint64_t vertexRange = m_quadModel->GetVertexBuffer()->GetSize() - vertexOffset;
-    gfxRenderPassEncoderSetVertexBuffer(renderContext.renderPassEncoder, 0, *m_quadModel->GetVertexBuffer(), vertexOffset, vertexRange);
-    gfxRenderPassEncoderSetIndexBuffer(renderContext.renderPassEncoder, *m_quadModel->GetIndexBuffer(), GFX_INDEX_FORMAT_UINT32, 0, m_quadModel->GetIndexBuffer()->GetSize());
+    gfxRenderPassEncoderSetVertexBuffer(renderContext.renderPassEncoder, 0, *m_quadModel->GetVertexBuffer(), m_quadModel->GetVertexBuffer()->GetOffset() + vertexOffset, vertexRange);
+    gfxRenderPassEncoderSetIndexBuffer(renderContext.renderPassEncoder, *m_quadModel->GetIndexBuffer(), GFX_INDEX_FORMAT_UINT32, m_quadModel->GetIndexBuffer()->GetOffset(), m_quadModel->GetIndexBuffer()->GetSize());
     gfxRenderPassEncoderSetBindGroup(renderContext.renderPassEncoder, 0, descriptorSet, nullptr, 0);
 
     gfxRenderPassEncoderDrawIndexed(renderContext.renderPassEncoder, m_quadModel->GetMesh()->GetIndicesCount(), 1, 0, 0, 0);
+    DrawStatistics::Instance().AddDrawCall();
 }
 
 void ShadowMapDebugRenderer::PostRender(const prev::render::RenderContext& renderContext)
@@ -1,5 +1,7 @@
 #include "Font3dRenderer.h"
 
+#include "../DrawStatistics.h"
+
 #include "../../../Tags.h"
 #include "../../../common/ShaderAssetManager.h"
 #include "../../../component/font/IFontRenderComponent.h"
@@ -108,6 +110,7 @@ void Font3dRenderer::Render(const NormalRenderContext& renderContext, const std:
 
     const auto nodeFontRenderComponent = prev::scene::component::NodeComponentHelper::GetComponent<prev_test::component::font::IFontRenderComponent<prev_test::render::font::WorldSpaceText>>(node);
     if (!nodeFontRenderComponent->IsReady()) {
+        nodeFontRenderComponent->GetFontMetadata()->RaiseLoadPriority(prev::core::AssetPriority::HIGH);
         return;
     }
 
@@ -153,11 +156,12 @@ void Font3dRenderer::Render(const NormalRenderContext& renderContext, const std:
         const GfxBindGroup descriptorSet = m_shader->UpdateNextBindGroup();
         const uint64_t vertexOffset = 0;
         const uint64_t vertexRange = renderableText.model->GetVertexBuffer()->GetSize() - vertexOffset;
-        gfxRenderPassEncoderSetVertexBuffer(renderContext.renderPassEncoder, 0, *renderableText.model->GetVertexBuffer(), vertexOffset, vertexRange);
-        gfxRenderPassEncoderSetIndexBuffer(renderContext.renderPassEncoder, *renderableText.model->GetIndexBuffer(), GFX_INDEX_FORMAT_UINT32, 0, renderableText.model->GetIndexBuffer()->GetSize());
+        gfxRenderPassEncoderSetVertexBuffer(renderContext.renderPassEncoder, 0, *renderableText.model->GetVertexBuffer(), renderableText.model->GetVertexBuffer()->GetOffset() + vertexOffset, vertexRange);
+        gfxRenderPassEncoderSetIndexBuffer(renderContext.renderPassEncoder, *renderableText.model->GetIndexBuffer(), GFX_INDEX_FORMAT_UINT32, renderableText.model->GetIndexBuffer()->GetOffset(), renderableText.model->GetIndexBuffer()->GetSize());
         gfxRenderPassEncoderSetBindGroup(renderContext.renderPassEncoder, 0, descriptorSet, nullptr, 0);
 
         gfxRenderPassEncoderDrawIndexed(renderContext.renderPassEncoder, renderableText.model->GetMesh()->GetIndicesCount(), 1, 0, 0, 0);
+        DrawStatistics::Instance().AddDrawCall();
     }
 }
 
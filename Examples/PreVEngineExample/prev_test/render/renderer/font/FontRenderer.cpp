@@ -1,5 +1,7 @@
 #include "FontRenderer.h"
 
+#include "../DrawStatistics.h"
+
 #include "../../../Tags.h"
 #include "../../../common/ShaderAssetManager.h"
 #include "../../../component/font/IFontRenderComponent.h"
@@ -107,6 +109,7 @@ void FontRenderer::Render(const NormalRenderContext& renderContext, const std::s
 
     const auto nodeFontRenderComponent = prev::scene::component::NodeComponentHelper::GetComponent<prev_test::component::font::IFontRenderComponent<prev_test::render::font::ScreenSpaceText>>(node);
     if (!nodeFontRenderComponent->IsReady()) {
+        nodeFontRenderComponent->GetFontMetadata()->RaiseLoadPriority(prev::core::AssetPriority::HIGH);
         return;
     }
 
@@ -143,11 +146,12 @@ void FontRenderer::Render(const NormalRenderContext& renderContext, const std::s
         const GfxBindGroup descriptorSet = m_shader->UpdateNextBindGroup();
         const uint64_t vertexOffset = 0;
         const uint64_t vertexRange = renderableText.model->GetVertexBuffer()->GetSize() - vertexOffset;
-        gfxRenderPassEncoderSetVertexBuffer(renderContext.renderPassEncoder, 0, *renderableText.model->GetVertexBuffer(), vertexOffset, vertexRange);
-        gfxRenderPassEncoderSetIndexBuffer(renderContext.renderPassEncoder, *renderableText.model->GetIndexBuffer(), GFX_INDEX_FORMAT_UINT32, 0, renderableText.model->GetIndexBuffer()->GetSize());
+        gfxRenderPassEncoderSetVertexBuffer(renderContext.renderPassEncoder, 0, *renderableText.model->GetVertexBuffer(), renderableText.model->GetVertexBuffer()->GetOffset() + vertexOffset, vertexRange);
+        gfxRenderPassEncoderSetIndexBuffer(renderContext.renderPassEncoder, *renderableText.model->GetIndexBuffer(), GFX_INDEX_FORMAT_UINT32, renderableText.model->GetIndexBuffer()->GetOffset(), renderableText.model->GetIndexBuffer()->GetSize());
         gfxRenderPassEncoderSetBindGroup(renderContext.renderPassEncoder, 0, descriptorSet, nullptr, 0);
 
         gfxRenderPassEncoderDrawIndexed(renderContext.renderPassEncoder, renderableText.model->GetMesh()->GetIndicesCount(), 1, 0, 0, 0);
+        DrawStatistics::Instance().AddDrawCall();
     }
 }
 
@@ -1,6 +1,7 @@
 #include "ConeStepMappedRenderer.h"
 
 #include "../../IMesh.h"
+#include "../DrawStatistics.h"
 #include "../RendererUtils.h"
 
 #include "../../../Tags.h"
@@ -155,7 +156,7 @@ void ConeStepMappedRenderer::Render(const NormalRenderContext& renderContext, co
         return;
     }
 
-    if (!prev_test::render::renderer::IsVisible(renderContext.frustums, renderContext.cameraCount, node)) {
+    if (!prev_test::render::renderer::IsVisible(renderContext.visibility, renderContext.frustums, renderContext.cameraCount, node)) {
         return;
     }
 
@@ -166,10 +167,12 @@ void ConeStepMappedRenderer::Render(const NormalRenderContext& renderContext, co
     const auto transformComponent = prev::scene::component::NodeComponentHelper::GetComponent<prev_test::component::transform::ITransformComponent>(node);
     const auto nodeRenderComponent = prev::scene::component::NodeComponentHelper::GetComponent<prev_test::component::render::IRenderComponent>(node);
     if (!nodeRenderComponent->IsReady()) {
+        prev_test::render::renderer::RaiseLoadPriority(nodeRenderComponent->GetMaterials());
         return;
     }
 
-    std::function<void(const prev_test::render::MeshNode&)> RenderMeshNode = [&](const prev_test::render::MeshNode& meshNode) {
+    // recursive through its own argument, a std::function would allocate its captures for every node
+    const auto RenderMeshNode = [&](const auto& self, const prev_test::render::MeshNode& meshNode) -> void {
         const auto model = nodeRenderComponent->GetModel();
         const auto mesh = model->GetMesh();
 
@@ -249,19 +252,20 @@ void ConeStepMappedRenderer::Render(const NormalRenderContext& renderContext, co
             const GfxBindGroup descriptorSet = m_shader->UpdateNextBindGroup();
             const uint64_t vertexOffset = static_cast<uint64_t>(meshPart.firstVertexIndex) * mesh->GetVertexLayout().GetStride();
             const uint64_t vertexRange = model->GetVertexBuffer()->GetSize() - vertexOffset;
-            gfxRenderPassEncoderSetVertexBuffer(renderContext.renderPassEncoder, 0, *model->GetVertexBuffer(), vertexOffset, vertexRange);
-            gfxRenderPassEncoderSetIndexBuffer(renderContext.renderPassEncoder, *model->GetIndexBuffer(), GFX_INDEX_FORMAT_UINT32, 0, model->GetIndexBuffer()->GetSize());
+            gfxRenderPassEncoderSetVertexBuffer(renderContext.renderPassEncoder, 0, *model->GetVertexBuffer(), model->GetVertexBuffer()->GetOffset() + vertexOffset, vertexRange);
+            gfxRenderPassEncoderSetIndexBuffer(renderContext.renderPassEncoder, *model->GetIndexBuffer(), GFX_INDEX_FORMAT_UINT32, model->GetIndexBuffer()->GetOffset(), model->GetIndexBuffer()->GetSize());
             gfxRenderPassEncoderSetBindGroup(renderContext.renderPassEncoder, 0, descriptorSet, nullptr, 0);
 
             gfxRenderPassEncoderDrawIndexed(renderContext.renderPassEncoder, meshPart.indicesCount, 1, meshPart.firstIndicesIndex, 0, 0);
+            DrawStatistics::Instance().AddDrawCall();
         }
 
         for (const auto& childMeshNode : meshNode.children) {
-            RenderMeshNode(childMeshNode);
+            self(self, childMeshNode);
         }
     };
 
-    RenderMeshNode(nodeRenderComponent->GetModel()->GetMesh()->GetRootNode());
+    RenderMeshNode(RenderMeshNode, nodeRenderComponent->GetModel()->GetMesh()->GetRootNode());
 }
 
 void ConeStepMappedRenderer::PostRender(const NormalRenderContext& renderContext)
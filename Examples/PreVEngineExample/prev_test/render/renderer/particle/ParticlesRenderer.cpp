@@ -1,11 +1,12 @@
 #include "ParticlesRenderer.h"
 
+#include "../DrawStatistics.h"
 #include "../RendererUtils.h"
 
 #include "../../../Tags.h"
 #include "../../../common/ShaderAssetManager.h"
-#include "../../../component/particle/IParticleSystemComponent.h"
 
+#include <prev/render/buffer/BufferBuilder.h>
 #include <prev/render/buffer/BufferPoolBuilder.h>
 #include <prev/render/pipeline/GraphicsPipelineBuilder.h>
 #include <prev/render/sampler/SamplerBuilder.h>
@@ -14,10 +15,11 @@
 #include <prev/scene/component/NodeComponentHelper.h>
 
 namespace prev_test::render::renderer::particle {
-ParticlesRenderer::ParticlesRenderer(prev::core::device::Device& device, prev::render::pass::RenderPass& renderPass, prev::scene::IScene& scene)
+ParticlesRenderer::ParticlesRenderer(prev::core::device::Device& device, prev::render::pass::RenderPass& renderPass, prev::scene::IScene& scene, const prev::scene::particle::ParticleSortMode sortMode)
     : m_device{ device }
     , m_renderPass{ renderPass }
     , m_scene{ scene }
+    , m_sorter{ sortMode }
 {
 }
 
@@ -62,7 +64,7 @@ void ParticlesRenderer::Init()
         .SetDepthTestEnabled(true)
         .SetDepthWriteEnabled(false)
         .SetBlendingModeEnabled(true)
-        .SetAdditiveBlendingEnabled(true)
+        .SetPremultipliedAlphaBlendingEnabled(true)
         .SetPolygonMode(GFX_POLYGON_MODE_FILL)
         .SetCullingMode(GFX_CULL_MODE_BACK)
         .Build();
@@ -100,10 +102,18 @@ void ParticlesRenderer::BeginFrame(const NormalRenderContext& renderContext)
     m_shader->BeginFrame(renderContext.frameInFlightIndex);
     m_uniformsPoolVS->BeginFrame(renderContext.frameInFlightIndex);
     m_uniformsPoolFS->BeginFrame(renderContext.frameInFlightIndex);
+
+    m_frameInFlightIndex = renderContext.frameInFlightIndex;
+    if (m_sortedInstanceBuffers.size() <= m_frameInFlightIndex) {
+        m_sortedInstanceBuffers.resize(m_frameInFlightIndex + 1);
+    }
 }
 
 void ParticlesRenderer::PreRender(const NormalRenderContext& renderContext)
 {
+    m_sortedSystems.clear();
+    m_sortSources.clear();
+    m_drawRuns.clear();
 }
 
 void ParticlesRenderer::Render(const NormalRenderContext& renderContext, const std::shared_ptr<prev::scene::graph::ISceneNode>& node)
@@ -112,15 +122,112 @@ void ParticlesRenderer::Render(const NormalRenderContext& renderContext, const s
         return;
     }
 
-    if (!prev_test::render::renderer::IsVisible(renderContext.frustums, renderContext.cameraCount, node)) {
+    if (!prev_test::render::renderer::IsVisible(renderContext.visibility, renderContext.frustums, renderContext.cameraCount, node)) {
         return;
     }
 
     const auto particlesComponent = prev::scene::component::NodeComponentHelper::GetComponent<prev_test::component::particle::IParticleSystemComponent>(node);
     if (!particlesComponent->IsReady()) {
+        prev_test::render::renderer::RaiseLoadPriority({ particlesComponent->GetMaterial() });
+        return;
+    }
+
+    // CPU simulated systems are collected here and drawn sorted in PostRender
+    const auto simulationState{ particlesComponent->GetSimulationState() };
+    if (!simulationState) {
+        if (particlesComponent->GetInstances() && particlesComponent->GetParticleCount() > 0) {
+            m_sortedSystems.push_back(particlesComponent);
+            m_sortSources.push_back({ particlesComponent->GetInstances(), particlesComponent->GetParticleCount() });
+        }
         return;
     }
 
+    BindParticleSystem(renderContext, *particlesComponent, *particlesComponent->GetVertexBuffer());
+
+    // GPU simulated systems know their alive count only on GPU
+    gfxRenderPassEncoderDrawIndexedIndirect(renderContext.renderPassEncoder, *simulationState->indirectDraw, 0);
+    DrawStatistics::Instance().AddDrawCall();
+}
+
+void ParticlesRenderer::PostRender(const NormalRenderContext& renderContext)
+{
+    uint32_t particleCount{ 0 };
+    for (const auto& sortSource : m_sortSources) {
+        particleCount += sortSource.count;
+    }
+
+    if (particleCount == 0) {
+        return;
+    }
+
+    // the first view orders all views of the pass
+    const auto& viewMatrix{ renderContext.viewMatrices[0] };
+    const glm::vec3 viewDirection{ -viewMatrix[0][2], -viewMatrix[1][2], -viewMatrix[2][2] };
+
+    m_sortedInstances.resize(particleCount);
+    m_sorter.Sort(renderContext.cameraPositions[0], viewDirection, m_sortSources, m_sortedInstances.data(), m_drawRuns, m_device.GetWorkerThreadPool());
+
+    const uint64_t instancesSize{ sizeof(prev::scene::particle::ParticleInstance) * particleCount };
+
+    auto& instanceBuffer{ m_sortedInstanceBuffers[m_frameInFlightIndex] };
+    if (!instanceBuffer || instanceBuffer->GetSize() < instancesSize) {
+        const uint64_t bufferSize{ std::max(instancesSize, instanceBuffer ? 2 * instanceBuffer->GetSize() : instancesSize) };
+        instanceBuffer = prev::render::buffer::BufferBuilder{ m_device, m_device.GetQueue(prev::core::device::QueueType::GRAPHICS) }
+                             .SetSize(bufferSize)
+                             .SetUsageFlags(GFX_BUFFER_USAGE_VERTEX | GFX_BUFFER_USAGE_MAP_WRITE)
+                             .SetMemoryProperties(GFX_MEMORY_PROPERTY_HOST_VISIBLE | GFX_MEMORY_PROPERTY_HOST_COHERENT)
+                             .Build();
+    }
+    instanceBuffer->Write(m_sortedInstances.data(), instancesSize);
+
+    // neighbouring runs of systems sharing a material and a model are contiguous in the sorted instances - one draw for all of them
+    size_t batchCount{ 0 };
+    for (const auto& drawRun : m_drawRuns) {
+        if (batchCount > 0) {
+            auto& batch{ m_drawRuns[batchCount - 1] };
+            const auto& batchSystem{ m_sortedSystems[batch.sourceIndex] };
+            const auto& runSystem{ m_sortedSystems[drawRun.sourceIndex] };
+            if (batchSystem->GetMaterial() == runSystem->GetMaterial() && batchSystem->GetModel() == runSystem->GetModel()) {
+                batch.instanceCount += drawRun.instanceCount;
+                continue;
+            }
+        }
+        m_drawRuns[batchCount++] = drawRun;
+    }
+    m_drawRuns.resize(batchCount);
+
+    for (const auto& drawRun : m_drawRuns) {
+        const auto& particlesComponent{ m_sortedSystems[drawRun.sourceIndex] };
+        BindParticleSystem(renderContext, *particlesComponent, *instanceBuffer);
+
+        gfxRenderPassEncoderDrawIndexed(renderContext.renderPassEncoder, particlesComponent->GetModel()->GetMesh()->GetIndicesCount(), drawRun.instanceCount, 0, 0, drawRun.firstInstance);
+        DrawStatistics::Instance().AddDrawCall();
+    }
+}
+
+void ParticlesRenderer::EndFrame(const NormalRenderContext& renderContext)
+{
+    m_shader->EndFrame();
+    m_uniformsPoolVS->EndFrame();
+    m_uniformsPoolFS->EndFrame();
+}
+
+void ParticlesRenderer::ShutDown()
+{
+    m_sortedSystems.clear();
+    m_sortedInstanceBuffers.clear();
+
+    m_colorSampler.reset();
+
+    m_uniformsPoolFS.reset();
+    m_uniformsPoolVS.reset();
+
+    m_pipeline.reset();
+    m_shader.reset();
+}
+
+void ParticlesRenderer::BindParticleSystem(const NormalRenderContext& renderContext, const prev_test::component::particle::IParticleSystemComponent& particlesComponent, const prev::render::buffer::Buffer& instanceBuffer)
+{
     const GfxViewport viewport{ static_cast<float>(renderContext.rect.origin.x), static_cast<float>(renderContext.rect.origin.y), static_cast<float>(renderContext.rect.extent.width), static_cast<float>(renderContext.rect.extent.height), 0.0f, 1.0f };
 
     gfxRenderPassEncoderSetPipeline(renderContext.renderPassEncoder, *m_pipeline);
@@ -134,7 +241,7 @@ void ParticlesRenderer::Render(const NormalRenderContext& renderContext, const s
         uniformsVS.viewMatrices[i] = renderContext.viewMatrices[i];
         uniformsVS.projectionMatrices[i] = renderContext.projectionMatrices[i];
     }
-    uniformsVS.textureNumberOfRows = particlesComponent->GetMaterial()->GetAtlasNumberOfRows();
+    uniformsVS.textureNumberOfRows = particlesComponent.GetMaterial()->GetAtlasNumberOfRows();
     uboVS.Write(uniformsVS);
 
     auto& uboFS = m_uniformsPoolFS->Next();
@@ -145,42 +252,18 @@ void ParticlesRenderer::Render(const NormalRenderContext& renderContext, const s
 
     m_shader->Bind("uboVS", uboVS);
     m_shader->Bind("uboFS", uboFS);
-    m_shader->Bind("colorTexture", particlesComponent->GetMaterial()->GetImageBuffer()->GetTextureView());
+    m_shader->Bind("colorTexture", particlesComponent.GetMaterial()->GetImageBuffer()->GetTextureView());
     m_shader->Bind("colorSampler", *m_colorSampler);
 
     const GfxBindGroup descriptorSet = m_shader->UpdateNextBindGroup();
     gfxRenderPassEncoderSetBindGroup(renderContext.renderPassEncoder, 0, descriptorSet, nullptr, 0);
 
     const uint64_t modelVertexOffset = 0;
-    const uint64_t modelVertexRange = particlesComponent->GetModel()->GetVertexBuffer()->GetSize() - modelVertexOffset;
-    gfxRenderPassEncoderSetVertexBuffer(renderContext.renderPassEncoder, 0, *particlesComponent->GetModel()->GetVertexBuffer(), modelVertexOffset, modelVertexRange);
+    const uint64_t modelVertexRange = particlesComponent.GetModel()->GetVertexBuffer()->GetSize() - modelVertexOffset;
+    gfxRenderPassEncoderSetVertexBuffer(renderContext.renderPassEncoder, 0, *particlesComponent.GetModel()->GetVertexBuffer(), particlesComponent.GetModel()->GetVertexBuffer()->GetOffset() + modelVertexOffset, modelVertexRange);
     const uint64_t particleVertexOffset = 0;
-    const uint64_t particleVertexRange = particlesComponent->GetVertexBuffer()->GetSize() - particleVertexOffset;
-    gfxRenderPassEncoderSetVertexBuffer(renderContext.renderPassEncoder, 1, *particlesComponent->GetVertexBuffer(), particleVertexOffset, particleVertexRange);
-    gfxRenderPassEncoderSetIndexBuffer(renderContext.renderPassEncoder, *particlesComponent->GetModel()->GetIndexBuffer(), GFX_INDEX_FORMAT_UINT32, 0, particlesComponent->GetModel()->GetIndexBuffer()->GetSize());
-
-    gfxRenderPassEncoderDrawIndexed(renderContext.renderPassEncoder, particlesComponent->GetModel()->GetMesh()->GetIndicesCount(), static_cast<uint32_t>(particlesComponent->GetParticles().size()), 0, 0, 0);
-}
-
-void ParticlesRenderer::PostRender(const NormalRenderContext& renderContext)
-{
-}
-
-void ParticlesRenderer::EndFrame(const NormalRenderContext& renderContext)
-{
-    m_shader->EndFrame();
-    m_uniformsPoolVS->EndFrame();
-    m_uniformsPoolFS->EndFrame();
-}
-
-void ParticlesRenderer::ShutDown()
-{
-    m_colorSampler.reset();
-
-    m_uniformsPoolFS.reset();
-    m_uniformsPoolVS.reset();
-
-    m_pipeline.reset();
-    m_shader.reset();
+    const uint64_t particleVertexRange = instanceBuffer.GetSize() - particleVertexOffset;
+    gfxRenderPassEncoderSetVertexBuffer(renderContext.renderPassEncoder, 1, instanceBuffer, instanceBuffer.GetOffset() + particleVertexOffset, particleVertexRange);
+    gfxRenderPassEncoderSetIndexBuffer(renderContext.renderPassEncoder, *particlesComponent.GetModel()->GetIndexBuffer(), GFX_INDEX_FORMAT_UINT32, particlesComponent.GetModel()->GetIndexBuffer()->GetOffset(), particlesComponent.GetModel()->GetIndexBuffer()->GetSize());
 }
 } // namespace prev_test::render::renderer::particle
@@ -5,6 +5,8 @@
 #include "../IRenderer.h"
 #include "../RenderContexts.h"
 
+#include "../../../component/particle/IParticleSystemComponent.h"
+
 #include <prev/core/device/Device.h>
 #include <prev/render/buffer/FrameScopedBufferPool.h>
 #include <prev/render/pass/RenderPass.h>
@@ -13,11 +15,12 @@
 #include <prev/render/shader/Shader.h>
 #include <prev/scene/IScene.h>
 #include <prev/scene/graph/ISceneNode.h>
+#include <prev/scene/particle/ParticleDepthSorter.h>
 
 namespace prev_test::render::renderer::particle {
 class ParticlesRenderer final : public IRenderer<NormalRenderContext> {
 public:
-    ParticlesRenderer(prev::core::device::Device& device, prev::render::pass::RenderPass& renderPass, prev::scene::IScene& scene);
+    ParticlesRenderer(prev::core::device::Device& device, prev::render::pass::RenderPass& renderPass, prev::scene::IScene& scene, const prev::scene::particle::ParticleSortMode sortMode = prev::scene::particle::ParticleSortMode::RADIX);
 
     ~ParticlesRenderer() = default;
 
@@ -36,6 +39,9 @@ public:
 
     void ShutDown() override;
 
+private:
+    void BindParticleSystem(const NormalRenderContext& renderContext, const prev_test::component::particle::IParticleSystemComponent& particlesComponent, const prev::render::buffer::Buffer& instanceBuffer);
+
 private:
     struct DEFAULT_ALIGNMENT UniformsVS {
         DEFAULT_ALIGNMENT glm::mat4 viewMatrices[MAX_PER_PASS_VIEW_COUNT];
@@ -69,6 +75,22 @@ private:
     std::unique_ptr<prev::render::buffer::FrameScopedBufferPool> m_uniformsPoolFS;
 
     std::unique_ptr<prev::render::sampler::Sampler> m_colorSampler;
+
+    // visible CPU simulated systems collected in Render, merged and drawn back to front in PostRender
+    prev::scene::particle::ParticleDepthSorter m_sorter;
+
+    std::vector<std::shared_ptr<prev_test::component::particle::IParticleSystemComponent>> m_sortedSystems;
+
+    std::vector<prev::scene::particle::ParticleSortSource> m_sortSources;
+
+    std::vector<prev::scene::particle::ParticleDrawRun> m_drawRuns;
+
+    std::vector<prev::scene::particle::ParticleInstance> m_sortedInstances;
+
+    // one per frame in flight, grown on demand
+    std::vector<std::shared_ptr<prev::render::buffer::Buffer>> m_sortedInstanceBuffers;
+
+    uint32_t m_frameInFlightIndex{};
 };
 } // namespace prev_test::render::renderer::particle
 
@@ -0,0 +1,62 @@
+#include "ParticlesSimulationRenderer.h"
+
+#include "../../../Tags.h"
+#include "../../../common/ShaderAssetManager.h"
+#include "../../../component/particle/IParticleSystemComponent.h"
+
+#include <prev/scene/component/NodeComponentHelper.h>
+
+namespace prev_test::render::renderer::particle {
+ParticlesSimulationRenderer::ParticlesSimulationRenderer(prev::core::device::Device& device, prev::scene::IScene& scene)
+    : m_device{ device }
+    , m_scene{ scene }
+{
+}
+
+void ParticlesSimulationRenderer::Init()
+{
+    const auto backend{ m_device.GetAdapter().GetInfo().backend };
+    m_simulation = std::make_unique<prev::render::particle::ParticleSimulation>(m_device, prev_test::common::ShaderAssetManager::Instance().GetAssetPath(backend, "particle/particles_simulate_comp"), prev_test::common::ShaderAssetManager::Instance().GetAssetPath(backend, "particle/particles_finalize_comp"), m_descriptorCount);
+
+    LOGI("Particles Simulation created");
+}
+
+void ParticlesSimulationRenderer::BeginFrame(const prev::render::RenderContext& renderContext)
+{
+    m_simulation->BeginFrame(renderContext.frameInFlightIndex);
+}
+
+void ParticlesSimulationRenderer::PreRender(const prev::render::RenderContext& renderContext)
+{
+}
+
+void ParticlesSimulationRenderer::Render(const prev::render::RenderContext& renderContext, const std::shared_ptr<prev::scene::graph::ISceneNode>& node)
+{
+    if (!node->GetTags().HasAll({ TAG_PARTICLE_SYSTEM_COMPONENT })) {
+        return;
+    }
+
+    // simulated regardless of visibility, the state has to advance every frame
+    const auto particlesComponent = prev::scene::component::NodeComponentHelper::GetComponent<prev_test::component::particle::IParticleSystemComponent>(node);
+    const auto simulationState{ particlesComponent->GetSimulationState() };
+    if (!simulationState || !particlesComponent->IsReady()) {
+        return;
+    }
+
+    m_simulation->Record(renderContext.commandEncoder, *simulationState, *particlesComponent->GetVertexBuffer(), particlesComponent->GetMaterial()->GetAtlasNumberOfRows());
+}
+
+void ParticlesSimulationRenderer::PostRender(const prev::render::RenderContext& renderContext)
+{
+}
+
+void ParticlesSimulationRenderer::EndFrame(const prev::render::RenderContext& renderContext)
+{
+    m_simulation->EndFrame();
+}
+
+void ParticlesSimulationRenderer::ShutDown()
+{
+    m_simulation.reset();
+}
+} // namespace prev_test::render::renderer::particle
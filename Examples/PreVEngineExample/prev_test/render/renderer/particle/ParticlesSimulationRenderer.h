@@ -0,0 +1,45 @@
+#ifndef __PARTICLES_SIMULATION_RENDERER_H__
+#define __PARTICLES_SIMULATION_RENDERER_H__
+
+#include "../IRenderer.h"
+
+#include <prev/core/device/Device.h>
+#include <prev/render/RenderContext.h>
+#include <prev/render/particle/ParticleSimulation.h>
+#include <prev/scene/IScene.h>
+#include <prev/scene/graph/ISceneNode.h>
+
+namespace prev_test::render::renderer::particle {
+// Simulates GPU particle systems in compute, has to run before any pass drawing them.
+class ParticlesSimulationRenderer final : public IRenderer<prev::render::RenderContext> {
+public:
+    ParticlesSimulationRenderer(prev::core::device::Device& device, prev::scene::IScene& scene);
+
+    ~ParticlesSimulationRenderer() = default;
+
+public:
+    void Init() override;
+
+    void BeginFrame(const prev::render::RenderContext& renderContext) override;
+
+    void PreRender(const prev::render::RenderContext& renderContext) override;
+
+    void Render(const prev::render::RenderContext& renderContext, const std::shared_ptr<prev::scene::graph::ISceneNode>& node) override;
+
+    void PostRender(const prev::render::RenderContext& renderContext) override;
+
+    void EndFrame(const prev::render::RenderContext& renderContext) override;
+
+    void ShutDown() override;
+
+private:
+    prev::core::device::Device& m_device;
+
+    prev::scene::IScene& m_scene;
+
+private:
+    std::unique_ptr<prev::render::particle::ParticleSimulation> m_simulation;
+};
+} // namespace prev_test::render::renderer::particle
+
+#endif // !__PARTICLES_SIMULATION_RENDERER_H__
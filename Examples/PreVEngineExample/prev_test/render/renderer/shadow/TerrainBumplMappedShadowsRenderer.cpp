@@ -1,5 +1,6 @@
 #include "TerrainBumplMappedShadowsRenderer.h"
 
+#include "../DrawStatistics.h"
 #include "../RendererUtils.h"
 
 #include "../../../Tags.h"
@@ -95,7 +96,7 @@ void TerrainBumplMappedShadowsRenderer::Render(const ShadowsRenderContext& rende
         return;
     }
 
-    if (!prev_test::render::renderer::IsVisible(&renderContext.frustum, 1, node)) {
+    if (!prev_test::render::renderer::IsVisible(renderContext.visibility, &renderContext.frustum, 1, node)) {
         return;
     }
 
@@ -118,11 +119,12 @@ void TerrainBumplMappedShadowsRenderer::Render(const ShadowsRenderContext& rende
     const GfxBindGroup descriptorSet = m_shader->UpdateNextBindGroup();
     const uint64_t vertexOffset = 0;
     const uint64_t vertexRange = terrainComponent->GetModel()->GetVertexBuffer()->GetSize() - vertexOffset;
-    gfxRenderPassEncoderSetVertexBuffer(renderContext.renderPassEncoder, 0, *terrainComponent->GetModel()->GetVertexBuffer(), vertexOffset, vertexRange);
-    gfxRenderPassEncoderSetIndexBuffer(renderContext.renderPassEncoder, *terrainComponent->GetModel()->GetIndexBuffer(), GFX_INDEX_FORMAT_UINT32, 0, terrainComponent->GetModel()->GetIndexBuffer()->GetSize());
+    gfxRenderPassEncoderSetVertexBuffer(renderContext.renderPassEncoder, 0, *terrainComponent->GetModel()->GetVertexBuffer(), terrainComponent->GetModel()->GetVertexBuffer()->GetOffset() + vertexOffset, vertexRange);
+    gfxRenderPassEncoderSetIndexBuffer(renderContext.renderPassEncoder, *terrainComponent->GetModel()->GetIndexBuffer(), GFX_INDEX_FORMAT_UINT32, terrainComponent->GetModel()->GetIndexBuffer()->GetOffset(), terrainComponent->GetModel()->GetIndexBuffer()->GetSize());
     gfxRenderPassEncoderSetBindGroup(renderContext.renderPassEncoder, 0, descriptorSet, nullptr, 0);
 
     gfxRenderPassEncoderDrawIndexed(renderContext.renderPassEncoder, terrainComponent->GetModel()->GetMesh()->GetIndicesCount(), 1, 0, 0, 0);
+    DrawStatistics::Instance().AddDrawCall();
 }
 
 void TerrainBumplMappedShadowsRenderer::PostRender(const ShadowsRenderContext& renderContext)
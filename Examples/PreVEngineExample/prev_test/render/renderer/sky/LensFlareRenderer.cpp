@@ -1,5 +1,7 @@
 #include "LensFlareRenderer.h"
 
+#include "../DrawStatistics.h"
+
 #include "../../../Tags.h"
 #include "../../../common/ShaderAssetManager.h"
 #include "../../../component/light/ILightComponent.h"
@@ -150,11 +152,12 @@ void LensFlareRenderer::Render(const NormalRenderContext& renderContext, const s
         const GfxBindGroup descriptorSet = m_shader->UpdateNextBindGroup();
         const uint64_t vertexOffset = 0;
         const uint64_t vertexRange = lensFlareComponent->GetModel()->GetVertexBuffer()->GetSize() - vertexOffset;
-        gfxRenderPassEncoderSetVertexBuffer(renderContext.renderPassEncoder, 0, *lensFlareComponent->GetModel()->GetVertexBuffer(), vertexOffset, vertexRange);
-        gfxRenderPassEncoderSetIndexBuffer(renderContext.renderPassEncoder, *lensFlareComponent->GetModel()->GetIndexBuffer(), GFX_INDEX_FORMAT_UINT32, 0, lensFlareComponent->GetModel()->GetIndexBuffer()->GetSize());
+        gfxRenderPassEncoderSetVertexBuffer(renderContext.renderPassEncoder, 0, *lensFlareComponent->GetModel()->GetVertexBuffer(), lensFlareComponent->GetModel()->GetVertexBuffer()->GetOffset() + vertexOffset, vertexRange);
+        gfxRenderPassEncoderSetIndexBuffer(renderContext.renderPassEncoder, *lensFlareComponent->GetModel()->GetIndexBuffer(), GFX_INDEX_FORMAT_UINT32, lensFlareComponent->GetModel()->GetIndexBuffer()->GetOffset(), lensFlareComponent->GetModel()->GetIndexBuffer()->GetSize());
         gfxRenderPassEncoderSetBindGroup(renderContext.renderPassEncoder, 0, descriptorSet, nullptr, 0);
 
         gfxRenderPassEncoderDrawIndexed(renderContext.renderPassEncoder, lensFlareComponent->GetModel()->GetMesh()->GetIndicesCount(), 1, 0, 0, 0);
+        DrawStatistics::Instance().AddDrawCall();
     }
 }
 
@@ -1,5 +1,8 @@
 #include "SkyBoxRenderer.h"
 
+#include "../DrawStatistics.h"
+#include "../RendererUtils.h"
+
 #include "../../../Tags.h"
 #include "../../../common/ShaderAssetManager.h"
 #include "../../../component/sky/ISkyBoxComponent.h"
@@ -115,6 +118,7 @@ void SkyBoxRenderer::Render(const NormalRenderContext& renderContext, const std:
     const auto transformComponent = prev::scene::component::NodeComponentHelper::GetComponent<prev_test::component::transform::ITransformComponent>(node);
     const auto skyBoxComponent = prev::scene::component::NodeComponentHelper::GetComponent<prev_test::component::sky::ISkyBoxComponent>(node);
     if (!skyBoxComponent->IsReady()) {
+        prev_test::render::renderer::RaiseLoadPriority({ skyBoxComponent->GetMaterial() });
         return;
     }
 
@@ -144,11 +148,12 @@ void SkyBoxRenderer::Render(const NormalRenderContext& renderContext, const std:
     const GfxBindGroup descriptorSet = m_shader->UpdateNextBindGroup();
     const uint64_t vertexOffset = 0;
     const uint64_t vertexRange = skyBoxComponent->GetModel()->GetVertexBuffer()->GetSize() - vertexOffset;
-    gfxRenderPassEncoderSetVertexBuffer(renderContext.renderPassEncoder, 0, *skyBoxComponent->GetModel()->GetVertexBuffer(), vertexOffset, vertexRange);
-    gfxRenderPassEncoderSetIndexBuffer(renderContext.renderPassEncoder, *skyBoxComponent->GetModel()->GetIndexBuffer(), GFX_INDEX_FORMAT_UINT32, 0, skyBoxComponent->GetModel()->GetIndexBuffer()->GetSize());
+    gfxRenderPassEncoderSetVertexBuffer(renderContext.renderPassEncoder, 0, *skyBoxComponent->GetModel()->GetVertexBuffer(), skyBoxComponent->GetModel()->GetVertexBuffer()->GetOffset() + vertexOffset, vertexRange);
+    gfxRenderPassEncoderSetIndexBuffer(renderContext.renderPassEncoder, *skyBoxComponent->GetModel()->GetIndexBuffer(), GFX_INDEX_FORMAT_UINT32, skyBoxComponent->GetModel()->GetIndexBuffer()->GetOffset(), skyBoxComponent->GetModel()->GetIndexBuffer()->GetSize());
     gfxRenderPassEncoderSetBindGroup(renderContext.renderPassEncoder, 0, descriptorSet, nullptr, 0);
 
     gfxRenderPassEncoderDrawIndexed(renderContext.renderPassEncoder, skyBoxComponent->GetModel()->GetMesh()->GetIndicesCount(), 1, 0, 0, 0);
+    DrawStatistics::Instance().AddDrawCall();
 }
 
 void SkyBoxRenderer::PostRender(const NormalRenderContext& renderContext)
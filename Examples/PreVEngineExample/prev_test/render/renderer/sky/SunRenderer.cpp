@@ -1,5 +1,7 @@
 #include "SunRenderer.h"
 #include "SkyEvents.h"
+#include "../DrawStatistics.h"
+
 
 #include "../../../Tags.h"
 #include "../../../common/ShaderAssetManager.h"
@@ -148,11 +150,12 @@ void SunRenderer::Render(const NormalRenderContext& renderContext, const std::sh
     const GfxBindGroup descriptorSet = m_shader->UpdateNextBindGroup();
     const uint64_t vertexOffset = 0;
     const uint64_t vertexRange = sunComponent->GetModel()->GetVertexBuffer()->GetSize() - vertexOffset;
-    gfxRenderPassEncoderSetVertexBuffer(renderContext.renderPassEncoder, 0, *sunComponent->GetModel()->GetVertexBuffer(), vertexOffset, vertexRange);
-    gfxRenderPassEncoderSetIndexBuffer(renderContext.renderPassEncoder, *sunComponent->GetModel()->GetIndexBuffer(), GFX_INDEX_FORMAT_UINT32, 0, sunComponent->GetModel()->GetIndexBuffer()->GetSize());
+    gfxRenderPassEncoderSetVertexBuffer(renderContext.renderPassEncoder, 0, *sunComponent->GetModel()->GetVertexBuffer(), sunComponent->GetModel()->GetVertexBuffer()->GetOffset() + vertexOffset, vertexRange);
+    gfxRenderPassEncoderSetIndexBuffer(renderContext.renderPassEncoder, *sunComponent->GetModel()->GetIndexBuffer(), GFX_INDEX_FORMAT_UINT32, sunComponent->GetModel()->GetIndexBuffer()->GetOffset(), sunComponent->GetModel()->GetIndexBuffer()->GetSize());
     gfxRenderPassEncoderSetBindGroup(renderContext.renderPassEncoder, 0, descriptorSet, nullptr, 0);
 
     gfxRenderPassEncoderDrawIndexed(renderContext.renderPassEncoder, sunComponent->GetModel()->GetMesh()->GetIndicesCount(), 1, 0, 0, 0);
+    DrawStatistics::Instance().AddDrawCall();
 
     m_queryPool->EndQuery(0, renderContext.renderPassEncoder);
 }
@@ -1,5 +1,6 @@
 #include "WaterRenderer.h"
 
+#include "../DrawStatistics.h"
 #include "../RendererUtils.h"
 
 #include "../../../Tags.h"
@@ -144,12 +145,13 @@ void WaterRenderer::Render(const NormalRenderContext& renderContext, const std::
         return;
     }
 
-    if (!prev_test::render::renderer::IsVisible(renderContext.frustums, renderContext.cameraCount, node)) {
+    if (!prev_test::render::renderer::IsVisible(renderContext.visibility, renderContext.frustums, renderContext.cameraCount, node)) {
         return;
     }
 
     const auto waterComponent = prev::scene::component::NodeComponentHelper::GetComponent<prev_test::component::water::IWaterComponent>(node);
     if (!waterComponent->IsReady()) {
+        prev_test::render::renderer::RaiseLoadPriority({ waterComponent->GetMaterial() });
         return;
     }
 
@@ -211,11 +213,12 @@ void WaterRenderer::Render(const NormalRenderContext& renderContext, const std::
     const GfxBindGroup descriptorSet = m_shader->UpdateNextBindGroup();
     const uint64_t vertexOffset = 0;
     const uint64_t vertexRange = waterComponent->GetModel()->GetVertexBuffer()->GetSize() - vertexOffset;
-    gfxRenderPassEncoderSetVertexBuffer(renderContext.renderPassEncoder, 0, *waterComponent->GetModel()->GetVertexBuffer(), vertexOffset, vertexRange);
-    gfxRenderPassEncoderSetIndexBuffer(renderContext.renderPassEncoder, *waterComponent->GetModel()->GetIndexBuffer(), GFX_INDEX_FORMAT_UINT32, 0, waterComponent->GetModel()->GetIndexBuffer()->GetSize());
+    gfxRenderPassEncoderSetVertexBuffer(renderContext.renderPassEncoder, 0, *waterComponent->GetModel()->GetVertexBuffer(), waterComponent->GetModel()->GetVertexBuffer()->GetOffset() + vertexOffset, vertexRange);
+    gfxRenderPassEncoderSetIndexBuffer(renderContext.renderPassEncoder, *waterComponent->GetModel()->GetIndexBuffer(), GFX_INDEX_FORMAT_UINT32, waterComponent->GetModel()->GetIndexBuffer()->GetOffset(), waterComponent->GetModel()->GetIndexBuffer()->GetSize());
     gfxRenderPassEncoderSetBindGroup(renderContext.renderPassEncoder, 0, descriptorSet, nullptr, 0);
 
     gfxRenderPassEncoderDrawIndexed(renderContext.renderPassEncoder, waterComponent->GetModel()->GetMesh()->GetIndicesCount(), 1, 0, 0, 0);
+    DrawStatistics::Instance().AddDrawCall();
 }
 
 void WaterRenderer::PostRender(const NormalRenderContext& renderContext)
@@ -2,6 +2,8 @@
 
 #ifdef ENABLE_XR
 
+#include "../DrawStatistics.h"
+
 #include "../../../Tags.h"
 #include "../../../common/ShaderAssetManager.h"
 #include "../../../component/hand_tracking/IHandTrackingComponent.h"
@@ -152,11 +154,12 @@ void HandTrackingRenderer::Render(const NormalRenderContext& renderContext, cons
             const GfxBindGroup descriptorSet = m_shader->UpdateNextBindGroup();
             const uint64_t vertexOffset = 0;
             const uint64_t vertexRange = jointModel->GetVertexBuffer()->GetSize() - vertexOffset;
-            gfxRenderPassEncoderSetVertexBuffer(renderContext.renderPassEncoder, 0, *jointModel->GetVertexBuffer(), vertexOffset, vertexRange);
-            gfxRenderPassEncoderSetIndexBuffer(renderContext.renderPassEncoder, *jointModel->GetIndexBuffer(), GFX_INDEX_FORMAT_UINT32, 0, jointModel->GetIndexBuffer()->GetSize());
+            gfxRenderPassEncoderSetVertexBuffer(renderContext.renderPassEncoder, 0, *jointModel->GetVertexBuffer(), jointModel->GetVertexBuffer()->GetOffset() + vertexOffset, vertexRange);
+            gfxRenderPassEncoderSetIndexBuffer(renderContext.renderPassEncoder, *jointModel->GetIndexBuffer(), GFX_INDEX_FORMAT_UINT32, jointModel->GetIndexBuffer()->GetOffset(), jointModel->GetIndexBuffer()->GetSize());
             gfxRenderPassEncoderSetBindGroup(renderContext.renderPassEncoder, 0, descriptorSet, nullptr, 0);
 
             gfxRenderPassEncoderDrawIndexed(renderContext.renderPassEncoder, jointModel->GetMesh()->GetIndicesCount(), 1, 0, 0, 0);
+            DrawStatistics::Instance().AddDrawCall();
         }
     }
 }
@@ -39,28 +39,41 @@ void Camera::Init()
 
 void Camera::Update(float deltaTime)
 {
+    const auto& input{ m_inputFacade.GetSnapshot() };
+    if (input.WasKeyPressed(prev::input::keyboard::KeyCode::KEY_R)) {
+        Reset();
+    }
+
+    if (input.IsButtonPressed(prev::input::mouse::MouseButtonType::LEFT)) {
+        const glm::vec2 angleInDegrees{ input.GetMouseDelta() * m_sensitivity };
+        for (auto& cameraComponent : m_cameraComponents) {
+            cameraComponent->AddPitch(glm::radians(-angleInDegrees.y));
+            cameraComponent->AddYaw(glm::radians(angleInDegrees.x));
+        }
+    }
+
     for (uint32_t view = 0; view < m_viewCount; ++view) {
         auto transformComponent{ m_transformComponents[view] };
         auto cameraComponent{ m_cameraComponents[view] };
 
 #ifndef ENABLE_XR
         glm::vec3 positionDelta{ 0.0f, 0.0f, 0.0f };
-        if (m_inputFacade.IsKeyPressed(prev::input::keyboard::KeyCode::KEY_W)) {
+        if (input.IsKeyPressed(prev::input::keyboard::KeyCode::KEY_W)) {
             positionDelta += cameraComponent->GetForwardDirection() * deltaTime * m_moveSpeed;
         }
-        if (m_inputFacade.IsKeyPressed(prev::input::keyboard::KeyCode::KEY_S)) {
+        if (input.IsKeyPressed(prev::input::keyboard::KeyCode::KEY_S)) {
             positionDelta -= cameraComponent->GetForwardDirection() * deltaTime * m_moveSpeed;
         }
-        if (m_inputFacade.IsKeyPressed(prev::input::keyboard::KeyCode::KEY_A)) {
+        if (input.IsKeyPressed(prev::input::keyboard::KeyCode::KEY_A)) {
             positionDelta -= cameraComponent->GetRightDirection() * deltaTime * m_moveSpeed;
         }
-        if (m_inputFacade.IsKeyPressed(prev::input::keyboard::KeyCode::KEY_D)) {
+        if (input.IsKeyPressed(prev::input::keyboard::KeyCode::KEY_D)) {
             positionDelta += cameraComponent->GetRightDirection() * deltaTime * m_moveSpeed;
         }
-        if (m_inputFacade.IsKeyPressed(prev::input::keyboard::KeyCode::KEY_Q)) {
+        if (input.IsKeyPressed(prev::input::keyboard::KeyCode::KEY_Q)) {
             positionDelta -= cameraComponent->GetUpDirection() * deltaTime * m_moveSpeed;
         }
-        if (m_inputFacade.IsKeyPressed(prev::input::keyboard::KeyCode::KEY_E)) {
+        if (input.IsKeyPressed(prev::input::keyboard::KeyCode::KEY_E)) {
             positionDelta += cameraComponent->GetUpDirection() * deltaTime * m_moveSpeed;
         }
 
@@ -92,17 +105,6 @@ void Camera::ShutDown()
     SceneNode::ShutDown();
 }
 
-void Camera::operator()(const prev::input::mouse::MouseEvent& mouseEvent)
-{
-    if (mouseEvent.action == prev::input::mouse::MouseActionType::MOVE && mouseEvent.button == prev::input::mouse::MouseButtonType::LEFT) {
-        const glm::vec2 angleInDegrees{ mouseEvent.position * m_sensitivity };
-        for (auto& cameraComponent : m_cameraComponents) {
-            cameraComponent->AddPitch(glm::radians(-angleInDegrees.y));
-            cameraComponent->AddYaw(glm::radians(angleInDegrees.x));
-        }
-    }
-}
-
 void Camera::operator()(const prev::input::touch::TouchEvent& touchEvent)
 {
 #if defined(__ANDROID__)
@@ -137,15 +139,6 @@ void Camera::operator()(const prev::input::touch::TouchEvent& touchEvent)
     }
 }
 
-void Camera::operator()(const prev::input::keyboard::KeyEvent& keyEvent)
-{
-    if (keyEvent.action == prev::input::keyboard::KeyActionType::PRESS) {
-        if (keyEvent.keyCode == prev::input::keyboard::KeyCode::KEY_R) {
-            Reset();
-        }
-    }
-}
-
 #ifdef ENABLE_XR
 void Camera::operator()(const prev::xr::CameraEvent& cameraEvent)
 {
@@ -29,12 +29,8 @@ public:
     void ShutDown() override;
 
 public:
-    void operator()(const prev::input::mouse::MouseEvent& mouseEvent);
-
     void operator()(const prev::input::touch::TouchEvent& touchEvent);
 
-    void operator()(const prev::input::keyboard::KeyEvent& keyEvent);
-
 #ifdef ENABLE_XR
     void operator()(const prev::xr::CameraEvent& cameraEvent);
 #else
@@ -45,12 +41,8 @@ private:
     void Reset();
 
 private:
-    prev::event::EventHandler<Camera, prev::input::mouse::MouseEvent> m_mouseHandler{ *this };
-
     prev::event::EventHandler<Camera, prev::input::touch::TouchEvent> m_touchHandler{ *this };
 
-    prev::event::EventHandler<Camera, prev::input::keyboard::KeyEvent> m_keyHandler{ *this };
-
 #ifdef ENABLE_XR
     prev::event::EventHandler<Camera, prev::xr::CameraEvent> m_xrCameraEventHandler{ *this };
 #else
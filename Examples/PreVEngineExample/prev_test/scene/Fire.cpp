@@ -18,9 +18,7 @@ Fire::Fire(prev::core::device::Device& device, bool colorManaged, const glm::vec
 
 void Fire::Init()
 {
-    prev_test::component::particle::ParticleSystemComponentFactory particleSystemComponentFactory{ m_device, m_colorManaged };
-    m_particleSystemComponent = particleSystemComponentFactory.CreateRandomInCone(glm::vec3(0.0f, 1.0f, 0.0f), 25.0f);
-    prev::scene::component::NodeComponentHelper::AddComponent<prev_test::component::particle::IParticleSystemComponent>(GetThis(), m_particleSystemComponent, { TAG_PARTICLE_SYSTEM_COMPONENT });
+    CreateParticleSystem();
 
     prev_test::component::ray_casting::BoundingVolumeComponentFactory bondingVolumeFactory{ m_device };
     m_boundingVolumeComponent = bondingVolumeFactory.CreateAABB(prev::util::intersection::AABB(glm::vec3{ -0.5 }, glm::vec3{ 0.5 }), glm::vec3{ 1.0f }, {});
@@ -52,4 +50,25 @@ void Fire::ShutDown()
 {
     SceneNode::ShutDown();
 }
+
+void Fire::operator()(const prev::input::keyboard::KeyEvent& keyEvent)
+{
+    if (keyEvent.action == prev::input::keyboard::KeyActionType::PRESS) {
+        if (keyEvent.keyCode == prev::input::keyboard::KeyCode::KEY_G) {
+            m_gpuSimulated = !m_gpuSimulated;
+
+            LOGI("Fire particles simulated on %s", m_gpuSimulated ? "GPU" : "CPU");
+
+            prev::scene::component::NodeComponentHelper::RemoveComponents<prev_test::component::particle::IParticleSystemComponent>(GetThis(), { TAG_PARTICLE_SYSTEM_COMPONENT });
+            CreateParticleSystem();
+        }
+    }
+}
+
+void Fire::CreateParticleSystem()
+{
+    prev_test::component::particle::ParticleSystemComponentFactory particleSystemComponentFactory{ m_device, m_colorManaged, true, m_gpuSimulated };
+    m_particleSystemComponent = particleSystemComponentFactory.CreateRandomInCone(glm::vec3(0.0f, 1.0f, 0.0f), 25.0f);
+    prev::scene::component::NodeComponentHelper::AddComponent<prev_test::component::particle::IParticleSystemComponent>(GetThis(), m_particleSystemComponent, { TAG_PARTICLE_SYSTEM_COMPONENT });
+}
 } // namespace prev_test::scene
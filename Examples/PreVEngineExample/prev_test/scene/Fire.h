@@ -5,6 +5,8 @@
 #include "../component/ray_casting/IBoundingVolumeComponent.h"
 
 #include <prev/core/device/Device.h>
+#include <prev/event/EventHandler.h>
+#include <prev/input/keyboard/KeyboardEvents.h>
 #include <prev/scene/graph/SceneNode.h>
 
 namespace prev_test::scene {
@@ -21,6 +23,15 @@ public:
 
     void ShutDown() override;
 
+public:
+    void operator()(const prev::input::keyboard::KeyEvent& keyEvent);
+
+private:
+    void CreateParticleSystem();
+
+private:
+    prev::event::EventHandler<Fire, prev::input::keyboard::KeyEvent> m_keyEventHandler{ *this };
+
 private:
     prev::core::device::Device& m_device;
 
@@ -28,6 +39,9 @@ private:
 
     glm::vec3 m_initialPosition;
 
+    // toggled by KEY_G, switches between the CPU and the compute shader simulation
+    bool m_gpuSimulated{ false };
+
     std::shared_ptr<prev_test::component::particle::IParticleSystemComponent> m_particleSystemComponent;
 
     std::shared_ptr<prev_test::component::ray_casting::IBoundingVolumeComponent> m_boundingVolumeComponent;
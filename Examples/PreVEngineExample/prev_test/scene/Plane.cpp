@@ -50,7 +50,9 @@ void Plane::Update(float deltaTime)
     m_transformComponent->Rotate(glm::quat(glm::radians(glm::vec3(0.0f, DEGS_PER_SEC * deltaTime, 0.0f))));
 
     m_transformComponent->Update(deltaTime);
-    m_boundingVolumeComponent->Update(m_transformComponent->GetWorldTransformScaled());
+    if (m_transformComponent->IsWorldTransformChanged()) {
+        m_boundingVolumeComponent->Update(m_transformComponent->GetWorldTransformScaled());
+    }
 
     SceneNode::Update(deltaTime);
 }
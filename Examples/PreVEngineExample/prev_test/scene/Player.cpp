@@ -65,7 +65,15 @@ void Player::Update(float deltaTime)
 
     auto walkingAnimation{ m_animationRenderComponent->GetAnimation(WALKING_ANIMATION_INDEX) };
 
-    if (m_shouldRotate) {
+    const auto& input{ m_inputFacade.GetSnapshot() };
+    const bool mouseRotate{ input.IsButtonPressed(prev::input::mouse::MouseButtonType::LEFT) };
+    if (mouseRotate) {
+        m_pitchYawRollDiff.y += input.GetMouseDelta().x;
+        m_pitchYawRollDiff.x += -input.GetMouseDelta().y;
+    }
+    m_cameraDistanceFromPerson += static_cast<float>(input.GetScrollDelta());
+
+    if (m_shouldRotate || mouseRotate) {
         const auto pitchAmount{ glm::radians(PITCH_TURN_SPEED * m_pitchYawRollDiff.x * deltaTime) };
         const auto yawAmount{ glm::radians(YAW_TURN_SPEED * m_pitchYawRollDiff.y * deltaTime) };
 
@@ -128,7 +136,9 @@ void Player::Update(float deltaTime)
     const glm::vec3 cameraPosition{ m_transformComponent->GetPosition() + (-m_cameraComponent->GetForwardDirection() * m_cameraDistanceFromPerson) + m_cameraComponent->GetDefaultUpDirection() * m_cameraPositionOffset };
     m_cameraComponent->SetPosition(cameraPosition);
 
-    m_boundingVolumeComponent->Update(m_transformComponent->GetWorldTransformScaled());
+    if (m_transformComponent->IsWorldTransformChanged()) {
+        m_boundingVolumeComponent->Update(m_transformComponent->GetWorldTransformScaled());
+    }
 
     SceneNode::Update(deltaTime);
 }
@@ -173,22 +183,6 @@ void Player::operator()(const prev::input::keyboard::KeyEvent& keyEvent)
     }
 }
 
-void Player::operator()(const prev::input::mouse::MouseEvent& mouseEvent)
-{
-    if (mouseEvent.button == prev::input::mouse::MouseButtonType::LEFT) {
-        if (mouseEvent.action == prev::input::mouse::MouseActionType::PRESS) {
-            m_shouldRotate = true;
-        } else if (mouseEvent.action == prev::input::mouse::MouseActionType::RELEASE) {
-            m_shouldRotate = false;
-        }
-    }
-
-    if (m_shouldRotate && mouseEvent.action == prev::input::mouse::MouseActionType::MOVE) {
-        m_pitchYawRollDiff.y += mouseEvent.position.x;
-        m_pitchYawRollDiff.x += -mouseEvent.position.y;
-    }
-}
-
 void Player::operator()(const prev::input::touch::TouchEvent& touchEvent)
 {
     if (touchEvent.action == prev::input::touch::TouchActionType::DOWN) {
@@ -231,9 +225,4 @@ void Player::operator()(const prev::input::touch::TouchEvent& touchEvent)
 
     m_prevTouchPosition = touchEvent.position;
 }
-
-void Player::operator()(const prev::input::mouse::MouseScrollEvent& scrollEvent)
-{
-    m_cameraDistanceFromPerson += static_cast<float>(scrollEvent.delta);
-}
 } // namespace prev_test::scene
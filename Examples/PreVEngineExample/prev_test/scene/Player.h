@@ -9,6 +9,7 @@
 #include <prev/core/CoreEvents.h>
 #include <prev/core/device/Device.h>
 #include <prev/event/EventHandler.h>
+#include <prev/input/InputFacade.h>
 #include <prev/input/keyboard/KeyboardEvents.h>
 #include <prev/input/mouse/MouseEvents.h>
 #include <prev/input/touch/TouchEvents.h>
@@ -33,12 +34,8 @@ public:
 
     void operator()(const prev::input::keyboard::KeyEvent& keyEvent);
 
-    void operator()(const prev::input::mouse::MouseEvent& mouseEvent);
-
     void operator()(const prev::input::touch::TouchEvent& touchEvent);
 
-    void operator()(const prev::input::mouse::MouseScrollEvent& scrollEvent);
-
 private:
     static const inline float RUN_SPEED{ 14.0f };
 
@@ -99,11 +96,10 @@ private:
 
     prev::event::EventHandler<Player, prev::input::keyboard::KeyEvent> m_keyboardEventsHandler{ *this };
 
-    prev::event::EventHandler<Player, prev::input::mouse::MouseEvent> m_mouseEventsHandler{ *this };
-
     prev::event::EventHandler<Player, prev::input::touch::TouchEvent> m_touchEventsHandler{ *this };
 
-    prev::event::EventHandler<Player, prev::input::mouse::MouseScrollEvent> m_mouseScrollsHandler{ *this };
+private:
+    prev::input::InputsFacade m_inputFacade;
 
 private:
     std::shared_ptr<prev_test::component::transform::ITransformComponent> m_transformComponent;
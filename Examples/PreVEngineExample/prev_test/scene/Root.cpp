@@ -12,6 +12,7 @@
 #include "ray_casting/InputsHelper.h"
 #include "ray_casting/RayCaster.h"
 #include "ray_casting/RayCasterObserver.h"
+#include "ray_casting/SceneQuery.h"
 #include "robot/CubeRobot.h"
 #include "shadow/Shadow.h"
 #include "sky/LensFlare.h"
@@ -28,6 +29,7 @@
 
 #include "../Tags.h"
 #include "../common/AssetManager.h"
+#include "../component/transform/TransformSystem.h"
 
 #include <prev/common/Logger.h>
 #include <prev/util/Utils.h>
@@ -145,6 +147,9 @@ void Root::Init()
     auto rayCaster = std::make_shared<ray_casting::RayCaster>();
     AddChild(rayCaster);
 
+    m_sceneQuery = std::make_shared<ray_casting::SceneQuery>();
+    AddChild(m_sceneQuery);
+
     auto rayCastObserver = std::make_shared<ray_casting::RayCastObserver>();
     AddChild(rayCastObserver);
 
@@ -153,12 +158,19 @@ void Root::Init()
 
 void Root::Update(float deltaTime)
 {
+    prev_test::component::transform::TransformSystem::Instance().Update(m_device.GetWorkerThreadPool());
+
     SceneNode::Update(deltaTime);
+
+    // after all the nodes, wherever they are in the graph, so the volumes moved this frame are refitted before culling
+    m_sceneQuery->Refit();
 }
 
 void Root::ShutDown()
 {
     SceneNode::ShutDown();
+
+    m_sceneQuery = nullptr;
 }
 
 void Root::operator()(const prev::input::keyboard::KeyEvent& keyEvent)
@@ -1,6 +1,8 @@
 #ifndef __ROOT_H__
 #define __ROOT_H__
 
+#include "ray_casting/SceneQuery.h"
+
 #include <prev/core/device/Device.h>
 #include <prev/event/EventHandler.h>
 #include <prev/input/keyboard/KeyboardEvents.h>
@@ -38,6 +40,8 @@ private:
 
     uint32_t m_viewCount{};
 
+    std::shared_ptr<ray_casting::SceneQuery> m_sceneQuery;
+
 private:
     prev::event::EventHandler<Root, prev::input::keyboard::KeyEvent> m_keyEventHnadler{ *this };
 
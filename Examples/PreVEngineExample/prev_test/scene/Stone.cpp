@@ -59,7 +59,9 @@ void Stone::Update(float deltaTime)
 
     m_transformComponent->Update(deltaTime);
 
-    m_boundingVolumeComponent->Update(m_transformComponent->GetWorldTransformScaled());
+    if (m_transformComponent->IsWorldTransformChanged()) {
+        m_boundingVolumeComponent->Update(m_transformComponent->GetWorldTransformScaled());
+    }
 
     SceneNode::Update(deltaTime);
 }
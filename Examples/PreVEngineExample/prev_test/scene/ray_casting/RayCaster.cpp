@@ -48,7 +48,7 @@ void RayCaster::Update(float deltaTime)
         prev::event::EventChannel::Post(RayEvent{ m_rayCasterComponent->GetRay() });
     } else {
         m_mouseRayCasterComponent->SetRayLength(RAY_LENGTH);
-        m_mouseRayCasterComponent->SetMousePosition(m_mousePosition);
+        m_mouseRayCasterComponent->SetMousePosition(m_inputFacade.GetSnapshot().GetMousePosition());
         m_mouseRayCasterComponent->SetViewPortDimensions(m_viewPortSize);
         m_mouseRayCasterComponent->SetProjectionMatrix(cameraComponent->GetViewFrustum().CreateProjectionMatrix());
         m_mouseRayCasterComponent->SetViewMatrix(cameraComponent->LookAt());
@@ -85,11 +85,6 @@ void RayCaster::operator()(const prev::core::NewIterationEvent& newIterationEven
     m_viewPortSize = glm::vec2(newIterationEvent.windowWidth, newIterationEvent.windowHeight);
 }
 
-void RayCaster::operator()(const prev::input::mouse::MouseEvent& mouseEvent)
-{
-    m_mousePosition = mouseEvent.position;
-}
-
 void RayCaster::operator()(const prev::input::mouse::MouseLockRequest& lockRequest)
 {
     RemoveRayCastComponnet();
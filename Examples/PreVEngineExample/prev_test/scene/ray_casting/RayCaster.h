@@ -32,8 +32,6 @@ private:
 public:
     void operator()(const prev::core::NewIterationEvent& newIterationEvent);
 
-    void operator()(const prev::input::mouse::MouseEvent& mouseEvent);
-
     void operator()(const prev::input::mouse::MouseLockRequest& lockRequest);
 
 private:
@@ -45,15 +43,11 @@ private:
 
     glm::vec2 m_viewPortSize;
 
-    glm::vec2 m_mousePosition;
-
     prev::input::InputsFacade m_inputFacade;
 
 private:
     prev::event::EventHandler<RayCaster, prev::core::NewIterationEvent> m_newIterationHandler{ *this };
 
-    prev::event::EventHandler<RayCaster, prev::input::mouse::MouseEvent> m_mouseEventHandler{ *this };
-
     prev::event::EventHandler<RayCaster, prev::input::mouse::MouseLockRequest> m_mouseLockHandler{ *this };
 };
 
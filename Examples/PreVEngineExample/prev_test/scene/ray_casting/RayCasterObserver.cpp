@@ -1,7 +1,7 @@
 #include "RayCasterObserver.h"
 
 #include "../../Tags.h"
-#include "../../component/ray_casting/IBoundingVolumeComponent.h"
+#include "../../component/ray_casting/ISceneQueryComponent.h"
 #include "../../component/ray_casting/ISelectableComponent.h"
 #include "../../component/terrain/ITerrainManagerComponent.h"
 
@@ -21,7 +21,7 @@ void RayCastObserver::Init()
 void RayCastObserver::Update(float deltaTime)
 {
     if (m_currentRay.has_value()) {
-        ResetAllSelectableNodes();
+        ResetSelectedNodes();
 
         IntersectionType intersectionType{ IntersectionType::NONE };
         const auto& currentRayValue{ m_currentRay.value() };
@@ -42,12 +42,14 @@ void RayCastObserver::Update(float deltaTime)
             auto selectableComponent{ prev::scene::component::NodeComponentHelper::GetComponent<prev_test::component::ray_casting::ISelectableComponent>(terrainManagerNode) };
             selectableComponent->SetSelected(true);
             selectableComponent->SetPosition(currentTerrainIntersectionPoint.value());
+            m_selectedComponents.push_back(selectableComponent);
         } else if (intersectionType == IntersectionType::OBJECT) {
             const auto& node{ closestIntersectingObject.value().node };
             const auto& rayCastResult{ closestIntersectingObject.value().result };
             auto selectableComponent{ prev::scene::component::NodeComponentHelper::GetComponent<prev_test::component::ray_casting::ISelectableComponent>(node) };
             selectableComponent->SetSelected(true);
             selectableComponent->SetPosition(rayCastResult.point);
+            m_selectedComponents.push_back(selectableComponent);
         }
     }
 
@@ -162,29 +164,31 @@ std::shared_ptr<prev_test::component::terrain::ITerrainComponent> RayCastObserve
 
 std::optional<RayCastObserver::IntersectionNodeResult> RayCastObserver::FindTheClosestIntersectingNode(const prev::util::intersection::Ray& ray) const
 {
-    std::optional<IntersectionNodeResult> theClosestNode;
-    float minDistance{ std::numeric_limits<float>::max() };
-    auto selectableNodes{ prev::scene::graph::GraphTraversal::FindAllByTags(GetRoot(), { TAG_SELECTABLE_COMPONENT, TAG_BOUNDING_VOLUME_COMPONENT }, prev::scene::graph::LogicOperation::AND) };
-    for (const auto& selectable : selectableNodes) {
-        const auto boundingVolume{ prev::scene::component::NodeComponentHelper::GetComponent<prev_test::component::ray_casting::IBoundingVolumeComponent>(selectable) };
-        prev::util::intersection::RayCastResult rayCastResult{};
-        if (boundingVolume->Intersects(ray, rayCastResult)) {
-            if (rayCastResult.t < minDistance) {
-                theClosestNode = { rayCastResult, selectable };
-                minDistance = rayCastResult.t;
-            }
-        }
+    // the scene query node may be gone, removed at runtime
+    const auto sceneQueryNode{ prev::scene::graph::GraphTraversal::FindByTags(GetRoot(), { TAG_SCENE_QUERY_COMPONENT }) };
+    if (!sceneQueryNode) {
+        return {};
+    }
+
+    const auto sceneQuery{ prev::scene::component::NodeComponentHelper::FindComponent<prev_test::component::ray_casting::ISceneQueryComponent>(sceneQueryNode) };
+    if (!sceneQuery) {
+        return {};
+    }
+
+    const auto closest{ sceneQuery->RayCastClosest(ray, [](const std::shared_ptr<prev::scene::graph::ISceneNode>& node) { return node->GetTags().Has(TAG_SELECTABLE_COMPONENT); }) };
+    if (!closest) {
+        return {};
     }
-    return theClosestNode;
+    return IntersectionNodeResult{ closest->result, closest->node };
 }
 
-void RayCastObserver::ResetAllSelectableNodes() const
+void RayCastObserver::ResetSelectedNodes()
 {
-    auto selectableNodes{ prev::scene::graph::GraphTraversal::FindAllByTags(GetRoot(), { TAG_SELECTABLE_COMPONENT }) };
-    for (auto& selectableNode : selectableNodes) {
-        auto selectableComponent{ prev::scene::component::NodeComponentHelper::GetComponent<prev_test::component::ray_casting::ISelectableComponent>(selectableNode) };
+    // only this observer selects, so there is no need to walk all selectable nodes
+    for (const auto& selectableComponent : m_selectedComponents) {
         selectableComponent->Reset();
     }
+    m_selectedComponents.clear();
 }
 
 void RayCastObserver::operator()(const RayEvent& rayEvt)
@@ -3,6 +3,7 @@
 
 #include "RayCasterEvents.h"
 
+#include "../../component/ray_casting/ISelectableComponent.h"
 #include "../../component/terrain/ITerrainComponent.h"
 
 #include <prev/event/EventHandler.h>
@@ -57,7 +58,7 @@ private:
     std::optional<IntersectionNodeResult> FindTheClosestIntersectingNode(const prev::util::intersection::Ray& ray) const;
 
     // Common
-    void ResetAllSelectableNodes() const;
+    void ResetSelectedNodes();
 
 public:
     void operator()(const RayEvent& rayEvt);
@@ -67,6 +68,8 @@ private:
 
     std::optional<prev::util::intersection::Ray> m_currentRay;
 
+    std::vector<std::shared_ptr<prev_test::component::ray_casting::ISelectableComponent>> m_selectedComponents;
+
     prev::event::EventHandler<RayCastObserver, RayEvent> m_rayHandler{ *this };
 };
 } // namespace prev_test::scene::ray_casting
@@ -0,0 +1,46 @@
+#include "SceneQuery.h"
+
+#include "../../Tags.h"
+#include "../../component/ray_casting/IBoundingVolumeComponent.h"
+#include "../../component/ray_casting/SceneQueryComponentFactory.h"
+
+#include <prev/scene/component/NodeComponentHelper.h>
+
+namespace prev_test::scene::ray_casting {
+SceneQuery::SceneQuery()
+    : SceneNode()
+    , m_sceneQueryComponent{ prev_test::component::ray_casting::SceneQueryComponentFactory{}.Create() }
+{
+}
+
+void SceneQuery::Init()
+{
+    prev::scene::component::NodeComponentHelper::AddComponent<prev_test::component::ray_casting::ISceneQueryComponent>(GetThis(), m_sceneQueryComponent, { TAG_SCENE_QUERY_COMPONENT });
+
+    SceneNode::Init();
+}
+
+void SceneQuery::ShutDown()
+{
+    SceneNode::ShutDown();
+}
+
+void SceneQuery::Refit()
+{
+    m_sceneQueryComponent->Update();
+}
+
+void SceneQuery::operator()(const prev::scene::component::ComponentAddedEvent& addedEvent)
+{
+    if (addedEvent.type == std::type_index(typeid(prev_test::component::ray_casting::IBoundingVolumeComponent))) {
+        m_sceneQueryComponent->Add(addedEvent.node);
+    }
+}
+
+void SceneQuery::operator()(const prev::scene::component::ComponentRemovedEvent& removedEvent)
+{
+    if (removedEvent.type == std::type_index(typeid(prev_test::component::ray_casting::IBoundingVolumeComponent))) {
+        m_sceneQueryComponent->Remove(removedEvent.nodeId);
+    }
+}
+} // namespace prev_test::scene::ray_casting
@@ -0,0 +1,43 @@
+#ifndef __SCENE_QUERY_H__
+#define __SCENE_QUERY_H__
+
+#include "../../component/ray_casting/ISceneQueryComponent.h"
+
+#include <prev/event/EventHandler.h>
+#include <prev/scene/component/ComponentEvents.h>
+#include <prev/scene/graph/SceneNode.h>
+
+namespace prev_test::scene::ray_casting {
+// Keeps the scene query tree in sync with the bounding volume components added to and removed from the nodes.
+class SceneQuery final : public prev::scene::graph::SceneNode {
+public:
+    SceneQuery();
+
+    ~SceneQuery() = default;
+
+public:
+    void Init() override;
+
+    void ShutDown() override;
+
+public:
+    // Refits the volumes updated this frame - call once all the nodes were updated.
+    void Refit();
+
+public:
+    void operator()(const prev::scene::component::ComponentAddedEvent& addedEvent);
+
+    void operator()(const prev::scene::component::ComponentRemovedEvent& removedEvent);
+
+private:
+    // made up front, the other nodes announce their volumes in their Init that may run before this one's
+    std::shared_ptr<prev_test::component::ray_casting::ISceneQueryComponent> m_sceneQueryComponent;
+
+private:
+    prev::event::EventHandler<SceneQuery, prev::scene::component::ComponentAddedEvent> m_componentAddedHandler{ *this };
+
+    prev::event::EventHandler<SceneQuery, prev::scene::component::ComponentRemovedEvent> m_componentRemovedHandler{ *this };
+};
+} // namespace prev_test::scene::ray_casting
+
+#endif // !__SCENE_QUERY_H__
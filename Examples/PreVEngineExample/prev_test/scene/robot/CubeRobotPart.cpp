@@ -47,7 +47,9 @@ void CubeRobotPart::Init()
 void CubeRobotPart::Update(float deltaTime)
 {
     m_transformComponent->Update(deltaTime);
-    m_boundingVolumeComponent->Update(m_transformComponent->GetWorldTransformScaled());
+    if (m_transformComponent->IsWorldTransformChanged()) {
+        m_boundingVolumeComponent->Update(m_transformComponent->GetWorldTransformScaled());
+    }
 
     SceneNode::Update(deltaTime);
 }
@@ -48,7 +48,9 @@ void Terrain::Init()
 void Terrain::Update(float deltaTime)
 {
     m_transformComponent->Update(deltaTime);
-    m_boundingVolumeComponent->Update(m_transformComponent->GetWorldTransform());
+    if (m_transformComponent->IsWorldTransformChanged()) {
+        m_boundingVolumeComponent->Update(m_transformComponent->GetWorldTransform());
+    }
 
     SceneNode::Update(deltaTime);
 }
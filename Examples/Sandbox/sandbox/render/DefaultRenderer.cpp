@@ -111,8 +111,8 @@ void DefaultRenderer::Render(GfxRenderPassEncoder encoder, const GfxScissorRect&
 
     const auto& model{ modelComponent->GetModel() };
 
-    gfxRenderPassEncoderSetVertexBuffer(encoder, 0, *model->vertexBuffer, 0, model->vertexBuffer->GetSize());
-    gfxRenderPassEncoderSetIndexBuffer(encoder, *model->indexBuffer, GFX_INDEX_FORMAT_UINT32, 0, model->indexBuffer->GetSize());
+    gfxRenderPassEncoderSetVertexBuffer(encoder, 0, *model->vertexBuffer, model->vertexBuffer->GetOffset(), model->vertexBuffer->GetSize());
+    gfxRenderPassEncoderSetIndexBuffer(encoder, *model->indexBuffer, GFX_INDEX_FORMAT_UINT32, model->indexBuffer->GetOffset(), model->indexBuffer->GetSize());
     gfxRenderPassEncoderSetBindGroup(encoder, 0, bindGroup, nullptr, 0);
     gfxRenderPassEncoderDrawIndexed(encoder, model->indexCount, 1, 0, 0, 0);
 }
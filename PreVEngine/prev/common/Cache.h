@@ -1,51 +1,291 @@
 #ifndef __CACHE_H__
 #define __CACHE_H__
 
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <future>
+#include <limits>
+#include <list>
 #include <memory>
+#include <mutex>
 #include <optional>
+#include <type_traits>
 #include <unordered_map>
+#include <vector>
 
 namespace prev::common {
 
-// TODO: no size limit
-// TODO: not thread-safe
-template <typename KeyType, typename ValueType>
+struct CacheStatistics {
+    uint64_t hitCount{};
+
+    uint64_t missCount{};
+
+    uint64_t evictionCount{};
+
+    size_t size{};
+
+    size_t cost{};
+};
+
+// Thread-safe cache with least recently used eviction. Keys are spread over shards with a lock each, the cost budget
+// is shared by all of them - an insert over budget evicts the least recently used entries of its own shard first and
+// then of the other shards that are not locked at the moment. Without a cost function every entry costs 1, so maxCost
+// is an entry count.
+template <typename KeyType, typename ValueType, typename HashType = std::hash<KeyType>>
 class Cache final {
 public:
-    std::optional<ValueType> Find(const KeyType& key) const
+    using CostFunction = std::function<size_t(const ValueType&)>;
+
+    explicit Cache(const size_t maxCost = std::numeric_limits<size_t>::max(), CostFunction costFunction = {}, const size_t shardCount = DEFAULT_SHARD_COUNT)
+        : m_maxCost{ maxCost }
+        , m_costFunction{ std::move(costFunction) }
+        , m_shards(std::max(shardCount, size_t{ 1 }))
     {
-        auto iter = m_storage.find(key);
-        if (iter == m_storage.cend()) {
+    }
+
+    ~Cache() = default;
+
+    Cache(const Cache&) = delete;
+    Cache& operator=(const Cache&) = delete;
+
+public:
+    std::optional<ValueType> Find(const KeyType& key)
+    {
+        auto& shard{ GetShard(key) };
+        std::lock_guard<std::mutex> lock{ shard.mutex };
+        auto iter{ shard.entries.find(key) };
+        if (iter == shard.entries.end()) {
+            ++m_missCount;
             return {};
         }
-        return iter->second;
+        ++m_hitCount;
+        shard.Touch(iter->second);
+        return iter->second->value;
     }
 
     bool Contains(const KeyType& key) const
     {
-        return m_storage.find(key) == m_storage.cend();
+        const auto& shard{ GetShard(key) };
+        std::lock_guard<std::mutex> lock{ shard.mutex };
+        return shard.entries.find(key) != shard.entries.cend();
     }
 
     void Add(const KeyType& key, const ValueType& value)
     {
-        m_storage[key] = value;
+        auto& shard{ GetShard(key) };
+        std::lock_guard<std::mutex> lock{ shard.mutex };
+        Insert(shard, key, value);
+    }
+
+    // Returns the cached value or the one created by `create`. Concurrent misses on the same key wait for
+    // a single call of `create` instead of running it each. When `create` throws, all of them rethrow. A null
+    // value (a failed create of a pointer) is returned but not cached, the next call tries again.
+    template <typename CreateFunction>
+    ValueType GetOrCreate(const KeyType& key, CreateFunction&& create)
+    {
+        auto& shard{ GetShard(key) };
+        std::unique_lock<std::mutex> lock{ shard.mutex };
+        if (auto iter = shard.entries.find(key); iter != shard.entries.end()) {
+            ++m_hitCount;
+            shard.Touch(iter->second);
+            return iter->second->value;
+        }
+
+        if (auto pendingIter = shard.pendingEntries.find(key); pendingIter != shard.pendingEntries.end()) {
+            // somebody else is already creating it
+            ++m_hitCount;
+            auto future{ pendingIter->second };
+            lock.unlock();
+            return future.get();
+        }
+
+        ++m_missCount;
+        std::promise<ValueType> promise{};
+        shard.pendingEntries.emplace(key, promise.get_future().share());
+        lock.unlock();
+
+        try {
+            ValueType value{ create() };
+
+            lock.lock();
+            if (!IsNull(value)) {
+                Insert(shard, key, value);
+            }
+            shard.pendingEntries.erase(key);
+            lock.unlock();
+
+            promise.set_value(value);
+            return value;
+        } catch (...) {
+            lock.lock();
+            shard.pendingEntries.erase(key);
+            lock.unlock();
+
+            promise.set_exception(std::current_exception());
+            throw;
+        }
     }
 
     void Remove(const KeyType& key)
     {
-        if (Contains(key)) {
-            m_storage.erase(key);
+        auto& shard{ GetShard(key) };
+        std::lock_guard<std::mutex> lock{ shard.mutex };
+        if (auto iter = shard.entries.find(key); iter != shard.entries.end()) {
+            Erase(shard, iter);
         }
     }
 
     void Clear()
     {
-        m_storage.clear();
+        for (auto& shard : m_shards) {
+            std::lock_guard<std::mutex> lock{ shard.mutex };
+            m_cost -= shard.cost;
+            shard.entries.clear();
+            shard.order.clear();
+            shard.cost = 0;
+        }
+    }
+
+    CacheStatistics GetStatistics() const
+    {
+        CacheStatistics statistics{ m_hitCount.load(), m_missCount.load(), m_evictionCount.load() };
+        for (const auto& shard : m_shards) {
+            std::lock_guard<std::mutex> lock{ shard.mutex };
+            statistics.size += shard.entries.size();
+            statistics.cost += shard.cost;
+        }
+        return statistics;
     }
 
 private:
-    std::unordered_map<KeyType, ValueType> m_storage;
+    struct Entry {
+        KeyType key;
+
+        ValueType value;
+
+        size_t cost;
+    };
+
+    using EntryList = std::list<Entry>;
+
+    struct Shard {
+        // the most recently used entry is at the front
+        void Touch(typename EntryList::iterator entry)
+        {
+            order.splice(order.begin(), order, entry);
+        }
+
+        mutable std::mutex mutex;
+
+        EntryList order;
+
+        std::unordered_map<KeyType, typename EntryList::iterator, HashType> entries;
+
+        std::unordered_map<KeyType, std::shared_future<ValueType>, HashType> pendingEntries;
+
+        size_t cost{};
+    };
+
+    using EntryMapIterator = typename std::unordered_map<KeyType, typename EntryList::iterator, HashType>::iterator;
+
+private:
+    Shard& GetShard(const KeyType& key)
+    {
+        return m_shards[HashType{}(key) % m_shards.size()];
+    }
+
+    const Shard& GetShard(const KeyType& key) const
+    {
+        return m_shards[HashType{}(key) % m_shards.size()];
+    }
+
+    static bool IsNull(const ValueType& value)
+    {
+        if constexpr (std::is_assignable_v<ValueType&, std::nullptr_t>) {
+            return value == nullptr;
+        } else {
+            return false;
+        }
+    }
+
+    size_t ComputeCost(const ValueType& value) const
+    {
+        return m_costFunction ? m_costFunction(value) : 1;
+    }
+
+    void Erase(Shard& shard, const EntryMapIterator iter)
+    {
+        shard.cost -= iter->second->cost;
+        m_cost -= iter->second->cost;
+        shard.order.erase(iter->second);
+        shard.entries.erase(iter);
+    }
+
+    void EvictLeastRecentlyUsed(Shard& shard)
+    {
+        Erase(shard, shard.entries.find(shard.order.back().key));
+        ++m_evictionCount;
+    }
+
+    void Insert(Shard& shard, const KeyType& key, const ValueType& value)
+    {
+        if (auto iter = shard.entries.find(key); iter != shard.entries.end()) {
+            Erase(shard, iter);
+        }
+
+        const auto cost{ ComputeCost(value) };
+        shard.order.push_front(Entry{ key, value, cost });
+        shard.entries.emplace(key, shard.order.begin());
+        shard.cost += cost;
+        m_cost += cost;
+
+        // an entry over the whole budget still stays, until the next one pushes it out
+        while (m_cost > m_maxCost && shard.order.size() > 1) {
+            EvictLeastRecentlyUsed(shard);
+        }
+
+        // only try the other locks - waiting for them while holding this one could deadlock with their inserts
+        for (auto& otherShard : m_shards) {
+            if (m_cost <= m_maxCost) {
+                break;
+            }
+
+            if (&otherShard == &shard) {
+                continue;
+            }
+
+            std::unique_lock<std::mutex> otherLock{ otherShard.mutex, std::try_to_lock };
+            if (!otherLock) {
+                continue;
+            }
+
+            while (m_cost > m_maxCost && !otherShard.order.empty()) {
+                EvictLeastRecentlyUsed(otherShard);
+            }
+        }
+    }
+
+private:
+    static const inline size_t DEFAULT_SHARD_COUNT{ 8 };
+
+private:
+    const size_t m_maxCost;
+
+    CostFunction m_costFunction;
+
+    std::vector<Shard> m_shards;
+
+    // summed over all shards
+    std::atomic<size_t> m_cost{};
+
+    std::atomic<uint64_t> m_hitCount{};
+
+    std::atomic<uint64_t> m_missCount{};
+
+    std::atomic<uint64_t> m_evictionCount{};
 };
 } // namespace prev::common
 
-#endif // !__CACHE_H__
\ No newline at end of file
+#endif // !__CACHE_H__
@@ -0,0 +1,96 @@
+#include "FrameAllocator.h"
+
+#include <algorithm>
+#include <cassert>
+#include <memory>
+
+namespace prev::common {
+namespace {
+    struct FrameBlock {
+        std::unique_ptr<uint8_t[]> data;
+
+        size_t size{};
+    };
+
+    struct FrameRegion {
+        std::vector<FrameBlock> blocks;
+
+        size_t blockIndex{};
+
+        size_t offset{};
+
+        size_t usedSize{};
+
+        uint64_t frameIndex{};
+    };
+
+    // freed with its thread
+    thread_local FrameRegion threadRegion{};
+
+    void* AllocateFromBlock(FrameRegion& region, const size_t size, const size_t alignment)
+    {
+        auto& block{ region.blocks[region.blockIndex] };
+        const auto base{ reinterpret_cast<uintptr_t>(block.data.get()) };
+        const auto alignedOffset{ ((base + region.offset + alignment - 1) & ~(static_cast<uintptr_t>(alignment) - 1)) - base };
+        if (alignedOffset + size > block.size) {
+            return nullptr;
+        }
+
+        region.usedSize += alignedOffset + size - region.offset;
+        region.offset = alignedOffset + size;
+        return block.data.get() + alignedOffset;
+    }
+} // namespace
+
+void FrameAllocator::BeginFrame()
+{
+    m_frameIndex.fetch_add(1, std::memory_order_release);
+}
+
+uint64_t FrameAllocator::GetFrameIndex() const
+{
+    return m_frameIndex.load(std::memory_order_acquire);
+}
+
+void* FrameAllocator::Allocate(const size_t size, const size_t alignment)
+{
+    assert(alignment > 0 && (alignment & (alignment - 1)) == 0);
+
+    auto& region{ threadRegion };
+    const uint64_t frameIndex{ GetFrameIndex() };
+    if (region.frameIndex != frameIndex) {
+        region.blockIndex = 0;
+        region.offset = 0;
+        region.usedSize = 0;
+        region.frameIndex = frameIndex;
+    }
+
+    // the rest of a block that does not fit is skipped until the next frame
+    for (; region.blockIndex < region.blocks.size(); ++region.blockIndex, region.offset = 0) {
+        if (auto memory = AllocateFromBlock(region, size, alignment)) {
+            return memory;
+        }
+    }
+
+    const size_t blockSize{ std::max(BLOCK_SIZE, size + alignment) };
+    region.blocks.push_back(FrameBlock{ std::unique_ptr<uint8_t[]>(new uint8_t[blockSize]), blockSize });
+    region.blockIndex = region.blocks.size() - 1;
+    region.offset = 0;
+    return AllocateFromBlock(region, size, alignment);
+}
+
+size_t FrameAllocator::GetThreadUsedSize() const
+{
+    const auto& region{ threadRegion };
+    return region.frameIndex == GetFrameIndex() ? region.usedSize : 0;
+}
+
+size_t FrameAllocator::GetThreadCapacity() const
+{
+    size_t capacity{};
+    for (const auto& block : threadRegion.blocks) {
+        capacity += block.size;
+    }
+    return capacity;
+}
+} // namespace prev::common
@@ -0,0 +1,94 @@
+#ifndef __FRAME_ALLOCATOR_H__
+#define __FRAME_ALLOCATOR_H__
+
+#include "pattern/Singleton.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace prev::common {
+// Linear arena for data living within a frame. Each thread bumps a pointer in its own region, so allocating takes
+// no lock, and nothing is freed one by one - a region starts over at its thread's first allocation after
+// BeginFrame. Memory handed out is valid until the next BeginFrame, do not keep it any longer. The blocks of
+// a region are kept for the next frames, so that a steady state frame does not touch the heap at all.
+class FrameAllocator final : public prev::common::pattern::Singleton<FrameAllocator> {
+private:
+    friend class prev::common::pattern::Singleton<FrameAllocator>;
+
+private:
+    FrameAllocator() = default;
+
+public:
+    ~FrameAllocator() = default;
+
+public:
+    // Called by the engine once per frame.
+    void BeginFrame();
+
+    uint64_t GetFrameIndex() const;
+
+    // Called from any thread, alignment is a power of two.
+    void* Allocate(const size_t size, const size_t alignment = alignof(std::max_align_t));
+
+    template <typename T>
+    T* Allocate(const size_t count)
+    {
+        return static_cast<T*>(Allocate(count * sizeof(T), alignof(T)));
+    }
+
+    // Of the calling thread's region in the current frame.
+    size_t GetThreadUsedSize() const;
+
+    size_t GetThreadCapacity() const;
+
+private:
+    static const inline size_t BLOCK_SIZE{ 256 * 1024 };
+
+private:
+    std::atomic<uint64_t> m_frameIndex{};
+};
+
+// Hands out frame memory to containers, deallocate does nothing.
+template <typename T>
+class FrameStlAllocator {
+public:
+    using value_type = T;
+
+    FrameStlAllocator() = default;
+
+    template <typename OtherType>
+    FrameStlAllocator(const FrameStlAllocator<OtherType>&) noexcept
+    {
+    }
+
+public:
+    T* allocate(const size_t count)
+    {
+        return FrameAllocator::Instance().Allocate<T>(count);
+    }
+
+    void deallocate(T*, const size_t) noexcept
+    {
+    }
+
+    template <typename OtherType>
+    bool operator==(const FrameStlAllocator<OtherType>&) const noexcept
+    {
+        return true;
+    }
+
+    template <typename OtherType>
+    bool operator!=(const FrameStlAllocator<OtherType>&) const noexcept
+    {
+        return false;
+    }
+};
+
+// Every reallocation leaves its old storage behind until the frame ends, reserve when the size is known.
+template <typename T>
+using FrameVector = std::vector<T, FrameStlAllocator<T>>;
+} // namespace prev::common
+
+#endif // !__FRAME_ALLOCATOR_H__
@@ -1,5 +1,696 @@
 #include "Logger.h"
 
+#include <algorithm>
+#include <chrono>
+#include <csignal>
+#include <exception>
+#include <iterator>
+#include <new>
+
+#if defined(TARGET_PLATFORM_EMSCRIPTEN) && !defined(__EMSCRIPTEN_PTHREADS__)
+#define LOGGER_SYNCHRONOUS
+#endif
+
+namespace prev::common {
+namespace {
+    constexpr uint32_t MAX_MODULE_FILTER_COUNT{ 32 };
+
+    constexpr uint32_t MAX_MODULE_NAME_LENGTH{ 64 };
+
+    constexpr int INHERITED_LEVEL{ -1 };
+
+    struct ModuleFilter {
+        // never changes once published
+        char name[MAX_MODULE_NAME_LENGTH];
+
+        size_t length;
+
+        std::atomic<int> level;
+    };
+
+    // constant initialized, so that the filters work and the logger's lifetime is known at any time
+    std::atomic<LogLevel> globalLevel{ LogLevel::VERBOSE };
+
+    ModuleFilter moduleFilters[MAX_MODULE_FILTER_COUNT]{};
+
+    std::atomic<uint32_t> moduleFilterCount{};
+
+    std::mutex moduleFiltersMutex;
+
+    std::atomic<Logger*> loggerInstance{};
+
+    std::atomic<bool> loggerDestroyed{};
+
+    uint64_t GetTimestamp()
+    {
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+    }
+
+    template <typename T>
+    T ReadValue(const uint8_t*& data)
+    {
+        T value;
+        std::memcpy(&value, data, sizeof(T));
+        data += sizeof(T);
+        return value;
+    }
+
+    template <typename T>
+    void AppendFormatted(std::string& outMessage, const char* specification, const T value)
+    {
+        const int length{ std::snprintf(nullptr, 0, specification, value) };
+        if (length <= 0) {
+            return;
+        }
+        const size_t offset{ outMessage.size() };
+        outMessage.resize(offset + length);
+        std::snprintf(outMessage.data() + offset, length + 1, specification, value);
+    }
+
+    struct LogArgument {
+        LogArgumentType type{};
+
+        const uint8_t* value{};
+    };
+
+    void AppendArgument(std::string& outMessage, const char* specification, const LogArgument& argument)
+    {
+        const uint8_t* value{ argument.value };
+        switch (argument.type) {
+        case LogArgumentType::INT:
+            AppendFormatted(outMessage, specification, ReadValue<int>(value));
+            break;
+        case LogArgumentType::UNSIGNED_INT:
+            AppendFormatted(outMessage, specification, ReadValue<unsigned int>(value));
+            break;
+        case LogArgumentType::LONG:
+            AppendFormatted(outMessage, specification, ReadValue<long>(value));
+            break;
+        case LogArgumentType::UNSIGNED_LONG:
+            AppendFormatted(outMessage, specification, ReadValue<unsigned long>(value));
+            break;
+        case LogArgumentType::LONG_LONG:
+            AppendFormatted(outMessage, specification, ReadValue<long long>(value));
+            break;
+        case LogArgumentType::UNSIGNED_LONG_LONG:
+            AppendFormatted(outMessage, specification, ReadValue<unsigned long long>(value));
+            break;
+        case LogArgumentType::DOUBLE:
+            AppendFormatted(outMessage, specification, ReadValue<double>(value));
+            break;
+        case LogArgumentType::LONG_DOUBLE:
+            AppendFormatted(outMessage, specification, ReadValue<long double>(value));
+            break;
+        case LogArgumentType::STRING:
+            value += sizeof(uint32_t);
+            AppendFormatted(outMessage, specification, reinterpret_cast<const char*>(value));
+            break;
+        case LogArgumentType::POINTER:
+            AppendFormatted(outMessage, specification, ReadValue<const void*>(value));
+            break;
+        }
+    }
+
+    size_t GetArgumentSize(const LogArgumentType type, const uint8_t* value)
+    {
+        switch (type) {
+        case LogArgumentType::INT:
+            return sizeof(int);
+        case LogArgumentType::UNSIGNED_INT:
+            return sizeof(unsigned int);
+        case LogArgumentType::LONG:
+            return sizeof(long);
+        case LogArgumentType::UNSIGNED_LONG:
+            return sizeof(unsigned long);
+        case LogArgumentType::LONG_LONG:
+            return sizeof(long long);
+        case LogArgumentType::UNSIGNED_LONG_LONG:
+            return sizeof(unsigned long long);
+        case LogArgumentType::DOUBLE:
+            return sizeof(double);
+        case LogArgumentType::LONG_DOUBLE:
+            return sizeof(long double);
+        case LogArgumentType::STRING:
+            return sizeof(uint32_t) + ReadValue<uint32_t>(value) + 1;
+        case LogArgumentType::POINTER:
+            return sizeof(const void*);
+        }
+        return 0;
+    }
+
+    // Walks the printf format and formats each conversion with its own argument - the argument has the very
+    // type it was passed with, so the result is the same as of the original printf call.
+    void FormatRecord(const uint8_t* data, LogEntry& outEntry)
+    {
+        const auto header{ ReadValue<LogRecordHeader>(data) };
+        outEntry.timestamp = header.timestamp;
+        outEntry.level = header.level;
+        outEntry.plain = header.plain;
+        outEntry.file = header.file;
+        outEntry.message.clear();
+
+        uint32_t argumentIndex{};
+        const auto NextArgument = [&](LogArgument& outArgument) {
+            if (argumentIndex >= header.argumentCount) {
+                return false;
+            }
+            outArgument.type = ReadValue<LogArgumentType>(data);
+            outArgument.value = data;
+            data += GetArgumentSize(outArgument.type, data);
+            ++argumentIndex;
+            return true;
+        };
+
+        const char* format{ header.format };
+        while (*format) {
+            if (*format != '%') {
+                const char* next{ std::strchr(format, '%') };
+                const size_t length{ next ? static_cast<size_t>(next - format) : std::strlen(format) };
+                outEntry.message.append(format, length);
+                format += length;
+                continue;
+            }
+
+            if (format[1] == '%') {
+                outEntry.message.push_back('%');
+                format += 2;
+                continue;
+            }
+
+            const char* conversion{ format + 1 };
+            while (*conversion && !std::strchr("diouxXeEfFgGaAcspn", *conversion)) {
+                ++conversion;
+            }
+            if (!*conversion || *conversion == 'n') {
+                outEntry.message.append(format, *conversion ? conversion + 1 : conversion);
+                format = *conversion ? conversion + 1 : conversion;
+                continue;
+            }
+
+            // a '*' width or precision takes its value from an argument of its own
+            char specification[64]{};
+            size_t specificationLength{};
+            bool valid{ true };
+            for (const char* character = format; character <= conversion && specificationLength + 16 < sizeof(specification); ++character) {
+                LogArgument starArgument{};
+                if (*character != '*') {
+                    specification[specificationLength++] = *character;
+                } else if (NextArgument(starArgument) && starArgument.type == LogArgumentType::INT) {
+                    specificationLength += std::snprintf(specification + specificationLength, sizeof(specification) - specificationLength, "%d", ReadValue<int>(starArgument.value));
+                } else {
+                    valid = false;
+                }
+            }
+
+            LogArgument argument{};
+            if (valid && specification[specificationLength - 1] == *conversion && NextArgument(argument)) {
+                AppendArgument(outEntry.message, specification, argument);
+            } else {
+                outEntry.message.append(format, conversion + 1);
+            }
+            format = conversion + 1;
+        }
+    }
+
+    void WriteToConsole(const LogEntry& entry)
+    {
+#ifdef TARGET_PLATFORM_ANDROID
+        static const android_LogPriority PRIORITIES[]{ ANDROID_LOG_VERBOSE, ANDROID_LOG_DEBUG, ANDROID_LOG_INFO, ANDROID_LOG_WARN, ANDROID_LOG_ERROR, ANDROID_LOG_SILENT };
+        __android_log_write(entry.plain ? ANDROID_LOG_INFO : PRIORITIES[static_cast<uint32_t>(entry.level)], LOG_TAG, entry.message.c_str());
+#else
+        static const ConsoleColor COLORS[]{ ConsoleColor::CYAN, ConsoleColor::BLUE, ConsoleColor::GREEN, ConsoleColor::YELLOW, ConsoleColor::RED, ConsoleColor::RESET };
+        static const char* const PREFIXES[]{ "PERF: ", "DEBUG: ", "INFO: ", "WARNING: ", "ERROR: ", "" };
+        if (!entry.plain) {
+            SetConsoleTextColor(COLORS[static_cast<uint32_t>(entry.level)]);
+            fputs(PREFIXES[static_cast<uint32_t>(entry.level)], stdout);
+            SetConsoleTextColor(ConsoleColor::RESET);
+        }
+        fputs(entry.message.c_str(), stdout);
+        fputc('\n', stdout);
+#endif
+    }
+
+    // the way out when there is no writer thread - before the first message of an exiting thread or after the
+    // logger is gone
+    void WriteSynchronously(const LogRecord& record)
+    {
+        LogEntry entry{};
+        FormatRecord(record.GetData(), entry);
+        WriteToConsole(entry);
+    }
+
+#ifndef LOGGER_SYNCHRONOUS
+    constexpr int CRASH_SIGNALS[]{ SIGSEGV, SIGABRT, SIGFPE, SIGILL };
+
+    using SignalHandler = void (*)(int);
+
+    SignalHandler previousSignalHandlers[std::size(CRASH_SIGNALS)]{};
+
+    std::terminate_handler previousTerminateHandler{};
+
+    // best effort, formatting is not async signal safe
+    void HandleCrashSignal(const int signal)
+    {
+        Logger::FlushOnCrash();
+
+        // the default or the previously installed handler finishes it
+        for (size_t i = 0; i < std::size(CRASH_SIGNALS); ++i) {
+            if (CRASH_SIGNALS[i] == signal) {
+                std::signal(signal, previousSignalHandlers[i] != SIG_ERR ? previousSignalHandlers[i] : SIG_DFL);
+            }
+        }
+        std::raise(signal);
+    }
+
+    void HandleTerminate()
+    {
+        Logger::FlushOnCrash();
+        if (previousTerminateHandler) {
+            previousTerminateHandler();
+        }
+        std::abort();
+    }
+
+    void InstallCrashHandlers()
+    {
+        for (size_t i = 0; i < std::size(CRASH_SIGNALS); ++i) {
+            previousSignalHandlers[i] = std::signal(CRASH_SIGNALS[i], HandleCrashSignal);
+        }
+        previousTerminateHandler = std::set_terminate(HandleTerminate);
+    }
+
+    void UninstallCrashHandlers()
+    {
+        for (size_t i = 0; i < std::size(CRASH_SIGNALS); ++i) {
+            if (previousSignalHandlers[i] != SIG_ERR) {
+                std::signal(CRASH_SIGNALS[i], previousSignalHandlers[i]);
+            }
+        }
+        std::set_terminate(previousTerminateHandler);
+    }
+#endif
+} // namespace
+
+// Single producer single consumer ring of records, the producer being the thread it belongs to.
+class LogRing final {
+public:
+    LogRing(const uint32_t capacity, const uint32_t threadIndex)
+        : m_data{ std::make_unique<uint8_t[]>(capacity) }
+        , m_capacity{ capacity }
+        , m_threadIndex{ threadIndex }
+    {
+    }
+
+    ~LogRing() = default;
+
+public:
+    bool TryPush(const uint8_t* record, const uint32_t size)
+    {
+        const uint64_t tail{ m_tail.load(std::memory_order_relaxed) };
+        const uint64_t head{ m_head.load(std::memory_order_acquire) };
+        if (m_capacity - (tail - head) < size) {
+            return false;
+        }
+        Copy(tail, record, size);
+        m_tail.store(tail + size, std::memory_order_release);
+        return true;
+    }
+
+    bool TryPop(std::vector<uint8_t>& outRecord)
+    {
+        const uint64_t head{ m_head.load(std::memory_order_relaxed) };
+        const uint64_t tail{ m_tail.load(std::memory_order_acquire) };
+        if (head == tail) {
+            return false;
+        }
+
+        uint32_t size{};
+        CopyOut(head, reinterpret_cast<uint8_t*>(&size), sizeof(size));
+        outRecord.resize(size);
+        CopyOut(head, outRecord.data(), size);
+        m_head.store(head + size, std::memory_order_release);
+        return true;
+    }
+
+    bool IsHalfFull() const
+    {
+        return m_tail.load(std::memory_order_relaxed) - m_head.load(std::memory_order_relaxed) > m_capacity / 2;
+    }
+
+    bool IsEmpty() const
+    {
+        return m_tail.load(std::memory_order_acquire) == m_head.load(std::memory_order_relaxed);
+    }
+
+    void Close()
+    {
+        m_closed.store(true, std::memory_order_release);
+    }
+
+    bool IsClosed() const
+    {
+        return m_closed.load(std::memory_order_acquire);
+    }
+
+    uint32_t GetThreadIndex() const
+    {
+        return m_threadIndex;
+    }
+
+private:
+    void Copy(const uint64_t position, const uint8_t* data, const uint32_t size)
+    {
+        const uint32_t offset{ static_cast<uint32_t>(position % m_capacity) };
+        const uint32_t firstSize{ std::min(size, m_capacity - offset) };
+        std::memcpy(m_data.get() + offset, data, firstSize);
+        std::memcpy(m_data.get(), data + firstSize, size - firstSize);
+    }
+
+    void CopyOut(const uint64_t position, uint8_t* outData, const uint32_t size) const
+    {
+        const uint32_t offset{ static_cast<uint32_t>(position % m_capacity) };
+        const uint32_t firstSize{ std::min(size, m_capacity - offset) };
+        std::memcpy(outData, m_data.get() + offset, firstSize);
+        std::memcpy(outData + firstSize, m_data.get(), size - firstSize);
+    }
+
+private:
+    std::unique_ptr<uint8_t[]> m_data;
+
+    uint32_t m_capacity{};
+
+    uint32_t m_threadIndex{};
+
+    alignas(64) std::atomic<uint64_t> m_head{};
+
+    alignas(64) std::atomic<uint64_t> m_tail{};
+
+    std::atomic<bool> m_closed{};
+};
+
+namespace {
+    // set once the thread's ring is gone, the thread's last messages are written synchronously
+    thread_local bool threadExiting{};
+
+    struct ThreadRingHolder {
+        std::shared_ptr<LogRing> ring;
+
+        ~ThreadRingHolder()
+        {
+            threadExiting = true;
+            if (ring) {
+                ring->Close();
+            }
+        }
+    };
+
+    thread_local ThreadRingHolder threadRingHolder{};
+} // namespace
+
+LogRecord::LogRecord(const LogLevel level, const bool plain, const char* file, const char* format)
+{
+    new (m_data) LogRecordHeader{ sizeof(LogRecordHeader), level, plain, 0, GetTimestamp(), file, format };
+    m_size = sizeof(LogRecordHeader);
+}
+
+const uint8_t* LogRecord::GetData() const
+{
+    return m_data;
+}
+
+uint32_t LogRecord::GetSize() const
+{
+    return m_size;
+}
+
+void LogRecord::AddString(const char* value)
+{
+    if (!value) {
+        value = "(null)";
+    }
+
+    // long strings are cut to fit the record
+    const uint32_t reservedSize{ static_cast<uint32_t>(sizeof(LogArgumentType) + sizeof(uint32_t) + 1) };
+    if (m_size + reservedSize > MAX_SIZE) {
+        return;
+    }
+    const uint32_t length{ static_cast<uint32_t>(std::min<size_t>(std::strlen(value), MAX_SIZE - m_size - reservedSize)) };
+
+    const LogArgumentType type{ LogArgumentType::STRING };
+    std::memcpy(m_data + m_size, &type, sizeof(type));
+    std::memcpy(m_data + m_size + sizeof(type), &length, sizeof(length));
+    std::memcpy(m_data + m_size + sizeof(type) + sizeof(length), value, length);
+    m_data[m_size + reservedSize - 1 + length] = '\0';
+    m_size += reservedSize + length;
+    OnArgumentAdded();
+}
+
+void LogRecord::OnArgumentAdded()
+{
+    auto& header{ *std::launder(reinterpret_cast<LogRecordHeader*>(m_data)) };
+    header.size = m_size;
+    ++header.argumentCount;
+}
+
+Logger::Logger()
+{
+    loggerInstance.store(this, std::memory_order_release);
+#ifndef LOGGER_SYNCHRONOUS
+    m_running = true;
+    m_thread = std::thread([this]() { Run(); });
+    InstallCrashHandlers();
+#endif
+}
+
+Logger::~Logger()
+{
+#ifndef LOGGER_SYNCHRONOUS
+    UninstallCrashHandlers();
+    {
+        std::scoped_lock lock{ m_wakeMutex };
+        m_running = false;
+    }
+    m_wakeCondition.notify_one();
+    m_thread.join();
+    Drain();
+#endif
+    loggerDestroyed.store(true, std::memory_order_release);
+    loggerInstance.store(nullptr, std::memory_order_release);
+    fflush(stdout);
+}
+
+bool Logger::IsEnabled(const LogLevel level, const char* file)
+{
+    const auto defaultLevel{ globalLevel.load(std::memory_order_relaxed) };
+    const uint32_t filterCount{ moduleFilterCount.load(std::memory_order_acquire) };
+    if (filterCount == 0) {
+        return level >= defaultLevel;
+    }
+
+    auto effectiveLevel{ defaultLevel };
+    size_t matchLength{};
+    for (uint32_t i = 0; i < filterCount; ++i) {
+        const auto& filter{ moduleFilters[i] };
+        const int filterLevel{ filter.level.load(std::memory_order_relaxed) };
+        if (filterLevel != INHERITED_LEVEL && filter.length > matchLength && std::strstr(file, filter.name)) {
+            effectiveLevel = static_cast<LogLevel>(filterLevel);
+            matchLength = filter.length;
+        }
+    }
+    return level >= effectiveLevel;
+}
+
+void Logger::SetLevel(const LogLevel level)
+{
+    globalLevel.store(level, std::memory_order_relaxed);
+}
+
+LogLevel Logger::GetLevel()
+{
+    return globalLevel.load(std::memory_order_relaxed);
+}
+
+bool Logger::SetModuleLevel(const std::string& module, const LogLevel level)
+{
+    if (module.empty() || module.size() >= MAX_MODULE_NAME_LENGTH) {
+        return false;
+    }
+
+    std::scoped_lock lock{ moduleFiltersMutex };
+    const uint32_t filterCount{ moduleFilterCount.load(std::memory_order_relaxed) };
+    for (uint32_t i = 0; i < filterCount; ++i) {
+        if (module == moduleFilters[i].name) {
+            moduleFilters[i].level.store(static_cast<int>(level), std::memory_order_relaxed);
+            return true;
+        }
+    }
+
+    if (filterCount >= MAX_MODULE_FILTER_COUNT) {
+        return false;
+    }
+
+    auto& filter{ moduleFilters[filterCount] };
+    std::memcpy(filter.name, module.c_str(), module.size() + 1);
+    filter.length = module.size();
+    filter.level.store(static_cast<int>(level), std::memory_order_relaxed);
+    moduleFilterCount.store(filterCount + 1, std::memory_order_release);
+    return true;
+}
+
+void Logger::ClearModuleLevels()
+{
+    // the names stay, a thread may be reading them
+    std::scoped_lock lock{ moduleFiltersMutex };
+    for (auto& filter : moduleFilters) {
+        filter.level.store(INHERITED_LEVEL, std::memory_order_relaxed);
+    }
+}
+
+void Logger::Flush()
+{
+    if (auto logger = loggerInstance.load(std::memory_order_acquire)) {
+        logger->Drain();
+    }
+    fflush(stdout);
+}
+
+void Logger::FlushOnCrash()
+{
+    auto logger{ loggerInstance.load(std::memory_order_acquire) };
+    if (!logger || logger->m_drainThreadId.load(std::memory_order_acquire) == std::this_thread::get_id()) {
+        fflush(stdout);
+        return;
+    }
+
+    if (logger->m_drainMutex.try_lock_for(std::chrono::milliseconds(CRASH_FLUSH_TIMEOUT_MS))) {
+        logger->m_drainMutex.unlock();
+        logger->Drain();
+    }
+    fflush(stdout);
+}
+
+void Logger::SetSink(const LogSink& sink)
+{
+    std::scoped_lock lock{ m_drainMutex };
+    m_sink = sink;
+}
+
+void Logger::ResetSink()
+{
+    std::scoped_lock lock{ m_drainMutex };
+    m_sink = nullptr;
+}
+
+uint64_t Logger::GetDroppedCount() const
+{
+    return m_droppedCount.load(std::memory_order_relaxed);
+}
+
+void Logger::Submit(const LogRecord& record)
+{
+#ifdef LOGGER_SYNCHRONOUS
+    WriteSynchronously(record);
+#else
+    if (threadExiting || loggerDestroyed.load(std::memory_order_acquire)) {
+        WriteSynchronously(record);
+        return;
+    }
+
+    auto& logger{ Instance() };
+    LogRing* ring{ threadRingHolder.ring.get() };
+    if (!ring) {
+        ring = logger.RegisterThreadRing();
+    }
+
+    if (!ring->TryPush(record.GetData(), record.GetSize())) {
+        logger.m_droppedCount.fetch_add(1, std::memory_order_relaxed);
+        logger.Wake();
+        return;
+    }
+
+    if (ring->IsHalfFull()) {
+        logger.Wake();
+    }
+#endif
+}
+
+LogRing* Logger::RegisterThreadRing()
+{
+    std::scoped_lock lock{ m_ringsMutex };
+    threadRingHolder.ring = std::make_shared<LogRing>(RING_SIZE, m_nextThreadIndex++);
+    m_rings.push_back(threadRingHolder.ring);
+    return threadRingHolder.ring.get();
+}
+
+void Logger::Wake()
+{
+    m_wakeCondition.notify_one();
+}
+
+void Logger::Run()
+{
+    std::unique_lock lock{ m_wakeMutex };
+    while (m_running) {
+        m_wakeCondition.wait_for(lock, std::chrono::milliseconds(WRITE_INTERVAL_MS));
+        lock.unlock();
+        Drain();
+        lock.lock();
+    }
+}
+
+void Logger::Drain()
+{
+    std::scoped_lock lock{ m_drainMutex };
+    // a crash within the drain must not flush again on the same thread
+    m_drainThreadId.store(std::this_thread::get_id(), std::memory_order_release);
+
+    {
+        std::scoped_lock ringsLock{ m_ringsMutex };
+        m_drainRings.assign(m_rings.cbegin(), m_rings.cend());
+    }
+
+    // messages of all threads go out in the order they were logged in
+    size_t entryCount{};
+    for (const auto& ring : m_drainRings) {
+        while (ring->TryPop(m_drainRecord)) {
+            if (entryCount == m_drainEntries.size()) {
+                m_drainEntries.emplace_back();
+            }
+            auto& entry{ m_drainEntries[entryCount++] };
+            FormatRecord(m_drainRecord.data(), entry);
+            entry.threadIndex = ring->GetThreadIndex();
+        }
+    }
+    std::stable_sort(m_drainEntries.begin(), m_drainEntries.begin() + entryCount, [](const auto& a, const auto& b) { return a.timestamp < b.timestamp; });
+
+    for (size_t i = 0; i < entryCount; ++i) {
+        if (m_sink) {
+            m_sink(m_drainEntries[i]);
+        } else {
+            WriteToConsole(m_drainEntries[i]);
+        }
+    }
+
+    const uint64_t droppedCount{ m_droppedCount.load(std::memory_order_relaxed) };
+    if (droppedCount > m_reportedDroppedCount) {
+        LogEntry entry{ GetTimestamp(), LogLevel::WARNING, false, 0, __FILE__, "Logger dropped " + std::to_string(droppedCount - m_reportedDroppedCount) + " messages, their thread's ring was full" };
+        if (m_sink) {
+            m_sink(entry);
+        } else {
+            WriteToConsole(entry);
+        }
+        m_reportedDroppedCount = droppedCount;
+    }
+
+    {
+        std::scoped_lock ringsLock{ m_ringsMutex };
+        m_rings.erase(std::remove_if(m_rings.begin(), m_rings.end(), [](const auto& ring) { return ring->IsClosed() && ring->IsEmpty(); }), m_rings.end());
+    }
+    m_drainRings.clear();
+    m_drainThreadId.store(std::thread::id{}, std::memory_order_release);
+}
+} // namespace prev::common
+
 void SetConsoleTextColor(const ConsoleColor color)
 {
 #if defined(TARGET_PLATFORM_WINDOWS)
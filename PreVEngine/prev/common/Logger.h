@@ -3,9 +3,23 @@
 
 #include "Common.h"
 
+#include "pattern/Singleton.h"
+
 #include <assert.h>
 #include <stdio.h>
 
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
 enum class ConsoleColor {
     RESET,
     RED,
@@ -27,8 +41,10 @@ enum class ConsoleColor {
 
 void SetConsoleTextColor(const ConsoleColor color);
 
+// Prints right away, the messages logged before are written out first to keep the order.
 #define print(COLOR, ...)                         \
     {                                             \
+        ::prev::common::Logger::Flush();          \
         SetConsoleTextColor(COLOR);               \
         printf(__VA_ARGS__);                      \
         SetConsoleTextColor(ConsoleColor::RESET); \
@@ -38,61 +54,259 @@ void SetConsoleTextColor(const ConsoleColor color);
 #include <android/log.h>
 #include <jni.h>
 #define LOG_TAG "PreVEngine"
-#define _LOG(...) __android_log_print(ANDROID_LOG_INFO, LOG_TAG, __VA_ARGS__)
-#define _LOGV(...) __android_log_print(ANDROID_LOG_VERBOSE, LOG_TAG, __VA_ARGS__)
-#define _LOGD(...) __android_log_print(ANDROID_LOG_DEBUG, LOG_TAG, __VA_ARGS__)
-#define _LOGI(...) __android_log_print(ANDROID_LOG_INFO, LOG_TAG, __VA_ARGS__)
-#define _LOGW(...) __android_log_print(ANDROID_LOG_WARN, LOG_TAG, __VA_ARGS__)
-#define _LOGE(...) __android_log_print(ANDROID_LOG_ERROR, LOG_TAG, __VA_ARGS__)
-#else
-#define _LOG(...)            \
-    {                        \
-        printf(__VA_ARGS__); \
-        printf("\n");        \
-    }
-#define _LOGV(...)                           \
-    {                                        \
-        print(ConsoleColor::CYAN, "PERF: "); \
-        printf(__VA_ARGS__);                 \
-        printf("\n");                        \
-    }
-#define _LOGD(...)                            \
-    {                                         \
-        print(ConsoleColor::BLUE, "DEBUG: "); \
-        printf(__VA_ARGS__);                  \
-        printf("\n");                         \
-    }
-#define _LOGI(...)                            \
-    {                                         \
-        print(ConsoleColor::GREEN, "INFO: "); \
-        printf(__VA_ARGS__);                  \
-        printf("\n");                         \
+#endif
+
+namespace prev::common {
+enum class LogLevel : uint8_t {
+    VERBOSE,
+    DEBUG,
+    INFO,
+    WARNING,
+    ERR, // ERROR is a macro on Windows
+    OFF
+};
+
+struct LogEntry {
+    // of the steady clock in nanoseconds
+    uint64_t timestamp{};
+
+    LogLevel level{};
+
+    // without the level prefix (LOG)
+    bool plain{};
+
+    // threads are numbered in order of their first message
+    uint32_t threadIndex{};
+
+    const char* file{};
+
+    std::string message;
+};
+
+using LogSink = std::function<void(const LogEntry&)>;
+
+enum class LogArgumentType : uint8_t {
+    INT,
+    UNSIGNED_INT,
+    LONG,
+    UNSIGNED_LONG,
+    LONG_LONG,
+    UNSIGNED_LONG_LONG,
+    DOUBLE,
+    LONG_DOUBLE,
+    STRING,
+    POINTER
+};
+
+struct LogRecordHeader {
+    uint32_t size;
+
+    LogLevel level;
+
+    bool plain;
+
+    uint8_t argumentCount;
+
+    uint64_t timestamp;
+
+    const char* file;
+
+    const char* format;
+};
+
+// One message as it goes through a thread's ring - the format pointer and the arguments by value, tagged with
+// their type after the default argument promotions. Strings are copied, so they may die right after the call.
+class LogRecord final {
+public:
+    LogRecord(const LogLevel level, const bool plain, const char* file, const char* format);
+
+    ~LogRecord() = default;
+
+public:
+    template <typename T>
+    void Add(const T& value)
+    {
+        using ValueType = std::decay_t<T>;
+        if constexpr (std::is_same_v<ValueType, char*> || std::is_same_v<ValueType, const char*>) {
+            AddString(value);
+        } else if constexpr (std::is_pointer_v<ValueType> || std::is_null_pointer_v<ValueType>) {
+            AddValue(LogArgumentType::POINTER, static_cast<const void*>(value));
+        } else if constexpr (std::is_same_v<ValueType, long double>) {
+            AddValue(LogArgumentType::LONG_DOUBLE, value);
+        } else if constexpr (std::is_floating_point_v<ValueType>) {
+            AddValue(LogArgumentType::DOUBLE, static_cast<double>(value));
+        } else if constexpr (std::is_enum_v<ValueType>) {
+            Add(static_cast<std::underlying_type_t<ValueType>>(value));
+        } else {
+            static_assert(std::is_integral_v<ValueType>, "Unsupported log argument type");
+            const auto promotedValue{ +value };
+            using PromotedType = decltype(promotedValue);
+            if constexpr (std::is_same_v<PromotedType, const int>) {
+                AddValue(LogArgumentType::INT, promotedValue);
+            } else if constexpr (std::is_same_v<PromotedType, const unsigned int>) {
+                AddValue(LogArgumentType::UNSIGNED_INT, promotedValue);
+            } else if constexpr (std::is_same_v<PromotedType, const long>) {
+                AddValue(LogArgumentType::LONG, promotedValue);
+            } else if constexpr (std::is_same_v<PromotedType, const unsigned long>) {
+                AddValue(LogArgumentType::UNSIGNED_LONG, promotedValue);
+            } else if constexpr (std::is_same_v<PromotedType, const long long>) {
+                AddValue(LogArgumentType::LONG_LONG, promotedValue);
+            } else {
+                static_assert(std::is_same_v<PromotedType, const unsigned long long>, "Unsupported log argument type");
+                AddValue(LogArgumentType::UNSIGNED_LONG_LONG, promotedValue);
+            }
+        }
     }
-#define _LOGW(...)                                \
-    {                                             \
-        print(ConsoleColor::YELLOW, "WARNING: "); \
-        printf(__VA_ARGS__);                      \
-        printf("\n");                             \
+
+    const uint8_t* GetData() const;
+
+    uint32_t GetSize() const;
+
+public:
+    static const inline uint32_t MAX_SIZE{ 2048 };
+
+private:
+    template <typename T>
+    void AddValue(const LogArgumentType type, const T& value)
+    {
+        if (m_size + sizeof(type) + sizeof(value) > MAX_SIZE) {
+            return;
+        }
+        std::memcpy(m_data + m_size, &type, sizeof(type));
+        std::memcpy(m_data + m_size + sizeof(type), &value, sizeof(value));
+        m_size += static_cast<uint32_t>(sizeof(type) + sizeof(value));
+        OnArgumentAdded();
     }
-#define _LOGE(...)                           \
-    {                                        \
-        print(ConsoleColor::RED, "ERROR: "); \
-        printf(__VA_ARGS__);                 \
-        printf("\n");                        \
+
+    void AddString(const char* value);
+
+    void OnArgumentAdded();
+
+private:
+    alignas(LogRecordHeader) uint8_t m_data[MAX_SIZE];
+
+    uint32_t m_size{};
+};
+
+class LogRing;
+
+// Asynchronous backend of the LOG* macros. A logging thread only encodes a record into its own lock-free ring,
+// formatting and the console output happen on the logger's writer thread. The level and module filters are
+// checked before anything is encoded, so filtered out messages cost a few compares.
+class Logger final : public prev::common::pattern::Singleton<Logger> {
+private:
+    friend class prev::common::pattern::Singleton<Logger>;
+
+private:
+    Logger();
+
+public:
+    ~Logger();
+
+public:
+    // The format has to outlive the logger, a string literal in practice.
+    template <typename... Args>
+    static void Write(const LogLevel level, const bool plain, const char* file, const char* format, const Args&... args)
+    {
+        if (!IsEnabled(level, file)) {
+            return;
+        }
+
+        LogRecord record{ level, plain, file, format };
+        (record.Add(args), ...);
+        Submit(record);
     }
-#endif
+
+    static bool IsEnabled(const LogLevel level, const char* file);
+
+    static void SetLevel(const LogLevel level);
+
+    static LogLevel GetLevel();
+
+    // A module is a part of the source path, like "render/image" - the level of the longest module found in
+    // the path of the logging file applies instead of the global one. Returns false when there is no room.
+    static bool SetModuleLevel(const std::string& module, const LogLevel level);
+
+    static void ClearModuleLevels();
+
+    // Writes out all messages logged so far by any thread, blocks until done.
+    static void Flush();
+
+    // Flush for std::terminate and fatal signals, it waits for a running write only a while - the logger
+    // installs it itself.
+    static void FlushOnCrash();
+
+    // Called on the writer thread or by Flush, the console one by default.
+    void SetSink(const LogSink& sink);
+
+    void ResetSink();
+
+    // Messages lost since the start because the ring of their thread was full.
+    uint64_t GetDroppedCount() const;
+
+private:
+    static void Submit(const LogRecord& record);
+
+    LogRing* RegisterThreadRing();
+
+    void Wake();
+
+    void Run();
+
+    void Drain();
+
+private:
+    static const inline uint32_t RING_SIZE{ 64 * 1024 };
+
+    static const inline uint32_t WRITE_INTERVAL_MS{ 20 };
+
+    static const inline uint32_t CRASH_FLUSH_TIMEOUT_MS{ 200 };
+
+private:
+    std::mutex m_ringsMutex;
+
+    std::vector<std::shared_ptr<LogRing>> m_rings;
+
+    uint32_t m_nextThreadIndex{};
+
+    std::timed_mutex m_drainMutex;
+
+    std::atomic<std::thread::id> m_drainThreadId{};
+
+    std::vector<std::shared_ptr<LogRing>> m_drainRings;
+
+    std::vector<LogEntry> m_drainEntries;
+
+    std::vector<uint8_t> m_drainRecord;
+
+    LogSink m_sink;
+
+    std::atomic<uint64_t> m_droppedCount{};
+
+    uint64_t m_reportedDroppedCount{};
+
+    std::mutex m_wakeMutex;
+
+    std::condition_variable m_wakeCondition;
+
+    bool m_running{};
+
+    std::thread m_thread;
+};
+} // namespace prev::common
 
 #ifdef ENABLE_LOGGING
-#define LOG(...) _LOG(__VA_ARGS__)
-#define LOGV(...) _LOGV(__VA_ARGS__)
-#define LOGD(...) _LOGD(__VA_ARGS__)
-#define LOGI(...) _LOGI(__VA_ARGS__)
-#define LOGW(...) _LOGW(__VA_ARGS__)
-#define LOGE(...) _LOGE(__VA_ARGS__)
+#define LOG(...) ::prev::common::Logger::Write(::prev::common::LogLevel::INFO, true, __FILE__, __VA_ARGS__)
+#define LOGV(...) ::prev::common::Logger::Write(::prev::common::LogLevel::VERBOSE, false, __FILE__, __VA_ARGS__)
+#define LOGD(...) ::prev::common::Logger::Write(::prev::common::LogLevel::DEBUG, false, __FILE__, __VA_ARGS__)
+#define LOGI(...) ::prev::common::Logger::Write(::prev::common::LogLevel::INFO, false, __FILE__, __VA_ARGS__)
+#define LOGW(...) ::prev::common::Logger::Write(::prev::common::LogLevel::WARNING, false, __FILE__, __VA_ARGS__)
+#define LOGE(...) ::prev::common::Logger::Write(::prev::common::LogLevel::ERR, false, __FILE__, __VA_ARGS__)
 #define ASSERT(EXPRESSION, ...)                    \
     {                                              \
         if (!(EXPRESSION)) {                       \
-            _LOGE(__VA_ARGS__);                    \
+            LOGE(__VA_ARGS__);                     \
+            ::prev::common::Logger::Flush();       \
             printf("%s:%d\n", __FILE__, __LINE__); \
             PAUSE;                                 \
             exit(0);                               \
@@ -0,0 +1,271 @@
+#ifndef __SMALL_VECTOR_H__
+#define __SMALL_VECTOR_H__
+
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace prev::common {
+// Vector keeping up to InlineCapacity elements inside of itself, it goes to the heap only when it grows over
+// that. The interface follows std::vector, so that it works with range-for and the std algorithms.
+template <typename T, size_t InlineCapacity>
+class SmallVector final {
+    static_assert(InlineCapacity > 0, "Use std::vector without any inline capacity");
+
+public:
+    using value_type = T;
+
+    using size_type = size_t;
+
+    using iterator = T*;
+
+    using const_iterator = const T*;
+
+    SmallVector() = default;
+
+    SmallVector(std::initializer_list<T> values)
+    {
+        reserve(values.size());
+        for (const auto& value : values) {
+            push_back(value);
+        }
+    }
+
+    SmallVector(const SmallVector& other)
+    {
+        reserve(other.size());
+        for (const auto& value : other) {
+            push_back(value);
+        }
+    }
+
+    SmallVector(SmallVector&& other) noexcept(std::is_nothrow_move_constructible_v<T>)
+    {
+        MoveFrom(std::move(other));
+    }
+
+    ~SmallVector()
+    {
+        clear();
+        FreeHeapStorage();
+    }
+
+    SmallVector& operator=(const SmallVector& other)
+    {
+        if (this != &other) {
+            clear();
+            reserve(other.size());
+            for (const auto& value : other) {
+                push_back(value);
+            }
+        }
+        return *this;
+    }
+
+    SmallVector& operator=(SmallVector&& other) noexcept(std::is_nothrow_move_constructible_v<T>)
+    {
+        if (this != &other) {
+            clear();
+            FreeHeapStorage();
+            MoveFrom(std::move(other));
+        }
+        return *this;
+    }
+
+public:
+    void push_back(const T& value)
+    {
+        emplace_back(value);
+    }
+
+    void push_back(T&& value)
+    {
+        emplace_back(std::move(value));
+    }
+
+    template <typename... Args>
+    T& emplace_back(Args&&... args)
+    {
+        if (m_size == m_capacity) {
+            // the argument may live in this very vector, so the new element is made before the old storage goes
+            T value(std::forward<Args>(args)...);
+            Grow(m_capacity * 2);
+            return *new (m_data + m_size++) T(std::move(value));
+        }
+        return *new (m_data + m_size++) T(std::forward<Args>(args)...);
+    }
+
+    void pop_back()
+    {
+        m_data[--m_size].~T();
+    }
+
+    void clear()
+    {
+        std::destroy(m_data, m_data + m_size);
+        m_size = 0;
+    }
+
+    void reserve(const size_t capacity)
+    {
+        if (capacity > m_capacity) {
+            Grow(capacity);
+        }
+    }
+
+    void resize(const size_t size)
+    {
+        reserve(size);
+        while (m_size < size) {
+            emplace_back();
+        }
+        while (m_size > size) {
+            pop_back();
+        }
+    }
+
+    size_t size() const
+    {
+        return m_size;
+    }
+
+    size_t capacity() const
+    {
+        return m_capacity;
+    }
+
+    bool empty() const
+    {
+        return m_size == 0;
+    }
+
+    // whether the elements are still in the inline storage
+    bool is_inline() const
+    {
+        return m_data == GetInlineStorage();
+    }
+
+    T* data()
+    {
+        return m_data;
+    }
+
+    const T* data() const
+    {
+        return m_data;
+    }
+
+    T& operator[](const size_t index)
+    {
+        return m_data[index];
+    }
+
+    const T& operator[](const size_t index) const
+    {
+        return m_data[index];
+    }
+
+    T& front()
+    {
+        return m_data[0];
+    }
+
+    const T& front() const
+    {
+        return m_data[0];
+    }
+
+    T& back()
+    {
+        return m_data[m_size - 1];
+    }
+
+    const T& back() const
+    {
+        return m_data[m_size - 1];
+    }
+
+    iterator begin()
+    {
+        return m_data;
+    }
+
+    iterator end()
+    {
+        return m_data + m_size;
+    }
+
+    const_iterator begin() const
+    {
+        return m_data;
+    }
+
+    const_iterator end() const
+    {
+        return m_data + m_size;
+    }
+
+private:
+    T* GetInlineStorage()
+    {
+        return reinterpret_cast<T*>(m_inlineStorage);
+    }
+
+    const T* GetInlineStorage() const
+    {
+        return reinterpret_cast<const T*>(m_inlineStorage);
+    }
+
+    void Grow(const size_t capacity)
+    {
+        const size_t newCapacity{ std::max<size_t>(capacity, 1) };
+        T* newData{ std::allocator<T>{}.allocate(newCapacity) };
+        std::uninitialized_move(m_data, m_data + m_size, newData);
+        std::destroy(m_data, m_data + m_size);
+        FreeHeapStorage();
+        m_data = newData;
+        m_capacity = newCapacity;
+    }
+
+    void FreeHeapStorage()
+    {
+        if (!is_inline()) {
+            std::allocator<T>{}.deallocate(m_data, m_capacity);
+            m_data = GetInlineStorage();
+            m_capacity = InlineCapacity;
+        }
+    }
+
+    // expects this one empty and inline
+    void MoveFrom(SmallVector&& other)
+    {
+        if (other.is_inline()) {
+            std::uninitialized_move(other.m_data, other.m_data + other.m_size, m_data);
+            m_size = other.m_size;
+            other.clear();
+        } else {
+            m_data = other.m_data;
+            m_size = other.m_size;
+            m_capacity = other.m_capacity;
+            other.m_data = other.GetInlineStorage();
+            other.m_size = 0;
+            other.m_capacity = InlineCapacity;
+        }
+    }
+
+private:
+    alignas(T) std::byte m_inlineStorage[sizeof(T) * InlineCapacity];
+
+    T* m_data{ GetInlineStorage() };
+
+    size_t m_size{};
+
+    size_t m_capacity{ InlineCapacity };
+};
+} // namespace prev::common
+
+#endif // !__SMALL_VECTOR_H__
@@ -81,6 +81,11 @@ public:
         return res;
     }
 
+    inline size_t GetThreadCount() const
+    {
+        return m_workers.size();
+    }
+
 private:
     std::vector<std::thread> m_workers;
 
@@ -0,0 +1,249 @@
+#include "AssetLoader.h"
+
+#include "../common/Logger.h"
+
+#include <algorithm>
+#include <exception>
+
+namespace prev::core {
+namespace {
+    float ToMilliseconds(const std::chrono::microseconds time)
+    {
+        return static_cast<float>(time.count()) / 1000.0f;
+    }
+} // namespace
+
+AssetLoader::AssetLoader(const size_t threadCount)
+    : m_threadPool{ threadCount > 0 ? std::make_unique<prev::common::ThreadPool>(threadCount) : nullptr }
+{
+}
+
+AssetLoader::~AssetLoader()
+{
+    // loads that did not start yet are dropped, the running ones finish before the workers are joined
+    m_running = false;
+    m_threadPool.reset();
+
+    std::lock_guard<std::mutex> lock{ m_mutex };
+    for (auto& entry : m_queuedEntries) {
+        entry->Complete(false);
+    }
+    for (auto& entry : m_stagedEntries) {
+        entry->Complete(false);
+    }
+    m_queuedEntries.clear();
+    m_stagedEntries.clear();
+}
+
+void AssetLoader::SetPriority(const std::string& key, const AssetPriority priority)
+{
+    std::lock_guard<std::mutex> lock{ m_mutex };
+    for (auto& entry : m_queuedEntries) {
+        if (entry->key == key) {
+            entry->priority = priority;
+        }
+    }
+}
+
+void AssetLoader::Update(const uint32_t maxStageCount)
+{
+    if (!m_threadPool) {
+        RunNextLoad();
+    }
+
+    std::vector<std::shared_ptr<detail::AssetEntry>> stagedEntries;
+    {
+        std::lock_guard<std::mutex> lock{ m_mutex };
+        const auto stageCount{ std::min(static_cast<size_t>(maxStageCount), m_stagedEntries.size()) };
+        stagedEntries.assign(m_stagedEntries.begin(), m_stagedEntries.begin() + stageCount);
+        m_stagedEntries.erase(m_stagedEntries.begin(), m_stagedEntries.begin() + stageCount);
+    }
+
+    for (auto& entry : stagedEntries) {
+        RunStage(entry);
+    }
+}
+
+uint32_t AssetLoader::GetPendingCount() const
+{
+    std::lock_guard<std::mutex> lock{ m_mutex };
+    return static_cast<uint32_t>(m_queuedEntries.size() + m_stagedEntries.size()) + m_loadingCount;
+}
+
+AssetLoadStatistics AssetLoader::GetStatistics() const
+{
+    std::lock_guard<std::mutex> lock{ m_mutex };
+    return m_statistics;
+}
+
+std::shared_ptr<detail::AssetEntry> AssetLoader::FindEntry(const EntryKey& key)
+{
+    auto iter{ m_entries.find(key) };
+    if (iter == m_entries.end()) {
+        return nullptr;
+    }
+
+    auto entry{ iter->second.lock() };
+    if (!entry || entry->state == AssetState::Failed) {
+        // nobody holds it anymore or it should be retried
+        m_entries.erase(iter);
+        return nullptr;
+    }
+    return entry;
+}
+
+void AssetLoader::WaitForEntry(const std::shared_ptr<detail::AssetEntry>& entry)
+{
+    std::unique_lock<std::mutex> lock{ m_mutex };
+    while (entry->state == AssetState::Loading || entry->state == AssetState::Staging) {
+        // not started yet or waiting for its staging step - done right here instead
+        const auto queuedIter{ std::find(m_queuedEntries.begin(), m_queuedEntries.end(), entry) };
+        if (queuedIter != m_queuedEntries.end()) {
+            m_queuedEntries.erase(queuedIter);
+            ++m_loadingCount;
+            lock.unlock();
+            RunLoad(entry);
+            lock.lock();
+            continue;
+        }
+
+        const auto stagedIter{ std::find(m_stagedEntries.begin(), m_stagedEntries.end(), entry) };
+        if (stagedIter != m_stagedEntries.end()) {
+            m_stagedEntries.erase(stagedIter);
+            lock.unlock();
+            RunStage(entry);
+            lock.lock();
+            continue;
+        }
+
+        // running on a loader thread
+        m_loadCondition.wait(lock);
+    }
+}
+
+void AssetLoader::PruneEntries()
+{
+    for (auto iter = m_entries.begin(); iter != m_entries.end();) {
+        const auto entry{ iter->second.lock() };
+        if (!entry || entry->state == AssetState::Failed) {
+            iter = m_entries.erase(iter);
+        } else {
+            ++iter;
+        }
+    }
+}
+
+void AssetLoader::ScheduleNextLoad()
+{
+    // every request adds one task to the pool, the task itself picks the most important queued load
+    if (m_threadPool) {
+        m_threadPool->Enqueue([this]() { RunNextLoad(); });
+    }
+}
+
+void AssetLoader::RunNextLoad()
+{
+    std::shared_ptr<detail::AssetEntry> entry{};
+    {
+        std::lock_guard<std::mutex> lock{ m_mutex };
+        if (!m_running || m_queuedEntries.empty()) {
+            return;
+        }
+
+        // the oldest one wins within the same priority
+        auto bestIter{ m_queuedEntries.begin() };
+        for (auto iter = m_queuedEntries.begin(); iter != m_queuedEntries.end(); ++iter) {
+            if ((*iter)->priority > (*bestIter)->priority) {
+                bestIter = iter;
+            }
+        }
+        entry = *bestIter;
+        m_queuedEntries.erase(bestIter);
+        ++m_loadingCount;
+    }
+
+    RunLoad(entry);
+}
+
+void AssetLoader::RunLoad(const std::shared_ptr<detail::AssetEntry>& entry)
+{
+    entry->context.m_metrics.queueTime = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - entry->queuedTime);
+
+    bool success{ false };
+    try {
+        success = entry->Load(entry->context);
+    } catch (const std::exception& e) {
+        LOGE("Asset: Failed to load %s: %s", entry->key.c_str(), e.what());
+    }
+
+    if (success && entry->HasStage()) {
+        entry->state = AssetState::Staging;
+        {
+            std::lock_guard<std::mutex> lock{ m_mutex };
+            --m_loadingCount;
+            m_stagedEntries.push_back(entry);
+        }
+        m_loadCondition.notify_all();
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock{ m_mutex };
+        --m_loadingCount;
+    }
+    Finish(*entry, success);
+}
+
+void AssetLoader::RunStage(const std::shared_ptr<detail::AssetEntry>& entry)
+{
+    bool success{ false };
+    try {
+        success = entry->context.Measure(AssetLoadStage::Stage, [&]() { return entry->Stage(entry->context); });
+    } catch (const std::exception& e) {
+        LOGE("Asset: Failed to stage %s: %s", entry->key.c_str(), e.what());
+    }
+    Finish(*entry, success);
+}
+
+void AssetLoader::Finish(detail::AssetEntry& entry, const bool success)
+{
+    const auto& metrics{ entry.context.GetMetrics() };
+    if (success) {
+        LOGI("Asset: Loaded %s (queue: %.2f ms, read: %.2f ms, decode: %.2f ms, cook: %.2f ms, stage: %.2f ms)", entry.key.c_str(), ToMilliseconds(metrics.queueTime),
+            ToMilliseconds(metrics.stageTimes[static_cast<size_t>(AssetLoadStage::Read)]),
+            ToMilliseconds(metrics.stageTimes[static_cast<size_t>(AssetLoadStage::Decode)]),
+            ToMilliseconds(metrics.stageTimes[static_cast<size_t>(AssetLoadStage::Cook)]),
+            ToMilliseconds(metrics.stageTimes[static_cast<size_t>(AssetLoadStage::Stage)]));
+    } else {
+        LOGE("Asset: Failed to load %s", entry.key.c_str());
+    }
+
+    {
+        std::lock_guard<std::mutex> lock{ m_mutex };
+        if (success) {
+            ++m_statistics.loadedCount;
+        } else {
+            ++m_statistics.failedCount;
+        }
+        m_statistics.totalMetrics.queueTime += metrics.queueTime;
+        for (size_t i = 0; i < metrics.stageTimes.size(); ++i) {
+            m_statistics.totalMetrics.stageTimes[i] += metrics.stageTimes[i];
+        }
+
+        // the entries of loads nobody holds anymore would pile up otherwise, FindEntry only drops the ones asked for again
+        if (m_queuedEntries.empty() && m_stagedEntries.empty() && m_loadingCount == 0) {
+            PruneEntries();
+        }
+    }
+
+    // last, whoever waits on the handle sees the statistics already updated
+    entry.Complete(success);
+
+    // taking the lock orders the notification after a waiter's check of the state
+    {
+        std::lock_guard<std::mutex> lock{ m_mutex };
+    }
+    m_loadCondition.notify_all();
+}
+
+} // namespace prev::core
@@ -0,0 +1,385 @@
+#ifndef __ASSET_LOADER_H__
+#define __ASSET_LOADER_H__
+
+#include "../common/ThreadPool.h"
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <future>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <type_traits>
+#include <typeindex>
+#include <utility>
+#include <vector>
+
+namespace prev::core {
+
+// Jobs with a higher priority start first, e.g. assets of visible objects before the rest.
+enum class AssetPriority {
+    LOW = 0,
+    NORMAL = 1,
+    HIGH = 2,
+};
+
+enum class AssetState {
+    Loading, // queued or running on a loader thread
+    Staging, // loaded, waiting for its staging step on the thread calling AssetLoader::Update
+    Ready,
+    Failed,
+};
+
+enum class AssetLoadStage {
+    Read = 0,
+    Decode,
+    Cook,
+    Stage,
+    Count,
+};
+
+struct AssetLoadMetrics {
+    // time spent waiting for a loader thread
+    std::chrono::microseconds queueTime{};
+
+    std::array<std::chrono::microseconds, static_cast<size_t>(AssetLoadStage::Count)> stageTimes{};
+};
+
+struct AssetLoadStatistics {
+    uint32_t loadedCount{};
+
+    uint32_t failedCount{};
+
+    // summed over all finished loads
+    AssetLoadMetrics totalMetrics{};
+};
+
+// Handed to the load and stage steps of a job so they can attribute their time to pipeline stages.
+class AssetLoadContext final {
+public:
+    template <typename F>
+    decltype(auto) Measure(const AssetLoadStage stage, F&& f)
+    {
+        const auto startTime{ std::chrono::steady_clock::now() };
+        struct StageTimer {
+            ~StageTimer()
+            {
+                time += std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - startTime);
+            }
+
+            std::chrono::microseconds& time;
+
+            std::chrono::steady_clock::time_point startTime;
+        } timer{ m_metrics.stageTimes[static_cast<size_t>(stage)], startTime };
+        return f();
+    }
+
+    const AssetLoadMetrics& GetMetrics() const
+    {
+        return m_metrics;
+    }
+
+private:
+    friend class AssetLoader;
+
+    AssetLoadMetrics m_metrics{};
+};
+
+namespace detail {
+    struct AssetEntry {
+        virtual ~AssetEntry() = default;
+
+        // run on a loader thread, false when the asset could not be loaded
+        virtual bool Load(AssetLoadContext& context) = 0;
+
+        virtual bool HasStage() const = 0;
+
+        // run on the thread calling AssetLoader::Update
+        virtual bool Stage(AssetLoadContext& context) = 0;
+
+        virtual void Complete(bool success) = 0;
+
+        // raises only, a load that already started is not affected
+        void RaisePriority(const AssetPriority newPriority)
+        {
+            auto currentPriority{ priority.load() };
+            while (currentPriority < newPriority && !priority.compare_exchange_weak(currentPriority, newPriority)) {
+            }
+        }
+
+        std::string key{};
+
+        std::atomic<AssetPriority> priority{ AssetPriority::NORMAL };
+
+        std::atomic<AssetState> state{ AssetState::Loading };
+
+        std::chrono::steady_clock::time_point queuedTime{};
+
+        AssetLoadContext context{};
+    };
+
+    template <typename T>
+    struct ValueAssetEntry : AssetEntry {
+        void Resolve(std::shared_ptr<T> result)
+        {
+            value = std::move(result);
+            state = value ? AssetState::Ready : AssetState::Failed;
+            promise.set_value(value);
+        }
+
+        std::shared_ptr<T> value{};
+
+        std::promise<std::shared_ptr<T>> promise{};
+
+        std::shared_future<std::shared_ptr<T>> future{ promise.get_future().share() };
+    };
+
+    template <typename T, typename LoadedT>
+    struct TypedAssetEntry final : ValueAssetEntry<T> {
+        bool Load(AssetLoadContext& ctx) override
+        {
+            loaded = load(ctx);
+            return loaded != nullptr;
+        }
+
+        bool HasStage() const override
+        {
+            return static_cast<bool>(stage);
+        }
+
+        bool Stage(AssetLoadContext& ctx) override
+        {
+            staged = stage(*loaded, ctx);
+            return staged != nullptr;
+        }
+
+        void Complete(const bool success) override
+        {
+            std::shared_ptr<T> result{};
+            if (success) {
+                if constexpr (std::is_same_v<T, LoadedT>) {
+                    result = HasStage() ? std::move(staged) : std::move(loaded);
+                } else {
+                    result = std::move(staged);
+                }
+            }
+            loaded.reset();
+            staged.reset();
+            load = {};
+            stage = {};
+            this->Resolve(std::move(result));
+        }
+
+        std::function<std::shared_ptr<LoadedT>(AssetLoadContext&)> load{};
+
+        std::function<std::shared_ptr<T>(LoadedT&, AssetLoadContext&)> stage{};
+
+        std::shared_ptr<LoadedT> loaded{};
+
+        std::shared_ptr<T> staged{};
+    };
+} // namespace detail
+
+// Shared view of one asset load. Copies refer to the same load; the value is nullptr until the load is Ready.
+template <typename T>
+class AssetHandle final {
+public:
+    AssetHandle() = default;
+
+    ~AssetHandle() = default;
+
+public:
+    // Wraps an already available value, so ready and streamed assets can be used the same way.
+    static AssetHandle FromValue(std::shared_ptr<T> value)
+    {
+        auto entry{ std::make_shared<detail::TypedAssetEntry<T, T>>() };
+        entry->Resolve(std::move(value));
+        return AssetHandle{ std::move(entry) };
+    }
+
+public:
+    AssetState GetState() const
+    {
+        return m_entry ? m_entry->state.load() : AssetState::Failed;
+    }
+
+    bool IsReady() const
+    {
+        return GetState() == AssetState::Ready;
+    }
+
+    // Ready or Failed - nothing will change anymore.
+    bool IsDone() const
+    {
+        const auto state{ GetState() };
+        return state == AssetState::Ready || state == AssetState::Failed;
+    }
+
+    std::shared_ptr<T> Get() const
+    {
+        return IsReady() ? m_entry->value : nullptr;
+    }
+
+    // Resolves to nullptr on failure. Assets with a staging step resolve only after AssetLoader::Update
+    // staged them, so do not wait on it from the thread that calls Update.
+    std::shared_future<std::shared_ptr<T>> GetFuture() const
+    {
+        return m_entry ? m_entry->future : std::shared_future<std::shared_ptr<T>>{};
+    }
+
+    // Complete once IsDone().
+    const AssetLoadMetrics& GetMetrics() const
+    {
+        return m_entry->context.GetMetrics();
+    }
+
+    // Moves a queued load ahead of the less important ones, e.g. once its object becomes visible.
+    void RaisePriority(const AssetPriority priority) const
+    {
+        if (m_entry && m_entry->state == AssetState::Loading) {
+            m_entry->RaisePriority(priority);
+        }
+    }
+
+    explicit operator bool() const
+    {
+        return m_entry != nullptr;
+    }
+
+private:
+    friend class AssetLoader;
+
+    explicit AssetHandle(std::shared_ptr<detail::ValueAssetEntry<T>> entry)
+        : m_entry{ std::move(entry) }
+    {
+    }
+
+private:
+    std::shared_ptr<detail::ValueAssetEntry<T>> m_entry{};
+};
+
+// Loads assets on a pool of threads in two steps: `load` (read, decode, cook - any thread) and an optional
+// `stage` (GPU resource creation, e.g. ImageBufferBuilder::BuildAsync) that runs on the thread calling Update,
+// once per frame before DeferredResourceUploader::Flush, so the frame loop never waits for file I/O. Concurrent
+// requests for the same key and value type share a single load for as long as a handle to it is alive.
+class AssetLoader final {
+public:
+    // Without threads the loads run in Update as well, one per call.
+    explicit AssetLoader(const size_t threadCount);
+
+    ~AssetLoader();
+
+    AssetLoader(const AssetLoader&) = delete;
+    AssetLoader& operator=(const AssetLoader&) = delete;
+
+public:
+    template <typename T>
+    AssetHandle<T> Load(const std::string& key, const AssetPriority priority, std::function<std::shared_ptr<T>(AssetLoadContext&)> load)
+    {
+        return Load<T, T>(key, priority, std::move(load), {});
+    }
+
+    template <typename T, typename LoadedT>
+    AssetHandle<T> Load(const std::string& key, const AssetPriority priority, std::function<std::shared_ptr<LoadedT>(AssetLoadContext&)> load, std::function<std::shared_ptr<T>(LoadedT&, AssetLoadContext&)> stage)
+    {
+        std::shared_ptr<detail::AssetEntry> entry{};
+        const auto entryKey{ std::make_pair(std::type_index{ typeid(T) }, key) };
+        {
+            std::lock_guard<std::mutex> lock{ m_mutex };
+            if (auto existingEntry = FindEntry(entryKey)) {
+                existingEntry->RaisePriority(priority);
+                return AssetHandle<T>{ std::static_pointer_cast<detail::ValueAssetEntry<T>>(existingEntry) };
+            }
+
+            auto typedEntry{ std::make_shared<detail::TypedAssetEntry<T, LoadedT>>() };
+            typedEntry->load = std::move(load);
+            typedEntry->stage = std::move(stage);
+            entry = typedEntry;
+            entry->key = key;
+            entry->priority = priority;
+            entry->queuedTime = std::chrono::steady_clock::now();
+            m_entries[entryKey] = entry;
+            m_queuedEntries.push_back(entry);
+        }
+
+        ScheduleNextLoad();
+        return AssetHandle<T>{ std::static_pointer_cast<detail::ValueAssetEntry<T>>(entry) };
+    }
+
+    // Reorders a queued load, e.g. once its object becomes visible. Loads that already started are not affected.
+    void SetPriority(const std::string& key, const AssetPriority priority);
+
+    // Blocks until the asset is done, for callers that cannot go on without it. A load that did not start yet
+    // and the staging step run on the calling thread, so call it only from the thread that calls Update.
+    template <typename T>
+    std::shared_ptr<T> Wait(const AssetHandle<T>& handle)
+    {
+        if (!handle) {
+            return nullptr;
+        }
+
+        WaitForEntry(handle.m_entry);
+        return handle.Get();
+    }
+
+    // Runs the staging steps of finished loads, at most maxStageCount of them per call.
+    void Update(const uint32_t maxStageCount = DEFAULT_MAX_STAGE_COUNT_PER_UPDATE);
+
+    // Queued, loading or waiting for staging.
+    uint32_t GetPendingCount() const;
+
+    AssetLoadStatistics GetStatistics() const;
+
+private:
+    using EntryKey = std::pair<std::type_index, std::string>;
+
+    std::shared_ptr<detail::AssetEntry> FindEntry(const EntryKey& key);
+
+    void WaitForEntry(const std::shared_ptr<detail::AssetEntry>& entry);
+
+    // Drops the entries of released and failed loads, called under the lock once nothing is pending.
+    void PruneEntries();
+
+    void ScheduleNextLoad();
+
+    void RunNextLoad();
+
+    void RunLoad(const std::shared_ptr<detail::AssetEntry>& entry);
+
+    void RunStage(const std::shared_ptr<detail::AssetEntry>& entry);
+
+    void Finish(detail::AssetEntry& entry, const bool success);
+
+private:
+    static const inline uint32_t DEFAULT_MAX_STAGE_COUNT_PER_UPDATE{ 16 };
+
+private:
+    mutable std::mutex m_mutex;
+
+    // signaled whenever a load leaves the loader threads
+    std::condition_variable m_loadCondition;
+
+    std::map<EntryKey, std::weak_ptr<detail::AssetEntry>> m_entries;
+
+    // in request order, RunNextLoad picks the most important one
+    std::vector<std::shared_ptr<detail::AssetEntry>> m_queuedEntries;
+
+    std::vector<std::shared_ptr<detail::AssetEntry>> m_stagedEntries;
+
+    uint32_t m_loadingCount{};
+
+    AssetLoadStatistics m_statistics{};
+
+    std::atomic<bool> m_running{ true };
+
+    // last member - its workers are joined before the rest is destroyed
+    std::unique_ptr<prev::common::ThreadPool> m_threadPool;
+};
+
+} // namespace prev::core
+
+#endif // !__ASSET_LOADER_H__
@@ -1,9 +1,13 @@
 #include "DeferredResourceUploader.h"
 
 #include "OwnedGfxHandle.h"
+#include "device/Queue.h"
+#include "sync/Fence.h"
 
 #include "../common/Logger.h"
 
+#include <algorithm>
+#include <cstring>
 #include <iterator>
 #include <memory>
 #include <utility>
@@ -17,10 +21,18 @@ namespace {
     // of its data until flushed. Beyond this, builders fall back to synchronous uploads, which free their
     // staging immediately.
     constexpr uint64_t MaxOutstandingUploadBytes{ 64ull * 1024 * 1024 };
+
+    // Persistently mapped staging memory. Sized for a few frames of flushes in flight.
+    constexpr uint64_t StagingRingSize{ 32ull * 1024 * 1024 };
+
+    // Part size of the uploads that do not fit a single ring reservation.
+    constexpr uint64_t UploadChunkSize{ 4ull * 1024 * 1024 };
 } // namespace
 
-DeferredResourceUploader::DeferredResourceUploader(DeferredResourceDestroyer& destroyer)
-    : m_destroyer{ destroyer }
+DeferredResourceUploader::DeferredResourceUploader(GfxDevice device, DeferredResourceDestroyer& destroyer)
+    : m_device{ device }
+    , m_destroyer{ destroyer }
+    , m_stagingRing{ device, StagingRingSize }
 {
 }
 
@@ -33,6 +45,40 @@ DeferredResourceUploader::~DeferredResourceUploader()
         }
     }
     m_pending.clear();
+
+    for (auto& batch : m_transferBatches) {
+        CompleteTransferBatch(batch);
+    }
+    m_transferBatches.clear();
+}
+
+void DeferredResourceUploader::SetTransferQueue(const device::Queue* queue)
+{
+    m_transferQueue = queue;
+}
+
+bool DeferredResourceUploader::HasTransferQueue() const
+{
+    return m_transferQueue != nullptr;
+}
+
+void DeferredResourceUploader::AdvanceFrame(uint32_t frameIndex)
+{
+    m_currentFrame = frameIndex;
+
+    auto batchIter{ m_transferBatches.begin() };
+    while (batchIter != m_transferBatches.end()) {
+        // The slot is about to be retired - its batches must be done by then, usually they long are.
+        const bool mustWait{ batchIter->frameIndex == frameIndex };
+        if (mustWait) {
+            batchIter->fence->Wait();
+        } else if (!batchIter->fence->TryWait(0)) {
+            ++batchIter;
+            continue;
+        }
+        CompleteTransferBatch(*batchIter);
+        batchIter = m_transferBatches.erase(batchIter);
+    }
 }
 
 void DeferredResourceUploader::Enqueue(std::function<void(GfxCommandEncoder)> record, std::shared_ptr<std::atomic<ResourceState>> state, StagingData staging)
@@ -42,6 +88,134 @@ void DeferredResourceUploader::Enqueue(std::function<void(GfxCommandEncoder)> re
     m_pending.push_back(Entry{ std::move(record), std::move(state), std::move(staging) });
 }
 
+bool DeferredResourceUploader::EnqueueBufferUpload(GfxBuffer destination, uint64_t destinationOffset, const void* data, uint64_t size, std::shared_ptr<std::atomic<ResourceState>> state)
+{
+    if (!m_stagingRing.IsAvailable() || !data || size == 0) {
+        return false;
+    }
+
+    if (auto ringAllocation = m_stagingRing.Reserve(size)) {
+        memcpy(ringAllocation->GetData(), data, size);
+
+        StagingData staging{};
+        staging.bytes = size;
+        staging.copyOnly = true;
+        auto record{ MakeCopyRecorder(ringAllocation->GetBuffer(), ringAllocation->GetOffset(), destination, destinationOffset, size) };
+        staging.ringAllocation = std::move(ringAllocation);
+        Enqueue(std::move(record), std::move(state), std::move(staging));
+        return true;
+    }
+
+    // Too large for one reservation or the ring is full: the parts hold a copy of the data until staged.
+    if (!CanQueue(size)) {
+        return false;
+    }
+    EnqueueChunkedBufferUpload(destination, destinationOffset, data, size, std::move(state));
+    return true;
+}
+
+bool DeferredResourceUploader::RecordBufferUpload(GfxCommandEncoder encoder, GfxBuffer destination, uint64_t destinationOffset, const void* data, uint64_t size)
+{
+    auto ringAllocation{ m_stagingRing.Reserve(size) };
+    if (!ringAllocation) {
+        return false;
+    }
+
+    memcpy(ringAllocation->GetData(), data, size);
+    MakeCopyRecorder(ringAllocation->GetBuffer(), ringAllocation->GetOffset(), destination, destinationOffset, size)(encoder);
+    m_destroyer.Destroy(std::move(ringAllocation));
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    ++m_statistics.uploadCount;
+    UpdateThroughput(size);
+    return true;
+}
+
+StagingRing& DeferredResourceUploader::GetStagingRing()
+{
+    return m_stagingRing;
+}
+
+UploadStatistics DeferredResourceUploader::GetStatistics() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    UploadStatistics statistics{ m_statistics };
+    statistics.staging = m_stagingRing.GetStatistics();
+    return statistics;
+}
+
+void DeferredResourceUploader::EnqueueChunkedBufferUpload(GfxBuffer destination, uint64_t destinationOffset, const void* data, uint64_t size, std::shared_ptr<std::atomic<ResourceState>> state)
+{
+    struct Chunk {
+        uint64_t offset{};
+        uint64_t size{};
+        std::unique_ptr<StagingRingAllocation> ringAllocation{};
+    };
+
+    const auto source{ std::make_shared<const std::vector<uint8_t>>(static_cast<const uint8_t*>(data), static_cast<const uint8_t*>(data) + size) };
+    const uint64_t chunkSize{ std::min(UploadChunkSize, m_stagingRing.GetMaxReservationSize()) };
+    const auto chunkCount{ static_cast<uint32_t>((size + chunkSize - 1) / chunkSize) };
+    const auto remainingParts{ std::make_shared<std::atomic<uint32_t>>(chunkCount) };
+
+    for (uint64_t offset = 0; offset < size; offset += chunkSize) {
+        const auto chunk{ std::make_shared<Chunk>(Chunk{ offset, std::min(chunkSize, size - offset) }) };
+
+        StagingData staging{};
+        staging.bytes = chunk->size;
+        staging.remainingParts = remainingParts;
+        staging.copyOnly = true;
+        // Staged at flush: false (retried next frame) while older ranges still hold the ring.
+        staging.prepare = [this, chunk, source]() {
+            if (!chunk->ringAllocation) {
+                chunk->ringAllocation = m_stagingRing.Reserve(chunk->size);
+                if (!chunk->ringAllocation) {
+                    return false;
+                }
+                memcpy(chunk->ringAllocation->GetData(), source->data() + chunk->offset, chunk->size);
+            }
+            return true;
+        };
+        auto record = [this, chunk, destination, destinationOffset](GfxCommandEncoder encoder) {
+            MakeCopyRecorder(chunk->ringAllocation->GetBuffer(), chunk->ringAllocation->GetOffset(), destination, destinationOffset + chunk->offset, chunk->size)(encoder);
+            m_destroyer.Destroy(std::move(chunk->ringAllocation));
+        };
+        Enqueue(std::move(record), state, std::move(staging));
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_statistics.chunkCount += chunkCount;
+}
+
+std::function<void(GfxCommandEncoder)> DeferredResourceUploader::MakeCopyRecorder(GfxBuffer source, uint64_t sourceOffset, GfxBuffer destination, uint64_t destinationOffset, uint64_t size)
+{
+    return [source, sourceOffset, destination, destinationOffset, size](GfxCommandEncoder encoder) {
+        GfxCopyBufferToBufferDescriptor copyDesc{};
+        copyDesc.source = source;
+        copyDesc.sourceOffset = sourceOffset;
+        copyDesc.destination = destination;
+        copyDesc.destinationOffset = destinationOffset;
+        copyDesc.size = size;
+        gfxCommandEncoderCopyBufferToBuffer(encoder, &copyDesc);
+    };
+}
+
+void DeferredResourceUploader::UpdateThroughput(uint64_t recordedBytes)
+{
+    m_statistics.uploadedBytes += recordedBytes;
+
+    const auto now{ std::chrono::steady_clock::now() };
+    if (m_throughputWindowBytes == 0) {
+        m_throughputWindowStart = now;
+    }
+    m_throughputWindowBytes += recordedBytes;
+
+    const std::chrono::duration<double> windowDuration{ now - m_throughputWindowStart };
+    if (windowDuration.count() >= 1.0) {
+        m_statistics.bytesPerSecond = static_cast<double>(m_throughputWindowBytes) / windowDuration.count();
+        m_throughputWindowBytes = 0;
+    }
+}
+
 bool DeferredResourceUploader::HasPending() const
 {
     std::lock_guard<std::mutex> lock(m_mutex);
@@ -79,19 +253,126 @@ void DeferredResourceUploader::Flush(GfxCommandEncoder encoder)
 
     LOGI("DeferredResourceUploader::Flush - recording %zu async uploads", batch.size());
 
+    std::vector<Entry> transferEntries;
+    uint64_t recordedBytes{ 0 };
+    uint32_t recordedCount{ 0 };
     for (auto& entry : batch) {
+        if (m_transferQueue && entry.staging.copyOnly) {
+            transferEntries.push_back(std::move(entry));
+            continue;
+        }
+
         m_outstandingBytes.fetch_sub(entry.staging.bytes, std::memory_order_relaxed); // staging is about to be freed
-        // CAS Creating -> Ready: skips a resource dropped before flush (destructor set Destroying) and
-        // never clobbers that Destroying. Records are handle-only, so a concurrent drop is not a UAF.
-        ResourceState expected{ ResourceState::Creating };
-        const bool claimed{ entry.state && entry.state->compare_exchange_strong(expected, ResourceState::Ready) };
-        if (claimed && entry.record) {
-            entry.record(encoder);
+        bool claimed{ false };
+        if (entry.staging.remainingParts) {
+            // A part of a chunked upload: recorded while the resource is still Creating, the last one flips it.
+            claimed = entry.state && entry.state->load() == ResourceState::Creating;
+            if (claimed && entry.record) {
+                entry.record(encoder);
+            }
+            CompletePart(entry);
+        } else {
+            // CAS Creating -> Ready: skips a resource dropped before flush (destructor set Destroying) and
+            // never clobbers that Destroying. Records are handle-only, so a concurrent drop is not a UAF.
+            ResourceState expected{ ResourceState::Creating };
+            claimed = entry.state && entry.state->compare_exchange_strong(expected, ResourceState::Ready);
+            if (claimed && entry.record) {
+                entry.record(encoder);
+            }
+        }
+        if (claimed) {
+            recordedBytes += entry.staging.bytes;
+            ++recordedCount;
         }
         if (entry.staging.buffer) {
             // Defer-destroy so the staging outlives the just-recorded copy (or just free it if cancelled).
             m_destroyer.Destroy(std::make_unique<OwnedGfxBuffer>(entry.staging.buffer));
         }
+        if (entry.staging.ringAllocation) {
+            m_destroyer.Destroy(std::move(entry.staging.ringAllocation));
+        }
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_statistics.uploadCount += recordedCount;
+        UpdateThroughput(recordedBytes);
+    }
+
+    if (!transferEntries.empty()) {
+        SubmitTransferBatch(std::move(transferEntries));
+    }
+}
+
+void DeferredResourceUploader::SubmitTransferBatch(std::vector<Entry>&& entries)
+{
+    GfxCommandEncoderDescriptor encoderDesc{};
+    encoderDesc.sType = GFX_STRUCTURE_TYPE_COMMAND_ENCODER_DESCRIPTOR;
+    encoderDesc.label = "TransferCommandEncoder";
+
+    TransferBatch batch{};
+    batch.frameIndex = m_currentFrame;
+    batch.fence = std::make_unique<sync::Fence>(m_device, false, "TransferFence");
+    GFXERRCHECK(gfxDeviceCreateCommandEncoder(m_device, &encoderDesc, &batch.encoder));
+
+    uint64_t recordedBytes{ 0 };
+    uint32_t recordedCount{ 0 };
+    GFXERRCHECK(gfxCommandEncoderBegin(batch.encoder));
+    for (auto& entry : entries) {
+        m_outstandingBytes.fetch_sub(entry.staging.bytes, std::memory_order_relaxed);
+        // Not flipped yet: Ready only once the copy completed, a drop before that still cancels.
+        if (entry.state && entry.state->load() == ResourceState::Creating && entry.record) {
+            entry.record(batch.encoder);
+            recordedBytes += entry.staging.bytes;
+            ++recordedCount;
+        }
+    }
+    GFXERRCHECK(gfxCommandEncoderEnd(batch.encoder));
+
+    GfxCommandEncoder encoders[] = { batch.encoder };
+
+    GfxSubmitDescriptor submitDesc{};
+    submitDesc.sType = GFX_STRUCTURE_TYPE_SUBMIT_DESCRIPTOR;
+    submitDesc.commandEncoders = encoders;
+    submitDesc.commandEncoderCount = 1;
+    submitDesc.signalFence = *batch.fence;
+    GFXERRCHECK(m_transferQueue->Submit(&submitDesc));
+
+    batch.entries = std::move(entries);
+    m_transferBatches.push_back(std::move(batch));
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_statistics.uploadCount += recordedCount;
+    m_statistics.transferUploadCount += recordedCount;
+    UpdateThroughput(recordedBytes);
+}
+
+void DeferredResourceUploader::CompleteTransferBatch(TransferBatch& batch)
+{
+    for (auto& entry : batch.entries) {
+        if (entry.staging.remainingParts) {
+            CompletePart(entry);
+        } else if (entry.state) {
+            ResourceState expected{ ResourceState::Creating };
+            entry.state->compare_exchange_strong(expected, ResourceState::Ready);
+        }
+        if (entry.staging.buffer) {
+            gfxBufferDestroy(entry.staging.buffer);
+        }
+        entry.staging.ringAllocation.reset();
+    }
+    batch.entries.clear();
+
+    gfxCommandEncoderDestroy(batch.encoder);
+    batch.encoder = {};
+}
+
+void DeferredResourceUploader::CompletePart(Entry& entry)
+{
+    // the last part of a chunked upload flips the resource
+    if (entry.staging.remainingParts->fetch_sub(1) == 1 && entry.state) {
+        ResourceState expected{ ResourceState::Creating };
+        entry.state->compare_exchange_strong(expected, ResourceState::Ready);
     }
 }
 
@@ -4,22 +4,54 @@
 #include "Core.h"
 #include "DeferredResourceDestroyer.h"
 #include "ResourceState.h"
+#include "StagingRing.h"
 
 #include <atomic>
+#include <chrono>
 #include <functional>
 #include <memory>
 #include <mutex>
 #include <vector>
 
+namespace prev::core::device {
+struct Queue;
+} // namespace prev::core::device
+
+namespace prev::core::sync {
+class Fence;
+} // namespace prev::core::sync
+
 namespace prev::core {
 
+struct UploadStatistics {
+    StagingRingStatistics staging{};
+
+    // bytes of the recorded copies
+    uint64_t uploadedBytes{};
+
+    uint64_t uploadCount{};
+
+    // parts of uploads too large for a single staging ring reservation
+    uint64_t chunkCount{};
+
+    // of the last second with uploads
+    double bytesPerSecond{};
+
+    // uploads recorded on the transfer queue
+    uint64_t transferUploadCount{};
+};
+
 // Queues async resource uploads (from BuildAsync) and records a byte-budgeted batch into the frame's
 // command encoder once per frame, before rendering. On flush each resource flips Creating -> Ready and its
-// staging buffer is defer-destroyed. Recording before the render passes keeps the uploads stall-free (the
-// resource is valid the same frame) without a separate submission.
+// staging is defer-destroyed. Recording before the render passes keeps the uploads stall-free (the
+// resource is valid the same frame) without a separate submission. Buffer uploads are staged in a
+// persistently mapped StagingRing; its ranges are retired with the frame slot that recorded their copy.
+//
+// With a transfer queue set, copy-only uploads are submitted there instead, so large batches do not serialize
+// with rendering. Such a resource flips Ready once its batch fence signaled (checked in AdvanceFrame).
 class DeferredResourceUploader final {
 public:
-    explicit DeferredResourceUploader(DeferredResourceDestroyer& destroyer);
+    DeferredResourceUploader(GfxDevice device, DeferredResourceDestroyer& destroyer);
 
     ~DeferredResourceUploader();
 
@@ -30,15 +62,45 @@ public:
     // The staging side of an upload: what the uploader destroys, budgets, and (optionally) readies.
     struct StagingData {
         GfxBuffer buffer{}; // may be null; owned by the uploader once enqueued
+        std::unique_ptr<StagingRingAllocation> ringAllocation{}; // may be null; alternative to `buffer`
         uint64_t bytes{}; // what the flush budget counts
         std::function<bool()> prepare{}; // empty = filled; else call to retry (false = map not landed yet)
+        std::shared_ptr<std::atomic<uint32_t>> remainingParts{}; // set on the parts of a chunked upload
+        bool copyOnly{}; // the record only copies, so it may run on the transfer queue
     };
 
+    // Uploads marked copyOnly go to `queue` from now on. It must be of the graphics queue family - the
+    // resources are then used on the graphics queue without any queue family ownership transfer.
+    void SetTransferQueue(const device::Queue* queue);
+
+    bool HasTransferQueue() const;
+
+    // Completes the transfer batches that finished, and waits for the ones submitted while `frameIndex` was last
+    // current, so that the DeferredResourceDestroyer retiring the slot next never frees a resource a transfer
+    // still writes. Call at frame start, before DeferredResourceDestroyer::AdvanceFrame.
+    void AdvanceFrame(uint32_t frameIndex);
+
     // Queues upload work and the resource's shared lifecycle state. Thread-safe; replayed at the next Flush.
     void Enqueue(std::function<void(GfxCommandEncoder)> record, std::shared_ptr<std::atomic<ResourceState>> state, StagingData staging);
 
+    // Queues a copy of `data` into `destination` through the staging ring. The data is written into the ring
+    // right away; uploads larger than a ring reservation (or arriving while the ring is full) keep a copy of
+    // the data and are split into chunks staged over the next flushes, the state flips Ready with the last one.
+    // Returns false when the ring is unavailable or the outstanding budget is exhausted - nothing is queued then.
+    bool EnqueueBufferUpload(GfxBuffer destination, uint64_t destinationOffset, const void* data, uint64_t size, std::shared_ptr<std::atomic<ResourceState>> state);
+
+    // Records a copy of `data` into `destination` to `encoder` right away, staged in the ring. Returns false
+    // when the ring is unavailable or has no room - the caller stages the data itself then.
+    bool RecordBufferUpload(GfxCommandEncoder encoder, GfxBuffer destination, uint64_t destinationOffset, const void* data, uint64_t size);
+
+    // For producers writing (decoding) straight into staging memory.
+    StagingRing& GetStagingRing();
+
+    UploadStatistics GetStatistics() const;
+
     // Records a byte-budgeted batch of still-Creating uploads into `encoder` (flipping each Ready), leaving
     // the rest queued for later frames. Called at frame start, before rendering and outside a render pass.
+    // Copy-only uploads are submitted to the transfer queue instead, when there is one.
     void Flush(GfxCommandEncoder encoder);
 
     bool HasPending() const;
@@ -54,11 +116,49 @@ private:
         StagingData staging;
     };
 
+    struct TransferBatch {
+        uint32_t frameIndex{};
+
+        GfxCommandEncoder encoder{};
+
+        std::unique_ptr<sync::Fence> fence;
+
+        std::vector<Entry> entries;
+    };
+
+    void SubmitTransferBatch(std::vector<Entry>&& entries);
+
+    // Flips the resources of a finished batch Ready and frees its staging right away - the GPU is done with it.
+    void CompleteTransferBatch(TransferBatch& batch);
+
+    static void CompletePart(Entry& entry);
+
+    std::function<void(GfxCommandEncoder)> MakeCopyRecorder(GfxBuffer source, uint64_t sourceOffset, GfxBuffer destination, uint64_t destinationOffset, uint64_t size);
+
+    void EnqueueChunkedBufferUpload(GfxBuffer destination, uint64_t destinationOffset, const void* data, uint64_t size, std::shared_ptr<std::atomic<ResourceState>> state);
+
+    void UpdateThroughput(uint64_t recordedBytes);
+
+    GfxDevice m_device;
+
     DeferredResourceDestroyer& m_destroyer;
 
+    StagingRing m_stagingRing;
+
+    const device::Queue* m_transferQueue{};
+
+    // render thread only
+    uint32_t m_currentFrame{};
+    std::vector<TransferBatch> m_transferBatches;
+
     std::vector<Entry> m_pending;
     mutable std::mutex m_mutex;
     std::atomic<uint64_t> m_outstandingBytes{ 0 };
+
+    // statistics, guarded by m_mutex
+    UploadStatistics m_statistics{};
+    std::chrono::steady_clock::time_point m_throughputWindowStart{};
+    uint64_t m_throughputWindowBytes{ 0 };
 };
 
 } // namespace prev::core
@@ -0,0 +1,121 @@
+#include "StagingRing.h"
+
+#include "../common/Logger.h"
+
+#include <algorithm>
+
+namespace prev::core {
+StagingRingAllocation::StagingRingAllocation(StagingRing& ring, const uint64_t offset, const uint64_t size)
+    : m_ring{ ring }
+    , m_offset{ offset }
+    , m_size{ size }
+{
+}
+
+StagingRingAllocation::~StagingRingAllocation()
+{
+    m_ring.Release(m_offset);
+}
+
+GfxBuffer StagingRingAllocation::GetBuffer() const
+{
+    return m_ring.m_buffer;
+}
+
+uint64_t StagingRingAllocation::GetOffset() const
+{
+    return m_offset;
+}
+
+uint64_t StagingRingAllocation::GetSize() const
+{
+    return m_size;
+}
+
+void* StagingRingAllocation::GetData() const
+{
+    return m_ring.m_data + m_offset;
+}
+
+StagingRing::StagingRing(GfxDevice device, const uint64_t size)
+    : m_allocator{ size }
+{
+    GfxBufferDescriptor desc{};
+    desc.sType = GFX_STRUCTURE_TYPE_BUFFER_DESCRIPTOR;
+    desc.size = size;
+    desc.usage = GFX_BUFFER_USAGE_MAP_WRITE | GFX_BUFFER_USAGE_COPY_SRC;
+    desc.memoryProperties = GFX_MEMORY_PROPERTY_HOST_VISIBLE | GFX_MEMORY_PROPERTY_HOST_COHERENT;
+
+    if (gfxDeviceCreateBuffer(device, &desc, &m_buffer) != GFX_RESULT_SUCCESS || !m_buffer) {
+        LOGW("Could not create staging ring: size = %llu bytes", static_cast<unsigned long long>(size));
+        m_buffer = {};
+        return;
+    }
+
+    void* pointer{ nullptr };
+    if (gfxBufferMapAsync(m_buffer, 0, size, &pointer) != GFX_RESULT_SUCCESS || !pointer) {
+        LOGI("Staging ring unavailable: the buffer could not be mapped persistently");
+        gfxBufferDestroy(m_buffer);
+        m_buffer = {};
+        return;
+    }
+    m_data = static_cast<uint8_t*>(pointer);
+    m_statistics.size = size;
+}
+
+StagingRing::~StagingRing()
+{
+    if (!m_buffer) {
+        return;
+    }
+
+    if (m_allocator.GetAllocationCount() > 0) {
+        LOGW("Staging ring destroyed with %u live reservations", m_allocator.GetAllocationCount());
+    }
+    gfxBufferUnmap(m_buffer);
+    gfxBufferDestroy(m_buffer);
+}
+
+bool StagingRing::IsAvailable() const
+{
+    return m_data != nullptr;
+}
+
+std::unique_ptr<StagingRingAllocation> StagingRing::Reserve(const uint64_t size, const uint64_t alignment)
+{
+    if (!IsAvailable() || size == 0 || size > GetMaxReservationSize()) {
+        return nullptr;
+    }
+
+    std::lock_guard<std::mutex> lock{ m_mutex };
+    const auto offset{ m_allocator.Allocate(size, alignment) };
+    if (!offset) {
+        ++m_statistics.stallCount;
+        return nullptr;
+    }
+
+    ++m_statistics.reservationCount;
+    m_statistics.reservedBytes += size;
+    m_statistics.usedSize = m_allocator.GetUsedSize();
+    m_statistics.peakUsedSize = std::max(m_statistics.peakUsedSize, m_statistics.usedSize);
+    return std::unique_ptr<StagingRingAllocation>(new StagingRingAllocation(*this, *offset, size));
+}
+
+uint64_t StagingRing::GetMaxReservationSize() const
+{
+    return m_allocator.GetSize() / 4;
+}
+
+StagingRingStatistics StagingRing::GetStatistics() const
+{
+    std::lock_guard<std::mutex> lock{ m_mutex };
+    return m_statistics;
+}
+
+void StagingRing::Release(const uint64_t offset)
+{
+    std::lock_guard<std::mutex> lock{ m_mutex };
+    m_allocator.Free(offset);
+    m_statistics.usedSize = m_allocator.GetUsedSize();
+}
+} // namespace prev::core
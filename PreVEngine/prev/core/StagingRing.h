@@ -0,0 +1,107 @@
+#ifndef __STAGING_RING_H__
+#define __STAGING_RING_H__
+
+#include "Core.h"
+
+#include "memory/RingAllocator.h"
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+
+namespace prev::core {
+class StagingRing;
+
+struct StagingRingStatistics {
+    uint64_t size{};
+
+    uint64_t usedSize{};
+
+    uint64_t peakUsedSize{};
+
+    uint64_t reservationCount{};
+
+    uint64_t reservedBytes{};
+
+    // reservations that failed because the ring was full
+    uint64_t stallCount{};
+};
+
+// A range of the staging ring, written through GetData() and copied from GetBuffer() at GetOffset(). The range
+// goes back to the ring on destruction - hand it to the DeferredResourceDestroyer once a copy from it is recorded.
+class StagingRingAllocation final {
+public:
+    ~StagingRingAllocation();
+
+    StagingRingAllocation(const StagingRingAllocation&) = delete;
+    StagingRingAllocation& operator=(const StagingRingAllocation&) = delete;
+
+public:
+    GfxBuffer GetBuffer() const;
+
+    uint64_t GetOffset() const;
+
+    uint64_t GetSize() const;
+
+    void* GetData() const;
+
+private:
+    friend class StagingRing;
+
+    StagingRingAllocation(StagingRing& ring, const uint64_t offset, const uint64_t size);
+
+private:
+    StagingRing& m_ring;
+
+    uint64_t m_offset;
+
+    uint64_t m_size;
+};
+
+// Persistently mapped host-visible buffer, the source of upload copies. Replaces a staging buffer created, mapped
+// and destroyed per upload. Unavailable where a buffer can not stay mapped (the map does not land inline, web),
+// callers keep their own staging buffers there. Thread-safe.
+class StagingRing final {
+public:
+    StagingRing(GfxDevice device, const uint64_t size);
+
+    ~StagingRing();
+
+    StagingRing(const StagingRing&) = delete;
+    StagingRing& operator=(const StagingRing&) = delete;
+
+public:
+    bool IsAvailable() const;
+
+    // Returns nullptr when the ring is unavailable or full - the caller retries in a later frame, once older
+    // ranges were retired, or falls back to its own staging.
+    std::unique_ptr<StagingRingAllocation> Reserve(const uint64_t size, const uint64_t alignment = DEFAULT_RESERVATION_ALIGNMENT);
+
+    // Larger reservations would keep too much of the ring from the others, split such uploads into chunks.
+    uint64_t GetMaxReservationSize() const;
+
+    StagingRingStatistics GetStatistics() const;
+
+private:
+    friend class StagingRingAllocation;
+
+    void Release(const uint64_t offset);
+
+private:
+    // covers the copy offset alignment of all backends
+    static const inline uint64_t DEFAULT_RESERVATION_ALIGNMENT{ 16 };
+
+private:
+    GfxBuffer m_buffer{};
+
+    uint8_t* m_data{};
+
+    mutable std::mutex m_mutex;
+
+    prev::core::memory::RingAllocator m_allocator;
+
+    StagingRingStatistics m_statistics{};
+};
+} // namespace prev::core
+
+#endif // !__STAGING_RING_H__
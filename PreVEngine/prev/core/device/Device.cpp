@@ -2,22 +2,56 @@
 
 #include "../../common/Common.h"
 #include "../../common/Logger.h"
+#include "../AssetLoader.h"
 #include "../DeferredResourceDestroyer.h"
 #include "../DeferredResourceUploader.h"
+#include "../memory/BufferMemoryAllocator.h"
 
 #include <algorithm>
 #include <iterator>
 #include <stdexcept>
+#include <thread>
 
 namespace prev::core::device {
+namespace {
+    size_t GetAssetLoaderThreadCount()
+    {
+#ifdef __EMSCRIPTEN__
+        // no worker threads on the web, loads run in AssetLoader::Update
+        return 0;
+#else
+        // leave a core to the frame loop
+        return std::max(std::thread::hardware_concurrency(), 2u) - 1;
+#endif
+    }
+
+    size_t GetWorkerThreadCount()
+    {
+#ifdef __EMSCRIPTEN__
+        // no worker threads on the web
+        return 0;
+#else
+        // leave a core to the frame loop
+        return std::max(std::thread::hardware_concurrency(), 2u) - 1;
+#endif
+    }
+} // namespace
+
 Device::Device(const Adapter& adapter, GfxDevice handle, std::map<QueueType, std::vector<std::unique_ptr<Queue>>>&& queues, std::vector<std::string> enabledExtensions)
     : m_adapter{ adapter }
     , m_handle{ handle }
     , m_queues{ std::move(queues) }
     , m_enabledExtensions{ std::move(enabledExtensions) }
     , m_deferredResourceDestroyer{ std::make_unique<prev::core::DeferredResourceDestroyer>() }
-    , m_deferredResourceUploader{ std::make_unique<prev::core::DeferredResourceUploader>(*m_deferredResourceDestroyer) }
+    , m_deferredResourceUploader{ std::make_unique<prev::core::DeferredResourceUploader>(handle, *m_deferredResourceDestroyer) }
+    , m_assetLoader{ std::make_unique<prev::core::AssetLoader>(GetAssetLoaderThreadCount()) }
+    , m_bufferMemoryAllocator{ std::make_unique<prev::core::memory::BufferMemoryAllocator>(handle) }
+    , m_pipelineCache{ std::make_unique<prev::render::pipeline::PipelineCache>() }
+    , m_workerThreadPool{ std::make_unique<prev::common::ThreadPool>(GetWorkerThreadCount()) }
 {
+    if (HasQueue(QueueType::TRANSFER) && HasQueue(QueueType::GRAPHICS) && GetQueue(QueueType::TRANSFER).handle != GetQueue(QueueType::GRAPHICS).handle) {
+        m_deferredResourceUploader->SetTransferQueue(&GetQueue(QueueType::TRANSFER));
+    }
     LOGI("Logical Device created");
 }
 
@@ -25,12 +59,20 @@ Device::~Device()
 {
     gfxDeviceWaitIdle(m_handle);
 
-    // Uploader first: it may still hold un-flushed staging buffers and references the destroyer.
+    // Asset loader first: its pending staging steps create resources on this device.
+    m_assetLoader.reset();
+
+    // The cached pipelines, layouts and modules nobody holds anymore.
+    m_pipelineCache.reset();
+
+    // Deferred resources next: they return their ranges to the uploader's staging ring.
+    m_deferredResourceDestroyer->Flush();
+
+    // Uploader then: it may still hold un-flushed staging buffers and references the destroyer.
     m_deferredResourceUploader.reset();
-    if (m_deferredResourceDestroyer) {
-        m_deferredResourceDestroyer->Flush();
-        m_deferredResourceDestroyer.reset();
-    }
+    m_deferredResourceDestroyer.reset();
+    // Last: the flush above returned the deferred sub-allocations to their blocks.
+    m_bufferMemoryAllocator.reset();
     gfxDeviceDestroy(m_handle);
     m_handle = nullptr;
     LOGI("Logical device destroyed");
@@ -102,6 +144,26 @@ prev::core::DeferredResourceUploader& Device::GetDeferredResourceUploader() cons
     return *m_deferredResourceUploader;
 }
 
+prev::core::AssetLoader& Device::GetAssetLoader() const
+{
+    return *m_assetLoader;
+}
+
+prev::core::memory::BufferMemoryAllocator& Device::GetBufferMemoryAllocator() const
+{
+    return *m_bufferMemoryAllocator;
+}
+
+prev::render::pipeline::PipelineCache& Device::GetPipelineCache() const
+{
+    return *m_pipelineCache;
+}
+
+prev::common::ThreadPool& Device::GetWorkerThreadPool() const
+{
+    return *m_workerThreadPool;
+}
+
 void Device::Print() const
 {
     auto queueTypeToString = [](const QueueType type) {
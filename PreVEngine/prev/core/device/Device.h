@@ -4,8 +4,13 @@
 #include "Adapter.h"
 #include "Queue.h"
 
+#include "../AssetLoader.h"
 #include "../DeferredResourceDestroyer.h"
 #include "../DeferredResourceUploader.h"
+#include "../memory/BufferMemoryAllocator.h"
+
+#include "../../common/ThreadPool.h"
+#include "../../render/pipeline/PipelineCache.h"
 
 #include <map>
 #include <memory>
@@ -35,6 +40,15 @@ public:
 
     prev::core::DeferredResourceUploader& GetDeferredResourceUploader() const;
 
+    prev::core::AssetLoader& GetAssetLoader() const;
+
+    prev::core::memory::BufferMemoryAllocator& GetBufferMemoryAllocator() const;
+
+    prev::render::pipeline::PipelineCache& GetPipelineCache() const;
+
+    // Short data parallel jobs of the frame. It has no threads on the web, callers run the work themselves then.
+    prev::common::ThreadPool& GetWorkerThreadPool() const;
+
     void Print() const;
 
 public:
@@ -54,6 +68,14 @@ private:
     std::unique_ptr<prev::core::DeferredResourceDestroyer> m_deferredResourceDestroyer;
 
     std::unique_ptr<prev::core::DeferredResourceUploader> m_deferredResourceUploader;
+
+    std::unique_ptr<prev::core::AssetLoader> m_assetLoader;
+
+    std::unique_ptr<prev::core::memory::BufferMemoryAllocator> m_bufferMemoryAllocator;
+
+    std::unique_ptr<prev::render::pipeline::PipelineCache> m_pipelineCache;
+
+    std::unique_ptr<prev::common::ThreadPool> m_workerThreadPool;
 };
 } // namespace prev::core::device
 
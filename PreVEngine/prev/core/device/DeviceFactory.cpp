@@ -29,12 +29,35 @@ std::unique_ptr<Device> DeviceFactory::Create(const Adapter& adapter, const std:
     nativeExtsDesc.nativeExtensions = nativeExtPtrs.empty() ? nullptr : nativeExtPtrs.data();
     nativeExtsDesc.nativeExtensionCount = static_cast<uint32_t>(nativeExtPtrs.size());
 
+    // Determine the real family index and its actual capability flags from the adapter.
+    // gfx defaults to the graphics queue family when no explicit queue requests are made.
+    const auto queueFamilies{ adapter.GetQueueFamilies() };
+    const int32_t familyIndex{ adapter.FindQueueFamily(GFX_QUEUE_FLAG_GRAPHICS) };
+    if (familyIndex < 0 || static_cast<uint32_t>(familyIndex) >= static_cast<uint32_t>(queueFamilies.size())) {
+        throw std::runtime_error("Failed to find graphics queue family");
+    }
+    const GfxQueueFlags actualFlags{ queueFamilies[static_cast<uint32_t>(familyIndex)].flags };
+
+    // A second queue of the graphics family takes the async uploads off the rendering queue. Of the same family,
+    // so that the resources need no queue family ownership transfer before the graphics queue uses them.
+    std::vector<GfxQueueRequest> queueRequests;
+    if (queueFamilies[static_cast<uint32_t>(familyIndex)].queueCount > 1) {
+        for (uint32_t queueIndex = 0; queueIndex < 2; ++queueIndex) {
+            GfxQueueRequest queueRequest{};
+            queueRequest.sType = GFX_STRUCTURE_TYPE_QUEUE_REQUEST;
+            queueRequest.queueFamilyIndex = static_cast<uint32_t>(familyIndex);
+            queueRequest.queueIndex = queueIndex;
+            queueRequest.priority = queueIndex == 0 ? 1.0f : 0.5f;
+            queueRequests.push_back(queueRequest);
+        }
+    }
+
     GfxDeviceDescriptor deviceDesc{};
     deviceDesc.sType = GFX_STRUCTURE_TYPE_DEVICE_DESCRIPTOR;
     deviceDesc.pNext = nativeExtensions.empty() ? nullptr : &nativeExtsDesc;
     deviceDesc.label = "Main Device";
-    deviceDesc.queueRequests = nullptr;
-    deviceDesc.queueRequestCount = 0;
+    deviceDesc.queueRequests = queueRequests.empty() ? nullptr : queueRequests.data();
+    deviceDesc.queueRequestCount = static_cast<uint32_t>(queueRequests.size());
     deviceDesc.enabledExtensions = extPtrs.empty() ? nullptr : extPtrs.data();
     deviceDesc.enabledExtensionCount = static_cast<uint32_t>(extPtrs.size());
 
@@ -49,15 +72,11 @@ std::unique_ptr<Device> DeviceFactory::Create(const Adapter& adapter, const std:
         throw std::runtime_error("Failed to get device queue");
     }
 
-    // Determine the real family index and its actual capability flags from the adapter.
-    // gfx defaults to the graphics queue family when no explicit queue requests are made.
-    const auto queueFamilies{ adapter.GetQueueFamilies() };
-    const int32_t familyIndex{ adapter.FindQueueFamily(GFX_QUEUE_FLAG_GRAPHICS) };
-    if (familyIndex < 0 || static_cast<uint32_t>(familyIndex) >= static_cast<uint32_t>(queueFamilies.size())) {
-        gfxDeviceDestroy(gfxDevice);
-        throw std::runtime_error("Failed to find graphics queue family");
+    GfxQueue gfxTransferQueue{};
+    if (!queueRequests.empty() && gfxDeviceGetQueueByIndex(gfxDevice, static_cast<uint32_t>(familyIndex), 1, &gfxTransferQueue) != GFX_RESULT_SUCCESS) {
+        LOGW("Could not get a separate transfer queue, uploads stay on the graphics queue");
+        gfxTransferQueue = nullptr;
     }
-    const GfxQueueFlags actualFlags{ queueFamilies[static_cast<uint32_t>(familyIndex)].flags };
 
     auto makeQueue = [&]() { return std::make_unique<Queue>(gfxQueue, static_cast<uint32_t>(familyIndex), 0, actualFlags); };
 
@@ -70,7 +89,9 @@ std::unique_ptr<Device> DeviceFactory::Create(const Adapter& adapter, const std:
     if (prev::util::math::HasAnyFlagsSet(actualFlags, static_cast<GfxQueueFlags>(GFX_QUEUE_FLAG_COMPUTE))) {
         queues[QueueType::COMPUTE].push_back(makeQueue());
     }
-    if (prev::util::math::HasAnyFlagsSet(actualFlags, static_cast<GfxQueueFlags>(GFX_QUEUE_FLAG_TRANSFER))) {
+    if (gfxTransferQueue) {
+        queues[QueueType::TRANSFER].push_back(std::make_unique<Queue>(gfxTransferQueue, static_cast<uint32_t>(familyIndex), 1, actualFlags));
+    } else if (prev::util::math::HasAnyFlagsSet(actualFlags, static_cast<GfxQueueFlags>(GFX_QUEUE_FLAG_TRANSFER))) {
         queues[QueueType::TRANSFER].push_back(makeQueue());
     }
 
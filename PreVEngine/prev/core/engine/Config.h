@@ -46,6 +46,18 @@ struct Config {
     int32_t gpuIndex{ -1 };
 
     XrMode xrMode{ XrMode::VR }; // initial XR compositing mode (XR builds only)
+
+    float frameTimeBudget{ 1.0f / 60.0f }; // frames presented later than this count as over budget
+
+    float frameStatisticsReportInterval{ 2.0f }; // seconds between frame time percentile reports in the log, 0 = none
+
+    std::string frameStatisticsCsvPath{}; // when set, every report is appended to this CSV file as well
+
+    bool gpuFrameTiming{ false }; // timestamp queries around the frame's commands, needs timestamp query support
+
+    float fixedDeltaTime{ 0.0f }; // > 0: the scene advances by this every frame instead of the measured time (benchmarks, replays)
+
+    uint32_t maxFrameCount{ 0 }; // > 0: the main loop ends after this many frames
 };
 } // namespace prev::core::engine
 
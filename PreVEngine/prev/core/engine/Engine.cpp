@@ -5,13 +5,25 @@
 #include "../CommandsExecutor.h"
 #include "../CoreEvents.h"
 
+#include "../../common/FrameAllocator.h"
 #include "../../common/Logger.h"
+#include "../../event/EventQueue.h"
+#include "../../input/InputSnapshotTracker.h"
+#include "../../profile/Profile.h"
+#include "../../render/query/QueryPoolBuilder.h"
 
 #ifdef __EMSCRIPTEN__
 #include <emscripten.h>
 #endif
 
 namespace prev::core::engine {
+namespace {
+    float ToSeconds(const std::chrono::steady_clock::duration duration)
+    {
+        return std::chrono::duration<float>(duration).count();
+    }
+} // namespace
+
 Engine::Engine(const Config& config)
     : m_engineImpl{ impl::EngineImplFactory{}.Create(config) }
 {
@@ -25,6 +37,19 @@ Engine::~Engine()
 void Engine::Init()
 {
     m_engineImpl->Init();
+
+    // created up front, so that it does not miss the input of the first frame
+    prev::input::InputSnapshotTracker::Instance();
+
+    const auto& config{ m_engineImpl->GetConfig() };
+    if (config.gpuFrameTiming) {
+        // a slot more than frames in flight, so that the one read back is never written meanwhile
+        m_frameTimestampQueryPool = prev::render::query::QueryPoolBuilder{ m_engineImpl->GetDevice() }
+                                        .SetQueryType(GFX_QUERY_TYPE_TIMESTAMP)
+                                        .SetPoolCount(config.swapchainFrameCount + 1)
+                                        .SetQueryCount(2)
+                                        .Build();
+    }
 }
 
 void Engine::InitScene(std::unique_ptr<prev::scene::IScene> scene)
@@ -39,7 +64,18 @@ void Engine::InitRenderer(std::unique_ptr<prev::render::IRootRenderer> rootRende
 
 void Engine::RunOneFrame()
 {
-    prev::event::EventChannel::DispatchAll();
+    PREV_PROFILE_SCOPE("Frame");
+
+    const auto frameStart{ std::chrono::steady_clock::now() };
+
+    // nothing uses the frame memory of the last frame anymore
+    prev::common::FrameAllocator::Instance().BeginFrame();
+
+    {
+        PREV_PROFILE_SCOPE("DispatchEvents");
+        prev::event::EventQueue::Instance().DispatchAll();
+        prev::event::EventChannel::DispatchAll();
+    }
 
     if (!m_engineImpl->BeginFrame()) {
         return;
@@ -47,31 +83,56 @@ void Engine::RunOneFrame()
 
     m_engineImpl->PollActions();
 
+    {
+        // the input posted by the actions reaches the scene in this very frame
+        PREV_PROFILE_SCOPE("DispatchInputEvents");
+        prev::event::EventQueue::Instance().DispatchAll();
+        prev::input::InputSnapshotTracker::Instance().Publish();
+    }
+
     auto& scene{ m_engineImpl->GetScene() };
     auto& rootRenderer{ m_engineImpl->GetRootRenderer() };
     auto& swapchain{ m_engineImpl->GetSwapchain() };
 
     const GfxExtent2D extent{ swapchain.GetExtent() };
-    const auto deltaTime{ m_engineImpl->GetCurrentDeltaTime() };
+    const auto& config{ m_engineImpl->GetConfig() };
+    const auto deltaTime{ config.fixedDeltaTime > 0.0f ? config.fixedDeltaTime : m_engineImpl->GetCurrentDeltaTime() };
 
     prev::event::EventChannel::Post(NewIterationEvent{ deltaTime, extent.width, extent.height });
 
-    scene.Update(deltaTime);
+    {
+        PREV_PROFILE_SCOPE("Scene::Update");
+        const auto updateStart{ std::chrono::steady_clock::now() };
+        scene.Update(deltaTime);
+        m_frameTimingStatistics.updateTime = ToSeconds(std::chrono::steady_clock::now() - updateStart);
+    }
+
+    // Stages assets loaded in the background; their uploads are flushed below in this very frame.
+    {
+        PREV_PROFILE_SCOPE("AssetLoader::Update");
+        m_engineImpl->GetDevice().GetAssetLoader().Update();
+    }
 
     // Frame scope: acquire the image + begin the single command buffer once. A frame is then rendered in
     // one or more passes: a single multiview pass, or one pass per eye where there is no multiview
     // (e.g. WebGPU). Each pass renders the view window the swapchain reports (viewOffset/viewCount) into
     // that pass's framebuffer; EndFrame submits the command buffer once.
     prev::render::swapchain::FrameContext frameContext;
+    const auto acquireStart{ std::chrono::steady_clock::now() };
     if (swapchain.BeginFrame(frameContext)) {
+        m_renderStart = std::chrono::steady_clock::now();
+
         // Per-frame resource bookkeeping (once): retire this slot's previous resources. BeginFrame waited
-        // the slot's fence, so the GPU is done with everything keyed to it.
+        // the slot's fence, so the GPU is done with everything keyed to it. The uploader goes first: it
+        // readies finished transfer-queue uploads and waits the ones the slot's resources may still see.
+        auto& uploader{ m_engineImpl->GetDeferredResourceUploader() };
+        uploader.AdvanceFrame(frameContext.index);
         m_engineImpl->GetDeferredResourceDestroyer().AdvanceFrame(frameContext.index);
 
         // Own submit so a rejected frame submit doesn't take the uploads with it. Must follow AdvanceFrame:
         // that keys their staging + one-shot command buffer to this slot, whose fence covers the upload.
-        auto& uploader{ m_engineImpl->GetDeferredResourceUploader() };
         if (uploader.HasPending()) {
+            PREV_PROFILE_SCOPE("FlushUploads");
             auto& device{ m_engineImpl->GetDevice() };
             prev::core::CommandsExecutor commandsExecutor{ device, device.GetQueue(prev::core::device::QueueType::GRAPHICS) };
             commandsExecutor.ExecuteDeferred(m_engineImpl->GetDeferredResourceDestroyer(), [&uploader](GfxCommandEncoder encoder) {
@@ -79,26 +140,85 @@ void Engine::RunOneFrame()
             });
         }
 
+        BeginGpuFrameTiming(frameContext.commandEncoder);
+
         const uint32_t passCount{ swapchain.GetPassCount() };
         prev::render::FrameSubmitSync submitSync{};
         for (uint32_t pass = 0; pass < passCount; ++pass) {
+            PREV_PROFILE_SCOPE("Render");
             swapchain.BeginPass(frameContext, pass);
             const prev::render::RenderContext renderContext{ frameContext.frameBuffer, frameContext.commandEncoder, frameContext.index, { { 0, 0 }, extent }, frameContext.viewOffset, frameContext.viewCount, m_engineImpl->GetConfig().colorManaged };
             submitSync = rootRenderer.Render(renderContext, scene); // XR sync is empty; use the last pass's for the single submit
             swapchain.EndPass(pass);
         }
-        swapchain.EndFrame(submitSync);
+        EndGpuFrameTiming(frameContext.commandEncoder);
+        {
+            PREV_PROFILE_SCOPE("Submit");
+            swapchain.EndFrame(submitSync);
+        }
+
+        m_renderEnd = std::chrono::steady_clock::now();
+        m_frameTimingStatistics.renderTime = ToSeconds(m_renderEnd - m_renderStart);
+
+        // the wait for the swapchain image and the frame slot is not CPU work of the frame
+        prev::profile::FrameSample sample{};
+        sample.cpuTime = ToSeconds((m_renderEnd - frameStart) - (m_renderStart - acquireStart));
+        sample.gpuTime = m_gpuFrameTime;
+        sample.presentInterval = m_lastPresentTime != std::chrono::steady_clock::time_point{} ? ToSeconds(m_renderEnd - m_lastPresentTime) : -1.0f;
+        m_engineImpl->GetFrameStatistics().Record(sample);
+        m_lastPresentTime = m_renderEnd;
     }
+    m_frameTimingStatistics.frameTime = deltaTime;
 
     m_engineImpl->EndFrame();
 }
 
+void Engine::BeginGpuFrameTiming(GfxCommandEncoder commandEncoder)
+{
+    if (!m_frameTimestampQueryPool) {
+        return;
+    }
+
+    m_frameTimestampQueryPool->Reset(commandEncoder);
+
+    // the result of a frame some frames back, the newest there is
+    if (m_frameTimestampQueryPool->IsAsyncResultReady() && m_frameTimestampQueryPool->GetAsyncQueryResults(m_frameTimestamps)) {
+        if (m_frameTimestamps[1] >= m_frameTimestamps[0]) {
+            m_gpuFrameTime = static_cast<float>(static_cast<double>(m_frameTimestamps[1] - m_frameTimestamps[0]) * 1e-9); // nanoseconds
+        }
+    }
+    m_frameTimestampQueryPool->StartAsyncMapRead();
+
+    m_frameTimestampQueryPool->WriteTimestamp(commandEncoder, 0);
+}
+
+void Engine::EndGpuFrameTiming(GfxCommandEncoder commandEncoder)
+{
+    if (!m_frameTimestampQueryPool) {
+        return;
+    }
+
+    m_frameTimestampQueryPool->WriteTimestamp(commandEncoder, 1);
+    m_frameTimestampQueryPool->Resolve(commandEncoder);
+}
+
 bool Engine::Tick()
 {
+    const auto maxFrameCount{ m_engineImpl->GetConfig().maxFrameCount };
+    if (maxFrameCount > 0 && m_frameCount >= maxFrameCount) {
+        return false;
+    }
+
     if (!m_engineImpl->Update()) {
         return false; // quit requested
     }
     RunOneFrame();
+    PREV_PROFILE_FRAME();
+
+    ++m_frameCount;
+    if (m_frameEndCallback) {
+        m_frameEndCallback();
+    }
     return true;
 }
 
@@ -122,6 +242,7 @@ void Engine::MainLoop()
 
 void Engine::ShutDown()
 {
+    m_frameTimestampQueryPool.reset();
     m_engineImpl->ShutDown();
 }
 
@@ -159,4 +280,24 @@ uint32_t Engine::GetViewCount() const
 {
     return m_engineImpl->GetViewCount();
 }
+
+FrameTimingStatistics Engine::GetFrameTimingStatistics() const
+{
+    return m_frameTimingStatistics;
+}
+
+prev::profile::FrameStatistics& Engine::GetFrameStatistics() const
+{
+    return m_engineImpl->GetFrameStatistics();
+}
+
+uint64_t Engine::GetFrameCount() const
+{
+    return m_frameCount;
+}
+
+void Engine::SetFrameEndCallback(const std::function<void()>& callback)
+{
+    m_frameEndCallback = callback;
+}
 } // namespace prev::core::engine
\ No newline at end of file
@@ -5,12 +5,27 @@
 
 #include "impl/EngineImpl.h"
 
+#include "../../profile/FrameStatistics.h"
 #include "../../render/IRootRenderer.h"
 #include "../../render/pass/RenderPass.h"
+#include "../../render/query/QueryPool.h"
 #include "../../render/swapchain/ISwapchain.h"
 #include "../../scene/IScene.h"
 
+#include <chrono>
+#include <functional>
+
 namespace prev::core::engine {
+// Seconds, of the last finished frame.
+struct FrameTimingStatistics {
+    float updateTime{};
+
+    // from the start of the frame's recording to its submit
+    float renderTime{};
+
+    float frameTime{};
+};
+
 class Engine final {
 public:
     Engine(const Config& config);
@@ -43,13 +58,47 @@ public:
 
     uint32_t GetViewCount() const;
 
+    FrameTimingStatistics GetFrameTimingStatistics() const;
+
+    // Per frame CPU, GPU and present times of the last frames, see Config::frameStatisticsReportInterval.
+    prev::profile::FrameStatistics& GetFrameStatistics() const;
+
+    // Frames run by the main loop so far.
+    uint64_t GetFrameCount() const;
+
+    // Called on the main thread after every frame, e.g. to sample the statistics of the frame.
+    void SetFrameEndCallback(const std::function<void()>& callback);
+
 private:
     void RunOneFrame();
 
+    void BeginGpuFrameTiming(GfxCommandEncoder commandEncoder);
+
+    void EndGpuFrameTiming(GfxCommandEncoder commandEncoder);
+
     bool Tick();
 
 private:
     std::unique_ptr<prev::core::engine::impl::EngineImpl> m_engineImpl{};
+
+    std::chrono::steady_clock::time_point m_renderStart{};
+
+    std::chrono::steady_clock::time_point m_renderEnd{};
+
+    FrameTimingStatistics m_frameTimingStatistics{};
+
+    std::chrono::steady_clock::time_point m_lastPresentTime{};
+
+    // Config::gpuFrameTiming
+    std::unique_ptr<prev::render::query::QueryPool> m_frameTimestampQueryPool{};
+
+    std::vector<uint64_t> m_frameTimestamps;
+
+    float m_gpuFrameTime{ -1.0f };
+
+    uint64_t m_frameCount{};
+
+    std::function<void()> m_frameEndCallback{};
 };
 } // namespace prev::core::engine
 
@@ -90,7 +90,7 @@ void DefaultEngineImpl::PollActions()
 
 bool DefaultEngineImpl::EndFrame()
 {
-    UpdateFps();
+    ReportFrameStatistics();
     return true;
 }
 
@@ -160,6 +160,12 @@ void DefaultEngineImpl::ResetDevice()
     if (isExtensionAvailable(GFX_DEVICE_EXTENSION_OCCLUSION_QUERY_PRECISE)) {
         extensions.push_back(GFX_DEVICE_EXTENSION_OCCLUSION_QUERY_PRECISE);
     }
+    // Block compressed texture formats, whichever families the adapter samples.
+    for (const auto& compressionExtension : { GFX_DEVICE_EXTENSION_TEXTURE_COMPRESSION_BC, GFX_DEVICE_EXTENSION_TEXTURE_COMPRESSION_ETC2, GFX_DEVICE_EXTENSION_TEXTURE_COMPRESSION_ASTC }) {
+        if (isExtensionAvailable(compressionExtension)) {
+            extensions.push_back(compressionExtension);
+        }
+    }
 
     m_device = prev::core::device::DeviceFactory{}.Create(*adapter, extensions);
     if (!m_device) {
@@ -5,6 +5,8 @@
 #include "../../../util/MathUtils.h"
 #include "../../../window/Window.h"
 
+#include <algorithm>
+#include <limits>
 #include <stdexcept>
 #include <vector>
 
@@ -59,6 +61,11 @@ prev::core::DeferredResourceUploader& EngineImpl::GetDeferredResourceUploader()
     return m_device->GetDeferredResourceUploader();
 }
 
+prev::profile::FrameStatistics& EngineImpl::GetFrameStatistics()
+{
+    return *m_frameStatistics;
+}
+
 const Config& EngineImpl::GetConfig() const
 {
     return m_config;
@@ -123,7 +130,10 @@ void EngineImpl::operator()(const prev::window::WindowSurfaceLostEvent& surfaceL
 void EngineImpl::ResetTiming()
 {
     m_clock = std::make_unique<prev::util::Clock<float>>();
-    m_fpsCounter = std::make_unique<prev::util::FPSCounter>();
+    m_frameStatistics = std::make_unique<prev::profile::FrameStatistics>();
+    m_frameStatistics->SetFrameBudget(m_config.frameTimeBudget);
+    m_frameStatisticsReportTime = 0.0f;
+    m_frameStatisticsReportedCount = 0;
 }
 
 void EngineImpl::ResetWindow()
@@ -168,10 +178,32 @@ std::unique_ptr<prev::render::pass::RenderPass> EngineImpl::CreateDefaultRenderP
         .Build();
 }
 
-void EngineImpl::UpdateFps()
+void EngineImpl::ReportFrameStatistics()
 {
-    if (m_fpsCounter->Tick()) {
-        LOGI("FPS %f", m_fpsCounter->GetAverageFPS());
+    if (m_config.frameStatisticsReportInterval <= 0.0f) {
+        return;
+    }
+
+    m_frameStatisticsReportTime += m_clock->GetDelta();
+    if (m_frameStatisticsReportTime < m_config.frameStatisticsReportInterval) {
+        return;
+    }
+    m_frameStatisticsReportTime = 0.0f;
+
+    // frames of the last interval only
+    const auto frameCount{ static_cast<uint32_t>(std::min<uint64_t>(m_frameStatistics->GetRecordedCount() - m_frameStatisticsReportedCount, std::numeric_limits<uint32_t>::max())) };
+    m_frameStatisticsReportedCount = m_frameStatistics->GetRecordedCount();
+    if (frameCount == 0) {
+        return;
+    }
+
+    const auto report{ m_frameStatistics->ComputeReport(frameCount) };
+    LOGI("Frame time p50 %.2f ms, p90 %.2f ms, p99 %.2f ms, max %.2f ms, over budget %u/%u (CPU p99 %.2f ms, GPU p99 %.2f ms)",
+        report.presentInterval.p50 * 1000.0f, report.presentInterval.p90 * 1000.0f, report.presentInterval.p99 * 1000.0f, report.presentInterval.max * 1000.0f,
+        report.overBudgetCount, report.frameCount, report.cpuTime.p99 * 1000.0f, report.gpuTime.p99 * 1000.0f);
+
+    if (!m_config.frameStatisticsCsvPath.empty()) {
+        prev::profile::FrameStatistics::AppendCsv(m_config.frameStatisticsCsvPath, report);
     }
 }
 } // namespace prev::core::engine::impl
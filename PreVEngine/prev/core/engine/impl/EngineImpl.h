@@ -10,6 +10,7 @@
 #include "../../instance/Instance.h"
 
 #include "../../../event/EventHandler.h"
+#include "../../../profile/FrameStatistics.h"
 #include "../../../render/IRootRenderer.h"
 #include "../../../render/pass/RenderPass.h"
 #include "../../../render/surface/Surface.h"
@@ -46,6 +47,8 @@ public:
 
     const Config& GetConfig() const;
 
+    prev::profile::FrameStatistics& GetFrameStatistics();
+
 public:
     virtual void Init() = 0;
 
@@ -106,7 +109,8 @@ protected:
 
     std::unique_ptr<prev::render::pass::RenderPass> CreateDefaultRenderPass(const prev::core::device::Device& device, GfxFormat colorFormat, GfxFormat depthFormat, uint32_t viewCount, bool storeColor, bool storeDepth);
 
-    void UpdateFps();
+    // Logs, and optionally dumps, the frame time percentiles once per report interval.
+    void ReportFrameStatistics();
 
 private:
     prev::event::EventHandler<EngineImpl, prev::window::WindowChangeEvent> m_windowChangedHandler{ *this };
@@ -120,7 +124,11 @@ protected:
 
     std::unique_ptr<prev::util::Clock<float>> m_clock{};
 
-    std::unique_ptr<prev::util::FPSCounter> m_fpsCounter{};
+    std::unique_ptr<prev::profile::FrameStatistics> m_frameStatistics{};
+
+    float m_frameStatisticsReportTime{};
+
+    uint64_t m_frameStatisticsReportedCount{};
 
     std::unique_ptr<prev::core::instance::Instance> m_instance{};
 
@@ -96,7 +96,7 @@ void XrEngineImpl::PollActions()
 bool XrEngineImpl::EndFrame()
 {
     bool result{ m_xr->EndFrame() };
-    UpdateFps();
+    ReportFrameStatistics();
     return result;
 }
 
@@ -0,0 +1,171 @@
+#include "BufferMemoryAllocator.h"
+
+#include "../../common/Logger.h"
+
+#include <algorithm>
+
+namespace prev::core::memory {
+struct BufferMemoryBlock {
+    BufferMemoryBlock(GfxBuffer buffer, const GfxBufferUsageFlags usageFlags, const GfxMemoryPropertyFlags memoryProperties, const uint64_t size)
+        : buffer{ buffer }
+        , usageFlags{ usageFlags }
+        , memoryProperties{ memoryProperties }
+        , allocator{ size }
+    {
+    }
+
+    GfxBuffer buffer;
+
+    GfxBufferUsageFlags usageFlags;
+
+    GfxMemoryPropertyFlags memoryProperties;
+
+    TlsfAllocator allocator;
+};
+
+BufferSubAllocation::BufferSubAllocation(BufferMemoryAllocator& allocator, BufferMemoryBlock& block, const TlsfAllocation& allocation)
+    : m_allocator{ allocator }
+    , m_block{ block }
+    , m_allocation{ allocation }
+{
+}
+
+BufferSubAllocation::~BufferSubAllocation()
+{
+    m_allocator.Free(m_block, m_allocation);
+}
+
+GfxBuffer BufferSubAllocation::GetBuffer() const
+{
+    return m_block.buffer;
+}
+
+uint64_t BufferSubAllocation::GetOffset() const
+{
+    return m_allocation.offset;
+}
+
+uint64_t BufferSubAllocation::GetSize() const
+{
+    return m_allocation.size;
+}
+
+BufferMemoryAllocator::BufferMemoryAllocator(GfxDevice device, const uint64_t blockSize)
+    : m_device{ device }
+    , m_blockSize{ blockSize }
+{
+}
+
+BufferMemoryAllocator::~BufferMemoryAllocator()
+{
+    std::lock_guard<std::mutex> lock{ m_mutex };
+    for (const auto& block : m_blocks) {
+        if (!block->allocator.IsEmpty()) {
+            LOGW("Buffer memory block destroyed with %u live allocations", block->allocator.GetAllocationCount());
+        }
+        gfxBufferDestroy(block->buffer);
+    }
+}
+
+std::unique_ptr<BufferSubAllocation> BufferMemoryAllocator::Allocate(const GfxBufferUsageFlags usageFlags, const GfxMemoryPropertyFlags memoryProperties, const uint64_t size, const uint64_t alignment)
+{
+    if (size == 0 || size > GetMaxAllocationSize()) {
+        return nullptr;
+    }
+
+    std::lock_guard<std::mutex> lock{ m_mutex };
+    for (auto& block : m_blocks) {
+        if (block->usageFlags != usageFlags || block->memoryProperties != memoryProperties) {
+            continue;
+        }
+        if (const auto allocation = block->allocator.Allocate(size, alignment)) {
+            return std::unique_ptr<BufferSubAllocation>(new BufferSubAllocation(*this, *block, *allocation));
+        }
+    }
+
+    auto block{ CreateBlock(usageFlags, memoryProperties) };
+    if (!block) {
+        return nullptr;
+    }
+
+    const auto allocation{ block->allocator.Allocate(size, alignment) };
+    if (!allocation) {
+        gfxBufferDestroy(block->buffer);
+        return nullptr;
+    }
+
+    m_blocks.push_back(std::move(block));
+    return std::unique_ptr<BufferSubAllocation>(new BufferSubAllocation(*this, *m_blocks.back(), *allocation));
+}
+
+uint64_t BufferMemoryAllocator::GetMaxAllocationSize() const
+{
+    // larger buffers would leave too little of a block for the others
+    return m_blockSize / 4;
+}
+
+void BufferMemoryAllocator::ReleaseEmptyBlocks()
+{
+    std::lock_guard<std::mutex> lock{ m_mutex };
+    m_blocks.erase(std::remove_if(m_blocks.begin(), m_blocks.end(), [](const auto& block) {
+        if (!block->allocator.IsEmpty()) {
+            return false;
+        }
+        gfxBufferDestroy(block->buffer);
+        return true;
+    }),
+        m_blocks.end());
+}
+
+BufferMemoryStatistics BufferMemoryAllocator::GetStatistics() const
+{
+    std::lock_guard<std::mutex> lock{ m_mutex };
+    BufferMemoryStatistics statistics{};
+    statistics.blockCount = static_cast<uint32_t>(m_blocks.size());
+    for (const auto& block : m_blocks) {
+        statistics.allocationCount += block->allocator.GetAllocationCount();
+        statistics.reservedSize += block->allocator.GetSize();
+        statistics.usedSize += block->allocator.GetUsedSize();
+        statistics.maxFragmentation = std::max(statistics.maxFragmentation, block->allocator.GetFragmentation());
+    }
+    return statistics;
+}
+
+void BufferMemoryAllocator::Free(BufferMemoryBlock& block, const TlsfAllocation& allocation)
+{
+    std::lock_guard<std::mutex> lock{ m_mutex };
+    block.allocator.Free(allocation);
+    if (!block.allocator.IsEmpty()) {
+        return;
+    }
+
+    // keep a single empty block of a kind around
+    const auto otherEmptyBlockIter{ std::find_if(m_blocks.begin(), m_blocks.end(), [&](const auto& other) {
+        return other.get() != &block && other->usageFlags == block.usageFlags && other->memoryProperties == block.memoryProperties && other->allocator.IsEmpty();
+    }) };
+    if (otherEmptyBlockIter == m_blocks.end()) {
+        return;
+    }
+
+    // the freed range is not used by the GPU anymore - the whole block is not then
+    const auto blockIter{ std::find_if(m_blocks.begin(), m_blocks.end(), [&](const auto& other) { return other.get() == &block; }) };
+    gfxBufferDestroy(block.buffer);
+    m_blocks.erase(blockIter);
+}
+
+std::unique_ptr<BufferMemoryBlock> BufferMemoryAllocator::CreateBlock(const GfxBufferUsageFlags usageFlags, const GfxMemoryPropertyFlags memoryProperties) const
+{
+    GfxBufferDescriptor desc{};
+    desc.sType = GFX_STRUCTURE_TYPE_BUFFER_DESCRIPTOR;
+    desc.size = m_blockSize;
+    desc.usage = usageFlags;
+    desc.memoryProperties = memoryProperties;
+
+    GfxBuffer buffer{};
+    if (gfxDeviceCreateBuffer(m_device, &desc, &buffer) != GFX_RESULT_SUCCESS || !buffer) {
+        LOGW("Could not allocate buffer memory block: size = %llu bytes", static_cast<unsigned long long>(m_blockSize));
+        return nullptr;
+    }
+    return std::make_unique<BufferMemoryBlock>(buffer, usageFlags, memoryProperties, m_blockSize);
+}
+} // namespace prev::core::memory
@@ -0,0 +1,107 @@
+#ifndef __BUFFER_MEMORY_ALLOCATOR_H__
+#define __BUFFER_MEMORY_ALLOCATOR_H__
+
+#include "TlsfAllocator.h"
+
+#include "../Core.h"
+
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace prev::core::memory {
+class BufferMemoryAllocator;
+
+struct BufferMemoryBlock;
+
+struct BufferMemoryStatistics {
+    uint32_t blockCount{};
+
+    uint32_t allocationCount{};
+
+    // bytes held by the blocks
+    uint64_t reservedSize{};
+
+    // bytes handed out to allocations
+    uint64_t usedSize{};
+
+    // of the worst block, see TlsfAllocator::GetFragmentation
+    float maxFragmentation{};
+};
+
+// A range of a block's GfxBuffer. It goes back to the block on destruction, so destroy it only once the GPU
+// stopped using the range (see DeferredResourceDestroyer).
+class BufferSubAllocation final {
+public:
+    ~BufferSubAllocation();
+
+    BufferSubAllocation(const BufferSubAllocation&) = delete;
+    BufferSubAllocation& operator=(const BufferSubAllocation&) = delete;
+
+public:
+    GfxBuffer GetBuffer() const;
+
+    uint64_t GetOffset() const;
+
+    uint64_t GetSize() const;
+
+private:
+    friend class BufferMemoryAllocator;
+
+    BufferSubAllocation(BufferMemoryAllocator& allocator, BufferMemoryBlock& block, const TlsfAllocation& allocation);
+
+private:
+    BufferMemoryAllocator& m_allocator;
+
+    BufferMemoryBlock& m_block;
+
+    TlsfAllocation m_allocation;
+};
+
+// Sub-allocates buffers from large GfxBuffer blocks, one set of blocks per usage and memory properties, so
+// that small buffers (vertex and index buffers of models, text meshes, ...) do not cost a driver allocation
+// each. Users must bind such buffers at their offset. Thread-safe.
+class BufferMemoryAllocator final {
+public:
+    explicit BufferMemoryAllocator(GfxDevice device, const uint64_t blockSize = DEFAULT_BLOCK_SIZE);
+
+    ~BufferMemoryAllocator();
+
+    BufferMemoryAllocator(const BufferMemoryAllocator&) = delete;
+    BufferMemoryAllocator& operator=(const BufferMemoryAllocator&) = delete;
+
+public:
+    // Returns nullptr when the size is over the sub-allocation limit or no block could be created,
+    // the caller falls back to a dedicated buffer then.
+    std::unique_ptr<BufferSubAllocation> Allocate(const GfxBufferUsageFlags usageFlags, const GfxMemoryPropertyFlags memoryProperties, const uint64_t size, const uint64_t alignment);
+
+    uint64_t GetMaxAllocationSize() const;
+
+    // Defragmentation hook: frees the blocks without any allocation, e.g. after a scene was unloaded. Blocks
+    // left empty are otherwise kept (one per kind), so that a reload does not create them again.
+    void ReleaseEmptyBlocks();
+
+    BufferMemoryStatistics GetStatistics() const;
+
+private:
+    friend class BufferSubAllocation;
+
+    void Free(BufferMemoryBlock& block, const TlsfAllocation& allocation);
+
+    std::unique_ptr<BufferMemoryBlock> CreateBlock(const GfxBufferUsageFlags usageFlags, const GfxMemoryPropertyFlags memoryProperties) const;
+
+private:
+    static const inline uint64_t DEFAULT_BLOCK_SIZE{ 64 * 1024 * 1024 };
+
+private:
+    GfxDevice m_device;
+
+    uint64_t m_blockSize;
+
+    mutable std::mutex m_mutex;
+
+    std::vector<std::unique_ptr<BufferMemoryBlock>> m_blocks;
+};
+} // namespace prev::core::memory
+
+#endif // !__BUFFER_MEMORY_ALLOCATOR_H__
@@ -0,0 +1,89 @@
+#include "RingAllocator.h"
+
+#include <algorithm>
+#include <cassert>
+
+namespace prev::core::memory {
+namespace {
+    uint64_t AlignUp(const uint64_t value, const uint64_t alignment)
+    {
+        return (value + alignment - 1) / alignment * alignment;
+    }
+} // namespace
+
+RingAllocator::RingAllocator(const uint64_t size)
+    : m_size{ size }
+{
+}
+
+std::optional<uint64_t> RingAllocator::Allocate(const uint64_t size, const uint64_t alignment)
+{
+    if (size == 0 || size > m_size) {
+        return {};
+    }
+
+    const uint64_t safeAlignment{ std::max<uint64_t>(alignment, 1) };
+
+    uint64_t offset{ 0 };
+    if (!m_ranges.empty()) {
+        const auto& oldest{ m_ranges.front() };
+        const auto& newest{ m_ranges.back() };
+        const bool wrapped{ newest.begin < oldest.begin };
+
+        offset = AlignUp(newest.end, safeAlignment);
+        if (wrapped) {
+            // the free space is between the newest and the oldest range
+            if (offset + size > oldest.begin) {
+                return {};
+            }
+        } else if (offset + size > m_size) {
+            // no room up to the end of the block, try its start
+            if (size > oldest.begin) {
+                return {};
+            }
+            offset = 0;
+        }
+    }
+
+    m_ranges.push_back(Range{ offset, offset + size, false });
+    return offset;
+}
+
+void RingAllocator::Free(const uint64_t offset)
+{
+    const auto rangeIter{ std::find_if(m_ranges.begin(), m_ranges.end(), [&](const auto& range) { return range.begin == offset && !range.freed; }) };
+    assert(rangeIter != m_ranges.end());
+    if (rangeIter == m_ranges.end()) {
+        return;
+    }
+    rangeIter->freed = true;
+
+    while (!m_ranges.empty() && m_ranges.front().freed) {
+        m_ranges.pop_front();
+    }
+}
+
+uint64_t RingAllocator::GetSize() const
+{
+    return m_size;
+}
+
+uint64_t RingAllocator::GetUsedSize() const
+{
+    if (m_ranges.empty()) {
+        return 0;
+    }
+
+    const auto& oldest{ m_ranges.front() };
+    const auto& newest{ m_ranges.back() };
+    if (newest.begin < oldest.begin) {
+        return m_size - oldest.begin + newest.end;
+    }
+    return newest.end - oldest.begin;
+}
+
+uint32_t RingAllocator::GetAllocationCount() const
+{
+    return static_cast<uint32_t>(std::count_if(m_ranges.cbegin(), m_ranges.cend(), [](const auto& range) { return !range.freed; }));
+}
+} // namespace prev::core::memory
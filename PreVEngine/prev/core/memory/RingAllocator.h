@@ -0,0 +1,48 @@
+#ifndef __RING_ALLOCATOR_H__
+#define __RING_ALLOCATOR_H__
+
+#include <cstdint>
+#include <deque>
+#include <optional>
+
+namespace prev::core::memory {
+// Hands out ranges of one block of memory in a ring - the next range always follows the newest one and wraps
+// to the start of the block when it does not fit at its end. Ranges may be freed in any order, but their
+// memory is reused only once all older ranges were freed too, so a long living range blocks the ring.
+class RingAllocator final {
+public:
+    explicit RingAllocator(const uint64_t size);
+
+    ~RingAllocator() = default;
+
+public:
+    // Returns the offset of the range, fails when the ring is full.
+    std::optional<uint64_t> Allocate(const uint64_t size, const uint64_t alignment = 1);
+
+    void Free(const uint64_t offset);
+
+    uint64_t GetSize() const;
+
+    // including padding and the end of the block skipped on a wrap
+    uint64_t GetUsedSize() const;
+
+    uint32_t GetAllocationCount() const;
+
+private:
+    struct Range {
+        uint64_t begin{};
+
+        uint64_t end{};
+
+        bool freed{};
+    };
+
+private:
+    uint64_t m_size{};
+
+    // oldest range at the front
+    std::deque<Range> m_ranges;
+};
+} // namespace prev::core::memory
+
+#endif // !__RING_ALLOCATOR_H__
@@ -0,0 +1,283 @@
+#include "TlsfAllocator.h"
+
+#include <algorithm>
+#include <cassert>
+
+namespace prev::core::memory {
+namespace {
+    uint64_t AlignUp(const uint64_t value, const uint64_t alignment)
+    {
+        return (value + alignment - 1) / alignment * alignment;
+    }
+
+    uint32_t FindMostSignificantBit(uint64_t value)
+    {
+        uint32_t bit{ 0 };
+        while (value >>= 1) {
+            ++bit;
+        }
+        return bit;
+    }
+
+    uint32_t FindLeastSignificantBit(const uint32_t value)
+    {
+        uint32_t bit{ 0 };
+        while (((value >> bit) & 1u) == 0) {
+            ++bit;
+        }
+        return bit;
+    }
+} // namespace
+
+TlsfAllocator::TlsfAllocator(const uint64_t size, const uint64_t granularity)
+    : m_granularity{ std::max<uint64_t>(granularity, 1) }
+{
+    m_size = size / m_granularity * m_granularity;
+    m_freeHeads.fill(INVALID_NODE);
+    if (m_size > 0) {
+        InsertFreeNode(CreateNode(0, m_size));
+    }
+}
+
+std::optional<TlsfAllocation> TlsfAllocator::Allocate(const uint64_t size, const uint64_t alignment)
+{
+    if (size == 0) {
+        return {};
+    }
+
+    const uint64_t alignedSize{ AlignUp(size, m_granularity) };
+    const uint64_t alignedAlignment{ AlignUp(std::max<uint64_t>(alignment, 1), m_granularity) };
+
+    // a stricter alignment may cost up to one alignment of padding in front
+    const uint64_t requiredSize{ alignedSize + (alignedAlignment > m_granularity ? alignedAlignment - m_granularity : 0) };
+    if (requiredSize > m_size) {
+        return {};
+    }
+
+    uint32_t node{ FindFreeNode(requiredSize) };
+    if (node == INVALID_NODE) {
+        return {};
+    }
+    RemoveFreeNode(node);
+
+    const uint64_t padding{ AlignUp(m_nodes[node].offset, alignedAlignment) - m_nodes[node].offset };
+    if (padding > 0) {
+        InsertFreeNode(SplitFront(node, padding));
+    }
+
+    if (m_nodes[node].size > alignedSize) {
+        const uint32_t usedNode{ SplitFront(node, alignedSize) };
+        InsertFreeNode(node);
+        node = usedNode;
+    }
+
+    m_nodes[node].free = false;
+    m_usedSize += m_nodes[node].size;
+    ++m_allocationCount;
+    return TlsfAllocation{ m_nodes[node].offset, m_nodes[node].size, node };
+}
+
+void TlsfAllocator::Free(const TlsfAllocation& allocation)
+{
+    uint32_t node{ allocation.node };
+    assert(node < m_nodes.size() && !m_nodes[node].free && m_nodes[node].offset == allocation.offset);
+
+    m_usedSize -= m_nodes[node].size;
+    --m_allocationCount;
+
+    const uint32_t prevNode{ m_nodes[node].prevPhysical };
+    if (prevNode != INVALID_NODE && m_nodes[prevNode].free) {
+        RemoveFreeNode(prevNode);
+        m_nodes[prevNode].size += m_nodes[node].size;
+        m_nodes[prevNode].nextPhysical = m_nodes[node].nextPhysical;
+        if (m_nodes[node].nextPhysical != INVALID_NODE) {
+            m_nodes[m_nodes[node].nextPhysical].prevPhysical = prevNode;
+        }
+        DestroyNode(node);
+        node = prevNode;
+    }
+
+    const uint32_t nextNode{ m_nodes[node].nextPhysical };
+    if (nextNode != INVALID_NODE && m_nodes[nextNode].free) {
+        RemoveFreeNode(nextNode);
+        m_nodes[node].size += m_nodes[nextNode].size;
+        m_nodes[node].nextPhysical = m_nodes[nextNode].nextPhysical;
+        if (m_nodes[nextNode].nextPhysical != INVALID_NODE) {
+            m_nodes[m_nodes[nextNode].nextPhysical].prevPhysical = node;
+        }
+        DestroyNode(nextNode);
+    }
+
+    InsertFreeNode(node);
+}
+
+uint64_t TlsfAllocator::GetSize() const
+{
+    return m_size;
+}
+
+uint64_t TlsfAllocator::GetUsedSize() const
+{
+    return m_usedSize;
+}
+
+uint32_t TlsfAllocator::GetAllocationCount() const
+{
+    return m_allocationCount;
+}
+
+uint64_t TlsfAllocator::GetLargestFreeSize() const
+{
+    if (m_firstLevelBitmap == 0) {
+        return 0;
+    }
+
+    // the largest range is in the highest non-empty class, but not necessarily at its head
+    const uint32_t firstLevel{ FindMostSignificantBit(m_firstLevelBitmap) };
+    const uint32_t secondLevel{ FindMostSignificantBit(m_secondLevelBitmaps[firstLevel]) };
+    uint64_t largestSize{ 0 };
+    for (uint32_t node = m_freeHeads[firstLevel * SECOND_LEVEL_COUNT + secondLevel]; node != INVALID_NODE; node = m_nodes[node].nextFree) {
+        largestSize = std::max(largestSize, m_nodes[node].size);
+    }
+    return largestSize;
+}
+
+bool TlsfAllocator::IsEmpty() const
+{
+    return m_allocationCount == 0;
+}
+
+float TlsfAllocator::GetFragmentation() const
+{
+    const uint64_t freeSize{ m_size - m_usedSize };
+    if (freeSize == 0) {
+        return 0.0f;
+    }
+    return 1.0f - static_cast<float>(static_cast<double>(GetLargestFreeSize()) / static_cast<double>(freeSize));
+}
+
+void TlsfAllocator::MapSize(const uint64_t units, uint32_t& firstLevel, uint32_t& secondLevel)
+{
+    if (units < SECOND_LEVEL_COUNT) {
+        // small sizes are spread linearly over the first class
+        firstLevel = 0;
+        secondLevel = static_cast<uint32_t>(units);
+        return;
+    }
+
+    const uint32_t mostSignificantBit{ FindMostSignificantBit(units) };
+    firstLevel = std::min(mostSignificantBit - SECOND_LEVEL_LOG2 + 1, FIRST_LEVEL_COUNT - 1);
+    secondLevel = static_cast<uint32_t>(units >> (mostSignificantBit - SECOND_LEVEL_LOG2)) - SECOND_LEVEL_COUNT;
+}
+
+uint32_t TlsfAllocator::FindFreeNode(const uint64_t size) const
+{
+    // rounded up to the next class, so that any range found there is large enough
+    uint64_t units{ size / m_granularity };
+    if (units >= SECOND_LEVEL_COUNT) {
+        units += (uint64_t{ 1 } << (FindMostSignificantBit(units) - SECOND_LEVEL_LOG2)) - 1;
+    }
+
+    uint32_t firstLevel, secondLevel;
+    MapSize(units, firstLevel, secondLevel);
+
+    uint32_t secondLevelBitmap{ m_secondLevelBitmaps[firstLevel] & (~0u << secondLevel) };
+    if (secondLevelBitmap == 0) {
+        if (firstLevel + 1 >= FIRST_LEVEL_COUNT) {
+            return INVALID_NODE;
+        }
+
+        const uint32_t firstLevelBitmap{ m_firstLevelBitmap & (~0u << (firstLevel + 1)) };
+        if (firstLevelBitmap == 0) {
+            return INVALID_NODE;
+        }
+        firstLevel = FindLeastSignificantBit(firstLevelBitmap);
+        secondLevelBitmap = m_secondLevelBitmaps[firstLevel];
+    }
+    secondLevel = FindLeastSignificantBit(secondLevelBitmap);
+
+    const uint32_t node{ m_freeHeads[firstLevel * SECOND_LEVEL_COUNT + secondLevel] };
+    // the last class is open ended
+    return m_nodes[node].size >= size ? node : INVALID_NODE;
+}
+
+void TlsfAllocator::InsertFreeNode(const uint32_t node)
+{
+    uint32_t firstLevel, secondLevel;
+    MapSize(m_nodes[node].size / m_granularity, firstLevel, secondLevel);
+
+    auto& head{ m_freeHeads[firstLevel * SECOND_LEVEL_COUNT + secondLevel] };
+    m_nodes[node].free = true;
+    m_nodes[node].prevFree = INVALID_NODE;
+    m_nodes[node].nextFree = head;
+    if (head != INVALID_NODE) {
+        m_nodes[head].prevFree = node;
+    }
+    head = node;
+
+    m_firstLevelBitmap |= 1u << firstLevel;
+    m_secondLevelBitmaps[firstLevel] |= 1u << secondLevel;
+}
+
+void TlsfAllocator::RemoveFreeNode(const uint32_t node)
+{
+    uint32_t firstLevel, secondLevel;
+    MapSize(m_nodes[node].size / m_granularity, firstLevel, secondLevel);
+
+    auto& head{ m_freeHeads[firstLevel * SECOND_LEVEL_COUNT + secondLevel] };
+    if (m_nodes[node].prevFree != INVALID_NODE) {
+        m_nodes[m_nodes[node].prevFree].nextFree = m_nodes[node].nextFree;
+    } else {
+        head = m_nodes[node].nextFree;
+    }
+    if (m_nodes[node].nextFree != INVALID_NODE) {
+        m_nodes[m_nodes[node].nextFree].prevFree = m_nodes[node].prevFree;
+    }
+    m_nodes[node].free = false;
+    m_nodes[node].prevFree = INVALID_NODE;
+    m_nodes[node].nextFree = INVALID_NODE;
+
+    if (head == INVALID_NODE) {
+        m_secondLevelBitmaps[firstLevel] &= ~(1u << secondLevel);
+        if (m_secondLevelBitmaps[firstLevel] == 0) {
+            m_firstLevelBitmap &= ~(1u << firstLevel);
+        }
+    }
+}
+
+uint32_t TlsfAllocator::CreateNode(const uint64_t offset, const uint64_t size)
+{
+    Node node{};
+    node.offset = offset;
+    node.size = size;
+
+    if (!m_unusedNodes.empty()) {
+        const uint32_t index{ m_unusedNodes.back() };
+        m_unusedNodes.pop_back();
+        m_nodes[index] = node;
+        return index;
+    }
+    m_nodes.push_back(node);
+    return static_cast<uint32_t>(m_nodes.size() - 1);
+}
+
+void TlsfAllocator::DestroyNode(const uint32_t node)
+{
+    m_unusedNodes.push_back(node);
+}
+
+uint32_t TlsfAllocator::SplitFront(const uint32_t node, const uint64_t size)
+{
+    const uint32_t frontNode{ CreateNode(m_nodes[node].offset, size) };
+    m_nodes[frontNode].prevPhysical = m_nodes[node].prevPhysical;
+    m_nodes[frontNode].nextPhysical = node;
+    if (m_nodes[node].prevPhysical != INVALID_NODE) {
+        m_nodes[m_nodes[node].prevPhysical].nextPhysical = frontNode;
+    }
+
+    m_nodes[node].prevPhysical = frontNode;
+    m_nodes[node].offset += size;
+    m_nodes[node].size -= size;
+    return frontNode;
+}
+} // namespace prev::core::memory
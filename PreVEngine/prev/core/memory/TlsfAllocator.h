@@ -0,0 +1,111 @@
+#ifndef __TLSF_ALLOCATOR_H__
+#define __TLSF_ALLOCATOR_H__
+
+#include <array>
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+namespace prev::core::memory {
+
+struct TlsfAllocation {
+    uint64_t offset{};
+
+    uint64_t size{};
+
+    uint32_t node{};
+};
+
+// Two-level segregated fit allocator of ranges within one block of memory - it hands out offsets only, the memory
+// itself lives elsewhere (e.g. in a GfxBuffer). Allocation and free are O(1), freed ranges merge with their free
+// neighbours right away. Every offset and size is a multiple of the granularity.
+class TlsfAllocator final {
+public:
+    explicit TlsfAllocator(const uint64_t size, const uint64_t granularity = DEFAULT_GRANULARITY);
+
+    ~TlsfAllocator() = default;
+
+public:
+    // Fails when no free range is large enough, the alignment is rounded up to the granularity.
+    std::optional<TlsfAllocation> Allocate(const uint64_t size, const uint64_t alignment = 1);
+
+    void Free(const TlsfAllocation& allocation);
+
+    uint64_t GetSize() const;
+
+    uint64_t GetUsedSize() const;
+
+    uint32_t GetAllocationCount() const;
+
+    uint64_t GetLargestFreeSize() const;
+
+    bool IsEmpty() const;
+
+    // 0 when all free memory is one range, close to 1 when it is split into many small ones.
+    float GetFragmentation() const;
+
+private:
+    struct Node {
+        uint64_t offset{};
+
+        uint64_t size{};
+
+        uint32_t prevPhysical{ INVALID_NODE };
+
+        uint32_t nextPhysical{ INVALID_NODE };
+
+        uint32_t prevFree{ INVALID_NODE };
+
+        uint32_t nextFree{ INVALID_NODE };
+
+        bool free{};
+    };
+
+    static void MapSize(const uint64_t units, uint32_t& firstLevel, uint32_t& secondLevel);
+
+    uint32_t FindFreeNode(const uint64_t size) const;
+
+    void InsertFreeNode(const uint32_t node);
+
+    void RemoveFreeNode(const uint32_t node);
+
+    uint32_t CreateNode(const uint64_t offset, const uint64_t size);
+
+    void DestroyNode(const uint32_t node);
+
+    // Cuts `size` bytes off the front of the node into a new node placed before it.
+    uint32_t SplitFront(const uint32_t node, const uint64_t size);
+
+private:
+    static const inline uint64_t DEFAULT_GRANULARITY{ 256 };
+
+    static const inline uint32_t SECOND_LEVEL_LOG2{ 4 };
+
+    static const inline uint32_t SECOND_LEVEL_COUNT{ 1u << SECOND_LEVEL_LOG2 };
+
+    static const inline uint32_t FIRST_LEVEL_COUNT{ 32 };
+
+    static const inline uint32_t INVALID_NODE{ ~0u };
+
+private:
+    uint64_t m_size{};
+
+    uint64_t m_granularity{};
+
+    uint64_t m_usedSize{};
+
+    uint32_t m_allocationCount{};
+
+    std::vector<Node> m_nodes;
+
+    std::vector<uint32_t> m_unusedNodes;
+
+    uint32_t m_firstLevelBitmap{};
+
+    std::array<uint32_t, FIRST_LEVEL_COUNT> m_secondLevelBitmaps{};
+
+    std::array<uint32_t, FIRST_LEVEL_COUNT * SECOND_LEVEL_COUNT> m_freeHeads{};
+};
+} // namespace prev::core::memory
+
+#endif // !__TLSF_ALLOCATOR_H__
@@ -47,6 +47,11 @@ void Fence::Wait(uint64_t timeoutNs)
     GFXERRCHECK(gfxFenceWait(m_fence, timeoutNs));
 }
 
+bool Fence::TryWait(uint64_t timeoutNs)
+{
+    return gfxFenceWait(m_fence, timeoutNs) == GFX_RESULT_SUCCESS;
+}
+
 void Fence::Reset()
 {
     GFXERRCHECK(gfxFenceReset(m_fence));
@@ -18,6 +18,9 @@ public:
 public:
     void Wait(uint64_t timeoutNs = UINT64_MAX);
 
+    // Returns false when the fence did not signal within the timeout, 0 just polls it.
+    bool TryWait(uint64_t timeoutNs);
+
     void Reset();
 
     operator GfxFence() const;
@@ -0,0 +1,86 @@
+#include "EventQueue.h"
+
+#include <chrono>
+
+namespace prev::event {
+namespace {
+    std::atomic<uint64_t> nextSequence{};
+} // namespace
+
+void EventQueue::DispatchAll()
+{
+    std::scoped_lock lock{ m_dispatchMutex };
+
+    // a handler dispatching again gets its events delivered once it returns
+    if (m_dispatching) {
+        return;
+    }
+    m_dispatching = true;
+
+    {
+        std::scoped_lock queuesLock{ m_queuesMutex };
+        m_dispatchQueues.assign(m_queues.cbegin(), m_queues.cend());
+    }
+
+    for (auto queue : m_dispatchQueues) {
+        queue->Collect(m_dispatchEvents);
+    }
+    std::sort(m_dispatchEvents.begin(), m_dispatchEvents.end(), [](const auto& a, const auto& b) { return a.sequence < b.sequence; });
+
+    for (const auto& event : m_dispatchEvents) {
+        event.queue->Dispatch(event.index);
+    }
+
+    for (auto queue : m_dispatchQueues) {
+        queue->EndDispatch();
+    }
+    m_dispatchEvents.clear();
+    m_dispatchQueues.clear();
+
+    m_dispatching = false;
+}
+
+std::vector<EventQueueStatistics> EventQueue::GetStatistics() const
+{
+    std::scoped_lock lock{ m_dispatchMutex, m_queuesMutex };
+
+    std::vector<EventQueueStatistics> statistics;
+    for (const auto queue : m_queues) {
+        const auto queueStatistics{ queue->GetStatistics() };
+        if (queueStatistics.postedCount > 0) {
+            statistics.push_back(queueStatistics);
+        }
+    }
+    return statistics;
+}
+
+void EventQueue::ResetStatistics()
+{
+    std::scoped_lock lock{ m_dispatchMutex, m_queuesMutex };
+    for (auto queue : m_queues) {
+        queue->ResetStatistics();
+    }
+}
+
+uint64_t EventQueue::NextSequence()
+{
+    return nextSequence.fetch_add(1, std::memory_order_relaxed);
+}
+
+uint64_t EventQueue::GetTimestamp()
+{
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+void EventQueue::Register(IEventTypeQueue& queue)
+{
+    std::scoped_lock lock{ m_queuesMutex };
+    m_queues.push_back(&queue);
+}
+
+void EventQueue::Unregister(IEventTypeQueue& queue)
+{
+    std::scoped_lock lock{ m_queuesMutex };
+    m_queues.erase(std::remove(m_queues.begin(), m_queues.end(), &queue), m_queues.end());
+}
+} // namespace prev::event
@@ -0,0 +1,279 @@
+#ifndef __EVENT_QUEUE_H__
+#define __EVENT_QUEUE_H__
+
+#include "EventChannel.h"
+
+#include "../common/pattern/Singleton.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <typeinfo>
+#include <vector>
+
+namespace prev::event {
+struct EventQueueStatistics {
+    // as the compiler names the type
+    const char* typeName{};
+
+    uint64_t postedCount{};
+
+    // merged into an event posted earlier
+    uint64_t coalescedCount{};
+
+    uint64_t dispatchedCount{};
+
+    // from Post to the handlers, in milliseconds
+    double averageLatency{};
+
+    double maxLatency{};
+};
+
+struct QueuedEventReference;
+
+class IEventTypeQueue {
+public:
+    // Takes over the events posted so far.
+    virtual void Collect(std::vector<QueuedEventReference>& outEvents) = 0;
+
+    virtual void Dispatch(const size_t index) = 0;
+
+    virtual void EndDispatch() = 0;
+
+    virtual EventQueueStatistics GetStatistics() const = 0;
+
+    virtual void ResetStatistics() = 0;
+
+public:
+    virtual ~IEventTypeQueue() = default;
+};
+
+struct QueuedEventReference {
+    uint64_t sequence{};
+
+    IEventTypeQueue* queue{};
+
+    size_t index{};
+};
+
+// Deferred delivery in front of EventChannel. Post only pushes the event to the lock-free queue of its type and
+// returns, from any thread. DispatchAll, called by the engine at fixed points of the frame, hands the events to
+// the EventChannel handlers on the calling thread - in the order they were posted across all types. Events
+// posted by the handlers themselves wait for the next DispatchAll.
+class EventQueue final : public prev::common::pattern::Singleton<EventQueue> {
+private:
+    friend class prev::common::pattern::Singleton<EventQueue>;
+
+private:
+    EventQueue() = default;
+
+public:
+    ~EventQueue() = default;
+
+public:
+    template <typename EventType>
+    void Post(const EventType& event)
+    {
+        GetTypeQueue<EventType>().Push(event, NextSequence());
+    }
+
+    // An event posted while one of its type waits may be merged into the waiting one - merge returns true
+    // when it took the incoming event over. Meant for high frequency state events, where the latest wins.
+    template <typename EventType>
+    void SetCoalescing(const std::function<bool(EventType& queued, const EventType& incoming)>& merge)
+    {
+        std::scoped_lock lock{ m_dispatchMutex };
+        GetTypeQueue<EventType>().SetCoalescing(merge);
+    }
+
+    // Only the latest of the waiting events of the type is dispatched.
+    template <typename EventType>
+    void SetCoalescingToLatest()
+    {
+        SetCoalescing<EventType>([](EventType& queued, const EventType& incoming) {
+            queued = incoming;
+            return true;
+        });
+    }
+
+    template <typename EventType>
+    void ClearCoalescing()
+    {
+        SetCoalescing<EventType>(nullptr);
+    }
+
+    void DispatchAll();
+
+    // Of the types posted at least once, since the start or the last reset.
+    std::vector<EventQueueStatistics> GetStatistics() const;
+
+    void ResetStatistics();
+
+private:
+    template <typename EventType>
+    class TypeQueue final : public IEventTypeQueue {
+    public:
+        TypeQueue()
+        {
+            EventQueue::Instance().Register(*this);
+        }
+
+        ~TypeQueue()
+        {
+            EventQueue::Instance().Unregister(*this);
+
+            // events nobody dispatched anymore
+            for (auto node = m_head.load(std::memory_order_acquire); node;) {
+                const auto next{ node->next };
+                delete node;
+                node = next;
+            }
+        }
+
+    public:
+        // lock-free, the events are pushed in reversed order and turned around in Collect
+        void Push(const EventType& event, const uint64_t sequence)
+        {
+            auto node{ new Node{ event, sequence, GetTimestamp(), m_head.load(std::memory_order_relaxed) } };
+            while (!m_head.compare_exchange_weak(node->next, node, std::memory_order_release, std::memory_order_relaxed)) {
+            }
+            m_postedCount.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        void SetCoalescing(const std::function<bool(EventType&, const EventType&)>& merge)
+        {
+            m_merge = merge;
+        }
+
+        void Collect(std::vector<QueuedEventReference>& outEvents) override
+        {
+            for (auto node = m_head.exchange(nullptr, std::memory_order_acquire); node; node = node->next) {
+                m_batch.push_back(node);
+            }
+            std::reverse(m_batch.begin(), m_batch.end());
+
+            // an event merged into the queued one moves it to its own place in the order, the latency counts
+            // from the older one
+            size_t batchSize{};
+            for (size_t i = 0; i < m_batch.size(); ++i) {
+                auto node{ m_batch[i] };
+                if (batchSize > 0 && m_merge && m_merge(m_batch[batchSize - 1]->event, node->event)) {
+                    m_batch[batchSize - 1]->sequence = node->sequence;
+                    delete node;
+                    ++m_coalescedCount;
+                } else {
+                    m_batch[batchSize++] = node;
+                }
+            }
+            m_batch.resize(batchSize);
+
+            for (size_t i = 0; i < m_batch.size(); ++i) {
+                outEvents.push_back(QueuedEventReference{ m_batch[i]->sequence, this, i });
+            }
+        }
+
+        void Dispatch(const size_t index) override
+        {
+            const auto node{ m_batch[index] };
+            const double latency{ static_cast<double>(GetTimestamp() - node->postTime) / 1'000'000.0 };
+            EventChannel::Post(node->event);
+
+            m_totalLatency += latency;
+            m_maxLatency = std::max(m_maxLatency, latency);
+            ++m_dispatchedCount;
+        }
+
+        void EndDispatch() override
+        {
+            for (auto node : m_batch) {
+                delete node;
+            }
+            m_batch.clear();
+        }
+
+        EventQueueStatistics GetStatistics() const override
+        {
+            EventQueueStatistics statistics{};
+            statistics.typeName = typeid(EventType).name();
+            statistics.postedCount = m_postedCount.load(std::memory_order_relaxed);
+            statistics.coalescedCount = m_coalescedCount;
+            statistics.dispatchedCount = m_dispatchedCount;
+            statistics.averageLatency = m_dispatchedCount > 0 ? m_totalLatency / static_cast<double>(m_dispatchedCount) : 0.0;
+            statistics.maxLatency = m_maxLatency;
+            return statistics;
+        }
+
+        void ResetStatistics() override
+        {
+            m_postedCount.store(0, std::memory_order_relaxed);
+            m_coalescedCount = 0;
+            m_dispatchedCount = 0;
+            m_totalLatency = 0.0;
+            m_maxLatency = 0.0;
+        }
+
+    private:
+        struct Node {
+            EventType event;
+
+            uint64_t sequence{};
+
+            uint64_t postTime{};
+
+            Node* next{};
+        };
+
+    private:
+        std::atomic<Node*> m_head{};
+
+        // owned by the dispatching thread
+        std::vector<Node*> m_batch;
+
+        std::function<bool(EventType&, const EventType&)> m_merge;
+
+        std::atomic<uint64_t> m_postedCount{};
+
+        uint64_t m_coalescedCount{};
+
+        uint64_t m_dispatchedCount{};
+
+        double m_totalLatency{};
+
+        double m_maxLatency{};
+    };
+
+private:
+    template <typename EventType>
+    static TypeQueue<EventType>& GetTypeQueue()
+    {
+        static TypeQueue<EventType> queue;
+        return queue;
+    }
+
+    static uint64_t NextSequence();
+
+    static uint64_t GetTimestamp();
+
+    void Register(IEventTypeQueue& queue);
+
+    void Unregister(IEventTypeQueue& queue);
+
+private:
+    mutable std::mutex m_queuesMutex;
+
+    std::vector<IEventTypeQueue*> m_queues;
+
+    // statistics are read under it as well, handlers may change the coalescing
+    mutable std::recursive_mutex m_dispatchMutex;
+
+    bool m_dispatching{};
+
+    std::vector<IEventTypeQueue*> m_dispatchQueues;
+
+    std::vector<QueuedEventReference> m_dispatchEvents;
+};
+} // namespace prev::event
+
+#endif // !__EVENT_QUEUE_H__
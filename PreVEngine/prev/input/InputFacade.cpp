@@ -1,4 +1,5 @@
 #include "InputFacade.h"
+#include "InputSnapshotTracker.h"
 
 namespace prev::input {
 bool InputsFacade::RegisterKeyboardActionListener(keyboard::IKeyboardActionListener& listener)
@@ -130,4 +131,9 @@ void InputsFacade::SetMouseCursorVisible(bool visible)
 {
     m_mouseInputComponent.SetCursorVisible(visible);
 }
+
+const InputSnapshot& InputsFacade::GetSnapshot() const
+{
+    return InputSnapshotTracker::Instance().GetSnapshot();
+}
 } // namespace prev::input
\ No newline at end of file
@@ -1,6 +1,8 @@
 #ifndef __INPUTS_H__
 #define __INPUTS_H__
 
+#include "InputSnapshot.h"
+
 #include "keyboard/KeyboardInputComponnet.h"
 #include "mouse/MouseInputComponent.h"
 #include "touch/TouchInputComponent.h"
@@ -74,6 +76,9 @@ public:
 
     void SetMouseCursorVisible(bool visible);
 
+    // Input of the current frame as a whole, meant for polling in Update - see InputSnapshotTracker.
+    const InputSnapshot& GetSnapshot() const;
+
 private:
     keyboard::KeyboardInputComponnet m_keyboardInputComponent;
 
@@ -0,0 +1,85 @@
+#include "InputSnapshot.h"
+
+namespace prev::input {
+namespace {
+    size_t GetKeyIndex(const keyboard::KeyCode keyCode)
+    {
+        return static_cast<size_t>(keyCode) & 0xFF;
+    }
+
+    size_t GetButtonIndex(const mouse::MouseButtonType button)
+    {
+        return static_cast<size_t>(button) & 0x3;
+    }
+} // namespace
+
+bool InputSnapshot::IsKeyPressed(const keyboard::KeyCode keyCode) const
+{
+    return m_pressedKeys[GetKeyIndex(keyCode)];
+}
+
+bool InputSnapshot::WasKeyPressed(const keyboard::KeyCode keyCode) const
+{
+    return m_keysWentDown[GetKeyIndex(keyCode)];
+}
+
+bool InputSnapshot::WasKeyReleased(const keyboard::KeyCode keyCode) const
+{
+    return m_keysWentUp[GetKeyIndex(keyCode)];
+}
+
+bool InputSnapshot::IsButtonPressed(const mouse::MouseButtonType button) const
+{
+    return m_pressedButtons[GetButtonIndex(button)];
+}
+
+bool InputSnapshot::WasButtonPressed(const mouse::MouseButtonType button) const
+{
+    return m_buttonsWentDown[GetButtonIndex(button)];
+}
+
+bool InputSnapshot::WasButtonReleased(const mouse::MouseButtonType button) const
+{
+    return m_buttonsWentUp[GetButtonIndex(button)];
+}
+
+const glm::vec2& InputSnapshot::GetMousePosition() const
+{
+    return m_mousePosition;
+}
+
+const glm::vec2& InputSnapshot::GetMouseDelta() const
+{
+    return m_mouseDelta;
+}
+
+int32_t InputSnapshot::GetScrollDelta() const
+{
+    return m_scrollDelta;
+}
+
+bool InputSnapshot::IsMouseLocked() const
+{
+    return m_mouseLocked;
+}
+
+const TouchState* InputSnapshot::FindTouch(const uint8_t pointerId) const
+{
+    for (const auto& touch : m_touches) {
+        if (touch.pointerId == pointerId) {
+            return &touch;
+        }
+    }
+    return nullptr;
+}
+
+const prev::common::SmallVector<TouchState, 10>& InputSnapshot::GetTouches() const
+{
+    return m_touches;
+}
+
+uint64_t InputSnapshot::GetFrameIndex() const
+{
+    return m_frameIndex;
+}
+} // namespace prev::input
@@ -0,0 +1,88 @@
+#ifndef __INPUT_SNAPSHOT_H__
+#define __INPUT_SNAPSHOT_H__
+
+#include "keyboard/KeyCodes.h"
+#include "mouse/MouseEvents.h"
+
+#include "../common/SmallVector.h"
+
+#include <bitset>
+
+namespace prev::input {
+struct TouchState {
+    uint8_t pointerId{};
+
+    glm::vec2 position{};
+
+    // moved since the last snapshot
+    glm::vec2 delta{};
+};
+
+// State of the input at the end of a frame's event dispatch. The edges (Was*) tell what happened during the
+// frame, so a key pressed and released in between is not lost.
+class InputSnapshot final {
+public:
+    bool IsKeyPressed(const keyboard::KeyCode keyCode) const;
+
+    bool WasKeyPressed(const keyboard::KeyCode keyCode) const;
+
+    bool WasKeyReleased(const keyboard::KeyCode keyCode) const;
+
+    bool IsButtonPressed(const mouse::MouseButtonType button) const;
+
+    bool WasButtonPressed(const mouse::MouseButtonType button) const;
+
+    bool WasButtonReleased(const mouse::MouseButtonType button) const;
+
+    // the last one reported while the mouse was not locked
+    const glm::vec2& GetMousePosition() const;
+
+    // sum of the moves during the frame, locked or not
+    const glm::vec2& GetMouseDelta() const;
+
+    int32_t GetScrollDelta() const;
+
+    bool IsMouseLocked() const;
+
+    const TouchState* FindTouch(const uint8_t pointerId) const;
+
+    const prev::common::SmallVector<TouchState, 10>& GetTouches() const;
+
+    uint64_t GetFrameIndex() const;
+
+private:
+    friend class InputSnapshotTracker;
+
+private:
+    static const inline size_t KEY_COUNT{ 256 };
+
+    static const inline size_t BUTTON_COUNT{ 4 };
+
+private:
+    std::bitset<KEY_COUNT> m_pressedKeys;
+
+    std::bitset<KEY_COUNT> m_keysWentDown;
+
+    std::bitset<KEY_COUNT> m_keysWentUp;
+
+    std::bitset<BUTTON_COUNT> m_pressedButtons;
+
+    std::bitset<BUTTON_COUNT> m_buttonsWentDown;
+
+    std::bitset<BUTTON_COUNT> m_buttonsWentUp;
+
+    glm::vec2 m_mousePosition{ 0.0f, 0.0f };
+
+    glm::vec2 m_mouseDelta{ 0.0f, 0.0f };
+
+    int32_t m_scrollDelta{};
+
+    bool m_mouseLocked{};
+
+    prev::common::SmallVector<TouchState, 10> m_touches;
+
+    uint64_t m_frameIndex{};
+};
+} // namespace prev::input
+
+#endif // !__INPUT_SNAPSHOT_H__
@@ -0,0 +1,118 @@
+#include "InputSnapshotTracker.h"
+
+#include <algorithm>
+
+namespace prev::input {
+void InputSnapshotTracker::Publish()
+{
+    const uint32_t nextIndex{ 1 - m_currentIndex.load(std::memory_order_relaxed) };
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        m_pending.m_frameIndex = ++m_frameIndex;
+        m_snapshots[nextIndex] = m_pending;
+
+        m_pending.m_keysWentDown.reset();
+        m_pending.m_keysWentUp.reset();
+        m_pending.m_buttonsWentDown.reset();
+        m_pending.m_buttonsWentUp.reset();
+        m_pending.m_mouseDelta = glm::vec2(0.0f, 0.0f);
+        m_pending.m_scrollDelta = 0;
+        for (auto& touch : m_pending.m_touches) {
+            touch.delta = glm::vec2(0.0f, 0.0f);
+        }
+    }
+    m_currentIndex.store(nextIndex, std::memory_order_release);
+}
+
+const InputSnapshot& InputSnapshotTracker::GetSnapshot() const
+{
+    return m_snapshots[m_currentIndex.load(std::memory_order_acquire)];
+}
+
+void InputSnapshotTracker::operator()(const keyboard::KeyEvent& keyEvent)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    const auto keyIndex{ static_cast<size_t>(keyEvent.keyCode) & 0xFF };
+    if (keyEvent.action == keyboard::KeyActionType::PRESS) {
+        // repeated presses of a held key are no edge
+        if (!m_pending.m_pressedKeys[keyIndex]) {
+            m_pending.m_keysWentDown.set(keyIndex);
+        }
+        m_pending.m_pressedKeys.set(keyIndex);
+    } else if (keyEvent.action == keyboard::KeyActionType::RELEASE) {
+        m_pending.m_keysWentUp.set(keyIndex);
+        m_pending.m_pressedKeys.reset(keyIndex);
+    }
+}
+
+void InputSnapshotTracker::operator()(const mouse::MouseEvent& mouseEvent)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    const auto buttonIndex{ static_cast<size_t>(mouseEvent.button) & 0x3 };
+    if (mouseEvent.action == mouse::MouseActionType::PRESS) {
+        m_pending.m_buttonsWentDown.set(buttonIndex);
+        m_pending.m_pressedButtons.set(buttonIndex);
+    } else if (mouseEvent.action == mouse::MouseActionType::RELEASE) {
+        m_pending.m_buttonsWentUp.set(buttonIndex);
+        m_pending.m_pressedButtons.reset(buttonIndex);
+    }
+
+    if (m_pending.m_mouseLocked && m_hasFocus) {
+        if (mouseEvent.action == mouse::MouseActionType::MOVE) {
+            m_pending.m_mouseDelta += mouseEvent.position;
+        }
+    } else {
+        if (mouseEvent.action == mouse::MouseActionType::MOVE && m_hasMousePosition) {
+            m_pending.m_mouseDelta += mouseEvent.position - m_pending.m_mousePosition;
+        }
+        m_pending.m_mousePosition = mouseEvent.position;
+        m_hasMousePosition = true;
+    }
+}
+
+void InputSnapshotTracker::operator()(const mouse::MouseScrollEvent& scrollEvent)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    m_pending.m_scrollDelta += scrollEvent.delta;
+}
+
+void InputSnapshotTracker::operator()(const mouse::MouseLockRequest& lockRequest)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    m_pending.m_mouseLocked = lockRequest.lock;
+    // the cursor may be anywhere once it is released
+    m_hasMousePosition = false;
+}
+
+void InputSnapshotTracker::operator()(const touch::TouchEvent& touchEvent)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    auto& touches{ m_pending.m_touches };
+    auto touchIt{ std::find_if(touches.begin(), touches.end(), [&](const TouchState& touch) { return touch.pointerId == touchEvent.pointerId; }) };
+    if (touchEvent.action == touch::TouchActionType::UP) {
+        if (touchIt != touches.end()) {
+            std::move(touchIt + 1, touches.end(), touchIt);
+            touches.pop_back();
+        }
+    } else if (touchIt == touches.end()) {
+        touches.push_back(TouchState{ touchEvent.pointerId, touchEvent.position, glm::vec2(0.0f, 0.0f) });
+    } else {
+        touchIt->delta += touchEvent.position - touchIt->position;
+        touchIt->position = touchEvent.position;
+    }
+}
+
+void InputSnapshotTracker::operator()(const prev::window::WindowFocusChangeEvent& focusChangeEvent)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    m_hasFocus = focusChangeEvent.hasFocus;
+    m_hasMousePosition = false;
+}
+} // namespace prev::input
@@ -0,0 +1,84 @@
+#ifndef __INPUT_SNAPSHOT_TRACKER_H__
+#define __INPUT_SNAPSHOT_TRACKER_H__
+
+#include "InputSnapshot.h"
+
+#include "keyboard/KeyboardEvents.h"
+#include "mouse/MouseEvents.h"
+#include "touch/TouchEvents.h"
+
+#include "../common/pattern/Singleton.h"
+#include "../event/EventHandler.h"
+#include "../window/WindowEvents.h"
+
+#include <atomic>
+#include <mutex>
+
+namespace prev::input {
+// Folds the input events into a per-frame snapshot, so that the scene reads the input state once per frame
+// instead of reacting to each event. The snapshots are double-buffered: Publish fills the one nobody reads and
+// swaps, readers never lock.
+class InputSnapshotTracker final : public prev::common::pattern::Singleton<InputSnapshotTracker> {
+private:
+    friend class prev::common::pattern::Singleton<InputSnapshotTracker>;
+
+private:
+    InputSnapshotTracker() = default;
+
+public:
+    ~InputSnapshotTracker() = default;
+
+public:
+    // Makes the input dispatched since the last call the current snapshot, the engine calls it once a frame
+    // after the input events were dispatched.
+    void Publish();
+
+    // Stays valid and unchanged until the Publish after the next one.
+    const InputSnapshot& GetSnapshot() const;
+
+public:
+    void operator()(const keyboard::KeyEvent& keyEvent);
+
+    void operator()(const mouse::MouseEvent& mouseEvent);
+
+    void operator()(const mouse::MouseScrollEvent& scrollEvent);
+
+    void operator()(const mouse::MouseLockRequest& lockRequest);
+
+    void operator()(const touch::TouchEvent& touchEvent);
+
+    void operator()(const prev::window::WindowFocusChangeEvent& focusChangeEvent);
+
+private:
+    prev::event::EventHandler<InputSnapshotTracker, keyboard::KeyEvent> m_keyEventsHandler{ *this };
+
+    prev::event::EventHandler<InputSnapshotTracker, mouse::MouseEvent> m_mouseEventsHandler{ *this };
+
+    prev::event::EventHandler<InputSnapshotTracker, mouse::MouseScrollEvent> m_mouseScrollsHandler{ *this };
+
+    prev::event::EventHandler<InputSnapshotTracker, mouse::MouseLockRequest> m_mouseLockHandler{ *this };
+
+    prev::event::EventHandler<InputSnapshotTracker, touch::TouchEvent> m_touchEventsHandler{ *this };
+
+    prev::event::EventHandler<InputSnapshotTracker, prev::window::WindowFocusChangeEvent> m_focusChangeHandler{ *this };
+
+private:
+    mutable std::mutex m_mutex;
+
+    // collects the events until the next Publish
+    InputSnapshot m_pending;
+
+    // a locked mouse with focus reports moves relative to the last one
+    bool m_hasFocus{ true };
+
+    bool m_hasMousePosition{};
+
+    uint64_t m_frameIndex{};
+
+    InputSnapshot m_snapshots[2];
+
+    std::atomic<uint32_t> m_currentIndex{};
+};
+} // namespace prev::input
+
+#endif // !__INPUT_SNAPSHOT_TRACKER_H__
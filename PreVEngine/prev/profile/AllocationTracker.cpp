@@ -0,0 +1,383 @@
+#include "AllocationTracker.h"
+
+#include "../common/Logger.h"
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+
+namespace prev::profile {
+namespace {
+    constexpr uint32_t MAX_SCOPE_DEPTH{ 64 };
+
+    constexpr uint32_t MAX_SCOPE_COUNT{ 256 };
+
+    // plain data, so that it is constant initialized and usable from operator new of any thread at any time
+    struct ThreadAllocationState {
+        uint64_t allocationCount;
+
+        const char* scopes[MAX_SCOPE_DEPTH];
+
+        uint32_t depth;
+
+        // the tracker's own bookkeeping is not counted
+        bool suspended;
+    };
+
+    thread_local ThreadAllocationState threadState{};
+
+    struct ScopeSlot {
+        std::atomic<const char*> name{};
+
+        std::atomic<uint64_t> count{};
+
+        std::atomic<uint64_t> bytes{};
+    };
+
+    // constant initialized too, allocations made before and during static initialization land somewhere
+    std::array<ScopeSlot, MAX_SCOPE_COUNT> scopeSlots{};
+
+    std::atomic<uint64_t> freeCount{};
+
+    ScopeSlot& FindScopeSlot(const char* name)
+    {
+        // the first slot is the untagged one, the others are an open addressing table keyed by the name pointer
+        if (name == AllocationTracker::UNTAGGED_SCOPE_NAME) {
+            return scopeSlots[0];
+        }
+
+        const uint64_t hash{ (reinterpret_cast<uintptr_t>(name) >> 3) * 0x9E3779B97F4A7C15ull };
+        for (uint32_t probe = 0; probe < MAX_SCOPE_COUNT - 1; ++probe) {
+            auto& slot{ scopeSlots[1 + (hash + probe) % (MAX_SCOPE_COUNT - 1)] };
+            const char* slotName{ slot.name.load(std::memory_order_acquire) };
+            if (slotName == name) {
+                return slot;
+            }
+            if (!slotName && (slot.name.compare_exchange_strong(slotName, name, std::memory_order_acq_rel) || slotName == name)) {
+                return slot;
+            }
+        }
+        return scopeSlots[0];
+    }
+
+    class TrackingSuspension final {
+    public:
+        TrackingSuspension()
+            : m_wasSuspended{ threadState.suspended }
+        {
+            threadState.suspended = true;
+        }
+
+        ~TrackingSuspension()
+        {
+            threadState.suspended = m_wasSuspended;
+        }
+
+    private:
+        bool m_wasSuspended{};
+    };
+} // namespace
+
+bool AllocationTracker::IsAvailable()
+{
+#ifdef ENABLE_ALLOCATION_TRACKING
+    return true;
+#else
+    return false;
+#endif
+}
+
+void AllocationTracker::RecordAllocation(const size_t size)
+{
+    auto& state{ threadState };
+    if (state.suspended) {
+        return;
+    }
+
+    ++state.allocationCount;
+
+    // scopes deeper than tracked are attributed to the deepest tracked one
+    const char* scope{ state.depth > 0 ? state.scopes[std::min(state.depth, MAX_SCOPE_DEPTH) - 1] : UNTAGGED_SCOPE_NAME };
+    auto& slot{ FindScopeSlot(scope) };
+    slot.count.fetch_add(1, std::memory_order_relaxed);
+    slot.bytes.fetch_add(size, std::memory_order_relaxed);
+}
+
+void AllocationTracker::RecordFree()
+{
+    if (threadState.suspended) {
+        return;
+    }
+    freeCount.fetch_add(1, std::memory_order_relaxed);
+}
+
+uint64_t AllocationTracker::GetThreadAllocationCount()
+{
+    return threadState.allocationCount;
+}
+
+void AllocationTracker::EndFrame()
+{
+    const TrackingSuspension suspension{};
+
+    AllocationFrame frame{};
+    for (uint32_t i = 0; i < MAX_SCOPE_COUNT; ++i) {
+        auto& slot{ scopeSlots[i] };
+        const char* name{ i == 0 ? UNTAGGED_SCOPE_NAME : slot.name.load(std::memory_order_acquire) };
+        if (!name) {
+            continue;
+        }
+
+        const uint64_t count{ slot.count.exchange(0, std::memory_order_relaxed) };
+        const uint64_t bytes{ slot.bytes.exchange(0, std::memory_order_relaxed) };
+        if (count == 0) {
+            continue;
+        }
+
+        frame.count += count;
+        frame.bytes += bytes;
+
+        // the same name may be a different literal in each translation unit
+        auto statistics{ std::find_if(frame.scopes.begin(), frame.scopes.end(), [&](const auto& item) { return std::strcmp(item.name, name) == 0; }) };
+        if (statistics == frame.scopes.end()) {
+            frame.scopes.push_back(AllocationScopeStatistics{ name });
+            statistics = frame.scopes.end() - 1;
+        }
+        statistics->count += count;
+        statistics->bytes += bytes;
+    }
+    frame.freeCount = freeCount.exchange(0, std::memory_order_relaxed);
+
+    std::sort(frame.scopes.begin(), frame.scopes.end(), [](const auto& a, const auto& b) { return a.bytes > b.bytes; });
+
+    std::scoped_lock lock{ m_mutex };
+    frame.index = m_frameIndex++;
+    frame.overBudget = frame.count > m_frameBudget;
+    if (frame.overBudget) {
+        LOGW("Frame %llu made %llu allocations (%llu bytes) over the budget of %llu, the most in %s", static_cast<unsigned long long>(frame.index), static_cast<unsigned long long>(frame.count), static_cast<unsigned long long>(frame.bytes), static_cast<unsigned long long>(m_frameBudget), frame.scopes.front().name);
+        assert(!m_assertOverBudget && "Frame allocation budget exceeded");
+    }
+    m_lastFrame = std::move(frame);
+}
+
+AllocationFrame AllocationTracker::GetLastFrame() const
+{
+    const TrackingSuspension suspension{};
+
+    std::scoped_lock lock{ m_mutex };
+    return m_lastFrame;
+}
+
+void AllocationTracker::SetFrameBudget(const uint64_t maxAllocationCount, const bool assertOverBudget)
+{
+    std::scoped_lock lock{ m_mutex };
+    m_frameBudget = maxAllocationCount;
+    m_assertOverBudget = assertOverBudget;
+}
+
+void AllocationTracker::ClearFrameBudget()
+{
+    std::scoped_lock lock{ m_mutex };
+    m_frameBudget = NO_BUDGET;
+    m_assertOverBudget = false;
+}
+
+void AllocationTracker::PushScope(const char* name)
+{
+    auto& state{ threadState };
+    if (state.depth < MAX_SCOPE_DEPTH) {
+        state.scopes[state.depth] = name;
+    }
+    ++state.depth;
+}
+
+void AllocationTracker::PopScope()
+{
+    auto& state{ threadState };
+    assert(state.depth > 0);
+    --state.depth;
+}
+
+AllocationScope::AllocationScope(const char* name)
+{
+    AllocationTracker::PushScope(name);
+}
+
+AllocationScope::~AllocationScope()
+{
+    AllocationTracker::PopScope();
+}
+
+AllocationCounter::AllocationCounter()
+    : m_startCount{ AllocationTracker::GetThreadAllocationCount() }
+{
+}
+
+uint64_t AllocationCounter::GetCount() const
+{
+    return AllocationTracker::GetThreadAllocationCount() - m_startCount;
+}
+} // namespace prev::profile
+
+#ifdef ENABLE_ALLOCATION_TRACKING
+
+// Replacements of the global allocation functions, linked in with this translation unit.
+namespace {
+void* AllocateTracked(const std::size_t size) noexcept
+{
+    prev::profile::AllocationTracker::RecordAllocation(size);
+    return std::malloc(size > 0 ? size : 1);
+}
+
+void* AllocateTrackedAligned(const std::size_t size, const std::align_val_t alignment) noexcept
+{
+    prev::profile::AllocationTracker::RecordAllocation(size);
+    const auto alignmentValue{ std::max(static_cast<std::size_t>(alignment), sizeof(void*)) };
+    const auto alignedSize{ (std::max<std::size_t>(size, 1) + alignmentValue - 1) / alignmentValue * alignmentValue };
+#if defined(_MSC_VER)
+    return _aligned_malloc(alignedSize, alignmentValue);
+#else
+    void* memory{};
+    return posix_memalign(&memory, alignmentValue, alignedSize) == 0 ? memory : nullptr;
+#endif
+}
+
+void FreeTracked(void* memory) noexcept
+{
+    if (!memory) {
+        return;
+    }
+    prev::profile::AllocationTracker::RecordFree();
+    std::free(memory);
+}
+
+void FreeTrackedAligned(void* memory) noexcept
+{
+    if (!memory) {
+        return;
+    }
+    prev::profile::AllocationTracker::RecordFree();
+#if defined(_MSC_VER)
+    _aligned_free(memory);
+#else
+    std::free(memory);
+#endif
+}
+} // namespace
+
+void* operator new(std::size_t size)
+{
+    if (void* memory = AllocateTracked(size)) {
+        return memory;
+    }
+    throw std::bad_alloc{};
+}
+
+void* operator new[](std::size_t size)
+{
+    if (void* memory = AllocateTracked(size)) {
+        return memory;
+    }
+    throw std::bad_alloc{};
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept
+{
+    return AllocateTracked(size);
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept
+{
+    return AllocateTracked(size);
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment)
+{
+    if (void* memory = AllocateTrackedAligned(size, alignment)) {
+        return memory;
+    }
+    throw std::bad_alloc{};
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment)
+{
+    if (void* memory = AllocateTrackedAligned(size, alignment)) {
+        return memory;
+    }
+    throw std::bad_alloc{};
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept
+{
+    return AllocateTrackedAligned(size, alignment);
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept
+{
+    return AllocateTrackedAligned(size, alignment);
+}
+
+void operator delete(void* memory) noexcept
+{
+    FreeTracked(memory);
+}
+
+void operator delete[](void* memory) noexcept
+{
+    FreeTracked(memory);
+}
+
+void operator delete(void* memory, std::size_t) noexcept
+{
+    FreeTracked(memory);
+}
+
+void operator delete[](void* memory, std::size_t) noexcept
+{
+    FreeTracked(memory);
+}
+
+void operator delete(void* memory, const std::nothrow_t&) noexcept
+{
+    FreeTracked(memory);
+}
+
+void operator delete[](void* memory, const std::nothrow_t&) noexcept
+{
+    FreeTracked(memory);
+}
+
+void operator delete(void* memory, std::align_val_t) noexcept
+{
+    FreeTrackedAligned(memory);
+}
+
+void operator delete[](void* memory, std::align_val_t) noexcept
+{
+    FreeTrackedAligned(memory);
+}
+
+void operator delete(void* memory, std::size_t, std::align_val_t) noexcept
+{
+    FreeTrackedAligned(memory);
+}
+
+void operator delete[](void* memory, std::size_t, std::align_val_t) noexcept
+{
+    FreeTrackedAligned(memory);
+}
+
+void operator delete(void* memory, std::align_val_t, const std::nothrow_t&) noexcept
+{
+    FreeTrackedAligned(memory);
+}
+
+void operator delete[](void* memory, std::align_val_t, const std::nothrow_t&) noexcept
+{
+    FreeTrackedAligned(memory);
+}
+
+#endif
@@ -0,0 +1,123 @@
+#ifndef __ALLOCATION_TRACKER_H__
+#define __ALLOCATION_TRACKER_H__
+
+#include "../common/pattern/Singleton.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+namespace prev::profile {
+struct AllocationScopeStatistics {
+    // not copied, string literals only
+    const char* name{};
+
+    uint64_t count{};
+
+    uint64_t bytes{};
+};
+
+struct AllocationFrame {
+    uint64_t index{};
+
+    uint64_t count{};
+
+    uint64_t bytes{};
+
+    uint64_t freeCount{};
+
+    // the most allocating first, allocations outside of any scope fall to UNTAGGED_SCOPE_NAME
+    std::vector<AllocationScopeStatistics> scopes;
+
+    bool overBudget{};
+};
+
+// Counts heap allocations of all threads per frame and per scope. Built with ENABLE_ALLOCATION_TRACKING the
+// global operator new/delete feed it, allocators that do not go through them may call RecordAllocation
+// themselves. An allocation is attributed to the innermost AllocationScope of its thread - PREV_PROFILE_SCOPE
+// opens one (Profile.h), so the profiler zones double as allocation tags.
+class AllocationTracker final : public prev::common::pattern::Singleton<AllocationTracker> {
+private:
+    friend class prev::common::pattern::Singleton<AllocationTracker>;
+
+private:
+    AllocationTracker() = default;
+
+public:
+    ~AllocationTracker() = default;
+
+public:
+    // Whether the operator new/delete hooks are built in, otherwise only RecordAllocation calls are counted.
+    static bool IsAvailable();
+
+    // Called from any thread, must not allocate.
+    static void RecordAllocation(const size_t size);
+
+    static void RecordFree();
+
+    // Of the calling thread since it started.
+    static uint64_t GetThreadAllocationCount();
+
+    void EndFrame();
+
+    AllocationFrame GetLastFrame() const;
+
+    // Frames allocating more than maxAllocationCount times are reported, with assertOverBudget they assert
+    // - a budget of zero checks a steady state render loop allocates nothing.
+    void SetFrameBudget(const uint64_t maxAllocationCount, const bool assertOverBudget = false);
+
+    void ClearFrameBudget();
+
+public:
+    static inline const char* const UNTAGGED_SCOPE_NAME{ "Untagged" };
+
+private:
+    friend class AllocationScope;
+
+    static void PushScope(const char* name);
+
+    static void PopScope();
+
+private:
+    static const inline uint64_t NO_BUDGET{ ~0ull };
+
+private:
+    mutable std::mutex m_mutex;
+
+    uint64_t m_frameIndex{};
+
+    AllocationFrame m_lastFrame{};
+
+    uint64_t m_frameBudget{ NO_BUDGET };
+
+    bool m_assertOverBudget{};
+};
+
+class AllocationScope final {
+public:
+    explicit AllocationScope(const char* name);
+
+    ~AllocationScope();
+
+    AllocationScope(const AllocationScope&) = delete;
+    AllocationScope& operator=(const AllocationScope&) = delete;
+};
+
+// Counts allocations of the calling thread while alive, tests use it to check a code path does not allocate.
+class AllocationCounter final {
+public:
+    AllocationCounter();
+
+    ~AllocationCounter() = default;
+
+public:
+    uint64_t GetCount() const;
+
+private:
+    uint64_t m_startCount{};
+};
+} // namespace prev::profile
+
+#endif // !__ALLOCATION_TRACKER_H__
@@ -0,0 +1,156 @@
+#include "FrameStatistics.h"
+
+#include "../common/Logger.h"
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+
+namespace prev::profile {
+namespace {
+    float GetPercentile(const std::vector<float>& sortedValues, const float percentile)
+    {
+        // nearest rank
+        const auto rank{ static_cast<size_t>(std::ceil(percentile * static_cast<float>(sortedValues.size()))) };
+        return sortedValues[std::clamp<size_t>(rank, 1, sortedValues.size()) - 1];
+    }
+
+    void AppendPercentiles(std::ofstream& file, const FrameTimePercentiles& percentiles)
+    {
+        // milliseconds
+        file << "," << percentiles.p50 * 1000.0f << "," << percentiles.p90 * 1000.0f << "," << percentiles.p99 * 1000.0f << "," << percentiles.max * 1000.0f;
+    }
+} // namespace
+
+FrameStatistics::FrameStatistics(const uint32_t capacity, const float frameBudget)
+    : m_slots(std::max(capacity, 1u) + 1) // the one the writer is at is never read
+    , m_frameBudget{ frameBudget }
+{
+}
+
+void FrameStatistics::Record(const FrameSample& sample)
+{
+    const uint64_t index{ m_writeCount.load(std::memory_order_relaxed) };
+    auto& slot{ m_slots[index % m_slots.size()] };
+    slot.cpuTime.store(sample.cpuTime, std::memory_order_relaxed);
+    slot.gpuTime.store(sample.gpuTime, std::memory_order_relaxed);
+    slot.presentInterval.store(sample.presentInterval, std::memory_order_relaxed);
+    m_writeCount.store(index + 1, std::memory_order_release);
+}
+
+FrameStatisticsReport FrameStatistics::ComputeReport(const uint32_t frameCount) const
+{
+    const auto samples{ GetSamples(frameCount) };
+
+    std::vector<float> cpuTimes;
+    std::vector<float> gpuTimes;
+    std::vector<float> presentIntervals;
+    cpuTimes.reserve(samples.size());
+    gpuTimes.reserve(samples.size());
+    presentIntervals.reserve(samples.size());
+
+    FrameStatisticsReport report{};
+    report.frameCount = static_cast<uint32_t>(samples.size());
+    report.frameBudget = GetFrameBudget();
+    for (const auto& sample : samples) {
+        if (sample.cpuTime >= 0.0f) {
+            cpuTimes.push_back(sample.cpuTime);
+        }
+        if (sample.gpuTime >= 0.0f) {
+            gpuTimes.push_back(sample.gpuTime);
+        }
+        if (sample.presentInterval >= 0.0f) {
+            presentIntervals.push_back(sample.presentInterval);
+            if (sample.presentInterval > report.frameBudget) {
+                ++report.overBudgetCount;
+            }
+        }
+    }
+
+    report.cpuTime = ComputePercentiles(cpuTimes);
+    report.gpuTime = ComputePercentiles(gpuTimes);
+    report.presentInterval = ComputePercentiles(presentIntervals);
+    return report;
+}
+
+std::vector<FrameSample> FrameStatistics::GetSamples(const uint32_t frameCount) const
+{
+    const uint64_t capacity{ m_slots.size() };
+    const uint64_t writeCount{ m_writeCount.load(std::memory_order_acquire) };
+    const uint64_t count{ std::min<uint64_t>({ writeCount, capacity - 1, frameCount }) };
+    const uint64_t first{ writeCount - count };
+
+    std::vector<FrameSample> samples;
+    samples.reserve(count);
+    for (uint64_t index = first; index < writeCount; ++index) {
+        const auto& slot{ m_slots[index % capacity] };
+        samples.push_back(FrameSample{ slot.cpuTime.load(std::memory_order_relaxed), slot.gpuTime.load(std::memory_order_relaxed), slot.presentInterval.load(std::memory_order_relaxed) });
+    }
+
+    // the writer may have moved on meanwhile, its current slot included - drop what it may have overwritten
+    std::atomic_thread_fence(std::memory_order_acquire);
+    const uint64_t newWriteCount{ m_writeCount.load(std::memory_order_relaxed) };
+    if (newWriteCount + 1 > first + capacity) {
+        const uint64_t overwrittenCount{ std::min<uint64_t>(newWriteCount + 1 - capacity - first, count) };
+        samples.erase(samples.begin(), samples.begin() + overwrittenCount);
+    }
+    return samples;
+}
+
+void FrameStatistics::SetFrameBudget(const float frameBudget)
+{
+    m_frameBudget.store(frameBudget, std::memory_order_relaxed);
+}
+
+float FrameStatistics::GetFrameBudget() const
+{
+    return m_frameBudget.load(std::memory_order_relaxed);
+}
+
+uint64_t FrameStatistics::GetRecordedCount() const
+{
+    return m_writeCount.load(std::memory_order_acquire);
+}
+
+FrameTimePercentiles FrameStatistics::ComputePercentiles(std::vector<float>& values)
+{
+    if (values.empty()) {
+        return {};
+    }
+
+    std::sort(values.begin(), values.end());
+
+    FrameTimePercentiles percentiles{};
+    percentiles.p50 = GetPercentile(values, 0.5f);
+    percentiles.p90 = GetPercentile(values, 0.9f);
+    percentiles.p99 = GetPercentile(values, 0.99f);
+    percentiles.max = values.back();
+    percentiles.count = static_cast<uint32_t>(values.size());
+    return percentiles;
+}
+
+bool FrameStatistics::AppendCsv(const std::string& path, const FrameStatisticsReport& report)
+{
+    const bool exists{ std::ifstream{ path }.good() };
+
+    std::ofstream file{ path, std::ios::out | std::ios::app };
+    if (!file.is_open()) {
+        LOGE("Could not open frame statistics file: %s", path.c_str());
+        return false;
+    }
+
+    if (!exists) {
+        file << "frames,overBudget,budgetMs,"
+             << "cpuP50Ms,cpuP90Ms,cpuP99Ms,cpuMaxMs,"
+             << "gpuP50Ms,gpuP90Ms,gpuP99Ms,gpuMaxMs,"
+             << "presentP50Ms,presentP90Ms,presentP99Ms,presentMaxMs\n";
+    }
+
+    file << report.frameCount << "," << report.overBudgetCount << "," << report.frameBudget * 1000.0f;
+    AppendPercentiles(file, report.cpuTime);
+    AppendPercentiles(file, report.gpuTime);
+    AppendPercentiles(file, report.presentInterval);
+    file << "\n";
+    return file.good();
+}
+} // namespace prev::profile
@@ -0,0 +1,101 @@
+#ifndef __FRAME_STATISTICS_H__
+#define __FRAME_STATISTICS_H__
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace prev::profile {
+// Seconds, negative when not measured (e.g. GPU time without timestamp queries).
+struct FrameSample {
+    float cpuTime{ -1.0f };
+
+    float gpuTime{ -1.0f };
+
+    float presentInterval{ -1.0f };
+};
+
+struct FrameTimePercentiles {
+    float p50{};
+
+    float p90{};
+
+    float p99{};
+
+    float max{};
+
+    // samples the percentiles were computed from
+    uint32_t count{};
+};
+
+struct FrameStatisticsReport {
+    FrameTimePercentiles cpuTime{};
+
+    FrameTimePercentiles gpuTime{};
+
+    FrameTimePercentiles presentInterval{};
+
+    // frames whose present interval was over the budget
+    uint32_t overBudgetCount{};
+
+    uint32_t frameCount{};
+
+    float frameBudget{};
+};
+
+// The last frames' timings in a ring, written by the frame loop and read from any thread without locks. A report
+// shows percentiles instead of an average, so that single hitches stay visible.
+class FrameStatistics final {
+public:
+    explicit FrameStatistics(const uint32_t capacity = DEFAULT_CAPACITY, const float frameBudget = DEFAULT_FRAME_BUDGET);
+
+    ~FrameStatistics() = default;
+
+    FrameStatistics(const FrameStatistics&) = delete;
+    FrameStatistics& operator=(const FrameStatistics&) = delete;
+
+public:
+    // Single writer.
+    void Record(const FrameSample& sample);
+
+    // Of the last frameCount frames, all recorded ones by default.
+    FrameStatisticsReport ComputeReport(const uint32_t frameCount = ~0u) const;
+
+    std::vector<FrameSample> GetSamples(const uint32_t frameCount = ~0u) const;
+
+    void SetFrameBudget(const float frameBudget);
+
+    float GetFrameBudget() const;
+
+    uint64_t GetRecordedCount() const;
+
+    static FrameTimePercentiles ComputePercentiles(std::vector<float>& values);
+
+    // Appends a row per report, the header goes into a new file only.
+    static bool AppendCsv(const std::string& path, const FrameStatisticsReport& report);
+
+private:
+    struct Slot {
+        std::atomic<float> cpuTime{};
+
+        std::atomic<float> gpuTime{};
+
+        std::atomic<float> presentInterval{};
+    };
+
+private:
+    static const inline uint32_t DEFAULT_CAPACITY{ 4096 };
+
+    static const inline float DEFAULT_FRAME_BUDGET{ 1.0f / 60.0f };
+
+private:
+    std::vector<Slot> m_slots;
+
+    std::atomic<uint64_t> m_writeCount{};
+
+    std::atomic<float> m_frameBudget{};
+};
+} // namespace prev::profile
+
+#endif // !__FRAME_STATISTICS_H__
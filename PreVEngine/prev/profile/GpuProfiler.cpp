@@ -0,0 +1,130 @@
+#include "GpuProfiler.h"
+
+#include "../common/Logger.h"
+#include "../render/query/QueryPoolBuilder.h"
+
+#include <algorithm>
+#include <cassert>
+#include <limits>
+
+namespace prev::profile {
+namespace {
+    constexpr size_t SKIPPED_ZONE{ std::numeric_limits<size_t>::max() };
+} // namespace
+
+GpuProfiler::GpuProfiler(prev::core::device::Device& device, const uint32_t frameCount, const uint32_t maxZoneCount)
+{
+    // one more slot than frames in flight, so that the read back slot is never the one being written
+    m_queryPool = prev::render::query::QueryPoolBuilder{ device }
+                      .SetQueryType(GFX_QUERY_TYPE_TIMESTAMP)
+                      .SetPoolCount(frameCount + 1)
+                      .SetQueryCount(maxZoneCount * 2)
+                      .Build();
+    m_slots.resize(m_queryPool->GetPoolCount());
+}
+
+void GpuProfiler::BeginFrame(GfxCommandEncoder commandEncoder)
+{
+    m_queryPool->Reset(commandEncoder);
+
+    CollectResults();
+    m_queryPool->StartAsyncMapRead();
+
+    m_zones.clear();
+    m_openZones.clear();
+    m_nextQuery = 0;
+}
+
+void GpuProfiler::BeginZone(GfxCommandEncoder commandEncoder, const char* name)
+{
+    if (m_nextQuery + 2 > m_queryPool->GetQueryCount()) {
+        if (!m_overflowReported) {
+            LOGW("GPU profiler ran out of queries, zones over %u per frame are skipped", m_queryPool->GetQueryCount() / 2);
+            m_overflowReported = true;
+        }
+        m_openZones.push_back(SKIPPED_ZONE);
+        return;
+    }
+
+    m_queryPool->WriteTimestamp(commandEncoder, m_nextQuery);
+    m_zones.push_back(Zone{ name, static_cast<uint32_t>(m_openZones.size()), m_nextQuery, m_nextQuery });
+    m_openZones.push_back(m_zones.size() - 1);
+    ++m_nextQuery;
+}
+
+void GpuProfiler::EndZone(GfxCommandEncoder commandEncoder)
+{
+    assert(!m_openZones.empty());
+    const size_t zoneIndex{ m_openZones.back() };
+    m_openZones.pop_back();
+    if (zoneIndex == SKIPPED_ZONE) {
+        return;
+    }
+
+    m_queryPool->WriteTimestamp(commandEncoder, m_nextQuery);
+    m_zones[zoneIndex].endQuery = m_nextQuery;
+    ++m_nextQuery;
+}
+
+void GpuProfiler::EndFrame(GfxCommandEncoder commandEncoder)
+{
+    assert(m_openZones.empty());
+
+    auto& slot{ m_slots[m_queryPool->GetWriteSlot()] };
+    slot.zones = m_zones;
+    slot.recordTime = Profiler::Now();
+
+    m_queryPool->Resolve(commandEncoder);
+}
+
+void GpuProfiler::CollectResults()
+{
+    if (!m_queryPool->IsAsyncResultReady()) {
+        return;
+    }
+
+    const int32_t slotIndex{ m_queryPool->GetAsyncReadSlot() };
+    if (slotIndex < 0 || !m_queryPool->GetAsyncQueryResults(m_results)) {
+        return;
+    }
+
+    const auto& slot{ m_slots[slotIndex] };
+    if (slot.zones.empty()) {
+        return;
+    }
+
+    uint64_t firstTimestamp{ std::numeric_limits<uint64_t>::max() };
+    for (const auto& zone : slot.zones) {
+        firstTimestamp = std::min(firstTimestamp, m_results[zone.beginQuery]);
+    }
+
+    std::vector<ProfileZone> zones;
+    zones.reserve(slot.zones.size());
+    for (const auto& zone : slot.zones) {
+        const uint64_t beginTimestamp{ m_results[zone.beginQuery] };
+        const uint64_t endTimestamp{ m_results[zone.endQuery] };
+        if (endTimestamp < beginTimestamp) {
+            continue; // not written, or the counter wrapped
+        }
+
+        // gfx resolves timestamp queries in nanoseconds, as WebGPU defines them, so there is no tick period
+        // to scale by here - the engine's GPU frame time reads them the same way
+        const auto startTime{ slot.recordTime + (beginTimestamp - firstTimestamp) };
+        const auto endTime{ slot.recordTime + (endTimestamp - firstTimestamp) };
+        zones.push_back(ProfileZone{ zone.name, startTime, endTime, 0, zone.depth });
+    }
+    Profiler::Instance().AddGpuZones(zones);
+}
+
+GpuProfileScope::GpuProfileScope(GpuProfiler& profiler, GfxCommandEncoder commandEncoder, const char* name)
+    : m_profiler{ profiler }
+    , m_commandEncoder{ commandEncoder }
+{
+    m_profiler.BeginZone(m_commandEncoder, name);
+}
+
+GpuProfileScope::~GpuProfileScope()
+{
+    m_profiler.EndZone(m_commandEncoder);
+}
+} // namespace prev::profile
@@ -0,0 +1,91 @@
+#ifndef __GPU_PROFILER_H__
+#define __GPU_PROFILER_H__
+
+#include "Profiler.h"
+
+#include "../core/device/Device.h"
+#include "../render/query/QueryPool.h"
+
+#include <memory>
+#include <vector>
+
+namespace prev::profile {
+// GPU zones from timestamps written into the command encoder, so only outside of render and compute passes.
+// Results are read back asynchronously a few frames later and handed over to the Profiler. GPU time is placed
+// on the CPU timeline at the moment the frame was recorded - good for durations, not for exact CPU/GPU order.
+class GpuProfiler final {
+public:
+    GpuProfiler(prev::core::device::Device& device, const uint32_t frameCount, const uint32_t maxZoneCount = DEFAULT_MAX_ZONE_COUNT);
+
+    ~GpuProfiler() = default;
+
+    GpuProfiler(const GpuProfiler&) = delete;
+    GpuProfiler& operator=(const GpuProfiler&) = delete;
+
+public:
+    // Collects a finished frame, if any, and resets the queries of this one.
+    void BeginFrame(GfxCommandEncoder commandEncoder);
+
+    void BeginZone(GfxCommandEncoder commandEncoder, const char* name);
+
+    void EndZone(GfxCommandEncoder commandEncoder);
+
+    void EndFrame(GfxCommandEncoder commandEncoder);
+
+private:
+    struct Zone {
+        const char* name{};
+
+        uint32_t depth{};
+
+        uint32_t beginQuery{};
+
+        uint32_t endQuery{};
+    };
+
+    struct SlotData {
+        std::vector<Zone> zones;
+
+        uint64_t recordTime{};
+    };
+
+private:
+    void CollectResults();
+
+private:
+    static const inline uint32_t DEFAULT_MAX_ZONE_COUNT{ 64 };
+
+private:
+    std::unique_ptr<prev::render::query::QueryPool> m_queryPool;
+
+    // by query pool slot
+    std::vector<SlotData> m_slots;
+
+    std::vector<Zone> m_zones;
+
+    std::vector<size_t> m_openZones;
+
+    uint32_t m_nextQuery{};
+
+    bool m_overflowReported{};
+
+    std::vector<uint64_t> m_results;
+};
+
+class GpuProfileScope final {
+public:
+    GpuProfileScope(GpuProfiler& profiler, GfxCommandEncoder commandEncoder, const char* name);
+
+    ~GpuProfileScope();
+
+    GpuProfileScope(const GpuProfileScope&) = delete;
+    GpuProfileScope& operator=(const GpuProfileScope&) = delete;
+
+private:
+    GpuProfiler& m_profiler;
+
+    GfxCommandEncoder m_commandEncoder;
+};
+} // namespace prev::profile
+
+#endif // !__GPU_PROFILER_H__
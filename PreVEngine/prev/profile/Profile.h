@@ -0,0 +1,55 @@
+#ifndef __PROFILE_H__
+#define __PROFILE_H__
+
+// Instrumentation macros, they expand to nothing unless built with ENABLE_PROFILING or ENABLE_ALLOCATION_TRACKING.
+//
+// PREV_PROFILE_SCOPE("name")                    - CPU zone and allocation scope until the end of the enclosing scope
+// PREV_PROFILE_FUNCTION()                       - CPU zone and allocation scope named after the enclosing function
+// PREV_PROFILE_GPU_SCOPE(gpuProfiler, enc, "n") - GPU zone, outside of render and compute passes only
+// PREV_PROFILE_FRAME()                          - closes the frame, once per frame
+//
+// Zone names are not copied, pass string literals.
+
+#define PREV_PROFILE_CONCAT_INNER(a, b) a##b
+#define PREV_PROFILE_CONCAT(a, b) PREV_PROFILE_CONCAT_INNER(a, b)
+
+#ifdef ENABLE_PROFILING
+
+#include "GpuProfiler.h"
+#include "Profiler.h"
+
+#define PREV_PROFILE_CPU_SCOPE(name) const prev::profile::ProfileScope PREV_PROFILE_CONCAT(profileScope, __LINE__){ name }
+#define PREV_PROFILE_GPU_SCOPE(gpuProfiler, commandEncoder, name) const prev::profile::GpuProfileScope PREV_PROFILE_CONCAT(gpuProfileScope, __LINE__){ gpuProfiler, commandEncoder, name }
+#define PREV_PROFILE_CPU_FRAME() prev::profile::Profiler::Instance().EndFrame()
+
+#else
+
+#define PREV_PROFILE_CPU_SCOPE(name)
+#define PREV_PROFILE_GPU_SCOPE(gpuProfiler, commandEncoder, name)
+#define PREV_PROFILE_CPU_FRAME()
+
+#endif
+
+#ifdef ENABLE_ALLOCATION_TRACKING
+
+#include "AllocationTracker.h"
+
+#define PREV_ALLOCATION_SCOPE(name) const prev::profile::AllocationScope PREV_PROFILE_CONCAT(allocationScope, __LINE__){ name }
+#define PREV_ALLOCATION_FRAME() prev::profile::AllocationTracker::Instance().EndFrame()
+
+#else
+
+#define PREV_ALLOCATION_SCOPE(name)
+#define PREV_ALLOCATION_FRAME()
+
+#endif
+
+#define PREV_PROFILE_SCOPE(name) \
+    PREV_PROFILE_CPU_SCOPE(name); \
+    PREV_ALLOCATION_SCOPE(name)
+#define PREV_PROFILE_FUNCTION() PREV_PROFILE_SCOPE(__func__)
+#define PREV_PROFILE_FRAME() \
+    PREV_PROFILE_CPU_FRAME(); \
+    PREV_ALLOCATION_FRAME()
+
+#endif // !__PROFILE_H__
@@ -0,0 +1,297 @@
+#include "Profiler.h"
+
+#include "../common/Logger.h"
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <sstream>
+#include <string_view>
+#include <unordered_map>
+
+namespace prev::profile {
+struct ProfileThreadBuffer {
+    ProfileThreadBuffer(const uint32_t threadId, const uint32_t capacity)
+        : zones(capacity)
+        , threadId{ threadId }
+    {
+    }
+
+    std::vector<ProfileZone> zones;
+
+    // written by the owning thread only, the zones below it are complete
+    std::atomic<uint64_t> writeCount{};
+
+    // guarded by the Profiler mutex
+    uint64_t readCount{};
+
+    uint32_t threadId{};
+
+    // owning thread only
+    uint32_t depth{};
+};
+
+namespace {
+    thread_local std::shared_ptr<ProfileThreadBuffer> threadBuffer{};
+
+    void WriteZone(ProfileThreadBuffer& buffer, const ProfileZone& zone)
+    {
+        const uint64_t index{ buffer.writeCount.load(std::memory_order_relaxed) };
+        buffer.zones[index % buffer.zones.size()] = zone;
+        buffer.writeCount.store(index + 1, std::memory_order_release);
+    }
+
+    void ReadZones(ProfileThreadBuffer& buffer, std::vector<ProfileZone>& outZones)
+    {
+        const uint64_t capacity{ buffer.zones.size() };
+        const uint64_t writeCount{ buffer.writeCount.load(std::memory_order_acquire) };
+        uint64_t readCount{ std::max(buffer.readCount, writeCount > capacity ? writeCount - capacity : 0) };
+
+        const size_t firstZone{ outZones.size() };
+        for (uint64_t index = readCount; index < writeCount; ++index) {
+            outZones.push_back(buffer.zones[index % capacity]);
+        }
+
+        // the owner kept on writing meanwhile - drop what it may have overwritten under our hands
+        const uint64_t newWriteCount{ buffer.writeCount.load(std::memory_order_acquire) };
+        if (newWriteCount > readCount + capacity) {
+            const uint64_t overwrittenCount{ std::min(newWriteCount - capacity - readCount, writeCount - readCount) };
+            outZones.erase(outZones.begin() + firstZone, outZones.begin() + firstZone + overwrittenCount);
+        }
+        buffer.readCount = writeCount;
+    }
+
+    void AppendEscaped(std::ostringstream& stream, const char* text)
+    {
+        for (const char* character = text; *character; ++character) {
+            if (*character == '"' || *character == '\\') {
+                stream << '\\';
+            }
+            stream << *character;
+        }
+    }
+
+    void AppendZone(std::ostringstream& stream, const ProfileZone& zone, const uint64_t baseTime, bool& first)
+    {
+        if (!first) {
+            stream << ",\n";
+        }
+        first = false;
+
+        stream << "{\"name\":\"";
+        AppendEscaped(stream, zone.name);
+        stream << "\",\"ph\":\"X\",\"pid\":1,\"tid\":" << zone.threadId
+               << ",\"ts\":" << static_cast<double>(zone.startTime - baseTime) / 1000.0
+               << ",\"dur\":" << static_cast<double>(zone.endTime - zone.startTime) / 1000.0 << "}";
+    }
+
+    void AppendThreadName(std::ostringstream& stream, const uint32_t threadId, const std::string& name, bool& first)
+    {
+        if (!first) {
+            stream << ",\n";
+        }
+        first = false;
+
+        stream << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << threadId << ",\"args\":{\"name\":\"" << name << "\"}}";
+    }
+} // namespace
+
+uint64_t Profiler::Now()
+{
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+void Profiler::SetEnabled(const bool enabled)
+{
+    m_enabled.store(enabled, std::memory_order_relaxed);
+}
+
+bool Profiler::IsEnabled() const
+{
+    return m_enabled.load(std::memory_order_relaxed);
+}
+
+void Profiler::AddCpuZone(const char* name, const uint64_t startTime, const uint64_t endTime)
+{
+    auto& buffer{ GetThreadBuffer() };
+    WriteZone(buffer, ProfileZone{ name, startTime, endTime, buffer.threadId, buffer.depth });
+}
+
+void Profiler::AddGpuZones(const std::vector<ProfileZone>& zones)
+{
+    std::lock_guard<std::mutex> lock{ m_mutex };
+    for (const auto& zone : zones) {
+        m_pendingGpuZones.push_back(zone);
+        m_pendingGpuZones.back().threadId = GPU_THREAD_ID;
+    }
+}
+
+void Profiler::EndFrame()
+{
+    const uint64_t endTime{ Now() };
+
+    std::lock_guard<std::mutex> lock{ m_mutex };
+
+    ProfileFrame frame{};
+    frame.index = m_frameIndex++;
+    frame.startTime = m_frameStartTime;
+    frame.endTime = endTime;
+    for (const auto& buffer : m_threadBuffers) {
+        ReadZones(*buffer, frame.cpuZones);
+    }
+    frame.gpuZones = std::move(m_pendingGpuZones);
+    m_pendingGpuZones.clear();
+
+    std::sort(frame.cpuZones.begin(), frame.cpuZones.end(), [](const auto& a, const auto& b) { return a.startTime < b.startTime; });
+    frame.cpuStatistics = ComputeStatistics(frame.cpuZones);
+    frame.gpuStatistics = ComputeStatistics(frame.gpuZones);
+
+    // buffers of finished threads, nothing left to read in them
+    m_threadBuffers.erase(std::remove_if(m_threadBuffers.begin(), m_threadBuffers.end(), [](const auto& buffer) { return buffer.use_count() == 1; }), m_threadBuffers.end());
+
+    if (m_capturing) {
+        m_capturedFrames.push_back(frame);
+        while (m_capturedFrames.size() > m_maxCapturedFrameCount) {
+            m_capturedFrames.pop_front();
+        }
+    }
+
+    m_lastFrame = std::move(frame);
+    m_frameStartTime = endTime;
+}
+
+ProfileFrame Profiler::GetLastFrame() const
+{
+    std::lock_guard<std::mutex> lock{ m_mutex };
+    return m_lastFrame;
+}
+
+void Profiler::BeginCapture(const uint32_t maxFrameCount)
+{
+    std::lock_guard<std::mutex> lock{ m_mutex };
+    m_capturedFrames.clear();
+    m_maxCapturedFrameCount = std::max(maxFrameCount, 1u);
+    m_capturing = true;
+}
+
+void Profiler::EndCapture()
+{
+    std::lock_guard<std::mutex> lock{ m_mutex };
+    m_capturing = false;
+}
+
+bool Profiler::IsCapturing() const
+{
+    std::lock_guard<std::mutex> lock{ m_mutex };
+    return m_capturing;
+}
+
+std::string Profiler::ToChromeTrace() const
+{
+    std::lock_guard<std::mutex> lock{ m_mutex };
+
+    // without a capture the last frame alone
+    std::vector<const ProfileFrame*> frames;
+    if (m_capturedFrames.empty()) {
+        frames.push_back(&m_lastFrame);
+    } else {
+        for (const auto& frame : m_capturedFrames) {
+            frames.push_back(&frame);
+        }
+    }
+
+    uint64_t baseTime{ frames.front()->startTime };
+    for (const auto frame : frames) {
+        for (const auto& zone : frame->gpuZones) {
+            baseTime = std::min(baseTime, zone.startTime);
+        }
+    }
+
+    std::ostringstream stream;
+    stream << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+
+    bool first{ true };
+    AppendThreadName(stream, GPU_THREAD_ID, "GPU", first);
+    for (const auto frame : frames) {
+        for (const auto& zone : frame->cpuZones) {
+            AppendZone(stream, zone, baseTime, first);
+        }
+        for (const auto& zone : frame->gpuZones) {
+            AppendZone(stream, zone, baseTime, first);
+        }
+
+        // frame boundaries as instant events, drawn over all tracks
+        stream << ",\n{\"name\":\"Frame " << frame->index << "\",\"ph\":\"i\",\"s\":\"g\",\"pid\":1,\"tid\":" << GPU_THREAD_ID
+               << ",\"ts\":" << static_cast<double>(frame->startTime - baseTime) / 1000.0 << "}";
+    }
+    stream << "\n]}\n";
+    return stream.str();
+}
+
+bool Profiler::ExportChromeTrace(const std::string& path) const
+{
+    std::ofstream file{ path, std::ios::out | std::ios::trunc };
+    if (!file.is_open()) {
+        LOGE("Could not open profile trace file: %s", path.c_str());
+        return false;
+    }
+    file << ToChromeTrace();
+    return file.good();
+}
+
+ProfileThreadBuffer& Profiler::GetThreadBuffer()
+{
+    if (!threadBuffer) {
+        std::lock_guard<std::mutex> lock{ m_mutex };
+        threadBuffer = std::make_shared<ProfileThreadBuffer>(m_nextThreadId++, THREAD_BUFFER_CAPACITY);
+        m_threadBuffers.push_back(threadBuffer);
+    }
+    return *threadBuffer;
+}
+
+std::vector<ProfileZoneStatistics> Profiler::ComputeStatistics(const std::vector<ProfileZone>& zones)
+{
+    std::vector<ProfileZoneStatistics> statistics;
+    std::unordered_map<std::string_view, size_t> indices;
+    for (const auto& zone : zones) {
+        // the same literal may live at different addresses in different translation units
+        const auto [iter, inserted] = indices.emplace(zone.name, statistics.size());
+        if (inserted) {
+            statistics.push_back(ProfileZoneStatistics{ zone.name });
+        }
+
+        auto& zoneStatistics{ statistics[iter->second] };
+        const uint64_t time{ zone.endTime - zone.startTime };
+        ++zoneStatistics.count;
+        zoneStatistics.totalTime += time;
+        zoneStatistics.maxTime = std::max(zoneStatistics.maxTime, time);
+    }
+
+    std::sort(statistics.begin(), statistics.end(), [](const auto& a, const auto& b) { return a.totalTime > b.totalTime; });
+    return statistics;
+}
+
+ProfileScope::ProfileScope(const char* name)
+{
+    auto& profiler{ Profiler::Instance() };
+    if (!profiler.IsEnabled()) {
+        return;
+    }
+
+    m_name = name;
+    ++profiler.GetThreadBuffer().depth;
+    m_startTime = Profiler::Now();
+}
+
+ProfileScope::~ProfileScope()
+{
+    if (!m_name) {
+        return;
+    }
+
+    const uint64_t endTime{ Profiler::Now() };
+    auto& buffer{ Profiler::Instance().GetThreadBuffer() };
+    --buffer.depth;
+    WriteZone(buffer, ProfileZone{ m_name, m_startTime, endTime, buffer.threadId, buffer.depth });
+}
+} // namespace prev::profile
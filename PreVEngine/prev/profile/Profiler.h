@@ -0,0 +1,155 @@
+#ifndef __PROFILER_H__
+#define __PROFILER_H__
+
+#include "../common/pattern/Singleton.h"
+
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace prev::profile {
+struct ProfileZone {
+    // not copied, string literals only
+    const char* name{};
+
+    // nanoseconds of the Profiler clock
+    uint64_t startTime{};
+
+    uint64_t endTime{};
+
+    uint32_t threadId{};
+
+    uint32_t depth{};
+};
+
+struct ProfileZoneStatistics {
+    const char* name{};
+
+    uint32_t count{};
+
+    uint64_t totalTime{};
+
+    uint64_t maxTime{};
+};
+
+struct ProfileFrame {
+    uint64_t index{};
+
+    uint64_t startTime{};
+
+    uint64_t endTime{};
+
+    std::vector<ProfileZone> cpuZones;
+
+    // of an earlier frame, GPU results come back a few frames late
+    std::vector<ProfileZone> gpuZones;
+
+    // CPU and GPU zones merged by name, the most expensive first
+    std::vector<ProfileZoneStatistics> cpuStatistics;
+
+    std::vector<ProfileZoneStatistics> gpuStatistics;
+};
+
+struct ProfileThreadBuffer;
+
+// Collects zones of all threads. Each thread writes its zones into its own ring, EndFrame gathers them into
+// a frame once per frame - zones of a thread that wrote more than a ring between two EndFrames are lost.
+// Use the PREV_PROFILE_* macros (Profile.h), so that builds without ENABLE_PROFILING do not pay anything.
+class Profiler final : public prev::common::pattern::Singleton<Profiler> {
+private:
+    friend class prev::common::pattern::Singleton<Profiler>;
+
+private:
+    Profiler() = default;
+
+public:
+    ~Profiler() = default;
+
+public:
+    static uint64_t Now();
+
+    void SetEnabled(const bool enabled);
+
+    bool IsEnabled() const;
+
+    // Called from any thread.
+    void AddCpuZone(const char* name, const uint64_t startTime, const uint64_t endTime);
+
+    // Called from the thread calling EndFrame.
+    void AddGpuZones(const std::vector<ProfileZone>& zones);
+
+    void EndFrame();
+
+    ProfileFrame GetLastFrame() const;
+
+    // Keeps the last maxFrameCount frames until EndCapture, ExportChromeTrace writes them out.
+    void BeginCapture(const uint32_t maxFrameCount = DEFAULT_MAX_CAPTURED_FRAME_COUNT);
+
+    void EndCapture();
+
+    bool IsCapturing() const;
+
+    // Chrome trace event JSON, opens in chrome://tracing and in Perfetto.
+    std::string ToChromeTrace() const;
+
+    bool ExportChromeTrace(const std::string& path) const;
+
+private:
+    friend class ProfileScope;
+
+    ProfileThreadBuffer& GetThreadBuffer();
+
+    static std::vector<ProfileZoneStatistics> ComputeStatistics(const std::vector<ProfileZone>& zones);
+
+private:
+    static const inline uint32_t DEFAULT_MAX_CAPTURED_FRAME_COUNT{ 600 };
+
+    static const inline uint32_t THREAD_BUFFER_CAPACITY{ 16 * 1024 };
+
+    static const inline uint32_t GPU_THREAD_ID{ 0 };
+
+private:
+    std::atomic<bool> m_enabled{ true };
+
+    mutable std::mutex m_mutex;
+
+    std::vector<std::shared_ptr<ProfileThreadBuffer>> m_threadBuffers;
+
+    uint32_t m_nextThreadId{ GPU_THREAD_ID + 1 };
+
+    uint64_t m_frameIndex{};
+
+    uint64_t m_frameStartTime{ Now() };
+
+    std::vector<ProfileZone> m_pendingGpuZones;
+
+    ProfileFrame m_lastFrame{};
+
+    bool m_capturing{};
+
+    uint32_t m_maxCapturedFrameCount{};
+
+    std::deque<ProfileFrame> m_capturedFrames;
+};
+
+class ProfileScope final {
+public:
+    explicit ProfileScope(const char* name);
+
+    ~ProfileScope();
+
+    ProfileScope(const ProfileScope&) = delete;
+    ProfileScope& operator=(const ProfileScope&) = delete;
+
+private:
+    const char* m_name{};
+
+    uint64_t m_startTime{};
+};
+} // namespace prev::profile
+
+#endif // !__PROFILER_H__
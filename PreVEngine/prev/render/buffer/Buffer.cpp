@@ -10,7 +10,7 @@
 #include <vector>
 
 namespace prev::render::buffer {
-Buffer::Buffer(GfxDevice device, GfxQueue queue, const CreateInfo& createInfo)
+Buffer::Buffer(GfxDevice device, GfxQueue queue, CreateInfo&& createInfo)
     : m_device{ device }
     , m_queue{ queue }
     , m_buffer{ createInfo.buffer }
@@ -21,6 +21,7 @@ Buffer::Buffer(GfxDevice device, GfxQueue queue, const CreateInfo& createInfo)
     , m_deferredResourceDestroyer{ createInfo.deferredResourceDestroyer }
     , m_destroyExecutionMode{ createInfo.destroyExecutionMode }
     , m_state{ createInfo.stateFlag ? createInfo.stateFlag : std::make_shared<std::atomic<prev::core::ResourceState>>(prev::core::ResourceState::Ready) }
+    , m_subAllocation{ std::move(createInfo.subAllocation) }
 {
     assert(m_deferredResourceDestroyer && "Buffer requires a deferred resource destroyer");
 }
@@ -41,6 +42,7 @@ Buffer::Buffer(Buffer&& other) noexcept
     , m_deferredResourceDestroyer{ other.m_deferredResourceDestroyer }
     , m_destroyExecutionMode{ other.m_destroyExecutionMode }
     , m_state{ other.m_state }
+    , m_subAllocation{ std::move(other.m_subAllocation) }
 {
     other.m_buffer = {};
     other.m_owning = false;
@@ -60,6 +62,7 @@ Buffer& Buffer::operator=(Buffer&& other) noexcept
         m_deferredResourceDestroyer = other.m_deferredResourceDestroyer;
         m_destroyExecutionMode = other.m_destroyExecutionMode;
         m_state = other.m_state;
+        m_subAllocation = std::move(other.m_subAllocation);
         other.m_buffer = {};
         other.m_owning = false;
     }
@@ -81,14 +84,22 @@ prev::core::ResourceState Buffer::GetState() const
 
 void Buffer::ReleaseBuffer()
 {
-    if (!m_owning || !m_buffer) {
+    if ((!m_owning && !m_subAllocation) || !m_buffer) {
         return;
     }
     // Cancel a still-pending async upload (optimization; the uploader's record is handle-only, not a UAF).
     if (m_state && m_state->load() == prev::core::ResourceState::Creating) {
         m_state->store(prev::core::ResourceState::Destroying);
     }
-    if (IsDeferred()) {
+    if (m_subAllocation) {
+        // The block stays, only the range goes back - once no in-flight frame uses it.
+        if (IsDeferred()) {
+            m_deferredResourceDestroyer->Destroy(std::move(m_subAllocation));
+        } else {
+            gfxQueueWaitIdle(m_queue);
+            m_subAllocation.reset();
+        }
+    } else if (IsDeferred()) {
         // Defer destruction past any in-flight work; no queue stall.
         m_deferredResourceDestroyer->Destroy(std::make_unique<prev::core::OwnedGfxBuffer>(m_buffer));
     } else {
@@ -142,7 +153,7 @@ Buffer Buffer::Slice(uint64_t offset, uint64_t size) const
     info.destroyExecutionMode = m_destroyExecutionMode;
     info.stateFlag = m_state; // the view shares the parent's lifecycle state
 
-    return Buffer(m_device, m_queue, info);
+    return Buffer(m_device, m_queue, std::move(info));
 }
 
 Buffer::operator GfxBuffer() const
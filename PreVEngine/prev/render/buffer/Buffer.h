@@ -6,6 +6,7 @@
 #include "../../core/DeferredResourceDestroyer.h"
 #include "../../core/IResource.h"
 #include "../../core/device/Device.h"
+#include "../../core/memory/BufferMemoryAllocator.h"
 
 #include <atomic>
 #include <memory>
@@ -28,9 +29,12 @@ private:
         // Initial/shared lifecycle state. Null defaults to Ready; async builds share a Creating state
         // with the uploader so it survives the resource being dropped before the upload is flushed.
         std::shared_ptr<std::atomic<prev::core::ResourceState>> stateFlag{};
+        // Set when the buffer is a range of a shared block (see BufferMemoryAllocator), `buffer` and `offset`
+        // point into the block then and releasing the buffer returns the range.
+        std::unique_ptr<prev::core::memory::BufferSubAllocation> subAllocation{};
     };
 
-    Buffer(GfxDevice device, GfxQueue queue, const CreateInfo& createInfo);
+    Buffer(GfxDevice device, GfxQueue queue, CreateInfo&& createInfo);
 
 public:
     ~Buffer() override;
@@ -94,6 +98,8 @@ protected:
     ExecutionMode m_destroyExecutionMode{ ExecutionMode::Auto };
 
     std::shared_ptr<std::atomic<prev::core::ResourceState>> m_state{};
+
+    std::unique_ptr<prev::core::memory::BufferSubAllocation> m_subAllocation{};
 };
 } // namespace prev::render::buffer
 
@@ -57,6 +57,12 @@ BufferBuilder& BufferBuilder::SetDestroyExecutionMode(ExecutionMode executionMod
     return *this;
 }
 
+BufferBuilder& BufferBuilder::SetSubAllocation(const bool subAllocation)
+{
+    m_subAllocation = subAllocation;
+    return *this;
+}
+
 std::unique_ptr<Buffer> BufferBuilder::Build() const
 {
     return BuildImpl(nullptr);
@@ -72,6 +78,27 @@ std::unique_ptr<Buffer> BufferBuilder::CreateBuffer(uint64_t& outAlignedSize, bo
     Validate();
 
     const uint64_t alignedSize{ prev::util::math::RoundUp(m_size, m_alignment) };
+    const bool hostMapped = (m_memoryProperties & GFX_MEMORY_PROPERTY_HOST_VISIBLE) != 0;
+
+    Buffer::CreateInfo createInfo{};
+    createInfo.hostMapped = hostMapped;
+    createInfo.size = alignedSize;
+    createInfo.deferredResourceDestroyer = &m_device.GetDeferredResourceDestroyer();
+    createInfo.destroyExecutionMode = m_destroyExecutionMode;
+    createInfo.stateFlag = stateFlag;
+
+    outAlignedSize = alignedSize;
+    outHostMapped = hostMapped;
+
+    if (CanSubAllocate(alignedSize)) {
+        if (auto subAllocation = m_device.GetBufferMemoryAllocator().Allocate(m_usageFlags, m_memoryProperties, alignedSize, m_alignment)) {
+            createInfo.buffer = subAllocation->GetBuffer();
+            createInfo.offset = subAllocation->GetOffset();
+            createInfo.owning = false;
+            createInfo.subAllocation = std::move(subAllocation);
+            return std::unique_ptr<Buffer>(new Buffer(m_device, m_queue, std::move(createInfo)));
+        }
+    }
 
     GfxBufferDescriptor desc{};
     desc.sType = GFX_STRUCTURE_TYPE_BUFFER_DESCRIPTOR;
@@ -84,19 +111,20 @@ std::unique_ptr<Buffer> BufferBuilder::CreateBuffer(uint64_t& outAlignedSize, bo
         throw std::runtime_error("Could not allocate buffer: size = " + std::to_string(alignedSize) + " bytes");
     }
 
-    const bool hostMapped = (m_memoryProperties & GFX_MEMORY_PROPERTY_HOST_VISIBLE) != 0;
-
-    Buffer::CreateInfo createInfo{};
     createInfo.buffer = buffer;
-    createInfo.hostMapped = hostMapped;
-    createInfo.size = alignedSize;
-    createInfo.deferredResourceDestroyer = &m_device.GetDeferredResourceDestroyer();
-    createInfo.destroyExecutionMode = m_destroyExecutionMode;
-    createInfo.stateFlag = stateFlag;
+    return std::unique_ptr<Buffer>(new Buffer(m_device, m_queue, std::move(createInfo)));
+}
 
-    outAlignedSize = alignedSize;
-    outHostMapped = hostMapped;
-    return std::unique_ptr<Buffer>(new Buffer(m_device, m_queue, createInfo));
+bool BufferBuilder::CanSubAllocate(const uint64_t size) const
+{
+    if (!m_subAllocation || size > m_device.GetBufferMemoryAllocator().GetMaxAllocationSize()) {
+        return false;
+    }
+
+    // only buffers bound at their offset by the renderers - storage, uniform or indirect
+    // buffers are bound in places that take the whole GfxBuffer
+    const GfxBufferUsageFlags subAllocatableUsageFlags{ GFX_BUFFER_USAGE_VERTEX | GFX_BUFFER_USAGE_INDEX | GFX_BUFFER_USAGE_COPY_DST | GFX_BUFFER_USAGE_MAP_WRITE };
+    return (m_usageFlags & (GFX_BUFFER_USAGE_VERTEX | GFX_BUFFER_USAGE_INDEX)) != 0 && (m_usageFlags & ~subAllocatableUsageFlags) == 0;
 }
 
 std::unique_ptr<Buffer> BufferBuilder::BuildImpl(GfxCommandEncoder commandEncoder) const
@@ -111,12 +139,10 @@ std::unique_ptr<Buffer> BufferBuilder::BuildImpl(GfxCommandEncoder commandEncode
     bool hostMapped{};
     auto buffer{ CreateBuffer(alignedSize, hostMapped, state) };
 
-    const GfxBuffer raw{ *buffer };
     if (m_data && m_dataSize > 0) {
-        UploadData(raw, std::min(m_dataSize, alignedSize), commandEncoder);
+        UploadData(*buffer, buffer->GetOffset(), std::min(m_dataSize, alignedSize), commandEncoder);
     } else if (hostMapped) {
-        std::vector<uint8_t> zeros(alignedSize, 0);
-        gfxQueueWriteBuffer(m_queue, raw, 0, zeros.data(), alignedSize);
+        buffer->Clear();
     }
 
     return buffer;
@@ -129,12 +155,6 @@ std::unique_ptr<Buffer> BufferBuilder::BuildAsync() const
         return BuildImpl(nullptr);
     }
 
-    if (!m_device.GetDeferredResourceUploader().CanQueue(m_dataSize)) {
-        // Too much staging already queued (e.g. a whole scene at load); build synchronously so this data's
-        // staging is freed immediately rather than held until flush, keeping peak memory bounded.
-        return BuildImpl(nullptr);
-    }
-
     // Allocate now but leave it Creating; the uploader records the copy at frame start and flips it Ready.
     // The shared state survives the resource being dropped before then (its destructor cancels the upload).
     auto state{ std::make_shared<std::atomic<prev::core::ResourceState>>(prev::core::ResourceState::Creating) };
@@ -144,30 +164,49 @@ std::unique_ptr<Buffer> BufferBuilder::BuildAsync() const
     auto buffer{ CreateBuffer(alignedSize, hostMapped, state) };
 
     const uint64_t size{ std::min(m_dataSize, alignedSize) };
+    auto& uploader{ m_device.GetDeferredResourceUploader() };
+    if (uploader.EnqueueBufferUpload(*buffer, buffer->GetOffset(), m_data, size, state)) {
+        return buffer;
+    }
+
+    if (!uploader.CanQueue(size)) {
+        // Too much staging already queued (e.g. a whole scene at load); upload synchronously so this data's
+        // staging is freed immediately rather than held until flush, keeping peak memory bounded.
+        gfxQueueWriteBuffer(m_queue, *buffer, buffer->GetOffset(), m_data, size);
+        state->store(prev::core::ResourceState::Ready);
+        return buffer;
+    }
+
+    // No staging ring on this platform: a staging buffer of its own.
     auto staged{ CreateStagedData(size) };
-    auto record{ MakeCopyRecorder(staged.buffer, *buffer, size) };
+    staged.copyOnly = true;
+    auto record{ MakeCopyRecorder(staged.buffer, *buffer, buffer->GetOffset(), size) };
 
-    m_device.GetDeferredResourceUploader().Enqueue(std::move(record), state, std::move(staged));
+    uploader.Enqueue(std::move(record), state, std::move(staged));
 
     return buffer;
 }
 
-void BufferBuilder::UploadData(GfxBuffer buffer, uint64_t size, GfxCommandEncoder commandEncoder) const
+void BufferBuilder::UploadData(GfxBuffer buffer, uint64_t offset, uint64_t size, GfxCommandEncoder commandEncoder) const
 {
     if (commandEncoder) {
+        // Stage in the ring + record a copy into the caller's encoder; the ring range outlives the submit.
+        if (m_device.GetDeferredResourceUploader().RecordBufferUpload(commandEncoder, buffer, offset, m_data, size)) {
+            return;
+        }
         // Stage + record a copy into the caller's encoder; defer-destroy the staging so it outlives the submit.
         auto staged{ CreateStagedData(size) };
         if (staged.prepare) {
             // The platform could not map the staging synchronously; a queue write covers this path too.
             gfxBufferDestroy(staged.buffer);
-            gfxQueueWriteBuffer(m_queue, buffer, 0, m_data, size);
+            gfxQueueWriteBuffer(m_queue, buffer, offset, m_data, size);
             return;
         }
-        MakeCopyRecorder(staged.buffer, buffer, size)(commandEncoder);
+        MakeCopyRecorder(staged.buffer, buffer, offset, size)(commandEncoder);
         m_device.GetDeferredResourceDestroyer().Destroy(std::make_unique<prev::core::OwnedGfxBuffer>(staged.buffer));
     } else {
         // Immediate: gfxQueueWriteBuffer covers host-visible and device-local targets.
-        gfxQueueWriteBuffer(m_queue, buffer, 0, m_data, size);
+        gfxQueueWriteBuffer(m_queue, buffer, offset, m_data, size);
     }
 }
 
@@ -205,14 +244,14 @@ prev::core::DeferredResourceUploader::StagingData BufferBuilder::CreateStagedDat
     return staged;
 }
 
-std::function<void(GfxCommandEncoder)> BufferBuilder::MakeCopyRecorder(GfxBuffer staging, GfxBuffer destination, uint64_t size) const
+std::function<void(GfxCommandEncoder)> BufferBuilder::MakeCopyRecorder(GfxBuffer staging, GfxBuffer destination, uint64_t destinationOffset, uint64_t size) const
 {
-    return [staging, destination, size](GfxCommandEncoder enc) {
+    return [staging, destination, destinationOffset, size](GfxCommandEncoder enc) {
         GfxCopyBufferToBufferDescriptor copyDesc{};
         copyDesc.source = staging;
         copyDesc.sourceOffset = 0;
         copyDesc.destination = destination;
-        copyDesc.destinationOffset = 0;
+        copyDesc.destinationOffset = destinationOffset;
         copyDesc.size = size;
         gfxCommandEncoderCopyBufferToBuffer(enc, &copyDesc);
     };
@@ -33,6 +33,10 @@ public:
 
     BufferBuilder& SetDestroyExecutionMode(ExecutionMode executionMode);
 
+    // Small vertex and index buffers are placed into shared blocks of the device's BufferMemoryAllocator
+    // by default (bind them at GetOffset()). Disable it for a buffer that needs a GfxBuffer of its own.
+    BufferBuilder& SetSubAllocation(const bool subAllocation);
+
     // Builds the buffer and uploads its data immediately (submit + wait); ready to use on return.
     std::unique_ptr<Buffer> Build() const;
 
@@ -59,13 +63,15 @@ private:
     // aligned size and whether the buffer is host-mapped.
     std::unique_ptr<Buffer> CreateBuffer(uint64_t& outAlignedSize, bool& outHostMapped, const std::shared_ptr<std::atomic<prev::core::ResourceState>>& stateFlag) const;
 
-    void UploadData(GfxBuffer buffer, uint64_t size, GfxCommandEncoder commandEncoder) const;
+    bool CanSubAllocate(const uint64_t size) const;
+
+    void UploadData(GfxBuffer buffer, uint64_t offset, uint64_t size, GfxCommandEncoder commandEncoder) const;
 
     // Creates a host-visible staging buffer filled with the builder's data. Caller owns it.
     prev::core::DeferredResourceUploader::StagingData CreateStagedData(uint64_t size) const;
 
     // Builds the staging->buffer copy recorder.
-    std::function<void(GfxCommandEncoder)> MakeCopyRecorder(GfxBuffer staging, GfxBuffer destination, uint64_t size) const;
+    std::function<void(GfxCommandEncoder)> MakeCopyRecorder(GfxBuffer staging, GfxBuffer destination, uint64_t destinationOffset, uint64_t size) const;
 
 private:
     const prev::core::device::Device& m_device;
@@ -85,6 +91,8 @@ private:
     uint64_t m_dataSize{};
 
     ExecutionMode m_destroyExecutionMode{ ExecutionMode::Auto };
+
+    bool m_subAllocation{ true };
 };
 } // namespace prev::render::buffer
 
@@ -95,6 +95,12 @@ ImageBufferBuilder& ImageBufferBuilder::SetLayerData(const std::vector<const uin
     return *this;
 }
 
+ImageBufferBuilder& ImageBufferBuilder::SetMipLevelData(const std::vector<std::vector<MipLevelData>>& layerMipLevelData)
+{
+    m_layerMipLevelData = layerMipLevelData;
+    return *this;
+}
+
 ImageBufferBuilder& ImageBufferBuilder::SetHostMapped(bool hostMapped)
 {
     m_hostMapped = hostMapped;
@@ -122,13 +128,14 @@ std::unique_ptr<ImageBuffer> ImageBufferBuilder::CreateImage(uint32_t& outMipLev
     Validate();
 
     const auto viewType{ m_viewType == GFX_TEXTURE_VIEW_TYPE_MAX_ENUM ? DeduceViewTypeFromTextureType(m_type) : m_viewType };
-    const auto mipLevels{ m_mipMapEnabled ? prev::util::math::Log2(std::max(m_extent.width, m_extent.height)) + 1 : 1 };
+    const bool precomputedMipLevels{ !m_layerMipLevelData.empty() };
+    const auto mipLevels{ precomputedMipLevels ? static_cast<uint32_t>(m_layerMipLevelData.front().size()) : (m_mipMapEnabled ? prev::util::math::Log2(std::max(m_extent.width, m_extent.height)) + 1 : 1) };
 
     GfxTextureUsageFlags usageFlags{ m_usageFlags };
-    if (!m_layersData.empty()) {
+    if (!m_layersData.empty() || precomputedMipLevels) {
         usageFlags |= GFX_TEXTURE_USAGE_COPY_DST;
     }
-    if (mipLevels > 1) {
+    if (mipLevels > 1 && !precomputedMipLevels) {
         usageFlags |= GFX_TEXTURE_USAGE_COPY_SRC;
         usageFlags |= GFX_TEXTURE_USAGE_COPY_DST;
         usageFlags |= GFX_TEXTURE_USAGE_RENDER_ATTACHMENT; // WebGPU backend generates mipmaps via render passes
@@ -161,7 +168,7 @@ std::unique_ptr<ImageBuffer> ImageBufferBuilder::CreateImage(uint32_t& outMipLev
     createInfo.usageFlags = usageFlags;
     // Initial layout reflects the texture's state right after the (pending) upload; the requested final
     // layout (m_layout) is applied when the creation work is recorded.
-    createInfo.layout = m_layersData.empty() ? GFX_TEXTURE_LAYOUT_UNDEFINED : GFX_TEXTURE_LAYOUT_SHADER_READ_ONLY;
+    createInfo.layout = m_layersData.empty() && !precomputedMipLevels ? GFX_TEXTURE_LAYOUT_UNDEFINED : GFX_TEXTURE_LAYOUT_SHADER_READ_ONLY;
     createInfo.deferredResourceDestroyer = &m_device.GetDeferredResourceDestroyer();
     createInfo.destroyExecutionMode = m_destroyExecutionMode;
     createInfo.stateFlag = stateFlag;
@@ -181,7 +188,7 @@ std::unique_ptr<ImageBuffer> ImageBufferBuilder::CreateImage(uint32_t& outMipLev
 
 std::unique_ptr<ImageBuffer> ImageBufferBuilder::BuildImpl(GfxCommandEncoder commandEncoder) const
 {
-    const bool hasData{ !m_layersData.empty() && m_layerDataSize > 0 };
+    const bool hasData{ HasData() };
     // Synchronous builds are usable on return (Ready); a texture built without data is allocated but
     // unpopulated (None) — its content is produced by a pass, not gated by the readiness check.
     auto state{ std::make_shared<std::atomic<prev::core::ResourceState>>(hasData ? prev::core::ResourceState::Ready : prev::core::ResourceState::None) };
@@ -194,11 +201,11 @@ std::unique_ptr<ImageBuffer> ImageBufferBuilder::BuildImpl(GfxCommandEncoder com
     }
 
     // Generate mipmaps and/or transition to the requested layout. Mipmaps are only generated here when
-    // data was uploaded; otherwise the caller does it (e.g. after a compute pass fills the texture).
-    // A layout of UNDEFINED means "leave as is" (e.g. render attachments).
+    // data was uploaded without its own mip chain; otherwise the caller does it (e.g. after a compute pass
+    // fills the texture). A layout of UNDEFINED means "leave as is" (e.g. render attachments).
     ImageBuffer* const img{ imageBuffer.get() };
     const GfxTextureLayout layout{ m_layout };
-    if (mipLevels > 1 && hasData) {
+    if (mipLevels > 1 && hasData && m_layerMipLevelData.empty()) {
         RecordCommands([img, layout](GfxCommandEncoder enc) {
             img->GenerateMipMaps(enc);
             img->UpdateLayout(layout, enc);
@@ -216,13 +223,13 @@ std::unique_ptr<ImageBuffer> ImageBufferBuilder::BuildImpl(GfxCommandEncoder com
 
 std::unique_ptr<ImageBuffer> ImageBufferBuilder::BuildAsync() const
 {
-    const bool hasData{ !m_layersData.empty() && m_layerDataSize > 0 };
-    if (!hasData) {
+    if (!HasData()) {
         // Nothing to stream; an async build with no data has no benefit, so build it ready immediately.
         return BuildImpl(nullptr);
     }
 
-    const uint64_t uploadBytes{ m_layerDataSize * std::min(m_layerCount, static_cast<uint32_t>(m_layersData.size())) };
+    uint64_t uploadBytes{};
+    ComputeCopyRegions(uploadBytes);
     if (!m_device.GetDeferredResourceUploader().CanQueue(uploadBytes)) {
         // Too much staging already queued (e.g. a whole scene at load); build synchronously so this data's
         // staging is freed immediately rather than held until flush, keeping peak memory bounded.
@@ -242,12 +249,13 @@ std::unique_ptr<ImageBuffer> ImageBufferBuilder::BuildAsync() const
 
     const uint32_t layerCount{ m_layerCount };
     const GfxTextureLayout finalLayout{ m_layout };
+    const bool generateMipMaps{ mipLevels > 1 && m_layerMipLevelData.empty() };
 
     // Replays the synchronous creation work at flush: copy layers, generate mips, transition layout.
     // Captures only GPU handles (never the ImageBuffer), so it stays safe even if the image is dropped first.
-    auto record{ [copyRecorder = std::move(copyRecorder), texture, mipLevels, layerCount, finalLayout](GfxCommandEncoder enc) {
+    auto record{ [copyRecorder = std::move(copyRecorder), texture, mipLevels, layerCount, finalLayout, generateMipMaps](GfxCommandEncoder enc) {
         copyRecorder(enc); // copies all layers, leaving the texture in SHADER_READ_ONLY
-        if (mipLevels > 1) {
+        if (generateMipMaps) {
             gfxCommandEncoderGenerateMipmaps(enc, texture);
         }
         if (finalLayout != GFX_TEXTURE_LAYOUT_UNDEFINED && finalLayout != GFX_TEXTURE_LAYOUT_SHADER_READ_ONLY) {
@@ -266,19 +274,19 @@ void ImageBufferBuilder::UploadLayerData(GfxTexture texture, GfxCommandEncoder c
     if (staged.prepare) {
         // The platform could not map the staging synchronously; queue writes cover this path too.
         gfxBufferDestroy(staged.buffer);
-        const uint32_t layerCount{ std::min(m_layerCount, static_cast<uint32_t>(m_layersData.size())) };
-        for (uint32_t layer = 0; layer < layerCount; ++layer) {
+        uint64_t stagingSize{};
+        for (const auto& region : ComputeCopyRegions(stagingSize)) {
             GfxWriteTextureDescriptor desc{};
             desc.texture = texture;
             desc.origin = { 0, 0, 0 };
-            desc.extent = m_extent;
-            desc.mipLevel = 0;
-            desc.arrayLayer = layer;
+            desc.extent = region.extent;
+            desc.mipLevel = region.mipLevel;
+            desc.arrayLayer = region.layer;
             desc.aspect = GFX_TEXTURE_ASPECT_ALL;
-            desc.bytesPerRow = 0;
+            desc.bytesPerRow = m_layerMipLevelData.empty() ? 0 : region.tightRowBytes;
             desc.rowsPerImage = 0;
             desc.finalLayout = GFX_TEXTURE_LAYOUT_SHADER_READ_ONLY;
-            GFXERRCHECK(gfxQueueWriteTexture(static_cast<GfxQueue>(m_queue), &desc, m_layersData[layer], m_layerDataSize));
+            GFXERRCHECK(gfxQueueWriteTexture(static_cast<GfxQueue>(m_queue), &desc, region.data, static_cast<uint64_t>(region.tightRowBytes) * region.rowCount));
         }
         return;
     }
@@ -293,20 +301,39 @@ void ImageBufferBuilder::UploadLayerData(GfxTexture texture, GfxCommandEncoder c
     }
 }
 
-uint32_t ImageBufferBuilder::ComputeBytesPerRow() const
+std::vector<ImageBufferBuilder::CopyRegion> ImageBufferBuilder::ComputeCopyRegions(uint64_t& outStagingSize) const
 {
-    const uint32_t tightRowBytes{ static_cast<uint32_t>(m_layerDataSize / m_extent.height) };
     constexpr uint32_t rowAlignment{ 256u };
-    return prev::util::math::RoundUp(tightRowBytes, rowAlignment);
+
+    std::vector<CopyRegion> regions;
+    outStagingSize = 0;
+    if (m_layerMipLevelData.empty()) {
+        const uint32_t layerCount{ std::min(m_layerCount, static_cast<uint32_t>(m_layersData.size())) };
+        const uint32_t tightRowBytes{ static_cast<uint32_t>(m_layerDataSize / m_extent.height) };
+        for (uint32_t layer = 0; layer < layerCount; ++layer) {
+            const CopyRegion region{ layer, 0, m_extent, m_layersData[layer], tightRowBytes, m_extent.height, prev::util::math::RoundUp(tightRowBytes, rowAlignment), outStagingSize };
+            outStagingSize += static_cast<uint64_t>(region.bytesPerRow) * region.rowCount;
+            regions.push_back(region);
+        }
+    } else {
+        const uint32_t layerCount{ std::min(m_layerCount, static_cast<uint32_t>(m_layerMipLevelData.size())) };
+        for (uint32_t layer = 0; layer < layerCount; ++layer) {
+            const auto& levels{ m_layerMipLevelData[layer] };
+            for (uint32_t level = 0; level < static_cast<uint32_t>(levels.size()); ++level) {
+                const GfxExtent3D extent{ std::max(m_extent.width >> level, 1u), std::max(m_extent.height >> level, 1u), 1 };
+                const CopyRegion region{ layer, level, extent, levels[level].data, levels[level].bytesPerRow, levels[level].rowCount, prev::util::math::RoundUp(levels[level].bytesPerRow, rowAlignment), outStagingSize };
+                outStagingSize += static_cast<uint64_t>(region.bytesPerRow) * region.rowCount;
+                regions.push_back(region);
+            }
+        }
+    }
+    return regions;
 }
 
 prev::core::DeferredResourceUploader::StagingData ImageBufferBuilder::CreateLayerStagedData() const
 {
-    const uint32_t layerCount{ std::min(m_layerCount, static_cast<uint32_t>(m_layersData.size())) };
-    const uint32_t tightRowBytes{ static_cast<uint32_t>(m_layerDataSize / m_extent.height) };
-    const uint32_t bytesPerRow{ ComputeBytesPerRow() };
-    const uint64_t layerSize{ static_cast<uint64_t>(bytesPerRow) * m_extent.height };
-    const uint64_t stagingSize{ layerSize * layerCount };
+    uint64_t stagingSize{};
+    const auto regions{ ComputeCopyRegions(stagingSize) };
 
     GfxBufferDescriptor stagingDesc{};
     stagingDesc.sType = GFX_STRUCTURE_TYPE_BUFFER_DESCRIPTOR;
@@ -335,10 +362,9 @@ prev::core::DeferredResourceUploader::StagingData ImageBufferBuilder::CreateLaye
     }
 
     // Copies the layers row-by-row into the 256-aligned row pitch WebGPU requires (valid on Vulkan too).
-    for (uint32_t layer = 0; layer < layerCount; ++layer) {
-        const uint8_t* const src{ m_layersData[layer] };
-        for (uint32_t row = 0; row < m_extent.height; ++row) {
-            memcpy(dst + layer * layerSize + row * bytesPerRow, src + row * tightRowBytes, tightRowBytes);
+    for (const auto& region : regions) {
+        for (uint32_t row = 0; row < region.rowCount; ++row) {
+            memcpy(dst + region.stagingOffset + static_cast<uint64_t>(row) * region.bytesPerRow, region.data + static_cast<uint64_t>(row) * region.tightRowBytes, region.tightRowBytes);
         }
     }
 
@@ -360,25 +386,24 @@ prev::core::DeferredResourceUploader::StagingData ImageBufferBuilder::CreateLaye
 
 std::function<void(GfxCommandEncoder)> ImageBufferBuilder::MakeLayerCopyRecorder(GfxBuffer staging, GfxTexture texture) const
 {
-    const uint32_t layerCount{ std::min(m_layerCount, static_cast<uint32_t>(m_layersData.size())) };
-    const GfxExtent3D extent{ m_extent };
-    const uint32_t bytesPerRow{ ComputeBytesPerRow() };
-    const uint64_t layerSize{ static_cast<uint64_t>(bytesPerRow) * m_extent.height };
-
-    // Copies each layer (UNDEFINED -> TRANSFER_DST -> SHADER_READ_ONLY). Captures only handles/POD so it is
-    // safe to replay later (caller's encoder or the deferred uploader). bytesPerRow matches the staging
-    // buffer's row pitch (ComputeBytesPerRow rounds up to 256 - required by WebGPU, valid on Vulkan too).
-    return [staging, texture, layerCount, extent, bytesPerRow, layerSize](GfxCommandEncoder enc) {
-        for (uint32_t layer = 0; layer < layerCount; ++layer) {
+    uint64_t stagingSize{};
+    const auto regions{ ComputeCopyRegions(stagingSize) };
+
+    // Copies each layer/level (UNDEFINED -> TRANSFER_DST -> SHADER_READ_ONLY). Captures only handles/POD so it
+    // is safe to replay later (caller's encoder or the deferred uploader); the regions' source pointers are not
+    // used here. bytesPerRow matches the staging buffer's row pitch (rounded up to 256 - required by WebGPU,
+    // valid on Vulkan too).
+    return [staging, texture, regions](GfxCommandEncoder enc) {
+        for (const auto& region : regions) {
             GfxCopyBufferToTextureDescriptor copyDesc{};
             copyDesc.source = staging;
-            copyDesc.sourceOffset = layer * layerSize;
-            copyDesc.bytesPerRow = bytesPerRow;
+            copyDesc.sourceOffset = region.stagingOffset;
+            copyDesc.bytesPerRow = region.bytesPerRow;
             copyDesc.destination = texture;
             copyDesc.origin = { 0, 0, 0 };
-            copyDesc.extent = extent;
-            copyDesc.mipLevel = 0;
-            copyDesc.arrayLayer = layer;
+            copyDesc.extent = region.extent;
+            copyDesc.mipLevel = region.mipLevel;
+            copyDesc.arrayLayer = region.layer;
             copyDesc.finalLayout = GFX_TEXTURE_LAYOUT_SHADER_READ_ONLY;
             gfxCommandEncoderCopyBufferToTexture(enc, &copyDesc);
         }
@@ -411,9 +436,26 @@ void ImageBufferBuilder::Validate() const
         throw std::runtime_error("Invalid image type - undefined.");
     }
 
-    if (!m_layersData.empty() && m_layerDataSize > 0 && m_layout == GFX_TEXTURE_LAYOUT_UNDEFINED) {
+    if (HasData() && m_layout == GFX_TEXTURE_LAYOUT_UNDEFINED) {
         throw std::runtime_error("Image buffer uploaded with data must specify a final layout via SetLayout().");
     }
+
+    if (!m_layerMipLevelData.empty()) {
+        const auto levelCount{ m_layerMipLevelData.front().size() };
+        if (levelCount == 0 || levelCount > prev::util::math::Log2(std::max(m_extent.width, m_extent.height)) + 1) {
+            throw std::runtime_error("Invalid mip level data - level count does not match the extent.");
+        }
+        for (const auto& levels : m_layerMipLevelData) {
+            if (levels.size() != levelCount) {
+                throw std::runtime_error("Invalid mip level data - all layers must have the same level count.");
+            }
+        }
+    }
+}
+
+bool ImageBufferBuilder::HasData() const
+{
+    return (!m_layersData.empty() && m_layerDataSize > 0) || !m_layerMipLevelData.empty();
 }
 
 } // namespace prev::render::buffer
@@ -17,6 +17,16 @@
 namespace prev::render::buffer {
 
 class ImageBufferBuilder final {
+public:
+    // One mip level of one layer in its upload layout - compressed formats count rows of blocks.
+    struct MipLevelData {
+        const uint8_t* data{};
+
+        uint32_t bytesPerRow{};
+
+        uint32_t rowCount{};
+    };
+
 public:
     ImageBufferBuilder(const prev::core::device::Device& device, const prev::core::device::Queue& queue);
 
@@ -43,6 +53,10 @@ public:
 
     ImageBufferBuilder& SetLayerData(const std::vector<const uint8_t*>& layerData, uint64_t layerDataSize = 0);
 
+    // Uploads a precomputed mip chain per layer instead of SetLayerData - no mipmaps are generated on the GPU.
+    // Required for block compressed formats, all layers must have the same level count.
+    ImageBufferBuilder& SetMipLevelData(const std::vector<std::vector<MipLevelData>>& layerMipLevelData);
+
     ImageBufferBuilder& SetHostMapped(bool hostMapped);
 
     ImageBufferBuilder& SetDestroyExecutionMode(ExecutionMode executionMode);
@@ -63,9 +77,30 @@ public:
     // IsReady() is false. The returned image must be kept alive until it becomes ready. No queue stall.
     std::unique_ptr<ImageBuffer> BuildAsync() const;
 
+private:
+    struct CopyRegion {
+        uint32_t layer{};
+
+        uint32_t mipLevel{};
+
+        GfxExtent3D extent{};
+
+        const uint8_t* data{};
+
+        uint32_t tightRowBytes{};
+
+        uint32_t rowCount{};
+
+        uint32_t bytesPerRow{};
+
+        uint64_t stagingOffset{};
+    };
+
 private:
     void Validate() const;
 
+    bool HasData() const;
+
     // Shared implementation: commandEncoder == nullptr -> immediate (submit + wait); otherwise records
     // the creation work into the encoder.
     std::unique_ptr<ImageBuffer> BuildImpl(GfxCommandEncoder commandEncoder) const;
@@ -77,7 +112,8 @@ private:
 
     void UploadLayerData(GfxTexture texture, GfxCommandEncoder commandEncoder) const;
 
-    uint32_t ComputeBytesPerRow() const;
+    // Layer (and mip level) copies laid out back to back in the staging buffer with 256-aligned rows.
+    std::vector<CopyRegion> ComputeCopyRegions(uint64_t& outStagingSize) const;
 
     // Packs all layers into one host-visible staging buffer. Caller owns it.
     prev::core::DeferredResourceUploader::StagingData CreateLayerStagedData() const;
@@ -114,6 +150,8 @@ private:
 
     uint64_t m_layerDataSize{ 0 };
 
+    std::vector<std::vector<MipLevelData>> m_layerMipLevelData{};
+
     bool m_hostMapped{ false };
 
     ExecutionMode m_destroyExecutionMode{ ExecutionMode::Auto };
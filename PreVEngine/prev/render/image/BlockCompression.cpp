@@ -0,0 +1,830 @@
+#include "BlockCompression.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace prev::render::image::block {
+namespace {
+    constexpr uint32_t PIXEL_COUNT{ 16 };
+
+    constexpr uint32_t CHANNEL_COUNT{ 4 };
+
+    constexpr uint8_t BC7_WEIGHTS[16]{ 0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64 };
+
+    // { small, large } modifier per table, the selectors map to +small, +large, -small, -large
+    constexpr int32_t ETC_MODIFIERS[8][2]{ { 2, 8 }, { 5, 17 }, { 9, 29 }, { 13, 42 }, { 18, 60 }, { 24, 80 }, { 33, 106 }, { 47, 183 } };
+
+    constexpr int32_t EAC_MODIFIERS[16][8]{
+        { -3, -6, -9, -15, 2, 5, 8, 14 },
+        { -3, -7, -10, -13, 2, 6, 9, 12 },
+        { -2, -5, -8, -13, 1, 4, 7, 12 },
+        { -2, -4, -6, -13, 1, 3, 5, 12 },
+        { -3, -6, -8, -12, 2, 5, 7, 11 },
+        { -3, -7, -9, -11, 2, 6, 8, 10 },
+        { -4, -7, -8, -11, 3, 6, 7, 10 },
+        { -3, -5, -8, -11, 2, 4, 7, 10 },
+        { -2, -6, -8, -10, 1, 5, 7, 9 },
+        { -2, -5, -8, -10, 1, 4, 7, 9 },
+        { -2, -4, -8, -10, 1, 3, 7, 9 },
+        { -2, -5, -7, -10, 1, 4, 6, 9 },
+        { -3, -4, -7, -10, 2, 3, 6, 9 },
+        { -1, -2, -3, -10, 0, 1, 2, 9 },
+        { -4, -6, -8, -9, 3, 5, 7, 8 },
+        { -3, -5, -7, -9, 2, 4, 6, 8 }
+    };
+
+    // table and selector with a zero modifier, used for flat blocks
+    constexpr uint32_t EAC_FLAT_TABLE{ 13 };
+
+    constexpr uint32_t EAC_FLAT_SELECTOR{ 4 };
+
+    uint8_t ClampByte(const int32_t value)
+    {
+        return static_cast<uint8_t>(std::clamp(value, 0, 255));
+    }
+
+    int32_t Square(const int32_t value)
+    {
+        return value * value;
+    }
+
+    int32_t ColorDistance(const uint8_t* a, const uint8_t* b, const uint32_t channelCount)
+    {
+        int32_t distance{ 0 };
+        for (uint32_t c = 0; c < channelCount; ++c) {
+            distance += Square(static_cast<int32_t>(a[c]) - static_cast<int32_t>(b[c]));
+        }
+        return distance;
+    }
+
+    // Fits a line through the pixels (principal axis by power iteration) and returns its extreme points.
+    void FindEndpoints(const uint8_t* pixels, const uint32_t channelCount, float* outMin, float* outMax)
+    {
+        float mean[CHANNEL_COUNT]{};
+        for (uint32_t i = 0; i < PIXEL_COUNT; ++i) {
+            for (uint32_t c = 0; c < channelCount; ++c) {
+                mean[c] += pixels[i * CHANNEL_COUNT + c];
+            }
+        }
+        for (uint32_t c = 0; c < channelCount; ++c) {
+            mean[c] /= PIXEL_COUNT;
+        }
+
+        float covariance[CHANNEL_COUNT][CHANNEL_COUNT]{};
+        for (uint32_t i = 0; i < PIXEL_COUNT; ++i) {
+            for (uint32_t a = 0; a < channelCount; ++a) {
+                for (uint32_t b = 0; b < channelCount; ++b) {
+                    covariance[a][b] += (pixels[i * CHANNEL_COUNT + a] - mean[a]) * (pixels[i * CHANNEL_COUNT + b] - mean[b]);
+                }
+            }
+        }
+
+        float axis[CHANNEL_COUNT]{ 1.0f, 1.0f, 1.0f, 1.0f };
+        for (uint32_t iteration = 0; iteration < 8; ++iteration) {
+            float next[CHANNEL_COUNT]{};
+            float length{ 0.0f };
+            for (uint32_t a = 0; a < channelCount; ++a) {
+                for (uint32_t b = 0; b < channelCount; ++b) {
+                    next[a] += covariance[a][b] * axis[b];
+                }
+                length = std::max(length, std::abs(next[a]));
+            }
+            if (length < 1e-6f) {
+                break;
+            }
+            for (uint32_t c = 0; c < channelCount; ++c) {
+                axis[c] = next[c] / length;
+            }
+        }
+
+        float minT{ std::numeric_limits<float>::max() };
+        float maxT{ std::numeric_limits<float>::lowest() };
+        float axisLengthSquared{ 0.0f };
+        for (uint32_t c = 0; c < channelCount; ++c) {
+            axisLengthSquared += axis[c] * axis[c];
+        }
+        for (uint32_t i = 0; i < PIXEL_COUNT; ++i) {
+            float t{ 0.0f };
+            for (uint32_t c = 0; c < channelCount; ++c) {
+                t += (pixels[i * CHANNEL_COUNT + c] - mean[c]) * axis[c];
+            }
+            t /= axisLengthSquared;
+            minT = std::min(minT, t);
+            maxT = std::max(maxT, t);
+        }
+
+        for (uint32_t c = 0; c < channelCount; ++c) {
+            outMin[c] = std::clamp(mean[c] + axis[c] * minT, 0.0f, 255.0f);
+            outMax[c] = std::clamp(mean[c] + axis[c] * maxT, 0.0f, 255.0f);
+        }
+    }
+
+    //
+    // BC1
+    //
+    uint16_t PackColor565(const float* color)
+    {
+        const auto r{ static_cast<uint32_t>(std::lround(color[0] * 31.0f / 255.0f)) };
+        const auto g{ static_cast<uint32_t>(std::lround(color[1] * 63.0f / 255.0f)) };
+        const auto b{ static_cast<uint32_t>(std::lround(color[2] * 31.0f / 255.0f)) };
+        return static_cast<uint16_t>((r << 11) | (g << 5) | b);
+    }
+
+    void UnpackColor565(const uint16_t packed, uint8_t* outColor)
+    {
+        const uint32_t r{ (packed >> 11) & 0x1Fu };
+        const uint32_t g{ (packed >> 5) & 0x3Fu };
+        const uint32_t b{ packed & 0x1Fu };
+        outColor[0] = static_cast<uint8_t>((r << 3) | (r >> 2));
+        outColor[1] = static_cast<uint8_t>((g << 2) | (g >> 4));
+        outColor[2] = static_cast<uint8_t>((b << 3) | (b >> 2));
+        outColor[3] = 255;
+    }
+
+    void BuildColorPalette(const uint16_t color0, const uint16_t color1, const bool forceFourColors, uint8_t (&outPalette)[4][CHANNEL_COUNT])
+    {
+        UnpackColor565(color0, outPalette[0]);
+        UnpackColor565(color1, outPalette[1]);
+        if (color0 > color1 || forceFourColors) {
+            for (uint32_t c = 0; c < 3; ++c) {
+                outPalette[2][c] = static_cast<uint8_t>((2 * outPalette[0][c] + outPalette[1][c] + 1) / 3);
+                outPalette[3][c] = static_cast<uint8_t>((outPalette[0][c] + 2 * outPalette[1][c] + 1) / 3);
+            }
+            outPalette[2][3] = outPalette[3][3] = 255;
+        } else {
+            for (uint32_t c = 0; c < 3; ++c) {
+                outPalette[2][c] = static_cast<uint8_t>((outPalette[0][c] + outPalette[1][c]) / 2);
+                outPalette[3][c] = 0;
+            }
+            outPalette[2][3] = 255;
+            outPalette[3][3] = 0;
+        }
+    }
+
+    int32_t FindColorIndices(const uint8_t* pixels, const uint16_t color0, const uint16_t color1, uint32_t& outIndices)
+    {
+        outIndices = 0;
+        if (color0 == color1) {
+            uint8_t color[CHANNEL_COUNT];
+            UnpackColor565(color0, color);
+            int32_t error{ 0 };
+            for (uint32_t i = 0; i < PIXEL_COUNT; ++i) {
+                error += ColorDistance(pixels + i * CHANNEL_COUNT, color, 3);
+            }
+            return error;
+        }
+
+        uint8_t palette[4][CHANNEL_COUNT];
+        BuildColorPalette(color0, color1, true, palette);
+
+        int32_t error{ 0 };
+        for (uint32_t i = 0; i < PIXEL_COUNT; ++i) {
+            uint32_t bestIndex{ 0 };
+            int32_t bestDistance{ std::numeric_limits<int32_t>::max() };
+            for (uint32_t p = 0; p < 4; ++p) {
+                const auto distance{ ColorDistance(pixels + i * CHANNEL_COUNT, palette[p], 3) };
+                if (distance < bestDistance) {
+                    bestDistance = distance;
+                    bestIndex = p;
+                }
+            }
+            outIndices |= bestIndex << (2 * i);
+            error += bestDistance;
+        }
+        return error;
+    }
+
+    // Least squares endpoints for the given indices, false when the system is degenerate.
+    bool RefineColorEndpoints(const uint8_t* pixels, const uint32_t indices, float* outColor0, float* outColor1)
+    {
+        constexpr float weights[4]{ 1.0f, 0.0f, 2.0f / 3.0f, 1.0f / 3.0f };
+
+        float aa{ 0.0f }, ab{ 0.0f }, bb{ 0.0f };
+        float ax[3]{}, bx[3]{};
+        for (uint32_t i = 0; i < PIXEL_COUNT; ++i) {
+            const float a{ weights[(indices >> (2 * i)) & 0x3u] };
+            const float b{ 1.0f - a };
+            aa += a * a;
+            ab += a * b;
+            bb += b * b;
+            for (uint32_t c = 0; c < 3; ++c) {
+                ax[c] += a * pixels[i * CHANNEL_COUNT + c];
+                bx[c] += b * pixels[i * CHANNEL_COUNT + c];
+            }
+        }
+
+        const float determinant{ aa * bb - ab * ab };
+        if (std::abs(determinant) < 1e-6f) {
+            return false;
+        }
+
+        for (uint32_t c = 0; c < 3; ++c) {
+            outColor0[c] = std::clamp((ax[c] * bb - bx[c] * ab) / determinant, 0.0f, 255.0f);
+            outColor1[c] = std::clamp((bx[c] * aa - ax[c] * ab) / determinant, 0.0f, 255.0f);
+        }
+        return true;
+    }
+
+    void WriteColorBlock(const uint16_t color0, const uint16_t color1, const uint32_t indices, uint8_t* outBlock)
+    {
+        outBlock[0] = static_cast<uint8_t>(color0 & 0xFF);
+        outBlock[1] = static_cast<uint8_t>(color0 >> 8);
+        outBlock[2] = static_cast<uint8_t>(color1 & 0xFF);
+        outBlock[3] = static_cast<uint8_t>(color1 >> 8);
+        for (uint32_t i = 0; i < 4; ++i) {
+            outBlock[4 + i] = static_cast<uint8_t>((indices >> (8 * i)) & 0xFF);
+        }
+    }
+
+    // Keeps color0 > color1 so the block decodes in the four color mode.
+    void OrderColorEndpoints(uint16_t& color0, uint16_t& color1, uint32_t& indices)
+    {
+        if (color0 >= color1) {
+            return;
+        }
+        std::swap(color0, color1);
+        // 0 <-> 1, 2 <-> 3
+        indices ^= 0x55555555u;
+    }
+
+    void EncodeColorBlock(const uint8_t* pixels, uint8_t* outBlock)
+    {
+        float minColor[CHANNEL_COUNT], maxColor[CHANNEL_COUNT];
+        FindEndpoints(pixels, 3, minColor, maxColor);
+
+        uint16_t color0{ PackColor565(maxColor) };
+        uint16_t color1{ PackColor565(minColor) };
+        uint32_t indices{};
+        const int32_t error{ FindColorIndices(pixels, color0, color1, indices) };
+
+        float refinedColor0[3], refinedColor1[3];
+        if (color0 != color1 && RefineColorEndpoints(pixels, indices, refinedColor0, refinedColor1)) {
+            const uint16_t refined0{ PackColor565(refinedColor0) };
+            const uint16_t refined1{ PackColor565(refinedColor1) };
+            uint32_t refinedIndices{};
+            const int32_t refinedError{ FindColorIndices(pixels, refined0, refined1, refinedIndices) };
+            if (refinedError < error) {
+                color0 = refined0;
+                color1 = refined1;
+                indices = refinedIndices;
+            }
+        }
+
+        OrderColorEndpoints(color0, color1, indices);
+        WriteColorBlock(color0, color1, indices, outBlock);
+    }
+
+    void DecodeColorBlock(const uint8_t* block, const bool forceFourColors, uint8_t* outPixels)
+    {
+        const uint16_t color0{ static_cast<uint16_t>(block[0] | (block[1] << 8)) };
+        const uint16_t color1{ static_cast<uint16_t>(block[2] | (block[3] << 8)) };
+        const uint32_t indices{ static_cast<uint32_t>(block[4]) | (static_cast<uint32_t>(block[5]) << 8) | (static_cast<uint32_t>(block[6]) << 16) | (static_cast<uint32_t>(block[7]) << 24) };
+
+        uint8_t palette[4][CHANNEL_COUNT];
+        BuildColorPalette(color0, color1, forceFourColors, palette);
+        for (uint32_t i = 0; i < PIXEL_COUNT; ++i) {
+            std::copy_n(palette[(indices >> (2 * i)) & 0x3u], CHANNEL_COUNT, outPixels + i * CHANNEL_COUNT);
+        }
+    }
+
+    //
+    // BC4
+    //
+    void BuildSingleChannelPalette(const uint8_t value0, const uint8_t value1, uint8_t (&outPalette)[8])
+    {
+        outPalette[0] = value0;
+        outPalette[1] = value1;
+        if (value0 > value1) {
+            for (uint32_t i = 1; i < 7; ++i) {
+                outPalette[i + 1] = static_cast<uint8_t>(((7 - i) * value0 + i * value1 + 3) / 7);
+            }
+        } else {
+            for (uint32_t i = 1; i < 5; ++i) {
+                outPalette[i + 1] = static_cast<uint8_t>(((5 - i) * value0 + i * value1 + 2) / 5);
+            }
+            outPalette[6] = 0;
+            outPalette[7] = 255;
+        }
+    }
+
+    //
+    // BC7
+    //
+    void WriteBits(uint8_t* block, uint32_t& offset, const uint32_t value, const uint32_t count)
+    {
+        for (uint32_t i = 0; i < count; ++i, ++offset) {
+            if ((value >> i) & 1u) {
+                block[offset / 8] |= static_cast<uint8_t>(1u << (offset % 8));
+            }
+        }
+    }
+
+    uint32_t ReadBits(const uint8_t* block, uint32_t& offset, const uint32_t count)
+    {
+        uint32_t value{ 0 };
+        for (uint32_t i = 0; i < count; ++i, ++offset) {
+            value |= ((block[offset / 8] >> (offset % 8)) & 1u) << i;
+        }
+        return value;
+    }
+
+    // Quantizes an endpoint to 7 bits per channel plus a shared p-bit, picks the p-bit with the lower error.
+    void QuantizeBC7Endpoint(const float* endpoint, uint8_t (&outQuantized)[CHANNEL_COUNT], uint32_t& outPBit)
+    {
+        float bestError{ std::numeric_limits<float>::max() };
+        for (uint32_t pBit = 0; pBit < 2; ++pBit) {
+            uint8_t quantized[CHANNEL_COUNT];
+            float error{ 0.0f };
+            for (uint32_t c = 0; c < CHANNEL_COUNT; ++c) {
+                quantized[c] = static_cast<uint8_t>(std::clamp(static_cast<int32_t>(std::lround((endpoint[c] - pBit) / 2.0f)), 0, 127));
+                const float difference{ static_cast<float>((quantized[c] << 1) | pBit) - endpoint[c] };
+                error += difference * difference;
+            }
+            if (error < bestError) {
+                bestError = error;
+                outPBit = pBit;
+                std::copy_n(quantized, CHANNEL_COUNT, outQuantized);
+            }
+        }
+    }
+
+    void BuildBC7Palette(const uint8_t (&endpoints)[2][CHANNEL_COUNT], const uint32_t (&pBits)[2], uint8_t (&outPalette)[16][CHANNEL_COUNT])
+    {
+        for (uint32_t i = 0; i < 16; ++i) {
+            for (uint32_t c = 0; c < CHANNEL_COUNT; ++c) {
+                const uint32_t value0{ static_cast<uint32_t>(endpoints[0][c] << 1) | pBits[0] };
+                const uint32_t value1{ static_cast<uint32_t>(endpoints[1][c] << 1) | pBits[1] };
+                outPalette[i][c] = static_cast<uint8_t>(((64 - BC7_WEIGHTS[i]) * value0 + BC7_WEIGHTS[i] * value1 + 32) >> 6);
+            }
+        }
+    }
+
+    //
+    // ETC2
+    //
+    struct EtcSubBlock {
+        uint32_t pixelIndices[8]{};
+    };
+
+    void GetEtcSubBlocks(const bool flip, EtcSubBlock (&outSubBlocks)[2])
+    {
+        uint32_t counts[2]{};
+        for (uint32_t y = 0; y < 4; ++y) {
+            for (uint32_t x = 0; x < 4; ++x) {
+                const uint32_t subBlock{ flip ? (y >= 2 ? 1u : 0u) : (x >= 2 ? 1u : 0u) };
+                outSubBlocks[subBlock].pixelIndices[counts[subBlock]++] = y * 4 + x;
+            }
+        }
+    }
+
+    // ETC pixel order is column major
+    uint32_t GetEtcPixelSlot(const uint32_t pixelIndex)
+    {
+        return (pixelIndex % 4) * 4 + pixelIndex / 4;
+    }
+
+    int32_t GetEtcModifier(const uint32_t table, const uint32_t selector)
+    {
+        const int32_t modifier{ ETC_MODIFIERS[table][selector & 1u] };
+        return (selector & 2u) ? -modifier : modifier;
+    }
+
+    // Picks the best table for a sub block with a given base color, returns its error.
+    int32_t FitEtcSubBlock(const uint8_t* pixels, const EtcSubBlock& subBlock, const uint8_t* baseColor, uint32_t& outTable, uint32_t (&outSelectors)[8])
+    {
+        int32_t bestError{ std::numeric_limits<int32_t>::max() };
+        for (uint32_t table = 0; table < 8; ++table) {
+            int32_t error{ 0 };
+            uint32_t selectors[8];
+            for (uint32_t i = 0; i < 8 && error < bestError; ++i) {
+                const uint8_t* pixel{ pixels + subBlock.pixelIndices[i] * CHANNEL_COUNT };
+                int32_t bestDistance{ std::numeric_limits<int32_t>::max() };
+                for (uint32_t selector = 0; selector < 4; ++selector) {
+                    const int32_t modifier{ GetEtcModifier(table, selector) };
+                    const uint8_t color[3]{ ClampByte(baseColor[0] + modifier), ClampByte(baseColor[1] + modifier), ClampByte(baseColor[2] + modifier) };
+                    const auto distance{ ColorDistance(pixel, color, 3) };
+                    if (distance < bestDistance) {
+                        bestDistance = distance;
+                        selectors[i] = selector;
+                    }
+                }
+                error += bestDistance;
+            }
+            if (error < bestError) {
+                bestError = error;
+                outTable = table;
+                std::copy_n(selectors, 8, outSelectors);
+            }
+        }
+        return bestError;
+    }
+
+    uint8_t Expand4(const uint32_t value)
+    {
+        return static_cast<uint8_t>((value << 4) | value);
+    }
+
+    uint8_t Expand5(const uint32_t value)
+    {
+        return static_cast<uint8_t>((value << 3) | (value >> 2));
+    }
+
+    void WriteBigEndian(const uint64_t value, uint8_t* outBlock)
+    {
+        for (uint32_t i = 0; i < 8; ++i) {
+            outBlock[i] = static_cast<uint8_t>(value >> (56 - 8 * i));
+        }
+    }
+
+    uint64_t ReadBigEndian(const uint8_t* block)
+    {
+        uint64_t value{ 0 };
+        for (uint32_t i = 0; i < 8; ++i) {
+            value = (value << 8) | block[i];
+        }
+        return value;
+    }
+
+    // Encodes both sub blocks with the given base colors, returns the error and the block bits without the mode header.
+    int32_t EncodeEtcSubBlocks(const uint8_t* pixels, const EtcSubBlock (&subBlocks)[2], const uint8_t (&baseColors)[2][3], uint64_t& outBits)
+    {
+        int32_t error{ 0 };
+        outBits = 0;
+        for (uint32_t s = 0; s < 2; ++s) {
+            uint32_t table{};
+            uint32_t selectors[8];
+            error += FitEtcSubBlock(pixels, subBlocks[s], baseColors[s], table, selectors);
+            outBits |= static_cast<uint64_t>(table) << (s == 0 ? 37 : 34);
+            for (uint32_t i = 0; i < 8; ++i) {
+                const uint32_t slot{ GetEtcPixelSlot(subBlocks[s].pixelIndices[i]) };
+                outBits |= static_cast<uint64_t>(selectors[i] >> 1) << (16 + slot);
+                outBits |= static_cast<uint64_t>(selectors[i] & 1u) << slot;
+            }
+        }
+        return error;
+    }
+
+    void EncodeEtcColorBlock(const uint8_t* pixels, uint8_t* outBlock)
+    {
+        int32_t bestError{ std::numeric_limits<int32_t>::max() };
+        uint64_t bestBits{ 0 };
+
+        for (uint32_t flip = 0; flip < 2; ++flip) {
+            EtcSubBlock subBlocks[2];
+            GetEtcSubBlocks(flip != 0, subBlocks);
+
+            float averages[2][3]{};
+            for (uint32_t s = 0; s < 2; ++s) {
+                for (uint32_t i = 0; i < 8; ++i) {
+                    for (uint32_t c = 0; c < 3; ++c) {
+                        averages[s][c] += pixels[subBlocks[s].pixelIndices[i] * CHANNEL_COUNT + c] / 8.0f;
+                    }
+                }
+            }
+
+            // differential mode - 555 base plus a 333 signed delta
+            int32_t quantized5[2][3];
+            bool differentialFits{ true };
+            for (uint32_t c = 0; c < 3; ++c) {
+                quantized5[0][c] = static_cast<int32_t>(std::lround(averages[0][c] * 31.0f / 255.0f));
+                quantized5[1][c] = static_cast<int32_t>(std::lround(averages[1][c] * 31.0f / 255.0f));
+                const int32_t delta{ quantized5[1][c] - quantized5[0][c] };
+                differentialFits = differentialFits && delta >= -4 && delta <= 3;
+            }
+            if (differentialFits) {
+                const uint8_t baseColors[2][3]{
+                    { Expand5(quantized5[0][0]), Expand5(quantized5[0][1]), Expand5(quantized5[0][2]) },
+                    { Expand5(quantized5[1][0]), Expand5(quantized5[1][1]), Expand5(quantized5[1][2]) }
+                };
+                uint64_t bits{};
+                const int32_t error{ EncodeEtcSubBlocks(pixels, subBlocks, baseColors, bits) };
+                if (error < bestError) {
+                    bestError = error;
+                    bestBits = bits | (1ull << 33) | (static_cast<uint64_t>(flip) << 32);
+                    for (uint32_t c = 0; c < 3; ++c) {
+                        const uint32_t delta{ static_cast<uint32_t>(quantized5[1][c] - quantized5[0][c]) & 0x7u };
+                        bestBits |= static_cast<uint64_t>(quantized5[0][c]) << (59 - 8 * c);
+                        bestBits |= static_cast<uint64_t>(delta) << (56 - 8 * c);
+                    }
+                }
+            }
+
+            // individual mode - two 444 base colors
+            int32_t quantized4[2][3];
+            for (uint32_t s = 0; s < 2; ++s) {
+                for (uint32_t c = 0; c < 3; ++c) {
+                    quantized4[s][c] = static_cast<int32_t>(std::lround(averages[s][c] * 15.0f / 255.0f));
+                }
+            }
+            const uint8_t baseColors[2][3]{
+                { Expand4(quantized4[0][0]), Expand4(quantized4[0][1]), Expand4(quantized4[0][2]) },
+                { Expand4(quantized4[1][0]), Expand4(quantized4[1][1]), Expand4(quantized4[1][2]) }
+            };
+            uint64_t bits{};
+            const int32_t error{ EncodeEtcSubBlocks(pixels, subBlocks, baseColors, bits) };
+            if (error < bestError) {
+                bestError = error;
+                bestBits = bits | (static_cast<uint64_t>(flip) << 32);
+                for (uint32_t c = 0; c < 3; ++c) {
+                    bestBits |= static_cast<uint64_t>(quantized4[0][c]) << (60 - 8 * c);
+                    bestBits |= static_cast<uint64_t>(quantized4[1][c]) << (56 - 8 * c);
+                }
+            }
+        }
+
+        WriteBigEndian(bestBits, outBlock);
+    }
+
+    int32_t FitEacBlock(const uint8_t* pixels, const uint32_t table, const uint32_t multiplier, const int32_t base, const int32_t bestError, uint32_t (&outSelectors)[PIXEL_COUNT])
+    {
+        int32_t error{ 0 };
+        for (uint32_t i = 0; i < PIXEL_COUNT && error < bestError; ++i) {
+            const int32_t alpha{ pixels[i * CHANNEL_COUNT + 3] };
+            int32_t bestDistance{ std::numeric_limits<int32_t>::max() };
+            for (uint32_t selector = 0; selector < 8; ++selector) {
+                const int32_t distance{ Square(ClampByte(base + EAC_MODIFIERS[table][selector] * static_cast<int32_t>(multiplier)) - alpha) };
+                if (distance < bestDistance) {
+                    bestDistance = distance;
+                    outSelectors[i] = selector;
+                }
+            }
+            error += bestDistance;
+        }
+        return error;
+    }
+
+    void EncodeEacAlphaBlock(const uint8_t* pixels, uint8_t* outBlock)
+    {
+        int32_t minAlpha{ 255 }, maxAlpha{ 0 };
+        for (uint32_t i = 0; i < PIXEL_COUNT; ++i) {
+            minAlpha = std::min<int32_t>(minAlpha, pixels[i * CHANNEL_COUNT + 3]);
+            maxAlpha = std::max<int32_t>(maxAlpha, pixels[i * CHANNEL_COUNT + 3]);
+        }
+
+        uint32_t bestTable{ EAC_FLAT_TABLE };
+        uint32_t bestMultiplier{ 1 };
+        int32_t bestBase{ minAlpha };
+        uint32_t bestSelectors[PIXEL_COUNT];
+        std::fill_n(bestSelectors, PIXEL_COUNT, EAC_FLAT_SELECTOR);
+
+        if (minAlpha != maxAlpha) {
+            int32_t bestError{ std::numeric_limits<int32_t>::max() };
+            for (uint32_t table = 0; table < 16; ++table) {
+                const int32_t tableMin{ EAC_MODIFIERS[table][3] };
+                const int32_t tableMax{ EAC_MODIFIERS[table][7] };
+                const int32_t guessMultiplier{ static_cast<int32_t>(std::lround(static_cast<float>(maxAlpha - minAlpha) / (tableMax - tableMin))) };
+                for (int32_t multiplier = std::max(guessMultiplier - 1, 1); multiplier <= std::min(guessMultiplier + 1, 15); ++multiplier) {
+                    const int32_t guessBase{ static_cast<int32_t>(std::lround((minAlpha + maxAlpha) / 2.0f - (tableMin + tableMax) * multiplier / 2.0f)) };
+                    for (int32_t base = std::max(guessBase - 1, 0); base <= std::min(guessBase + 1, 255); ++base) {
+                        uint32_t selectors[PIXEL_COUNT];
+                        const int32_t error{ FitEacBlock(pixels, table, multiplier, base, bestError, selectors) };
+                        if (error < bestError) {
+                            bestError = error;
+                            bestTable = table;
+                            bestMultiplier = multiplier;
+                            bestBase = base;
+                            std::copy_n(selectors, PIXEL_COUNT, bestSelectors);
+                        }
+                    }
+                }
+            }
+        }
+
+        uint64_t bits{ (static_cast<uint64_t>(bestBase) << 56) | (static_cast<uint64_t>(bestMultiplier) << 52) | (static_cast<uint64_t>(bestTable) << 48) };
+        for (uint32_t i = 0; i < PIXEL_COUNT; ++i) {
+            bits |= static_cast<uint64_t>(bestSelectors[i]) << (45 - 3 * GetEtcPixelSlot(i));
+        }
+        WriteBigEndian(bits, outBlock);
+    }
+
+    void DecodeEacAlphaBlock(const uint8_t* block, uint8_t* outPixels)
+    {
+        const uint64_t bits{ ReadBigEndian(block) };
+        const int32_t base{ static_cast<int32_t>((bits >> 56) & 0xFF) };
+        const int32_t multiplier{ static_cast<int32_t>((bits >> 52) & 0xF) };
+        const uint32_t table{ static_cast<uint32_t>((bits >> 48) & 0xF) };
+        for (uint32_t i = 0; i < PIXEL_COUNT; ++i) {
+            const uint32_t selector{ static_cast<uint32_t>((bits >> (45 - 3 * GetEtcPixelSlot(i))) & 0x7) };
+            outPixels[i * CHANNEL_COUNT + 3] = ClampByte(base + EAC_MODIFIERS[table][selector] * multiplier);
+        }
+    }
+} // namespace
+
+void EncodeBC1(const uint8_t* pixels, uint8_t* outBlock)
+{
+    EncodeColorBlock(pixels, outBlock);
+}
+
+void EncodeBC3(const uint8_t* pixels, uint8_t* outBlock)
+{
+    EncodeBC4(pixels, 3, outBlock);
+    EncodeColorBlock(pixels, outBlock + 8);
+}
+
+void EncodeBC4(const uint8_t* pixels, const uint32_t channel, uint8_t* outBlock)
+{
+    uint8_t minValue{ 255 }, maxValue{ 0 };
+    for (uint32_t i = 0; i < PIXEL_COUNT; ++i) {
+        minValue = std::min(minValue, pixels[i * CHANNEL_COUNT + channel]);
+        maxValue = std::max(maxValue, pixels[i * CHANNEL_COUNT + channel]);
+    }
+
+    uint8_t palette[8];
+    BuildSingleChannelPalette(maxValue, minValue, palette);
+
+    uint64_t indices{ 0 };
+    if (minValue != maxValue) {
+        for (uint32_t i = 0; i < PIXEL_COUNT; ++i) {
+            const int32_t value{ pixels[i * CHANNEL_COUNT + channel] };
+            uint32_t bestIndex{ 0 };
+            int32_t bestDistance{ std::numeric_limits<int32_t>::max() };
+            for (uint32_t p = 0; p < 8; ++p) {
+                const int32_t distance{ std::abs(value - palette[p]) };
+                if (distance < bestDistance) {
+                    bestDistance = distance;
+                    bestIndex = p;
+                }
+            }
+            indices |= static_cast<uint64_t>(bestIndex) << (3 * i);
+        }
+    }
+
+    outBlock[0] = maxValue;
+    outBlock[1] = minValue;
+    for (uint32_t i = 0; i < 6; ++i) {
+        outBlock[2 + i] = static_cast<uint8_t>((indices >> (8 * i)) & 0xFF);
+    }
+}
+
+void EncodeBC5(const uint8_t* pixels, uint8_t* outBlock)
+{
+    EncodeBC4(pixels, 0, outBlock);
+    EncodeBC4(pixels, 1, outBlock + 8);
+}
+
+void EncodeBC7(const uint8_t* pixels, uint8_t* outBlock)
+{
+    float minColor[CHANNEL_COUNT], maxColor[CHANNEL_COUNT];
+    FindEndpoints(pixels, CHANNEL_COUNT, minColor, maxColor);
+
+    uint8_t endpoints[2][CHANNEL_COUNT];
+    uint32_t pBits[2]{};
+    QuantizeBC7Endpoint(minColor, endpoints[0], pBits[0]);
+    QuantizeBC7Endpoint(maxColor, endpoints[1], pBits[1]);
+
+    uint8_t palette[16][CHANNEL_COUNT];
+    BuildBC7Palette(endpoints, pBits, palette);
+
+    uint32_t indices[PIXEL_COUNT];
+    for (uint32_t i = 0; i < PIXEL_COUNT; ++i) {
+        int32_t bestDistance{ std::numeric_limits<int32_t>::max() };
+        for (uint32_t p = 0; p < 16; ++p) {
+            const auto distance{ ColorDistance(pixels + i * CHANNEL_COUNT, palette[p], CHANNEL_COUNT) };
+            if (distance < bestDistance) {
+                bestDistance = distance;
+                indices[i] = p;
+            }
+        }
+    }
+
+    // the most significant bit of the first index is implicit zero
+    if (indices[0] & 0x8u) {
+        std::swap(endpoints[0], endpoints[1]);
+        std::swap(pBits[0], pBits[1]);
+        for (auto& index : indices) {
+            index = 15 - index;
+        }
+    }
+
+    std::fill_n(outBlock, 16, uint8_t{ 0 });
+    uint32_t offset{ 0 };
+    WriteBits(outBlock, offset, 1u << 6, 7);
+    for (uint32_t c = 0; c < CHANNEL_COUNT; ++c) {
+        WriteBits(outBlock, offset, endpoints[0][c], 7);
+        WriteBits(outBlock, offset, endpoints[1][c], 7);
+    }
+    WriteBits(outBlock, offset, pBits[0], 1);
+    WriteBits(outBlock, offset, pBits[1], 1);
+    for (uint32_t i = 0; i < PIXEL_COUNT; ++i) {
+        WriteBits(outBlock, offset, indices[i], i == 0 ? 3 : 4);
+    }
+}
+
+void EncodeETC2RGB(const uint8_t* pixels, uint8_t* outBlock)
+{
+    EncodeEtcColorBlock(pixels, outBlock);
+}
+
+void EncodeETC2RGBA(const uint8_t* pixels, uint8_t* outBlock)
+{
+    EncodeEacAlphaBlock(pixels, outBlock);
+    EncodeEtcColorBlock(pixels, outBlock + 8);
+}
+
+void DecodeBC1(const uint8_t* block, uint8_t* outPixels)
+{
+    DecodeColorBlock(block, false, outPixels);
+}
+
+void DecodeBC3(const uint8_t* block, uint8_t* outPixels)
+{
+    DecodeColorBlock(block + 8, true, outPixels);
+    DecodeBC4(block, 3, outPixels);
+}
+
+void DecodeBC4(const uint8_t* block, const uint32_t channel, uint8_t* outPixels)
+{
+    uint8_t palette[8];
+    BuildSingleChannelPalette(block[0], block[1], palette);
+
+    uint64_t indices{ 0 };
+    for (uint32_t i = 0; i < 6; ++i) {
+        indices |= static_cast<uint64_t>(block[2 + i]) << (8 * i);
+    }
+    for (uint32_t i = 0; i < PIXEL_COUNT; ++i) {
+        outPixels[i * CHANNEL_COUNT + channel] = palette[(indices >> (3 * i)) & 0x7u];
+    }
+}
+
+void DecodeBC5(const uint8_t* block, uint8_t* outPixels)
+{
+    for (uint32_t i = 0; i < PIXEL_COUNT; ++i) {
+        outPixels[i * CHANNEL_COUNT + 2] = 0;
+        outPixels[i * CHANNEL_COUNT + 3] = 255;
+    }
+    DecodeBC4(block, 0, outPixels);
+    DecodeBC4(block + 8, 1, outPixels);
+}
+
+bool DecodeBC7(const uint8_t* block, uint8_t* outPixels)
+{
+    if ((block[0] & 0x7Fu) != 0x40u) {
+        return false;
+    }
+
+    uint32_t offset{ 7 };
+    uint8_t endpoints[2][CHANNEL_COUNT];
+    for (uint32_t c = 0; c < CHANNEL_COUNT; ++c) {
+        endpoints[0][c] = static_cast<uint8_t>(ReadBits(block, offset, 7));
+        endpoints[1][c] = static_cast<uint8_t>(ReadBits(block, offset, 7));
+    }
+    const uint32_t pBits[2]{ ReadBits(block, offset, 1), ReadBits(block, offset, 1) };
+
+    uint8_t palette[16][CHANNEL_COUNT];
+    BuildBC7Palette(endpoints, pBits, palette);
+    for (uint32_t i = 0; i < PIXEL_COUNT; ++i) {
+        std::copy_n(palette[ReadBits(block, offset, i == 0 ? 3 : 4)], CHANNEL_COUNT, outPixels + i * CHANNEL_COUNT);
+    }
+    return true;
+}
+
+bool DecodeETC2RGB(const uint8_t* block, uint8_t* outPixels)
+{
+    const uint64_t bits{ ReadBigEndian(block) };
+    const bool differential{ ((bits >> 33) & 1u) != 0 };
+    const bool flip{ ((bits >> 32) & 1u) != 0 };
+
+    uint8_t baseColors[2][3];
+    for (uint32_t c = 0; c < 3; ++c) {
+        if (differential) {
+            const int32_t base{ static_cast<int32_t>((bits >> (59 - 8 * c)) & 0x1F) };
+            const int32_t delta{ (static_cast<int32_t>((bits >> (56 - 8 * c)) & 0x7) ^ 0x4) - 0x4 };
+            if (base + delta < 0 || base + delta > 31) {
+                // the T, H and planar modes are signalled by an overflowing delta
+                return false;
+            }
+            baseColors[0][c] = Expand5(base);
+            baseColors[1][c] = Expand5(base + delta);
+        } else {
+            baseColors[0][c] = Expand4((bits >> (60 - 8 * c)) & 0xF);
+            baseColors[1][c] = Expand4((bits >> (56 - 8 * c)) & 0xF);
+        }
+    }
+    const uint32_t tables[2]{ static_cast<uint32_t>((bits >> 37) & 0x7), static_cast<uint32_t>((bits >> 34) & 0x7) };
+
+    for (uint32_t y = 0; y < 4; ++y) {
+        for (uint32_t x = 0; x < 4; ++x) {
+            const uint32_t subBlock{ flip ? (y >= 2 ? 1u : 0u) : (x >= 2 ? 1u : 0u) };
+            const uint32_t slot{ x * 4 + y };
+            const uint32_t selector{ static_cast<uint32_t>((((bits >> (16 + slot)) & 1u) << 1) | ((bits >> slot) & 1u)) };
+            const int32_t modifier{ GetEtcModifier(tables[subBlock], selector) };
+            uint8_t* pixel{ outPixels + (y * 4 + x) * CHANNEL_COUNT };
+            for (uint32_t c = 0; c < 3; ++c) {
+                pixel[c] = ClampByte(baseColors[subBlock][c] + modifier);
+            }
+            pixel[3] = 255;
+        }
+    }
+    return true;
+}
+
+bool DecodeETC2RGBA(const uint8_t* block, uint8_t* outPixels)
+{
+    if (!DecodeETC2RGB(block + 8, outPixels)) {
+        return false;
+    }
+    DecodeEacAlphaBlock(block, outPixels);
+    return true;
+}
+} // namespace prev::render::image::block
@@ -0,0 +1,46 @@
+#ifndef __BLOCK_COMPRESSION_H__
+#define __BLOCK_COMPRESSION_H__
+
+#include <cinttypes>
+
+namespace prev::render::image::block {
+// Every block covers 4x4 pixels, pixels are passed as 16 tightly packed RGBA8 values in row major order.
+
+// Opaque four color mode.
+void EncodeBC1(const uint8_t* pixels, uint8_t* outBlock);
+
+void EncodeBC3(const uint8_t* pixels, uint8_t* outBlock);
+
+// Encodes a single channel (0 - R, 1 - G, ...) of the pixels.
+void EncodeBC4(const uint8_t* pixels, const uint32_t channel, uint8_t* outBlock);
+
+void EncodeBC5(const uint8_t* pixels, uint8_t* outBlock);
+
+// Mode 6 only - one subset with 4 bit indices and RGBA endpoints.
+void EncodeBC7(const uint8_t* pixels, uint8_t* outBlock);
+
+// Individual and differential modes - the ETC1 compatible subset of ETC2.
+void EncodeETC2RGB(const uint8_t* pixels, uint8_t* outBlock);
+
+// EAC alpha followed by an ETC2 RGB block.
+void EncodeETC2RGBA(const uint8_t* pixels, uint8_t* outBlock);
+
+// Decoders write all four channels, missing channels are set to 0 (alpha to 255).
+// Those returning bool decode only the modes the encoders above emit and return false for the rest.
+void DecodeBC1(const uint8_t* block, uint8_t* outPixels);
+
+void DecodeBC3(const uint8_t* block, uint8_t* outPixels);
+
+// Writes only the given channel.
+void DecodeBC4(const uint8_t* block, const uint32_t channel, uint8_t* outPixels);
+
+void DecodeBC5(const uint8_t* block, uint8_t* outPixels);
+
+bool DecodeBC7(const uint8_t* block, uint8_t* outPixels);
+
+bool DecodeETC2RGB(const uint8_t* block, uint8_t* outPixels);
+
+bool DecodeETC2RGBA(const uint8_t* block, uint8_t* outPixels);
+} // namespace prev::render::image::block
+
+#endif // !__BLOCK_COMPRESSION_H__
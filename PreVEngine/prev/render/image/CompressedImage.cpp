@@ -0,0 +1,110 @@
+#include "CompressedImage.h"
+
+#include <stdexcept>
+#include <string>
+
+namespace prev::render::image {
+CompressedImage::CompressedImage(const CompressedImageFormat format, const bool srgb, std::vector<CompressedImageLevel>&& levels)
+    : m_format{ format }
+    , m_srgb{ srgb }
+    , m_levels{ std::move(levels) }
+{
+    if (m_format == CompressedImageFormat::UNKNOWN) {
+        throw std::invalid_argument("Compressed image format must be known.");
+    }
+
+    if (m_levels.empty()) {
+        throw std::invalid_argument("Compressed image must have at least one level.");
+    }
+
+    for (const auto& level : m_levels) {
+        if (level.width == 0 || level.height == 0) {
+            throw std::invalid_argument("Compressed image dimensions must be positive.");
+        }
+        if (level.data.size() != GetLevelByteSize(m_format, level.width, level.height)) {
+            throw std::invalid_argument("Compressed image level has invalid size: " + std::to_string(level.data.size()));
+        }
+    }
+}
+
+CompressedImageFormat CompressedImage::GetFormat() const
+{
+    return m_format;
+}
+
+bool CompressedImage::IsSrgb() const
+{
+    return m_srgb;
+}
+
+uint32_t CompressedImage::GetWidth() const
+{
+    return m_levels.front().width;
+}
+
+uint32_t CompressedImage::GetHeight() const
+{
+    return m_levels.front().height;
+}
+
+uint32_t CompressedImage::GetLevelCount() const
+{
+    return static_cast<uint32_t>(m_levels.size());
+}
+
+const CompressedImageLevel& CompressedImage::GetLevel(const uint32_t level) const
+{
+    return m_levels.at(level);
+}
+
+uint64_t CompressedImage::GetSize() const
+{
+    uint64_t size{ 0 };
+    for (const auto& level : m_levels) {
+        size += level.data.size();
+    }
+    return size;
+}
+
+uint32_t CompressedImage::GetBlockByteSize(const CompressedImageFormat format)
+{
+    switch (format) {
+    case CompressedImageFormat::BC1_RGBA:
+    case CompressedImageFormat::BC4_R:
+    case CompressedImageFormat::ETC2_RGB8:
+        return 8;
+    case CompressedImageFormat::BC3_RGBA:
+    case CompressedImageFormat::BC5_RG:
+    case CompressedImageFormat::BC7_RGBA:
+    case CompressedImageFormat::ETC2_RGBA8:
+    case CompressedImageFormat::ASTC_4x4_RGBA:
+        return 16;
+    default:
+        return 0;
+    }
+}
+
+uint32_t CompressedImage::GetBlockCount(const uint32_t size)
+{
+    return (size + BLOCK_SIZE - 1) / BLOCK_SIZE;
+}
+
+uint64_t CompressedImage::GetLevelByteSize(const CompressedImageFormat format, const uint32_t width, const uint32_t height)
+{
+    return static_cast<uint64_t>(GetBlockCount(width)) * GetBlockCount(height) * GetBlockByteSize(format);
+}
+
+bool CompressedImage::HasAlpha(const CompressedImageFormat format)
+{
+    // BC1 is cooked in its opaque four color mode only
+    switch (format) {
+    case CompressedImageFormat::BC3_RGBA:
+    case CompressedImageFormat::BC7_RGBA:
+    case CompressedImageFormat::ETC2_RGBA8:
+    case CompressedImageFormat::ASTC_4x4_RGBA:
+        return true;
+    default:
+        return false;
+    }
+}
+} // namespace prev::render::image
@@ -0,0 +1,72 @@
+#ifndef __COMPRESSED_IMAGE_H__
+#define __COMPRESSED_IMAGE_H__
+
+#include <cinttypes>
+#include <vector>
+
+namespace prev::render::image {
+// All supported formats use 4x4 pixel blocks.
+enum class CompressedImageFormat {
+    UNKNOWN,
+    BC1_RGBA,
+    BC3_RGBA,
+    BC4_R,
+    BC5_RG,
+    BC7_RGBA,
+    ETC2_RGB8,
+    ETC2_RGBA8,
+    ASTC_4x4_RGBA,
+};
+
+struct CompressedImageLevel {
+    uint32_t width{};
+
+    uint32_t height{};
+
+    std::vector<uint8_t> data{};
+};
+
+// Block compressed image with its whole mip chain, level 0 is the largest one.
+class CompressedImage final {
+public:
+    static constexpr uint32_t BLOCK_SIZE{ 4 };
+
+public:
+    CompressedImage(const CompressedImageFormat format, const bool srgb, std::vector<CompressedImageLevel>&& levels);
+
+    ~CompressedImage() = default;
+
+public:
+    CompressedImageFormat GetFormat() const;
+
+    bool IsSrgb() const;
+
+    uint32_t GetWidth() const;
+
+    uint32_t GetHeight() const;
+
+    uint32_t GetLevelCount() const;
+
+    const CompressedImageLevel& GetLevel(const uint32_t level) const;
+
+    uint64_t GetSize() const;
+
+public:
+    static uint32_t GetBlockByteSize(const CompressedImageFormat format);
+
+    static uint32_t GetBlockCount(const uint32_t size);
+
+    static uint64_t GetLevelByteSize(const CompressedImageFormat format, const uint32_t width, const uint32_t height);
+
+    static bool HasAlpha(const CompressedImageFormat format);
+
+private:
+    CompressedImageFormat m_format;
+
+    bool m_srgb;
+
+    std::vector<CompressedImageLevel> m_levels;
+};
+} // namespace prev::render::image
+
+#endif // !__COMPRESSED_IMAGE_H__
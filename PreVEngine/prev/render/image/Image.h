@@ -5,8 +5,13 @@
 #include "ImageFormat.h"
 #include "Pixel.h"
 
+#include <algorithm>
+#include <cstring>
+#include <functional>
+#include <memory>
 #include <stdexcept>
-#include <vector>
+#include <type_traits>
+#include <utility>
 
 namespace prev::render::image {
 
@@ -15,27 +20,35 @@ class Image : public IImage {
 public:
     using PixelType = Pixel<T, Channels>;
 
+    // Releases an adopted buffer - e.g. stbi_image_free, an unmap, or a no-op for a view into memory owned elsewhere.
+    using Deleter = std::function<void(T*)>;
+
+    // Pixels are read straight from adopted buffers, which relies on Pixel being a plain array of channels.
+    static_assert(sizeof(PixelType) == sizeof(T) * Channels, "Pixel must be tightly packed.");
+
     Image()
         : m_width(0)
         , m_height(0)
-        , m_pixels()
+        , m_pixels(nullptr, DeleteOwnedPixels)
     {
     }
 
     Image(uint32_t width, uint32_t height)
         : m_width(width)
         , m_height(height)
-        , m_pixels(width * height)
+        , m_pixels(nullptr, DeleteOwnedPixels)
     {
         if (width == 0 || height == 0) {
             throw std::invalid_argument("Image dimensions must be positive.");
         }
+
+        m_pixels = AllocatePixels(GetPixelCount(), true);
     }
 
     Image(uint32_t width, uint32_t height, const T* data)
         : m_width(width)
         , m_height(height)
-        , m_pixels(width * height)
+        , m_pixels(nullptr, DeleteOwnedPixels)
     {
         if (width == 0 || height == 0) {
             throw std::invalid_argument("Image dimensions must be positive.");
@@ -45,18 +58,75 @@ public:
             throw std::invalid_argument("Image data cannot be null.");
         }
 
-        for (size_t i = 0; i < m_pixels.size(); ++i) {
-            m_pixels[i] = PixelType(data + i * Channels);
+        m_pixels = AllocatePixels(GetPixelCount(), false);
+        std::memcpy(GetRawData(), data, GetPixelCount() * sizeof(PixelType));
+    }
+
+    // Adopts tightly packed pixel data without copying it, the deleter is called once the image is destroyed.
+    Image(uint32_t width, uint32_t height, T* data, Deleter deleter)
+        : m_width(width)
+        , m_height(height)
+        , m_pixels(nullptr, DeleteOwnedPixels)
+    {
+        if (width == 0 || height == 0) {
+            throw std::invalid_argument("Image dimensions must be positive.");
         }
+
+        if (data == nullptr) {
+            throw std::invalid_argument("Image data cannot be null.");
+        }
+
+        m_pixels = PixelBuffer(reinterpret_cast<PixelType*>(data), [deleter = std::move(deleter)](PixelType* pixels) {
+            if (deleter) {
+                deleter(reinterpret_cast<T*>(pixels));
+            }
+        });
     }
 
     ~Image() = default;
 
-    Image(const Image&) = default;
-    Image& operator=(const Image&) = default;
+    Image(const Image& other)
+        : Image()
+    {
+        *this = other;
+    }
+
+    Image& operator=(const Image& other)
+    {
+        if (this == &other) {
+            return *this;
+        }
+
+        // copies always own their pixels, an adopted buffer stays with its original image
+        PixelBuffer pixels{ nullptr, DeleteOwnedPixels };
+        if (other.m_pixels) {
+            pixels = AllocatePixels(other.GetPixelCount(), false);
+            std::memcpy(pixels.get(), other.m_pixels.get(), other.GetPixelCount() * sizeof(PixelType));
+        }
+        m_width = other.m_width;
+        m_height = other.m_height;
+        m_pixels = std::move(pixels);
+        return *this;
+    }
+
+    Image(Image&& other) noexcept
+        : m_width(std::exchange(other.m_width, 0))
+        , m_height(std::exchange(other.m_height, 0))
+        , m_pixels(std::move(other.m_pixels))
+    {
+    }
+
+    Image& operator=(Image&& other) noexcept
+    {
+        if (this == &other) {
+            return *this;
+        }
 
-    Image(Image&&) noexcept = default;
-    Image& operator=(Image&&) noexcept = default;
+        m_width = std::exchange(other.m_width, 0);
+        m_height = std::exchange(other.m_height, 0);
+        m_pixels = std::move(other.m_pixels);
+        return *this;
+    }
 
 public:
     uint32_t GetWidth() const override
@@ -76,7 +146,7 @@ public:
 
     uint32_t GetSize() const override
     {
-        return static_cast<uint32_t>(m_pixels.size());
+        return static_cast<uint32_t>(GetPixelCount());
     }
 
     uint32_t GetPixelSize() const override
@@ -106,7 +176,7 @@ public:
 
     T* GetRawData()
     {
-        if (m_pixels.empty()) {
+        if (!m_pixels) {
             return nullptr;
         }
         return m_pixels[0].data.data();
@@ -114,7 +184,7 @@ public:
 
     const T* GetRawData() const
     {
-        if (m_pixels.empty()) {
+        if (!m_pixels) {
             return nullptr;
         }
         return m_pixels[0].data.data();
@@ -144,33 +214,95 @@ public:
         if (newWidth == m_width && newHeight == m_height) {
             return; // No change needed
         }
+
+        // keeps the leading pixels like a vector resize would
+        const size_t newPixelCount{ static_cast<size_t>(newWidth) * newHeight };
+        PixelBuffer pixels{ AllocatePixels(newPixelCount, true) };
+        if (m_pixels) {
+            std::memcpy(pixels.get(), m_pixels.get(), std::min(newPixelCount, GetPixelCount()) * sizeof(PixelType));
+        }
         m_width = newWidth;
         m_height = newHeight;
-        m_pixels.resize(m_width * m_height);
+        m_pixels = std::move(pixels);
     }
 
     void Clear(const PixelType& clearColor = PixelType())
     {
-        std::fill(m_pixels.begin(), m_pixels.end(), clearColor);
+        std::fill(m_pixels.get(), m_pixels.get() + GetPixelCount(), clearColor);
     }
 
     // Function to convert to a different image type (e.g., 8-bit RGB to float RGB)
+    // Channels missing in the source are zeroed, extra ones are dropped.
     template <typename TargetT, size_t TargetChannels = Channels>
     Image<TargetT, TargetChannels> Convert() const
     {
-        Image<TargetT, TargetChannels> newImage(m_width, m_height);
-        for (size_t i = 0; i < m_pixels.size(); ++i) {
-            newImage.m_pixels[i] = m_pixels[i].template ConvertTo<TargetT>();
+        Image<TargetT, TargetChannels> newImage(m_width, m_height, typename Image<TargetT, TargetChannels>::AllocateUninitialized{});
+
+        const size_t pixelCount{ GetPixelCount() };
+        const T* src{ GetRawData() };
+        TargetT* dst{ newImage.GetRawData() };
+        if constexpr (std::is_same_v<T, TargetT> && Channels == TargetChannels) {
+            std::memcpy(dst, src, pixelCount * sizeof(PixelType));
+        } else if constexpr (Channels == TargetChannels) {
+            // one flat loop over all components, simple enough for the compiler to vectorize
+            for (size_t i = 0; i < pixelCount * Channels; ++i) {
+                dst[i] = static_cast<TargetT>(src[i]);
+            }
+        } else {
+            constexpr size_t CommonChannels{ std::min(Channels, TargetChannels) };
+            for (size_t i = 0; i < pixelCount; ++i) {
+                for (size_t c = 0; c < CommonChannels; ++c) {
+                    dst[i * TargetChannels + c] = static_cast<TargetT>(src[i * Channels + c]);
+                }
+                for (size_t c = CommonChannels; c < TargetChannels; ++c) {
+                    dst[i * TargetChannels + c] = TargetT{};
+                }
+            }
         }
         return newImage;
     }
 
 private:
+    using PixelBuffer = std::unique_ptr<PixelType[], std::function<void(PixelType*)>>;
+
+    struct AllocateUninitialized {
+    };
+
+    // Conversions overwrite every pixel, so they skip zeroing the buffer.
+    Image(uint32_t width, uint32_t height, AllocateUninitialized)
+        : m_width(width)
+        , m_height(height)
+        , m_pixels(AllocatePixels(GetPixelCount(), false))
+    {
+    }
+
+    // Owned pixels are allocated as plain components, zeroing matches a default constructed Pixel
+    // and is skipped when the buffer gets overwritten right away.
+    static PixelBuffer AllocatePixels(const size_t pixelCount, const bool zeroed)
+    {
+        T* data{ zeroed ? new T[pixelCount * Channels]() : new T[pixelCount * Channels] };
+        return PixelBuffer(reinterpret_cast<PixelType*>(data), DeleteOwnedPixels);
+    }
+
+    static void DeleteOwnedPixels(PixelType* pixels)
+    {
+        delete[] reinterpret_cast<T*>(pixels);
+    }
+
+    size_t GetPixelCount() const
+    {
+        return static_cast<size_t>(m_width) * m_height;
+    }
+
+private:
+    template <typename, size_t>
+    friend class Image;
+
     uint32_t m_width;
 
     uint32_t m_height;
 
-    std::vector<PixelType> m_pixels;
+    PixelBuffer m_pixels;
 };
 } // namespace prev::render::image
 
@@ -1,5 +1,6 @@
 #include "ImageFactory.h"
 #include "Image.h"
+#include "Ktx2Serializer.h"
 
 #include "../../common/Logger.h"
 #include "../../util/Utils.h"
@@ -9,28 +10,47 @@
 
 namespace prev::render::image {
 namespace {
-    template <typename T, size_t Channels>
-    std::unique_ptr<Image<T, Channels>> CreateImageFromData(const uint32_t width, const uint32_t height, const uint8_t* data)
+    template <size_t Channels>
+    std::unique_ptr<Image<uint8_t, Channels>> CreateImageFromStbData(const uint32_t width, const uint32_t height, uint8_t* data)
     {
         if (!data) {
             LOGE("Image: Failed to create image from data: data is null");
             return nullptr;
         }
 
-        return std::make_unique<Image<T, Channels>>(width, height, data);
+        // the image takes over the decoded buffer instead of copying it
+        return std::make_unique<Image<uint8_t, Channels>>(width, height, data, [](uint8_t* pixels) { stbi_image_free(pixels); });
     }
 
-    std::unique_ptr<IImage> CreateUint8ImageFromData(const uint32_t width, const uint32_t height, const uint32_t channelCount, const uint8_t* data)
+    std::unique_ptr<IImage> CreateUint8ImageFromStbData(const uint32_t width, const uint32_t height, const uint32_t channelCount, uint8_t* data)
     {
         switch (channelCount) {
         case 1:
-            return CreateImageFromData<uint8_t, 1>(width, height, data);
+            return CreateImageFromStbData<1>(width, height, data);
         case 2:
-            return CreateImageFromData<uint8_t, 2>(width, height, data);
+            return CreateImageFromStbData<2>(width, height, data);
         case 3:
-            return CreateImageFromData<uint8_t, 3>(width, height, data);
+            return CreateImageFromStbData<3>(width, height, data);
         case 4:
-            return CreateImageFromData<uint8_t, 4>(width, height, data);
+            return CreateImageFromStbData<4>(width, height, data);
+        default:
+            LOGE("Image: Unsupported channel count: %u", channelCount);
+            stbi_image_free(data);
+            return nullptr;
+        }
+    }
+
+    std::unique_ptr<IImage> CreateUint8Image(const uint32_t width, const uint32_t height, const uint32_t channelCount)
+    {
+        switch (channelCount) {
+        case 1:
+            return std::make_unique<Image<uint8_t, 1>>(width, height);
+        case 2:
+            return std::make_unique<Image<uint8_t, 2>>(width, height);
+        case 3:
+            return std::make_unique<Image<uint8_t, 3>>(width, height);
+        case 4:
+            return std::make_unique<Image<uint8_t, 4>>(width, height);
         default:
             LOGE("Image: Unsupported channel count: %u", channelCount);
             return nullptr;
@@ -60,12 +80,10 @@ std::unique_ptr<IImage> ImageFactory::CreateImage(const std::string& filename, b
         return nullptr;
     }
 
-    auto image = CreateUint8ImageFromData(width, height, ouputChannelCount, imageBytes);
+    auto image = CreateUint8ImageFromStbData(width, height, ouputChannelCount, imageBytes);
 
     LOGI("Loaded image: %s (%dx%d|%d)", filename.c_str(), width, height, ouputChannelCount);
 
-    stbi_image_free(imageBytes);
-
     return image;
 }
 
@@ -85,12 +103,10 @@ std::unique_ptr<IImage> ImageFactory::CreateImageFromMemory(const uint8_t* data,
         return nullptr;
     }
 
-    auto image = CreateUint8ImageFromData(width, height, ouputChannelCount, imageBytes);
+    auto image = CreateUint8ImageFromStbData(width, height, ouputChannelCount, imageBytes);
 
     LOGI("Loaded image from memory: %u bytes (%dx%d|%d)", dataLength, width, height, ouputChannelCount);
 
-    stbi_image_free(imageBytes);
-
     return image;
 }
 
@@ -132,7 +148,12 @@ std::unique_ptr<IImage> ImageFactory::CreateResizedImage(const IImage& source, c
     const uint32_t channels = source.GetChannels();
     const uint8_t* src = source.GetRawDataPtr();
 
-    std::vector<uint8_t> resized(newWidth * newHeight * channels);
+    auto image = CreateUint8Image(newWidth, newHeight, channels);
+    if (!image) {
+        return nullptr;
+    }
+
+    uint8_t* resized = image->GetRawDataPtr();
     for (uint32_t y = 0; y < newHeight; ++y) {
         for (uint32_t x = 0; x < newWidth; ++x) {
             const float srcX = static_cast<float>(x) * (srcW - 1) / static_cast<float>(newWidth - 1);
@@ -158,6 +179,27 @@ std::unique_ptr<IImage> ImageFactory::CreateResizedImage(const IImage& source, c
         }
     }
 
-    return CreateUint8ImageFromData(newWidth, newHeight, channels, resized.data());
+    return image;
+}
+
+std::unique_ptr<CompressedImage> ImageFactory::CreateCompressedImage(const std::string& filename) const
+{
+    if (!prev::util::file::Exists(filename)) {
+        LOGE("Image: File not found: %s", filename.c_str());
+        return nullptr;
+    }
+
+    LOGI("Loading compressed image: %s...", filename.c_str());
+
+    const auto data{ prev::util::file::ReadBinaryFile(filename) };
+    auto image{ Ktx2Serializer{}.Deserialize(reinterpret_cast<const uint8_t*>(data.data()), data.size()) };
+    if (!image) {
+        LOGE("Image: Failed to load compressed image: %s", filename.c_str());
+        return nullptr;
+    }
+
+    LOGI("Loaded compressed image: %s (%ux%u|%u levels)", filename.c_str(), image->GetWidth(), image->GetHeight(), image->GetLevelCount());
+
+    return image;
 }
 } // namespace prev::render::image
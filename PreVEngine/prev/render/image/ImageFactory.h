@@ -1,6 +1,7 @@
 #ifndef __IMAGE_FACTORY_H__
 #define __IMAGE_FACTORY_H__
 
+#include "CompressedImage.h"
 #include "IImage.h"
 #include "Pixel.h"
 
@@ -19,6 +20,9 @@ public:
     std::unique_ptr<IImage> CreateImageWithColor(const uint32_t width, const uint32_t height, const Pixel<uint8_t, 4>& color) const;
 
     std::unique_ptr<IImage> CreateResizedImage(const IImage& source, const uint32_t newWidth, const uint32_t newHeight) const;
+
+    // Loads a cooked KTX2 image with all its mip levels, the blocks are kept compressed.
+    std::unique_ptr<CompressedImage> CreateCompressedImage(const std::string& filename) const;
 };
 } // namespace prev::render::image
 
@@ -0,0 +1,261 @@
+#include "Ktx2Serializer.h"
+
+#include "../../common/Logger.h"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+
+namespace prev::render::image {
+namespace {
+    constexpr uint8_t KTX2_IDENTIFIER[12]{ 0xAB, 0x4B, 0x54, 0x58, 0x20, 0x32, 0x30, 0xBB, 0x0D, 0x0A, 0x1A, 0x0A };
+
+    // identifier, header and index
+    constexpr size_t HEADER_SIZE{ 80 };
+
+    constexpr size_t LEVEL_INDEX_ENTRY_SIZE{ 24 };
+
+    constexpr uint32_t DFD_CHANNEL_ALPHA{ 15 };
+
+    constexpr uint32_t DFD_TRANSFER_LINEAR{ 1 };
+
+    constexpr uint32_t DFD_TRANSFER_SRGB{ 2 };
+
+    constexpr uint32_t DFD_PRIMARIES_BT709{ 1 };
+
+    struct FormatInfo {
+        CompressedImageFormat format{};
+
+        uint32_t vkFormat{};
+
+        uint32_t vkFormatSrgb{};
+
+        uint32_t colorModel{};
+
+        // channel id of every 64 bit half of the block, the first one describes the first half
+        std::vector<uint32_t> channels{};
+    };
+
+    const std::vector<FormatInfo>& GetFormatInfos()
+    {
+        static const std::vector<FormatInfo> infos{
+            { CompressedImageFormat::BC1_RGBA, 133, 134, 128, { 1 } },
+            { CompressedImageFormat::BC3_RGBA, 137, 138, 130, { DFD_CHANNEL_ALPHA, 0 } },
+            { CompressedImageFormat::BC4_R, 139, 0, 131, { 0 } },
+            { CompressedImageFormat::BC5_RG, 141, 0, 132, { 0, 1 } },
+            { CompressedImageFormat::BC7_RGBA, 145, 146, 134, { 0 } },
+            { CompressedImageFormat::ETC2_RGB8, 147, 148, 161, { 2 } },
+            { CompressedImageFormat::ETC2_RGBA8, 151, 152, 161, { DFD_CHANNEL_ALPHA, 2 } },
+            { CompressedImageFormat::ASTC_4x4_RGBA, 157, 158, 162, { 0 } },
+        };
+        return infos;
+    }
+
+    const FormatInfo* FindFormatInfo(const CompressedImageFormat format)
+    {
+        for (const auto& info : GetFormatInfos()) {
+            if (info.format == format) {
+                return &info;
+            }
+        }
+        return nullptr;
+    }
+
+    const FormatInfo* FindFormatInfo(const uint32_t vkFormat, bool& outSrgb)
+    {
+        // BC1 without alpha decodes the same way
+        constexpr uint32_t VK_FORMAT_BC1_RGB_UNORM{ 131 };
+        constexpr uint32_t VK_FORMAT_BC1_RGB_SRGB{ 132 };
+        if (vkFormat == VK_FORMAT_BC1_RGB_UNORM || vkFormat == VK_FORMAT_BC1_RGB_SRGB) {
+            outSrgb = vkFormat == VK_FORMAT_BC1_RGB_SRGB;
+            return FindFormatInfo(CompressedImageFormat::BC1_RGBA);
+        }
+
+        for (const auto& info : GetFormatInfos()) {
+            if (info.vkFormat == vkFormat || (info.vkFormatSrgb != 0 && info.vkFormatSrgb == vkFormat)) {
+                outSrgb = info.vkFormatSrgb == vkFormat;
+                return &info;
+            }
+        }
+        return nullptr;
+    }
+
+    size_t Align(const size_t value, const size_t alignment)
+    {
+        return (value + alignment - 1) / alignment * alignment;
+    }
+
+    template <typename T>
+    void Write(std::vector<uint8_t>& data, const size_t offset, const T value)
+    {
+        // KTX2 is little endian, as are all supported platforms
+        std::memcpy(data.data() + offset, &value, sizeof(T));
+    }
+
+    template <typename T>
+    T Read(const uint8_t* data, const size_t offset)
+    {
+        T value;
+        std::memcpy(&value, data + offset, sizeof(T));
+        return value;
+    }
+
+    std::vector<uint8_t> CreateDataFormatDescriptor(const FormatInfo& info, const bool srgb)
+    {
+        const uint32_t sampleCount{ static_cast<uint32_t>(info.channels.size()) };
+        const uint32_t blockSize{ 24 + 16 * sampleCount };
+        const uint32_t blockByteSize{ CompressedImage::GetBlockByteSize(info.format) };
+        const uint32_t sampleBitLength{ blockByteSize * 8 / sampleCount };
+
+        std::vector<uint8_t> dfd(4 + blockSize);
+        Write<uint32_t>(dfd, 0, static_cast<uint32_t>(dfd.size()));
+        // vendor KHRONOS, descriptor type basic
+        Write<uint32_t>(dfd, 4, 0);
+        // version 2
+        Write<uint32_t>(dfd, 8, 2 | (blockSize << 16));
+        Write<uint32_t>(dfd, 12, info.colorModel | (DFD_PRIMARIES_BT709 << 8) | ((srgb ? DFD_TRANSFER_SRGB : DFD_TRANSFER_LINEAR) << 16));
+        // texel block dimensions minus one
+        Write<uint32_t>(dfd, 16, (CompressedImage::BLOCK_SIZE - 1) | ((CompressedImage::BLOCK_SIZE - 1) << 8));
+        Write<uint32_t>(dfd, 20, blockByteSize);
+        Write<uint32_t>(dfd, 24, 0);
+        for (uint32_t i = 0; i < sampleCount; ++i) {
+            const size_t offset{ 28 + 16 * static_cast<size_t>(i) };
+            Write<uint32_t>(dfd, offset, (i * sampleBitLength) | ((sampleBitLength - 1) << 16) | (info.channels[i] << 24));
+            Write<uint32_t>(dfd, offset + 4, 0);
+            Write<uint32_t>(dfd, offset + 8, 0);
+            Write<uint32_t>(dfd, offset + 12, 0xFFFFFFFFu);
+        }
+        return dfd;
+    }
+} // namespace
+
+std::vector<uint8_t> Ktx2Serializer::Serialize(const CompressedImage& image) const
+{
+    const auto info{ FindFormatInfo(image.GetFormat()) };
+    const bool srgb{ image.IsSrgb() && info->vkFormatSrgb != 0 };
+    const auto dfd{ CreateDataFormatDescriptor(*info, srgb) };
+    const uint32_t levelCount{ image.GetLevelCount() };
+    const size_t dfdOffset{ HEADER_SIZE + LEVEL_INDEX_ENTRY_SIZE * levelCount };
+    const size_t levelAlignment{ CompressedImage::GetBlockByteSize(image.GetFormat()) };
+
+    // levels are stored from the smallest one
+    std::vector<size_t> levelOffsets(levelCount);
+    size_t size{ dfdOffset + dfd.size() };
+    for (uint32_t level = levelCount; level-- > 0;) {
+        size = Align(size, levelAlignment);
+        levelOffsets[level] = size;
+        size += image.GetLevel(level).data.size();
+    }
+
+    std::vector<uint8_t> data(size);
+    std::memcpy(data.data(), KTX2_IDENTIFIER, sizeof(KTX2_IDENTIFIER));
+    Write<uint32_t>(data, 12, srgb ? info->vkFormatSrgb : info->vkFormat);
+    // type size
+    Write<uint32_t>(data, 16, 1);
+    Write<uint32_t>(data, 20, image.GetWidth());
+    Write<uint32_t>(data, 24, image.GetHeight());
+    // depth, layer count, face count
+    Write<uint32_t>(data, 28, 0);
+    Write<uint32_t>(data, 32, 0);
+    Write<uint32_t>(data, 36, 1);
+    Write<uint32_t>(data, 40, levelCount);
+    // supercompression scheme
+    Write<uint32_t>(data, 44, 0);
+    Write<uint32_t>(data, 48, static_cast<uint32_t>(dfdOffset));
+    Write<uint32_t>(data, 52, static_cast<uint32_t>(dfd.size()));
+    // no key/value or supercompression global data
+    Write<uint32_t>(data, 56, 0);
+    Write<uint32_t>(data, 60, 0);
+    Write<uint64_t>(data, 64, 0);
+    Write<uint64_t>(data, 72, 0);
+
+    for (uint32_t level = 0; level < levelCount; ++level) {
+        const auto& levelData{ image.GetLevel(level).data };
+        const size_t entryOffset{ HEADER_SIZE + LEVEL_INDEX_ENTRY_SIZE * level };
+        Write<uint64_t>(data, entryOffset, levelOffsets[level]);
+        Write<uint64_t>(data, entryOffset + 8, levelData.size());
+        Write<uint64_t>(data, entryOffset + 16, levelData.size());
+        std::memcpy(data.data() + levelOffsets[level], levelData.data(), levelData.size());
+    }
+
+    std::memcpy(data.data() + dfdOffset, dfd.data(), dfd.size());
+    return data;
+}
+
+std::unique_ptr<CompressedImage> Ktx2Serializer::Deserialize(const uint8_t* data, const size_t size) const
+{
+    if (!data || size < HEADER_SIZE || std::memcmp(data, KTX2_IDENTIFIER, sizeof(KTX2_IDENTIFIER)) != 0) {
+        LOGE("KTX2: Invalid identifier");
+        return nullptr;
+    }
+
+    const auto vkFormat{ Read<uint32_t>(data, 12) };
+    const auto width{ Read<uint32_t>(data, 20) };
+    const auto height{ Read<uint32_t>(data, 24) };
+    const auto depth{ Read<uint32_t>(data, 28) };
+    const auto layerCount{ Read<uint32_t>(data, 32) };
+    const auto faceCount{ Read<uint32_t>(data, 36) };
+    const auto levelCount{ std::max(Read<uint32_t>(data, 40), 1u) };
+    const auto supercompressionScheme{ Read<uint32_t>(data, 44) };
+
+    if (width == 0 || height == 0 || depth > 1 || layerCount > 1 || faceCount != 1 || supercompressionScheme != 0) {
+        LOGE("KTX2: Only single layer 2D images without supercompression are supported");
+        return nullptr;
+    }
+
+    // a full mip chain ends at 1x1, anything longer is a corrupted header
+    uint32_t maxLevelCount{ 1 };
+    for (uint32_t dimension = std::max(width, height); dimension > 1; dimension >>= 1) {
+        ++maxLevelCount;
+    }
+
+    if (levelCount > maxLevelCount) {
+        LOGE("KTX2: Level count %u exceeds the full mip chain of %ux%u", levelCount, width, height);
+        return nullptr;
+    }
+
+    bool srgb{ false };
+    const auto info{ FindFormatInfo(vkFormat, srgb) };
+    if (!info) {
+        LOGE("KTX2: Unsupported vkFormat: %u", vkFormat);
+        return nullptr;
+    }
+
+    if (size < HEADER_SIZE + LEVEL_INDEX_ENTRY_SIZE * static_cast<size_t>(levelCount)) {
+        LOGE("KTX2: Truncated level index");
+        return nullptr;
+    }
+
+    std::vector<CompressedImageLevel> levels;
+    levels.reserve(levelCount);
+    for (uint32_t level = 0; level < levelCount; ++level) {
+        const size_t entryOffset{ HEADER_SIZE + LEVEL_INDEX_ENTRY_SIZE * level };
+        const auto byteOffset{ Read<uint64_t>(data, entryOffset) };
+        const auto byteLength{ Read<uint64_t>(data, entryOffset + 8) };
+
+        CompressedImageLevel compressedLevel{ std::max(width >> level, 1u), std::max(height >> level, 1u) };
+        if (byteLength != CompressedImage::GetLevelByteSize(info->format, compressedLevel.width, compressedLevel.height) || byteOffset > size || byteLength > size - byteOffset) {
+            LOGE("KTX2: Invalid level %u", level);
+            return nullptr;
+        }
+
+        compressedLevel.data.assign(data + byteOffset, data + byteOffset + byteLength);
+        levels.push_back(std::move(compressedLevel));
+    }
+
+    return std::make_unique<CompressedImage>(info->format, srgb, std::move(levels));
+}
+
+bool Ktx2Serializer::Save(const CompressedImage& image, const std::string& filename) const
+{
+    const auto data{ Serialize(image) };
+
+    std::ofstream file{ filename, std::ios::binary };
+    if (!file) {
+        LOGE("KTX2: Could not open file for writing: %s", filename.c_str());
+        return false;
+    }
+    file.write(reinterpret_cast<const char*>(data.data()), static_cast<std::streamsize>(data.size()));
+    return static_cast<bool>(file);
+}
+} // namespace prev::render::image
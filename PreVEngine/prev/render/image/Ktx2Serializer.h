@@ -0,0 +1,28 @@
+#ifndef __KTX2_SERIALIZER_H__
+#define __KTX2_SERIALIZER_H__
+
+#include "CompressedImage.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace prev::render::image {
+// Reads and writes single layer 2D KTX2 containers without supercompression.
+class Ktx2Serializer final {
+public:
+    Ktx2Serializer() = default;
+
+    ~Ktx2Serializer() = default;
+
+public:
+    std::vector<uint8_t> Serialize(const CompressedImage& image) const;
+
+    // Returns nullptr for malformed files and for layouts or formats that are not supported.
+    std::unique_ptr<CompressedImage> Deserialize(const uint8_t* data, const size_t size) const;
+
+    bool Save(const CompressedImage& image, const std::string& filename) const;
+};
+} // namespace prev::render::image
+
+#endif // !__KTX2_SERIALIZER_H__
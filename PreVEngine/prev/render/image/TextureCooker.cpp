@@ -0,0 +1,298 @@
+#include "TextureCooker.h"
+#include "BlockCompression.h"
+#include "Image.h"
+
+#include "../../common/Logger.h"
+#include "../../util/ColorSpace.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <future>
+
+namespace prev::render::image {
+namespace {
+    constexpr uint32_t RGBA_CHANNEL_COUNT{ 4 };
+
+    const std::array<float, 256>& GetSrgbToLinearTable()
+    {
+        static const std::array<float, 256> table{ [] {
+            std::array<float, 256> values{};
+            for (uint32_t i = 0; i < values.size(); ++i) {
+                values[i] = prev::util::color::SrgbToLinear(i / 255.0f);
+            }
+            return values;
+        }() };
+        return table;
+    }
+
+    uint8_t ToByte(const float value)
+    {
+        return static_cast<uint8_t>(std::clamp(std::lround(value * 255.0f), 0l, 255l));
+    }
+
+    void EncodeBlock(const CompressedImageFormat format, const uint8_t* pixels, uint8_t* outBlock)
+    {
+        switch (format) {
+        case CompressedImageFormat::BC1_RGBA:
+            block::EncodeBC1(pixels, outBlock);
+            break;
+        case CompressedImageFormat::BC3_RGBA:
+            block::EncodeBC3(pixels, outBlock);
+            break;
+        case CompressedImageFormat::BC4_R:
+            block::EncodeBC4(pixels, 0, outBlock);
+            break;
+        case CompressedImageFormat::BC5_RG:
+            block::EncodeBC5(pixels, outBlock);
+            break;
+        case CompressedImageFormat::BC7_RGBA:
+            block::EncodeBC7(pixels, outBlock);
+            break;
+        case CompressedImageFormat::ETC2_RGB8:
+            block::EncodeETC2RGB(pixels, outBlock);
+            break;
+        case CompressedImageFormat::ETC2_RGBA8:
+            block::EncodeETC2RGBA(pixels, outBlock);
+            break;
+        default:
+            break;
+        }
+    }
+
+    bool DecodeBlock(const CompressedImageFormat format, const uint8_t* block, uint8_t* outPixels)
+    {
+        switch (format) {
+        case CompressedImageFormat::BC1_RGBA:
+            block::DecodeBC1(block, outPixels);
+            return true;
+        case CompressedImageFormat::BC3_RGBA:
+            block::DecodeBC3(block, outPixels);
+            return true;
+        case CompressedImageFormat::BC4_R:
+            for (uint32_t i = 0; i < CompressedImage::BLOCK_SIZE * CompressedImage::BLOCK_SIZE; ++i) {
+                outPixels[i * RGBA_CHANNEL_COUNT + 1] = outPixels[i * RGBA_CHANNEL_COUNT + 2] = 0;
+                outPixels[i * RGBA_CHANNEL_COUNT + 3] = 255;
+            }
+            block::DecodeBC4(block, 0, outPixels);
+            return true;
+        case CompressedImageFormat::BC5_RG:
+            block::DecodeBC5(block, outPixels);
+            return true;
+        case CompressedImageFormat::BC7_RGBA:
+            return block::DecodeBC7(block, outPixels);
+        case CompressedImageFormat::ETC2_RGB8:
+            return block::DecodeETC2RGB(block, outPixels);
+        case CompressedImageFormat::ETC2_RGBA8:
+            return block::DecodeETC2RGBA(block, outPixels);
+        default:
+            return false;
+        }
+    }
+} // namespace
+
+CompressedImageFormat TextureCooker::SelectFormat(const TextureCompressionFamily family, const TextureUsage usage, const bool hasAlpha)
+{
+    switch (family) {
+    case TextureCompressionFamily::BC:
+        switch (usage) {
+        case TextureUsage::NORMAL_MAP:
+        case TextureUsage::CONE_MAP:
+            return CompressedImageFormat::BC5_RG;
+        case TextureUsage::HEIGHT_MAP:
+            return CompressedImageFormat::BC4_R;
+        default:
+            return hasAlpha ? CompressedImageFormat::BC7_RGBA : CompressedImageFormat::BC1_RGBA;
+        }
+    case TextureCompressionFamily::ETC2:
+        return hasAlpha && usage == TextureUsage::COLOR ? CompressedImageFormat::ETC2_RGBA8 : CompressedImageFormat::ETC2_RGB8;
+    case TextureCompressionFamily::ASTC:
+        return CompressedImageFormat::ASTC_4x4_RGBA;
+    default:
+        return CompressedImageFormat::UNKNOWN;
+    }
+}
+
+std::unique_ptr<CompressedImage> TextureCooker::Cook(const IImage& image, const TextureUsage usage, const CompressedImageFormat format, const bool srgb, const bool generateMipMaps) const
+{
+    return CookImpl(image, usage, format, srgb, generateMipMaps, nullptr);
+}
+
+std::unique_ptr<CompressedImage> TextureCooker::Cook(const IImage& image, const TextureUsage usage, const CompressedImageFormat format, const bool srgb, const bool generateMipMaps, prev::common::ThreadPool& threadPool) const
+{
+    return CookImpl(image, usage, format, srgb, generateMipMaps, &threadPool);
+}
+
+std::unique_ptr<IImage> TextureCooker::Decode(const CompressedImage& image, const uint32_t level) const
+{
+    const auto& compressedLevel{ image.GetLevel(level) };
+    const uint32_t blockByteSize{ CompressedImage::GetBlockByteSize(image.GetFormat()) };
+    const uint32_t blocksWide{ CompressedImage::GetBlockCount(compressedLevel.width) };
+    const uint32_t blocksHigh{ CompressedImage::GetBlockCount(compressedLevel.height) };
+
+    auto result{ std::make_unique<Image<uint8_t, RGBA_CHANNEL_COUNT>>(compressedLevel.width, compressedLevel.height) };
+    uint8_t* const dst{ result->GetRawDataPtr() };
+
+    uint8_t pixels[CompressedImage::BLOCK_SIZE * CompressedImage::BLOCK_SIZE * RGBA_CHANNEL_COUNT];
+    for (uint32_t blockY = 0; blockY < blocksHigh; ++blockY) {
+        for (uint32_t blockX = 0; blockX < blocksWide; ++blockX) {
+            if (!DecodeBlock(image.GetFormat(), compressedLevel.data.data() + (blockY * blocksWide + blockX) * blockByteSize, pixels)) {
+                LOGE("Texture Cooker: Unsupported block in compressed image level %u", level);
+                return nullptr;
+            }
+
+            for (uint32_t y = 0; y < CompressedImage::BLOCK_SIZE; ++y) {
+                for (uint32_t x = 0; x < CompressedImage::BLOCK_SIZE; ++x) {
+                    const uint32_t imageX{ blockX * CompressedImage::BLOCK_SIZE + x };
+                    const uint32_t imageY{ blockY * CompressedImage::BLOCK_SIZE + y };
+                    if (imageX < compressedLevel.width && imageY < compressedLevel.height) {
+                        std::copy_n(pixels + (y * CompressedImage::BLOCK_SIZE + x) * RGBA_CHANNEL_COUNT, RGBA_CHANNEL_COUNT, dst + (imageY * compressedLevel.width + imageX) * RGBA_CHANNEL_COUNT);
+                    }
+                }
+            }
+        }
+    }
+    return result;
+}
+
+std::unique_ptr<CompressedImage> TextureCooker::CookImpl(const IImage& image, const TextureUsage usage, const CompressedImageFormat format, const bool srgb, const bool generateMipMaps, prev::common::ThreadPool* threadPool) const
+{
+    if (format == CompressedImageFormat::UNKNOWN || format == CompressedImageFormat::ASTC_4x4_RGBA) {
+        LOGE("Texture Cooker: Unsupported target format: %d", static_cast<int>(format));
+        return nullptr;
+    }
+
+    if (image.IsFloatingPoint() || image.GetPixelSize() != image.GetChannels() || image.GetChannels() == 0 || image.GetChannels() > RGBA_CHANNEL_COUNT) {
+        LOGE("Texture Cooker: Only 8 bit images with 1 to 4 channels can be cooked");
+        return nullptr;
+    }
+
+    const auto levels{ GenerateLevels(image, usage, srgb, generateMipMaps) };
+
+    std::vector<CompressedImageLevel> compressedLevels;
+    compressedLevels.reserve(levels.size());
+    for (const auto& level : levels) {
+        CompressedImageLevel compressedLevel{ level.width, level.height };
+        compressedLevel.data.resize(CompressedImage::GetLevelByteSize(format, level.width, level.height));
+
+        const uint32_t blockRowCount{ CompressedImage::GetBlockCount(level.height) };
+        const uint32_t taskCount{ threadPool ? std::min(std::max(std::thread::hardware_concurrency(), 1u), std::max(blockRowCount / MIN_PARALLEL_BLOCK_ROW_COUNT, 1u)) : 1u };
+        if (taskCount <= 1) {
+            EncodeBlockRows(level, format, 0, blockRowCount, compressedLevel.data.data());
+        } else {
+            const uint32_t rowsPerTask{ (blockRowCount + taskCount - 1) / taskCount };
+
+            std::vector<std::future<void>> futures;
+            futures.reserve(taskCount);
+            for (uint32_t firstRow = 0; firstRow < blockRowCount; firstRow += rowsPerTask) {
+                futures.push_back(threadPool->Enqueue([&, firstRow]() { EncodeBlockRows(level, format, firstRow, std::min(rowsPerTask, blockRowCount - firstRow), compressedLevel.data.data()); }));
+            }
+            for (auto& future : futures) {
+                future.get();
+            }
+        }
+
+        compressedLevels.push_back(std::move(compressedLevel));
+    }
+
+    return std::make_unique<CompressedImage>(format, srgb, std::move(compressedLevels));
+}
+
+std::vector<TextureCooker::Level> TextureCooker::GenerateLevels(const IImage& image, const TextureUsage usage, const bool srgb, const bool generateMipMaps) const
+{
+    const uint32_t channels{ image.GetChannels() };
+    const uint8_t* const src{ image.GetRawDataPtr() };
+
+    Level baseLevel{ image.GetWidth(), image.GetHeight() };
+    baseLevel.pixels.resize(static_cast<size_t>(baseLevel.width) * baseLevel.height * RGBA_CHANNEL_COUNT);
+    for (size_t i = 0; i < static_cast<size_t>(baseLevel.width) * baseLevel.height; ++i) {
+        uint8_t* const pixel{ baseLevel.pixels.data() + i * RGBA_CHANNEL_COUNT };
+        const uint8_t* const source{ src + i * channels };
+        // single channel images are gray, missing channels of the others are zero with opaque alpha
+        pixel[0] = source[0];
+        pixel[1] = channels > 1 ? source[1] : (channels == 1 ? source[0] : 0);
+        pixel[2] = channels > 2 ? source[2] : (channels == 1 ? source[0] : 0);
+        pixel[3] = channels > 3 ? source[3] : 255;
+    }
+
+    std::vector<Level> levels;
+    levels.push_back(std::move(baseLevel));
+    while (generateMipMaps && (levels.back().width > 1 || levels.back().height > 1)) {
+        levels.push_back(Downsample(levels.back(), usage, srgb));
+    }
+    return levels;
+}
+
+TextureCooker::Level TextureCooker::Downsample(const Level& source, const TextureUsage usage, const bool srgb) const
+{
+    const auto& srgbToLinear{ GetSrgbToLinearTable() };
+
+    Level result{ std::max(source.width / 2, 1u), std::max(source.height / 2, 1u) };
+    result.pixels.resize(static_cast<size_t>(result.width) * result.height * RGBA_CHANNEL_COUNT);
+
+    for (uint32_t y = 0; y < result.height; ++y) {
+        for (uint32_t x = 0; x < result.width; ++x) {
+            // 2x2 box, odd edges repeat the last texel
+            const uint32_t xs[2]{ std::min(2 * x, source.width - 1), std::min(2 * x + 1, source.width - 1) };
+            const uint32_t ys[2]{ std::min(2 * y, source.height - 1), std::min(2 * y + 1, source.height - 1) };
+
+            float sum[RGBA_CHANNEL_COUNT]{};
+            for (const auto sy : ys) {
+                for (const auto sx : xs) {
+                    const uint8_t* const pixel{ source.pixels.data() + (static_cast<size_t>(sy) * source.width + sx) * RGBA_CHANNEL_COUNT };
+                    for (uint32_t c = 0; c < RGBA_CHANNEL_COUNT; ++c) {
+                        if (usage == TextureUsage::NORMAL_MAP && c < 3) {
+                            sum[c] += pixel[c] / 255.0f * 2.0f - 1.0f;
+                        } else if (usage == TextureUsage::COLOR && srgb && c < 3) {
+                            sum[c] += srgbToLinear[pixel[c]];
+                        } else {
+                            sum[c] += pixel[c] / 255.0f;
+                        }
+                    }
+                }
+            }
+
+            uint8_t* const pixel{ result.pixels.data() + (static_cast<size_t>(y) * result.width + x) * RGBA_CHANNEL_COUNT };
+            if (usage == TextureUsage::NORMAL_MAP) {
+                // averaged normals get shorter, renormalize
+                const float length{ std::sqrt(sum[0] * sum[0] + sum[1] * sum[1] + sum[2] * sum[2]) };
+                const float normal[3]{ length > 0.0f ? sum[0] / length : 0.0f, length > 0.0f ? sum[1] / length : 0.0f, length > 0.0f ? sum[2] / length : 1.0f };
+                for (uint32_t c = 0; c < 3; ++c) {
+                    pixel[c] = ToByte(normal[c] * 0.5f + 0.5f);
+                }
+            } else if (usage == TextureUsage::COLOR && srgb) {
+                for (uint32_t c = 0; c < 3; ++c) {
+                    pixel[c] = ToByte(prev::util::color::LinearToSrgb(sum[c] / 4.0f));
+                }
+            } else {
+                for (uint32_t c = 0; c < 3; ++c) {
+                    pixel[c] = ToByte(sum[c] / 4.0f);
+                }
+            }
+            pixel[3] = ToByte(sum[3] / 4.0f);
+        }
+    }
+    return result;
+}
+
+void TextureCooker::EncodeBlockRows(const Level& level, const CompressedImageFormat format, const uint32_t firstBlockRow, const uint32_t blockRowCount, uint8_t* outData) const
+{
+    const uint32_t blockByteSize{ CompressedImage::GetBlockByteSize(format) };
+    const uint32_t blocksWide{ CompressedImage::GetBlockCount(level.width) };
+
+    uint8_t pixels[CompressedImage::BLOCK_SIZE * CompressedImage::BLOCK_SIZE * RGBA_CHANNEL_COUNT];
+    for (uint32_t blockY = firstBlockRow; blockY < firstBlockRow + blockRowCount; ++blockY) {
+        for (uint32_t blockX = 0; blockX < blocksWide; ++blockX) {
+            // partial edge blocks repeat the last texels
+            for (uint32_t y = 0; y < CompressedImage::BLOCK_SIZE; ++y) {
+                const uint32_t imageY{ std::min(blockY * CompressedImage::BLOCK_SIZE + y, level.height - 1) };
+                for (uint32_t x = 0; x < CompressedImage::BLOCK_SIZE; ++x) {
+                    const uint32_t imageX{ std::min(blockX * CompressedImage::BLOCK_SIZE + x, level.width - 1) };
+                    std::copy_n(level.pixels.data() + (static_cast<size_t>(imageY) * level.width + imageX) * RGBA_CHANNEL_COUNT, RGBA_CHANNEL_COUNT, pixels + (y * CompressedImage::BLOCK_SIZE + x) * RGBA_CHANNEL_COUNT);
+                }
+            }
+            EncodeBlock(format, pixels, outData + (static_cast<size_t>(blockY) * blocksWide + blockX) * blockByteSize);
+        }
+    }
+}
+} // namespace prev::render::image
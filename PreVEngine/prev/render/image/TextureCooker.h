@@ -0,0 +1,76 @@
+#ifndef __TEXTURE_COOKER_H__
+#define __TEXTURE_COOKER_H__
+
+#include "CompressedImage.h"
+#include "IImage.h"
+
+#include "../../common/ThreadPool.h"
+
+#include <memory>
+#include <vector>
+
+namespace prev::render::image {
+enum class TextureUsage {
+    COLOR,
+    NORMAL_MAP,
+    // single channel height
+    HEIGHT_MAP,
+    // height in R, cone ratio in G
+    CONE_MAP,
+};
+
+// Block compression formats a device can sample.
+enum class TextureCompressionFamily {
+    BC,
+    ETC2,
+    ASTC,
+};
+
+// Converts decoded images into block compressed images with a precomputed mip chain, all on the CPU.
+class TextureCooker final {
+public:
+    // bump whenever the cooked output changes, stored cooked images of older versions are cooked again
+    static const inline uint32_t VERSION{ 1 };
+
+public:
+    TextureCooker() = default;
+
+    ~TextureCooker() = default;
+
+public:
+    // Normal and cone maps go to two channel formats and height maps to single channel ones where the family has them.
+    static CompressedImageFormat SelectFormat(const TextureCompressionFamily family, const TextureUsage usage, const bool hasAlpha);
+
+    // Expects 8 bit unsigned images with 1 to 4 channels. Returns nullptr when the format can not be encoded - ASTC is load only.
+    std::unique_ptr<CompressedImage> Cook(const IImage& image, const TextureUsage usage, const CompressedImageFormat format, const bool srgb, const bool generateMipMaps = true) const;
+
+    std::unique_ptr<CompressedImage> Cook(const IImage& image, const TextureUsage usage, const CompressedImageFormat format, const bool srgb, const bool generateMipMaps, prev::common::ThreadPool& threadPool) const;
+
+    // Decodes one level into an RGBA8 image, the fallback for devices without the format.
+    // Returns nullptr for ASTC and for block modes the cooker does not emit.
+    std::unique_ptr<IImage> Decode(const CompressedImage& image, const uint32_t level = 0) const;
+
+private:
+    struct Level {
+        uint32_t width{};
+
+        uint32_t height{};
+
+        std::vector<uint8_t> pixels{};
+    };
+
+private:
+    std::unique_ptr<CompressedImage> CookImpl(const IImage& image, const TextureUsage usage, const CompressedImageFormat format, const bool srgb, const bool generateMipMaps, prev::common::ThreadPool* threadPool) const;
+
+    std::vector<Level> GenerateLevels(const IImage& image, const TextureUsage usage, const bool srgb, const bool generateMipMaps) const;
+
+    Level Downsample(const Level& source, const TextureUsage usage, const bool srgb) const;
+
+    void EncodeBlockRows(const Level& level, const CompressedImageFormat format, const uint32_t firstBlockRow, const uint32_t blockRowCount, uint8_t* outData) const;
+
+private:
+    static const inline uint32_t MIN_PARALLEL_BLOCK_ROW_COUNT{ 16 };
+};
+} // namespace prev::render::image
+
+#endif // !__TEXTURE_COOKER_H__
@@ -0,0 +1,120 @@
+#include "ParticleSimulation.h"
+
+#include "../buffer/BufferPoolBuilder.h"
+#include "../pipeline/ComputePipelineBuilder.h"
+#include "../shader/ShaderBuilder.h"
+
+#include "../../scene/particle/ParticlePool.h"
+#include "../../util/MathUtils.h"
+
+namespace prev::render::particle {
+ParticleSimulation::ParticleSimulation(prev::core::device::Device& device, const std::string& simulateShaderPath, const std::string& finalizeShaderPath, const uint32_t descriptorCount)
+{
+    // clang-format off
+    m_simulateShader = prev::render::shader::ShaderBuilder{ device }
+        .AddShaderStagePaths({
+            { GFX_SHADER_STAGE_COMPUTE, simulateShaderPath }
+        })
+        .AddBindGroupEntries({
+            prev::render::shader::ShaderBuilder::BindGroupEntry::Buffer("uboCS", 0, GFX_SHADER_STAGE_COMPUTE),
+            prev::render::shader::ShaderBuilder::BindGroupEntry::StorageBuffer("inParticles", 1, GFX_SHADER_STAGE_COMPUTE),
+            prev::render::shader::ShaderBuilder::BindGroupEntry::StorageBuffer("emittedParticles", 2, GFX_SHADER_STAGE_COMPUTE),
+            prev::render::shader::ShaderBuilder::BindGroupEntry::StorageBuffer("outParticles", 3, GFX_SHADER_STAGE_COMPUTE, GFX_STORAGE_BUFFER_ACCESS_READ_WRITE),
+            prev::render::shader::ShaderBuilder::BindGroupEntry::StorageBuffer("outInstances", 4, GFX_SHADER_STAGE_COMPUTE, GFX_STORAGE_BUFFER_ACCESS_READ_WRITE),
+            prev::render::shader::ShaderBuilder::BindGroupEntry::StorageBuffer("counters", 5, GFX_SHADER_STAGE_COMPUTE, GFX_STORAGE_BUFFER_ACCESS_READ_WRITE)
+        })
+        .Build();
+    // clang-format on
+
+    // clang-format off
+    m_simulatePipeline = prev::render::pipeline::ComputePipelineBuilder{ device, *m_simulateShader }
+        .Build();
+    // clang-format on
+
+    // clang-format off
+    m_finalizeShader = prev::render::shader::ShaderBuilder{ device }
+        .AddShaderStagePaths({
+            { GFX_SHADER_STAGE_COMPUTE, finalizeShaderPath }
+        })
+        .AddBindGroupEntries({
+            prev::render::shader::ShaderBuilder::BindGroupEntry::Buffer("uboCS", 0, GFX_SHADER_STAGE_COMPUTE),
+            prev::render::shader::ShaderBuilder::BindGroupEntry::StorageBuffer("counters", 1, GFX_SHADER_STAGE_COMPUTE, GFX_STORAGE_BUFFER_ACCESS_READ_WRITE),
+            prev::render::shader::ShaderBuilder::BindGroupEntry::StorageBuffer("drawArgs", 2, GFX_SHADER_STAGE_COMPUTE, GFX_STORAGE_BUFFER_ACCESS_READ_WRITE)
+        })
+        .Build();
+    // clang-format on
+
+    // clang-format off
+    m_finalizePipeline = prev::render::pipeline::ComputePipelineBuilder{ device, *m_finalizeShader }
+        .Build();
+    // clang-format on
+
+    m_uniformsPoolCS = prev::render::buffer::BufferPoolBuilder{ device, device.GetQueue(prev::core::device::QueueType::GRAPHICS) }
+                           .SetMemoryProperties(GFX_MEMORY_PROPERTY_HOST_VISIBLE | GFX_MEMORY_PROPERTY_HOST_COHERENT)
+                           .SetUsageFlags(GFX_BUFFER_USAGE_UNIFORM | GFX_BUFFER_USAGE_MAP_WRITE)
+                           .SetChunkSize(descriptorCount)
+                           .SetStride(sizeof(UniformsCS))
+                           .SetAlignment(device.GetAdapter().GetLimits().minUniformBufferOffsetAlignment)
+                           .BuildFrameScoped();
+}
+
+void ParticleSimulation::BeginFrame(const uint32_t frameInFlightIndex)
+{
+    m_simulateShader->BeginFrame(frameInFlightIndex);
+    m_finalizeShader->BeginFrame(frameInFlightIndex);
+    m_uniformsPoolCS->BeginFrame(frameInFlightIndex);
+}
+
+void ParticleSimulation::Record(GfxCommandEncoder commandEncoder, const ParticleSimulationState& simulationState, const prev::render::buffer::Buffer& instanceBuffer, const uint32_t atlasNumberOfRows)
+{
+    auto& uboCS = m_uniformsPoolCS->Next();
+
+    UniformsCS uniformsCS{};
+    uniformsCS.deltaTime = simulationState.deltaTime;
+    uniformsCS.gravity = prev::scene::particle::ParticlePool::GRAVITY_Y;
+    uniformsCS.capacity = simulationState.capacity;
+    uniformsCS.emittedCount = simulationState.emittedCount;
+    uniformsCS.inputIndex = simulationState.inputIndex;
+    uniformsCS.atlasNumberOfRows = atlasNumberOfRows;
+    uboCS.Write(uniformsCS);
+
+    const uint32_t outputIndex{ 1 - simulationState.inputIndex };
+
+    m_simulateShader->Bind("uboCS", uboCS);
+    m_simulateShader->Bind("inParticles", *simulationState.particles[simulationState.inputIndex]);
+    m_simulateShader->Bind("emittedParticles", *simulationState.emittedParticles);
+    m_simulateShader->Bind("outParticles", *simulationState.particles[outputIndex]);
+    m_simulateShader->Bind("outInstances", instanceBuffer);
+    m_simulateShader->Bind("counters", *simulationState.counters);
+
+    const GfxBindGroup descriptorSetSimulate = m_simulateShader->UpdateNextBindGroup();
+
+    m_finalizeShader->Bind("uboCS", uboCS);
+    m_finalizeShader->Bind("counters", *simulationState.counters);
+    m_finalizeShader->Bind("drawArgs", *simulationState.indirectDraw);
+
+    const GfxBindGroup descriptorSetFinalize = m_finalizeShader->UpdateNextBindGroup();
+
+    GfxComputePassEncoder computePassEncoder{};
+    GfxComputePassBeginDescriptor computePassDesc{};
+    gfxCommandEncoderBeginComputePass(commandEncoder, &computePassDesc, &computePassEncoder);
+
+    // one thread per potentially alive particle plus the emitted ones, the dead exit early
+    gfxComputePassEncoderSetPipeline(computePassEncoder, *m_simulatePipeline);
+    gfxComputePassEncoderSetBindGroup(computePassEncoder, 0, descriptorSetSimulate, nullptr, 0);
+    gfxComputePassEncoderDispatch(computePassEncoder, prev::util::math::DispatchSize(simulationState.capacity + simulationState.emittedCount, WORK_GROUP_SIZE), 1, 1);
+
+    gfxComputePassEncoderSetPipeline(computePassEncoder, *m_finalizePipeline);
+    gfxComputePassEncoderSetBindGroup(computePassEncoder, 0, descriptorSetFinalize, nullptr, 0);
+    gfxComputePassEncoderDispatch(computePassEncoder, 1, 1, 1);
+
+    gfxComputePassEncoderEnd(computePassEncoder);
+}
+
+void ParticleSimulation::EndFrame()
+{
+    m_simulateShader->EndFrame();
+    m_finalizeShader->EndFrame();
+    m_uniformsPoolCS->EndFrame();
+}
+} // namespace prev::render::particle
@@ -0,0 +1,90 @@
+#ifndef __PARTICLE_SIMULATION_H__
+#define __PARTICLE_SIMULATION_H__
+
+#include "../buffer/Buffer.h"
+#include "../buffer/FrameScopedBufferPool.h"
+#include "../pipeline/Pipeline.h"
+#include "../shader/Shader.h"
+
+#include "../../common/Common.h"
+#include "../../core/device/Device.h"
+
+#include <array>
+#include <memory>
+#include <string>
+
+namespace prev::render::particle {
+// Particle as stored by the GPU simulation, mirrors particles_simulate.slang.
+struct GpuParticle {
+    glm::vec4 positionAndGravityEffect;
+
+    glm::vec4 velocityAndLifeLength;
+
+    glm::vec4 elapsedTimeRotationScale;
+};
+
+// State of a particle system simulated in compute - particles ping-pong between two storage buffers,
+// the frame's emitted particles are appended by the simulation.
+struct ParticleSimulationState {
+    std::array<std::shared_ptr<prev::render::buffer::Buffer>, 2> particles{};
+
+    std::shared_ptr<prev::render::buffer::Buffer> emittedParticles{};
+
+    // alive count of both particle buffers
+    std::shared_ptr<prev::render::buffer::Buffer> counters{};
+
+    std::shared_ptr<prev::render::buffer::Buffer> indirectDraw{};
+
+    uint32_t capacity{};
+
+    uint32_t inputIndex{};
+
+    uint32_t emittedCount{};
+
+    float deltaTime{};
+};
+
+// The simulate and finalize compute pipelines of GPU particle systems. Record advances the alive and the emitted
+// particles into the other particle buffer, writes their instances and the alive count into the indirect draw.
+class ParticleSimulation final {
+public:
+    ParticleSimulation(prev::core::device::Device& device, const std::string& simulateShaderPath, const std::string& finalizeShaderPath, const uint32_t descriptorCount);
+
+    ~ParticleSimulation() = default;
+
+public:
+    void BeginFrame(const uint32_t frameInFlightIndex);
+
+    // Records one frame of a system into its own compute pass.
+    void Record(GfxCommandEncoder commandEncoder, const ParticleSimulationState& simulationState, const prev::render::buffer::Buffer& instanceBuffer, const uint32_t atlasNumberOfRows);
+
+    void EndFrame();
+
+private:
+    struct DEFAULT_ALIGNMENT UniformsCS {
+        DEFAULT_ALIGNMENT float deltaTime;
+        float gravity;
+        uint32_t capacity;
+        uint32_t emittedCount;
+
+        DEFAULT_ALIGNMENT uint32_t inputIndex;
+        uint32_t atlasNumberOfRows;
+    };
+
+private:
+    static const inline uint32_t WORK_GROUP_SIZE{ 64 };
+
+private:
+    std::unique_ptr<prev::render::shader::Shader> m_simulateShader;
+
+    std::unique_ptr<prev::render::pipeline::Pipeline> m_simulatePipeline;
+
+    std::unique_ptr<prev::render::shader::Shader> m_finalizeShader;
+
+    std::unique_ptr<prev::render::pipeline::Pipeline> m_finalizePipeline;
+
+    std::unique_ptr<prev::render::buffer::FrameScopedBufferPool> m_uniformsPoolCS;
+};
+} // namespace prev::render::particle
+
+#endif // !__PARTICLE_SIMULATION_H__
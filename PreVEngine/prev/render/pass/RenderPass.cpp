@@ -4,10 +4,11 @@
 #include "../../core/Formats.h"
 
 namespace prev::render::pass {
-RenderPass::RenderPass(GfxDevice device, GfxRenderPass renderPass, const std::vector<AttachmentInfo>& attachmentInfos)
+RenderPass::RenderPass(GfxDevice device, GfxRenderPass renderPass, const std::vector<AttachmentInfo>& attachmentInfos, const uint32_t viewCount)
     : m_gfxDevice{ device }
     , m_gfxRenderPass{ renderPass }
     , m_attachmentInfos{ attachmentInfos }
+    , m_viewCount{ viewCount }
 {
     for (const auto& info : attachmentInfos) {
         m_gfxSampleCount = static_cast<GfxSampleCount>(std::max(static_cast<int>(m_gfxSampleCount), static_cast<int>(info.sampleCount)));
@@ -102,6 +103,11 @@ GfxSampleCount RenderPass::GetSampleCount() const
     return m_gfxSampleCount;
 }
 
+uint32_t RenderPass::GetViewCount() const
+{
+    return m_viewCount;
+}
+
 RenderPass::operator GfxRenderPass() const
 {
     return m_gfxRenderPass;
@@ -23,7 +23,7 @@ public:
     };
 
 public:
-    RenderPass(GfxDevice device, GfxRenderPass renderPass, const std::vector<AttachmentInfo>& attachmentInfos);
+    RenderPass(GfxDevice device, GfxRenderPass renderPass, const std::vector<AttachmentInfo>& attachmentInfos, const uint32_t viewCount = 1);
 
     ~RenderPass();
 
@@ -45,6 +45,8 @@ public:
 
     GfxSampleCount GetSampleCount() const;
 
+    uint32_t GetViewCount() const;
+
     std::vector<GfxFormat> GetGfxColorFormats() const;
 
     GfxRenderPassEncoder GetEncoder() const;
@@ -64,6 +66,8 @@ private:
 
     std::vector<AttachmentInfo> m_attachmentInfos;
 
+    uint32_t m_viewCount{ 1 };
+
     GfxRenderPassEncoder m_activeEncoder{};
 
     GfxQuerySet m_occlusionQuerySet{};
@@ -147,7 +147,7 @@ std::unique_ptr<RenderPass> RenderPassBuilder::Build() const
 
     LOGI("Renderpass created");
 
-    return std::make_unique<RenderPass>(m_device, renderPass, m_attachmentInfos);
+    return std::make_unique<RenderPass>(m_device, renderPass, m_attachmentInfos, m_viewCount);
 }
 
 void RenderPassBuilder::Validate() const
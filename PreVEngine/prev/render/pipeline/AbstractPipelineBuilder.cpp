@@ -1,5 +1,7 @@
 #include "AbstractPipelineBuilder.h"
 
+#include "../../core/device/Device.h"
+
 #include <stdexcept>
 
 namespace prev::render::pipeline {
@@ -9,6 +11,13 @@ AbstractPipelineBuilder::AbstractPipelineBuilder(GfxDevice device, const shader:
 {
 }
 
+AbstractPipelineBuilder::AbstractPipelineBuilder(const prev::core::device::Device& device, const shader::Shader& shader)
+    : m_device{ device }
+    , m_shader{ shader }
+    , m_pipelineCache{ &device.GetPipelineCache() }
+{
+}
+
 void AbstractPipelineBuilder::ValidateConstants(const std::vector<GfxConstantEntry>& constants, const std::string& stageName)
 {
     for (size_t i = 0; i < constants.size(); ++i) {
@@ -19,4 +28,26 @@ void AbstractPipelineBuilder::ValidateConstants(const std::vector<GfxConstantEnt
         }
     }
 }
+
+void AbstractPipelineBuilder::AddConstantsToKey(const std::vector<GfxConstantEntry>& constants, PipelineKey& key)
+{
+    key.Add(static_cast<uint32_t>(constants.size()));
+    for (const auto& constant : constants) {
+        key.Add(constant.id).Add(constant.type);
+        switch (constant.type) {
+        case GFX_CONSTANT_TYPE_BOOL:
+            key.Add(constant.value.b);
+            break;
+        case GFX_CONSTANT_TYPE_I32:
+            key.Add(constant.value.i32);
+            break;
+        case GFX_CONSTANT_TYPE_U32:
+            key.Add(constant.value.u32);
+            break;
+        default:
+            key.Add(constant.value.f32);
+            break;
+        }
+    }
+}
 } // namespace prev::render::pipeline
\ No newline at end of file
@@ -2,6 +2,7 @@
 #define __ABSTRACT_PIPELINE_BUILDER_H__
 
 #include "Pipeline.h"
+#include "PipelineCache.h"
 
 #include "../shader/Shader.h"
 
@@ -9,11 +10,18 @@
 #include <type_traits>
 #include <vector>
 
+namespace prev::core::device {
+class Device;
+}
+
 namespace prev::render::pipeline {
 class AbstractPipelineBuilder {
 protected:
     AbstractPipelineBuilder(GfxDevice device, const shader::Shader& shader);
 
+    // Builds through the pipeline cache of the device.
+    AbstractPipelineBuilder(const prev::core::device::Device& device, const shader::Shader& shader);
+
     virtual ~AbstractPipelineBuilder() = default;
 
 public:
@@ -49,10 +57,14 @@ protected:
 
     static void ValidateConstants(const std::vector<GfxConstantEntry>& constants, const std::string& stageName);
 
+    static void AddConstantsToKey(const std::vector<GfxConstantEntry>& constants, PipelineKey& key);
+
 protected:
     const GfxDevice m_device;
 
     const shader::Shader& m_shader;
+
+    PipelineCache* m_pipelineCache{};
 };
 } // namespace prev::render::pipeline
 
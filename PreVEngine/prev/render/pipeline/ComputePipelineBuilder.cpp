@@ -10,11 +10,19 @@ ComputePipelineBuilder::ComputePipelineBuilder(GfxDevice device, const shader::S
 {
 }
 
+ComputePipelineBuilder::ComputePipelineBuilder(const prev::core::device::Device& device, const shader::Shader& shader)
+    : AbstractPipelineBuilder(device, shader)
+{
+}
+
 std::unique_ptr<Pipeline> ComputePipelineBuilder::Build() const
 {
     Validate();
 
-    auto pipeline{ CreateComputePipeline() };
+    const auto create = [this]() -> std::shared_ptr<const SharedComputePipeline> {
+        return std::make_shared<SharedComputePipeline>(CreateComputePipeline(), [](GfxComputePipeline pipeline) { gfxComputePipelineDestroy(pipeline); });
+    };
+    auto pipeline{ m_pipelineCache ? m_pipelineCache->GetOrCreateComputePipeline(CreateKey(), create) : create() };
 
     return std::unique_ptr<Pipeline>(new Pipeline(m_device, pipeline));
 }
@@ -51,4 +59,12 @@ GfxComputePipeline ComputePipelineBuilder::CreateComputePipeline() const
     GFXERRCHECK(gfxDeviceCreateComputePipeline(m_device, &desc, &pipeline));
     return pipeline;
 }
+
+PipelineKey ComputePipelineBuilder::CreateKey() const
+{
+    PipelineKey key{};
+    key.Add(m_shader.GetCacheKey());
+    AddConstantsToKey(m_constants, key);
+    return key;
+}
 } // namespace prev::render::pipeline
\ No newline at end of file
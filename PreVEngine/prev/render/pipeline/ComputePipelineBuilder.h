@@ -8,6 +8,8 @@ class ComputePipelineBuilder final : public AbstractPipelineBuilder {
 public:
     ComputePipelineBuilder(GfxDevice device, const shader::Shader& shader);
 
+    ComputePipelineBuilder(const prev::core::device::Device& device, const shader::Shader& shader);
+
     ~ComputePipelineBuilder() = default;
 
 public:
@@ -26,6 +28,8 @@ private:
 private:
     GfxComputePipeline CreateComputePipeline() const;
 
+    PipelineKey CreateKey() const;
+
 private:
     std::vector<GfxConstantEntry> m_constants;
 };
@@ -16,6 +16,12 @@ GraphicsPipelineBuilder::GraphicsPipelineBuilder(GfxDevice device, const shader:
 {
 }
 
+GraphicsPipelineBuilder::GraphicsPipelineBuilder(const prev::core::device::Device& device, const shader::Shader& shader, const pass::RenderPass& renderPass)
+    : AbstractPipelineBuilder(device, shader)
+    , m_renderPass{ renderPass }
+{
+}
+
 GraphicsPipelineBuilder& GraphicsPipelineBuilder::SetPrimitiveTopology(GfxPrimitiveTopology primitiveTopology)
 {
     m_primitiveTopology = primitiveTopology;
@@ -46,6 +52,12 @@ GraphicsPipelineBuilder& GraphicsPipelineBuilder::SetAdditiveBlendingEnabled(boo
     return *this;
 }
 
+GraphicsPipelineBuilder& GraphicsPipelineBuilder::SetPremultipliedAlphaBlendingEnabled(bool enabled)
+{
+    m_premultipliedAlphaBlendingEnabled = enabled;
+    return *this;
+}
+
 GraphicsPipelineBuilder& GraphicsPipelineBuilder::SetPolygonMode(GfxPolygonMode mode)
 {
     m_polygonMode = mode;
@@ -68,11 +80,47 @@ std::unique_ptr<Pipeline> GraphicsPipelineBuilder::Build() const
 {
     Validate();
 
-    auto pipeline{ CreateGraphicsPipeline() };
+    const auto create = [this]() -> std::shared_ptr<const SharedRenderPipeline> {
+        return std::make_shared<SharedRenderPipeline>(CreateGraphicsPipeline(), [](GfxRenderPipeline pipeline) { gfxRenderPipelineDestroy(pipeline); });
+    };
+    auto pipeline{ m_pipelineCache ? m_pipelineCache->GetOrCreateRenderPipeline(CreateKey(), create) : create() };
 
     return std::unique_ptr<Pipeline>(new Pipeline(m_device, pipeline));
 }
 
+PipelineKey GraphicsPipelineBuilder::CreateKey() const
+{
+    PipelineKey key{};
+    key.Add(m_shader.GetCacheKey());
+
+    const auto& inputBindings{ m_shader.GetVertexInputBindings() };
+    key.Add(static_cast<uint32_t>(inputBindings.size()));
+    for (const auto& binding : inputBindings) {
+        key.Add(binding.binding).Add(binding.stride).Add(binding.stepMode);
+    }
+
+    const auto& inputAttributes{ m_shader.GetVertexInputAttributes() };
+    key.Add(static_cast<uint32_t>(inputAttributes.size()));
+    for (const auto& attribute : inputAttributes) {
+        key.Add(attribute.binding).Add(attribute.shaderLocation).Add(attribute.format).Add(attribute.offset);
+    }
+
+    // what makes render passes compatible, the clear values and load/store operations do not matter
+    const auto& attachments{ m_renderPass.GetAttachments() };
+    key.Add(static_cast<uint32_t>(attachments.size()));
+    for (const auto& attachment : attachments) {
+        key.Add(attachment.format).Add(attachment.sampleCount).Add(attachment.resolveAttachment);
+    }
+    key.Add(m_renderPass.GetViewCount());
+
+    key.Add(m_primitiveTopology).Add(m_depthTestEnabled).Add(m_depthWriteEnabled).Add(m_blendingEnabled).Add(m_additiveBlendingEnabled).Add(m_premultipliedAlphaBlendingEnabled);
+    key.Add(m_polygonMode).Add(m_cullingMode).Add(m_frontFace);
+
+    AddConstantsToKey(m_vertexConstants, key);
+    AddConstantsToKey(m_fragmentConstants, key);
+    return key;
+}
+
 GfxRenderPipeline GraphicsPipelineBuilder::CreateGraphicsPipeline() const
 {
     // --- Vertex state: group attributes by binding ---
@@ -132,6 +180,9 @@ GfxRenderPipeline GraphicsPipelineBuilder::CreateGraphicsPipeline() const
     if (m_additiveBlendingEnabled) {
         blendState.color = { GFX_BLEND_OPERATION_ADD, GFX_BLEND_FACTOR_ONE, GFX_BLEND_FACTOR_ONE };
         blendState.alpha = { GFX_BLEND_OPERATION_ADD, GFX_BLEND_FACTOR_SRC_ALPHA, GFX_BLEND_FACTOR_ONE_MINUS_SRC_ALPHA };
+    } else if (m_premultipliedAlphaBlendingEnabled) {
+        blendState.color = { GFX_BLEND_OPERATION_ADD, GFX_BLEND_FACTOR_ONE, GFX_BLEND_FACTOR_ONE_MINUS_SRC_ALPHA };
+        blendState.alpha = { GFX_BLEND_OPERATION_ADD, GFX_BLEND_FACTOR_ONE, GFX_BLEND_FACTOR_ONE_MINUS_SRC_ALPHA };
     } else {
         blendState.color = { GFX_BLEND_OPERATION_ADD, GFX_BLEND_FACTOR_SRC_ALPHA, GFX_BLEND_FACTOR_ONE_MINUS_SRC_ALPHA };
         blendState.alpha = { GFX_BLEND_OPERATION_ADD, GFX_BLEND_FACTOR_ONE, GFX_BLEND_FACTOR_ZERO };
@@ -207,6 +258,14 @@ void GraphicsPipelineBuilder::Validate() const
         throw std::runtime_error("Invalid pipeline configuration: Blending is disabled and additive blending enabled - additive blending will be ignored.");
     }
 
+    if (!m_blendingEnabled && m_premultipliedAlphaBlendingEnabled) {
+        throw std::runtime_error("Invalid pipeline configuration: Blending is disabled and premultiplied alpha blending enabled - premultiplied alpha blending will be ignored.");
+    }
+
+    if (m_additiveBlendingEnabled && m_premultipliedAlphaBlendingEnabled) {
+        throw std::runtime_error("Invalid pipeline configuration: Additive and premultiplied alpha blending are both enabled.");
+    }
+
     ValidateConstants(m_vertexConstants, "vertex");
     ValidateConstants(m_fragmentConstants, "fragment");
 }
@@ -10,6 +10,8 @@ class GraphicsPipelineBuilder final : public AbstractPipelineBuilder {
 public:
     GraphicsPipelineBuilder(GfxDevice device, const shader::Shader& shader, const pass::RenderPass& renderPass);
 
+    GraphicsPipelineBuilder(const prev::core::device::Device& device, const shader::Shader& shader, const pass::RenderPass& renderPass);
+
     ~GraphicsPipelineBuilder() = default;
 
 public:
@@ -23,6 +25,9 @@ public:
 
     GraphicsPipelineBuilder& SetAdditiveBlendingEnabled(bool enabled);
 
+    // "over" blending of colors already multiplied by their alpha, order dependent unlike the additive one
+    GraphicsPipelineBuilder& SetPremultipliedAlphaBlendingEnabled(bool enabled);
+
     GraphicsPipelineBuilder& SetPolygonMode(GfxPolygonMode mode);
 
     GraphicsPipelineBuilder& SetCullingMode(GfxCullMode mode);
@@ -51,6 +56,8 @@ private:
 private:
     GfxRenderPipeline CreateGraphicsPipeline() const;
 
+    PipelineKey CreateKey() const;
+
 private:
     const pass::RenderPass& m_renderPass;
 
@@ -64,6 +71,8 @@ private:
 
     bool m_additiveBlendingEnabled{ false };
 
+    bool m_premultipliedAlphaBlendingEnabled{ false };
+
     GfxPolygonMode m_polygonMode{ GFX_POLYGON_MODE_FILL };
 
     GfxCullMode m_cullingMode{ GFX_CULL_MODE_NONE };
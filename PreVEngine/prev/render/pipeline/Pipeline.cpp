@@ -3,13 +3,13 @@
 #include "../../common/Logger.h"
 
 namespace prev::render::pipeline {
-Pipeline::Pipeline(GfxDevice device, GfxRenderPipeline renderPipeline)
+Pipeline::Pipeline(GfxDevice device, const std::shared_ptr<const SharedRenderPipeline>& renderPipeline)
     : m_device{ device }
     , m_renderPipeline{ renderPipeline }
 {
 }
 
-Pipeline::Pipeline(GfxDevice device, GfxComputePipeline computePipeline)
+Pipeline::Pipeline(GfxDevice device, const std::shared_ptr<const SharedComputePipeline>& computePipeline)
     : m_device{ device }
     , m_computePipeline{ computePipeline }
 {
@@ -17,22 +17,17 @@ Pipeline::Pipeline(GfxDevice device, GfxComputePipeline computePipeline)
 
 Pipeline::~Pipeline()
 {
+    // the gfx pipeline itself goes with its last owner, the cache may keep it
     GFXERRCHECK(gfxDeviceWaitIdle(m_device));
-    if (m_renderPipeline) {
-        gfxRenderPipelineDestroy(m_renderPipeline);
-    }
-    if (m_computePipeline) {
-        gfxComputePipelineDestroy(m_computePipeline);
-    }
 }
 
 Pipeline::operator GfxRenderPipeline() const
 {
-    return m_renderPipeline;
+    return m_renderPipeline ? m_renderPipeline->GetHandle() : GfxRenderPipeline{};
 }
 
 Pipeline::operator GfxComputePipeline() const
 {
-    return m_computePipeline;
+    return m_computePipeline ? m_computePipeline->GetHandle() : GfxComputePipeline{};
 }
 } // namespace prev::render::pipeline
\ No newline at end of file
@@ -1,17 +1,21 @@
 #ifndef __PIPELINE_H__
 #define __PIPELINE_H__
 
+#include "PipelineCache.h"
+
 #include "../../core/Core.h"
 
+#include <memory>
+
 namespace prev::render::pipeline {
 class GraphicsPipelineBuilder;
 class ComputePipelineBuilder;
 
 class Pipeline final {
 private:
-    Pipeline(GfxDevice device, GfxRenderPipeline renderPipeline);
+    Pipeline(GfxDevice device, const std::shared_ptr<const SharedRenderPipeline>& renderPipeline);
 
-    Pipeline(GfxDevice device, GfxComputePipeline computePipeline);
+    Pipeline(GfxDevice device, const std::shared_ptr<const SharedComputePipeline>& computePipeline);
 
 public:
     ~Pipeline();
@@ -28,9 +32,10 @@ public:
 private:
     GfxDevice m_device;
 
-    GfxRenderPipeline m_renderPipeline{};
+    // possibly shared with other pipelines built the same way
+    std::shared_ptr<const SharedRenderPipeline> m_renderPipeline{};
 
-    GfxComputePipeline m_computePipeline{};
+    std::shared_ptr<const SharedComputePipeline> m_computePipeline{};
 };
 } // namespace prev::render::pipeline
 
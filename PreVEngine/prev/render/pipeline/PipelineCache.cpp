@@ -0,0 +1,56 @@
+#include "PipelineCache.h"
+
+#include "../../common/Logger.h"
+
+namespace prev::render::pipeline {
+PipelineCache::PipelineCache(const size_t maxCount)
+    : m_shaderModules{ maxCount }
+    , m_bindGroupLayouts{ maxCount }
+    , m_renderPipelines{ maxCount }
+    , m_computePipelines{ maxCount }
+{
+}
+
+PipelineCache::~PipelineCache()
+{
+    const auto statistics{ GetStatistics() };
+    LOGI("Pipeline cache: shader modules %llu hits / %llu misses, bind group layouts %llu / %llu, render pipelines %llu / %llu, compute pipelines %llu / %llu",
+        static_cast<unsigned long long>(statistics.shaderModules.hitCount), static_cast<unsigned long long>(statistics.shaderModules.missCount),
+        static_cast<unsigned long long>(statistics.bindGroupLayouts.hitCount), static_cast<unsigned long long>(statistics.bindGroupLayouts.missCount),
+        static_cast<unsigned long long>(statistics.renderPipelines.hitCount), static_cast<unsigned long long>(statistics.renderPipelines.missCount),
+        static_cast<unsigned long long>(statistics.computePipelines.hitCount), static_cast<unsigned long long>(statistics.computePipelines.missCount));
+}
+
+std::shared_ptr<const SharedShaderModule> PipelineCache::GetOrCreateShaderModule(const PipelineKey& key, const std::function<std::shared_ptr<const SharedShaderModule>()>& create)
+{
+    return m_shaderModules.GetOrCreate(key.GetData(), create);
+}
+
+std::shared_ptr<const SharedBindGroupLayout> PipelineCache::GetOrCreateBindGroupLayout(const PipelineKey& key, const std::function<std::shared_ptr<const SharedBindGroupLayout>()>& create)
+{
+    return m_bindGroupLayouts.GetOrCreate(key.GetData(), create);
+}
+
+std::shared_ptr<const SharedRenderPipeline> PipelineCache::GetOrCreateRenderPipeline(const PipelineKey& key, const std::function<std::shared_ptr<const SharedRenderPipeline>()>& create)
+{
+    return m_renderPipelines.GetOrCreate(key.GetData(), create);
+}
+
+std::shared_ptr<const SharedComputePipeline> PipelineCache::GetOrCreateComputePipeline(const PipelineKey& key, const std::function<std::shared_ptr<const SharedComputePipeline>()>& create)
+{
+    return m_computePipelines.GetOrCreate(key.GetData(), create);
+}
+
+void PipelineCache::Clear()
+{
+    m_shaderModules.Clear();
+    m_bindGroupLayouts.Clear();
+    m_renderPipelines.Clear();
+    m_computePipelines.Clear();
+}
+
+PipelineCacheStatistics PipelineCache::GetStatistics() const
+{
+    return { m_shaderModules.GetStatistics(), m_bindGroupLayouts.GetStatistics(), m_renderPipelines.GetStatistics(), m_computePipelines.GetStatistics() };
+}
+} // namespace prev::render::pipeline
@@ -0,0 +1,156 @@
+#ifndef __PIPELINE_CACHE_H__
+#define __PIPELINE_CACHE_H__
+
+#include "../../common/Cache.h"
+#include "../../core/Core.h"
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <type_traits>
+
+namespace prev::render::pipeline {
+// A gfx object shared by everybody built with the same description, destroyed with its last owner.
+template <typename HandleType>
+class SharedGfxObject final {
+public:
+    SharedGfxObject(HandleType handle, std::function<void(HandleType)> destroy)
+        : m_handle{ handle }
+        , m_destroy{ std::move(destroy) }
+        , m_id{ NextId() }
+    {
+    }
+
+    ~SharedGfxObject()
+    {
+        if (m_handle && m_destroy) {
+            m_destroy(m_handle);
+        }
+    }
+
+    SharedGfxObject(const SharedGfxObject& other) = delete;
+
+    SharedGfxObject& operator=(const SharedGfxObject& other) = delete;
+
+public:
+    HandleType GetHandle() const
+    {
+        return m_handle;
+    }
+
+    // never reused, unlike the handle value
+    uint64_t GetId() const
+    {
+        return m_id;
+    }
+
+private:
+    static uint64_t NextId()
+    {
+        static std::atomic<uint64_t> nextId{ 1 };
+        return nextId.fetch_add(1, std::memory_order_relaxed);
+    }
+
+private:
+    HandleType m_handle{};
+
+    std::function<void(HandleType)> m_destroy;
+
+    uint64_t m_id{};
+};
+
+using SharedShaderModule = SharedGfxObject<GfxShader>;
+
+using SharedBindGroupLayout = SharedGfxObject<GfxBindGroupLayout>;
+
+using SharedRenderPipeline = SharedGfxObject<GfxRenderPipeline>;
+
+using SharedComputePipeline = SharedGfxObject<GfxComputePipeline>;
+
+// Byte string identifying an object description. Values go in field by field, a struct would bring its
+// padding along.
+class PipelineKey final {
+public:
+    template <typename T>
+    PipelineKey& Add(const T& value)
+    {
+        static_assert(std::is_arithmetic_v<T> || std::is_enum_v<T>, "Add the fields one by one");
+        m_data.append(reinterpret_cast<const char*>(&value), sizeof(value));
+        return *this;
+    }
+
+    PipelineKey& Add(const std::string& value)
+    {
+        Add(static_cast<uint64_t>(value.size()));
+        m_data.append(value);
+        return *this;
+    }
+
+    PipelineKey& Add(const PipelineKey& key)
+    {
+        return Add(key.GetData());
+    }
+
+    const std::string& GetData() const
+    {
+        return m_data;
+    }
+
+private:
+    std::string m_data;
+};
+
+struct PipelineCacheStatistics {
+    prev::common::CacheStatistics shaderModules;
+
+    prev::common::CacheStatistics bindGroupLayouts;
+
+    prev::common::CacheStatistics renderPipelines;
+
+    prev::common::CacheStatistics computePipelines;
+};
+
+// Device level cache of the shader modules, bind group layouts and pipelines - renderers built for several
+// passes and rebuilt on swapchain changes get the objects created the first time. The cache keeps the least
+// recently used ones alive while nobody uses them, up to the given count per kind.
+class PipelineCache final {
+public:
+    explicit PipelineCache(const size_t maxCount = DEFAULT_MAX_COUNT);
+
+    ~PipelineCache();
+
+    PipelineCache(const PipelineCache& other) = delete;
+
+    PipelineCache& operator=(const PipelineCache& other) = delete;
+
+public:
+    std::shared_ptr<const SharedShaderModule> GetOrCreateShaderModule(const PipelineKey& key, const std::function<std::shared_ptr<const SharedShaderModule>()>& create);
+
+    std::shared_ptr<const SharedBindGroupLayout> GetOrCreateBindGroupLayout(const PipelineKey& key, const std::function<std::shared_ptr<const SharedBindGroupLayout>()>& create);
+
+    std::shared_ptr<const SharedRenderPipeline> GetOrCreateRenderPipeline(const PipelineKey& key, const std::function<std::shared_ptr<const SharedRenderPipeline>()>& create);
+
+    std::shared_ptr<const SharedComputePipeline> GetOrCreateComputePipeline(const PipelineKey& key, const std::function<std::shared_ptr<const SharedComputePipeline>()>& create);
+
+    // Drops the references of the cache, objects in use stay alive with their users.
+    void Clear();
+
+    PipelineCacheStatistics GetStatistics() const;
+
+private:
+    static const inline size_t DEFAULT_MAX_COUNT{ 512 };
+
+private:
+    prev::common::Cache<std::string, std::shared_ptr<const SharedShaderModule>> m_shaderModules;
+
+    prev::common::Cache<std::string, std::shared_ptr<const SharedBindGroupLayout>> m_bindGroupLayouts;
+
+    prev::common::Cache<std::string, std::shared_ptr<const SharedRenderPipeline>> m_renderPipelines;
+
+    prev::common::Cache<std::string, std::shared_ptr<const SharedComputePipeline>> m_computePipelines;
+};
+} // namespace prev::render::pipeline
+
+#endif // !__PIPELINE_CACHE_H__
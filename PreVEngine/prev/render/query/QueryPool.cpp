@@ -125,6 +125,26 @@ void QueryPool::Resolve(GfxCommandEncoder commandEncoder)
     ++m_index; // advance so the CPU can read this result while the next frame writes the next set
 }
 
+uint32_t QueryPool::GetWriteSlot() const
+{
+    return m_index;
+}
+
+int32_t QueryPool::GetAsyncReadSlot() const
+{
+    return m_asyncMapSlot;
+}
+
+uint32_t QueryPool::GetPoolCount() const
+{
+    return m_poolCount;
+}
+
+uint32_t QueryPool::GetQueryCount() const
+{
+    return m_queryCount;
+}
+
 bool QueryPool::MapSlot(const uint32_t slot, const uint64_t offset, const uint64_t size, void*& outPointer)
 {
     if (!m_resultBuffers[slot]) {
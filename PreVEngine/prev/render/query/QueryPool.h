@@ -99,6 +99,34 @@ public:
         return true;
     }
 
+    template <typename ResultType>
+    bool GetAsyncQueryResults(std::vector<ResultType>& outQueryResults)
+    {
+        if (m_asyncMapSlot < 0) {
+            return false;
+        }
+        const uint32_t slot{ static_cast<uint32_t>(m_asyncMapSlot) };
+        void* pointer{ nullptr };
+        if (!MapSlot(slot, 0, sizeof(uint64_t) * m_queryCount, pointer)) {
+            return false;
+        }
+        outQueryResults.resize(m_queryCount);
+        memcpy(outQueryResults.data(), pointer, sizeof(ResultType) * m_queryCount);
+        UnmapSlot(slot);
+        m_asyncMapSlot = -1;
+        return true;
+    }
+
+    // Slot the next queries are written into, Resolve moves on to the next one.
+    uint32_t GetWriteSlot() const;
+
+    // Slot of the async read in flight, -1 = none.
+    int32_t GetAsyncReadSlot() const;
+
+    uint32_t GetPoolCount() const;
+
+    uint32_t GetQueryCount() const;
+
 public:
     friend class QueryPoolBuilder;
 
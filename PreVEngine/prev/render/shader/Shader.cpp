@@ -1,25 +1,34 @@
 #include "Shader.h"
 
 #include "../../common/Logger.h"
+#include "../../common/SmallVector.h"
 
 #include <algorithm>
 
 namespace prev::render::shader {
 Shader::Shader(GfxDevice device,
-    const std::map<GfxShaderStageFlags, GfxShader>& shaderModules,
+    const std::map<GfxShaderStageFlags, std::shared_ptr<const prev::render::pipeline::SharedShaderModule>>& shaderModules,
     const std::vector<VertexInputBinding>& vertexBindings,
     const std::vector<VertexInputAttribute>& vertexAttributes,
-    GfxBindGroupLayout bindGroupLayout,
+    const std::shared_ptr<const prev::render::pipeline::SharedBindGroupLayout>& bindGroupLayout,
     const std::map<std::string, BindingInfo>& bindingInfos,
     std::unique_ptr<IBindGroupPool> bindGroupPool)
     : m_device{ device }
-    , m_shaderModules{ shaderModules }
+    , m_sharedShaderModules{ shaderModules }
     , m_vertexInputBindings{ vertexBindings }
     , m_vertexInputAttributes{ vertexAttributes }
-    , m_bindGroupLayout{ bindGroupLayout }
+    , m_sharedBindGroupLayout{ bindGroupLayout }
+    , m_bindGroupLayout{ bindGroupLayout->GetHandle() }
     , m_bindingInfos{ bindingInfos }
     , m_bindGroupPool{ std::move(bindGroupPool) }
 {
+    prev::render::pipeline::PipelineKey cacheKey{};
+    for (const auto& [stage, shaderModule] : m_sharedShaderModules) {
+        m_shaderModules[stage] = shaderModule->GetHandle();
+        cacheKey.Add(stage).Add(shaderModule->GetId());
+    }
+    cacheKey.Add(m_sharedBindGroupLayout->GetId());
+    m_cacheKey = cacheKey.GetData();
 }
 
 Shader::~Shader()
@@ -28,12 +37,7 @@ Shader::~Shader()
 
     m_bindGroupPool.reset();
 
-    if (m_bindGroupLayout) {
-        gfxBindGroupLayoutDestroy(m_bindGroupLayout);
-    }
-    for (auto& [stage, shader] : m_shaderModules) {
-        gfxShaderDestroy(shader);
-    }
+    // the modules and the layout go with their last owner, the pipeline cache may keep them
 }
 
 void Shader::BeginFrame(uint32_t frameInFlightIndex)
@@ -50,8 +54,10 @@ GfxBindGroup Shader::UpdateNextBindGroup()
 {
     CheckBindings();
 
-    // Gather entries sorted by binding index (one entry per array element, addressed via arrayElement)
-    std::map<std::string, GfxBindGroupEntry> entriesByName;
+    // One entry per array element, addressed via arrayElement. Bind groups are rebuilt for every draw, the
+    // entries stay off the heap.
+    prev::common::SmallVector<GfxBindGroupEntry, MAX_INLINE_BIND_GROUP_ENTRY_COUNT> entries;
+    entries.reserve(m_bindingInfos.size());
     for (auto& [name, info] : m_bindingInfos) {
         GfxBindGroupEntry entry{};
         entry.binding = info.binding;
@@ -66,12 +72,6 @@ GfxBindGroup Shader::UpdateNextBindGroup()
         } else if (info.type == GFX_BIND_GROUP_ENTRY_TYPE_SAMPLER) {
             entry.resource.sampler = info.sampler;
         }
-        entriesByName[name] = entry;
-    }
-
-    std::vector<GfxBindGroupEntry> entries;
-    entries.reserve(entriesByName.size());
-    for (auto& [key, entry] : entriesByName) {
         entries.push_back(entry);
     }
 
@@ -152,4 +152,9 @@ const std::vector<VertexInputAttribute>& Shader::GetVertexInputAttributes() cons
 {
     return m_vertexInputAttributes;
 }
+
+const std::string& Shader::GetCacheKey() const
+{
+    return m_cacheKey;
+}
 } // namespace prev::render::shader
@@ -5,6 +5,7 @@
 
 #include "../buffer/Buffer.h"
 #include "../buffer/ImageBufferView.h"
+#include "../pipeline/PipelineCache.h"
 #include "../sampler/Sampler.h"
 
 #include "../../core/Core.h"
@@ -51,10 +52,10 @@ private:
     // The bind-group pool (ring vs frame-scoped) is chosen by the builder and injected here, so the
     // shader depends only on the IBindGroupPool interface, not the concrete strategies.
     Shader(GfxDevice device,
-        const std::map<GfxShaderStageFlags, GfxShader>& shaderModules,
+        const std::map<GfxShaderStageFlags, std::shared_ptr<const prev::render::pipeline::SharedShaderModule>>& shaderModules,
         const std::vector<VertexInputBinding>& vertexBindings,
         const std::vector<VertexInputAttribute>& vertexAttributes,
-        GfxBindGroupLayout bindGroupLayout,
+        const std::shared_ptr<const prev::render::pipeline::SharedBindGroupLayout>& bindGroupLayout,
         const std::map<std::string, BindingInfo>& bindingInfos,
         std::unique_ptr<IBindGroupPool> bindGroupPool);
 
@@ -89,23 +90,36 @@ public:
 
     const std::vector<VertexInputAttribute>& GetVertexInputAttributes() const;
 
+    // Identifies the modules and the bind group layout, shaders built the same way share it when the
+    // modules come from the device's pipeline cache.
+    const std::string& GetCacheKey() const;
+
 public:
     friend class ShaderBuilder;
 
 private:
     void CheckBindings() const;
 
+private:
+    static const inline size_t MAX_INLINE_BIND_GROUP_ENTRY_COUNT{ 16 };
+
 private:
     GfxDevice m_device;
 
+    std::map<GfxShaderStageFlags, std::shared_ptr<const prev::render::pipeline::SharedShaderModule>> m_sharedShaderModules;
+
     std::map<GfxShaderStageFlags, GfxShader> m_shaderModules;
 
     std::vector<VertexInputBinding> m_vertexInputBindings;
 
     std::vector<VertexInputAttribute> m_vertexInputAttributes;
 
+    std::shared_ptr<const prev::render::pipeline::SharedBindGroupLayout> m_sharedBindGroupLayout;
+
     GfxBindGroupLayout m_bindGroupLayout{};
 
+    std::string m_cacheKey;
+
     std::map<std::string, BindingInfo> m_bindingInfos;
 
     // Owns the bind-group slots: a fixed ring or a frame-scoped pool, chosen at construction.
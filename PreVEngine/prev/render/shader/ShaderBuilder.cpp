@@ -4,6 +4,7 @@
 #include "FrameScopedBindGroupPool.h"
 
 #include "../../common/Logger.h"
+#include "../../core/device/Device.h"
 #include "../../util/MathUtils.h"
 #include "../../util/Utils.h"
 
@@ -35,12 +36,35 @@ namespace {
         }
         return GFX_SHADER_SOURCE_SPIRV;
     }
+
+    // FNV-1a
+    uint64_t HashByteCode(const std::vector<char>& byteCode)
+    {
+        uint64_t hash{ 14695981039346656037ull };
+        for (const auto byte : byteCode) {
+            hash ^= static_cast<uint8_t>(byte);
+            hash *= 1099511628211ull;
+        }
+        return hash;
+    }
+
+    enum class ShaderModuleSource : uint8_t {
+        BYTE_CODE,
+        PATH
+    };
 } // namespace
+
 ShaderBuilder::ShaderBuilder(GfxDevice device)
     : m_device{ device }
 {
 }
 
+ShaderBuilder::ShaderBuilder(const prev::core::device::Device& device)
+    : m_device{ device }
+    , m_pipelineCache{ &device.GetPipelineCache() }
+{
+}
+
 ShaderBuilder& ShaderBuilder::AddShaderStagePath(GfxShaderStageFlags stage, const std::string& path)
 {
     m_stagePaths.insert({ stage, path });
@@ -125,23 +149,36 @@ ShaderBuilder& ShaderBuilder::SetEntryPointName(const std::string& name)
 
 std::unique_ptr<Shader> ShaderBuilder::Build() const
 {
-    // Build shader modules
-    auto byteCodes{ m_stageByteCodes };
-    for (const auto& [stage, path] : m_stagePaths) {
-        LOGI("ShaderBuilder: Loading shader: %s", path.c_str());
-        byteCodes.insert({ stage, prev::util::file::ReadBinaryFile(path) });
-    }
-
-    // Determine shader source format from file extension
-    std::map<GfxShaderStageFlags, GfxShader> shaderModules;
-    for (const auto& [stage, byteCode] : byteCodes) {
+    // Build shader modules, a stage given by both takes the byte code; the module does not depend on the stage,
+    // so a file with several entry points is loaded once
+    std::map<GfxShaderStageFlags, std::shared_ptr<const prev::render::pipeline::SharedShaderModule>> shaderModules;
+    for (const auto& [stage, byteCode] : m_stageByteCodes) {
+        // Determine shader source format from file extension
         auto it = m_stagePaths.find(stage);
         const GfxShaderSourceType sourceType = (it != m_stagePaths.end()) ? GetShaderSourceType(it->second) : GFX_SHADER_SOURCE_SPIRV;
-        shaderModules[stage] = CreateShaderModule(byteCode, sourceType);
+
+        prev::render::pipeline::PipelineKey key{};
+        key.Add(ShaderModuleSource::BYTE_CODE).Add(sourceType).Add(GetEntryPointName()).Add(HashByteCode(byteCode)).Add(static_cast<uint64_t>(byteCode.size()));
+        shaderModules[stage] = GetShaderModule(key, sourceType, [&byteCode = byteCode]() { return byteCode; });
+    }
+    for (const auto& [stage, path] : m_stagePaths) {
+        if (shaderModules.find(stage) != shaderModules.cend()) {
+            continue;
+        }
+
+        const GfxShaderSourceType sourceType{ GetShaderSourceType(path) };
+
+        // the write time makes a rebuilt shader file a new module, e.g. for a reload of the renderers
+        prev::render::pipeline::PipelineKey key{};
+        key.Add(ShaderModuleSource::PATH).Add(sourceType).Add(GetEntryPointName()).Add(path).Add(prev::util::file::GetLastWriteTime(path));
+        shaderModules[stage] = GetShaderModule(key, sourceType, [&path = path]() {
+            LOGI("ShaderBuilder: Loading shader: %s", path.c_str());
+            return prev::util::file::ReadBinaryFile(path);
+        });
     }
 
     // Build bind group layout
-    GfxBindGroupLayout bindGroupLayout{ CreateBindGroupLayout() };
+    const auto bindGroupLayout{ GetBindGroupLayout() };
 
     // Build binding infos
     std::map<std::string, Shader::BindingInfo> bindingInfos;
@@ -183,12 +220,47 @@ std::unique_ptr<Shader> ShaderBuilder::Build() const
         std::move(bindGroupPool)));
 }
 
+std::shared_ptr<const prev::render::pipeline::SharedShaderModule> ShaderBuilder::GetShaderModule(const prev::render::pipeline::PipelineKey& key, GfxShaderSourceType sourceType, const std::function<std::vector<char>()>& loadCode) const
+{
+    const auto create = [&]() -> std::shared_ptr<const prev::render::pipeline::SharedShaderModule> {
+        return std::make_shared<prev::render::pipeline::SharedShaderModule>(CreateShaderModule(loadCode(), sourceType), [](GfxShader shader) { gfxShaderDestroy(shader); });
+    };
+    return m_pipelineCache ? m_pipelineCache->GetOrCreateShaderModule(key, create) : create();
+}
+
+std::shared_ptr<const prev::render::pipeline::SharedBindGroupLayout> ShaderBuilder::GetBindGroupLayout() const
+{
+    const auto create = [this]() -> std::shared_ptr<const prev::render::pipeline::SharedBindGroupLayout> {
+        return std::make_shared<prev::render::pipeline::SharedBindGroupLayout>(CreateBindGroupLayout(), [](GfxBindGroupLayout layout) { gfxBindGroupLayoutDestroy(layout); });
+    };
+    if (!m_pipelineCache) {
+        return create();
+    }
+
+    // the fields CreateBindGroupLayout takes over
+    prev::render::pipeline::PipelineKey key{};
+    key.Add(static_cast<uint32_t>(m_bindGroupEntries.size()));
+    for (const auto& ds : m_bindGroupEntries) {
+        key.Add(ds.binding).Add(ds.stageFlags).Add(ds.bindingType).Add(ds.count);
+        if (ds.bindingType == GFX_BINDING_TYPE_TEXTURE) {
+            key.Add(ds.textureViewDimension).Add(ds.textureSampleType);
+        } else if (ds.bindingType == GFX_BINDING_TYPE_SAMPLER) {
+            key.Add(ds.samplerNonFiltering);
+        } else if (ds.bindingType == GFX_BINDING_TYPE_STORAGE_TEXTURE) {
+            key.Add(ds.storageTextureFormat).Add(ds.storageTextureViewDimension).Add(ds.storageTextureAccess);
+        } else if (ds.bindingType == GFX_BINDING_TYPE_STORAGE_BUFFER) {
+            key.Add(ds.storageBufferAccess);
+        }
+    }
+    return m_pipelineCache->GetOrCreateBindGroupLayout(key, create);
+}
+
 GfxShader ShaderBuilder::CreateShaderModule(const std::vector<char>& code, GfxShaderSourceType sourceType) const
 {
     GfxShaderDescriptor desc{};
     desc.sType = GFX_STRUCTURE_TYPE_SHADER_DESCRIPTOR;
     desc.sourceType = sourceType;
-    desc.entryPoint = m_entryPointName.empty() ? DEFAULT_ENTRY_POINT_NAME.c_str() : m_entryPointName.c_str();
+    desc.entryPoint = GetEntryPointName().c_str();
 
     std::vector<uint32_t> codeAligned;
     if (sourceType == GFX_SHADER_SOURCE_SPIRV) {
@@ -241,4 +313,9 @@ GfxBindGroupLayout ShaderBuilder::CreateBindGroupLayout() const
     return layout;
 }
 
+const std::string& ShaderBuilder::GetEntryPointName() const
+{
+    return m_entryPointName.empty() ? DEFAULT_ENTRY_POINT_NAME : m_entryPointName;
+}
+
 } // namespace prev::render::shader
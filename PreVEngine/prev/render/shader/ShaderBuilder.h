@@ -3,10 +3,15 @@
 
 #include "Shader.h"
 
+#include <functional>
 #include <map>
 #include <memory>
 #include <vector>
 
+namespace prev::core::device {
+class Device;
+}
+
 namespace prev::render::shader {
 class ShaderBuilder final {
 public:
@@ -87,6 +92,9 @@ public:
 public:
     ShaderBuilder(GfxDevice device);
 
+    // Shares the modules and the bind group layout through the pipeline cache of the device.
+    ShaderBuilder(const prev::core::device::Device& device);
+
     ~ShaderBuilder() = default;
 
 public:
@@ -117,13 +125,21 @@ public:
     std::unique_ptr<Shader> Build() const;
 
 private:
+    std::shared_ptr<const prev::render::pipeline::SharedShaderModule> GetShaderModule(const prev::render::pipeline::PipelineKey& key, GfxShaderSourceType sourceType, const std::function<std::vector<char>()>& loadCode) const;
+
+    std::shared_ptr<const prev::render::pipeline::SharedBindGroupLayout> GetBindGroupLayout() const;
+
     GfxShader CreateShaderModule(const std::vector<char>& code, GfxShaderSourceType sourceType) const;
 
     GfxBindGroupLayout CreateBindGroupLayout() const;
 
+    const std::string& GetEntryPointName() const;
+
 private:
     GfxDevice m_device;
 
+    prev::render::pipeline::PipelineCache* m_pipelineCache{};
+
     std::map<GfxShaderStageFlags, std::string> m_stagePaths;
 
     std::map<GfxShaderStageFlags, std::vector<char>> m_stageByteCodes;
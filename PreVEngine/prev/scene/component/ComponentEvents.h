@@ -0,0 +1,28 @@
+#ifndef __COMPONENT_EVENTS_H__
+#define __COMPONENT_EVENTS_H__
+
+#include "../graph/ISceneNode.h"
+
+#include <cstdint>
+#include <memory>
+#include <typeindex>
+
+namespace prev::scene::component {
+// Posted by NodeComponentHelper once components were added to the node - systems tracking components of a type
+// pick them up here, the nodes do not announce them themselves.
+struct ComponentAddedEvent {
+    std::shared_ptr<graph::ISceneNode> node;
+
+    std::type_index type;
+};
+
+// Posted by NodeComponentHelper on removal and by SceneNode::ShutDown for every type of the node, before the
+// components go away.
+struct ComponentRemovedEvent {
+    uint64_t nodeId;
+
+    std::type_index type;
+};
+} // namespace prev::scene::component
+
+#endif // !__COMPONENT_EVENTS_H__
@@ -94,6 +94,33 @@ public:
         return result;
     }
 
+    // Types with components in the repository.
+    std::vector<std::type_index> GetTypes() const
+    {
+        std::vector<std::type_index> result;
+        result.reserve(m_components.size());
+        for (const auto& [type, components] : m_components) {
+            result.push_back(type);
+        }
+        return result;
+    }
+
+    // Appends to outComponents, any container with push_back.
+    template <typename ComponentType, typename ContainerType>
+    void FindAll(ContainerType& outComponents) const
+    {
+        auto iter{ m_components.find(GetTypeIndex<ComponentType>()) };
+        if (iter == m_components.cend()) {
+            return;
+        }
+
+        for (const auto& component : iter->second) {
+            if (component) {
+                outComponents.push_back(Cast<ComponentType>(component));
+            }
+        }
+    }
+
 private:
     template <typename ComponentType>
     static inline std::shared_ptr<ComponentType> Cast(const std::shared_ptr<IComponent>& component)
@@ -1,13 +1,16 @@
 #ifndef __NODE_COMPONENT_HELPER_H__
 #define __NODE_COMPONENT_HELPER_H__
 
+#include "ComponentEvents.h"
 #include "ComponentRepository.h"
 
 #include "../graph/GraphTraversal.h"
 #include "../graph/ISceneNode.h"
 
 #include "../../common/FlagSet.h"
+#include "../../common/FrameAllocator.h"
 #include "../../common/TagSet.h"
+#include "../../event/EventChannel.h"
 
 #include <memory>
 #include <sstream>
@@ -32,14 +35,22 @@ public:
         return component;
     }
 
+    // Renderers look components up for every node and frame, so the result lives in frame memory - do not keep
+    // it past the frame.
     template <typename ComponentType>
-    static std::vector<std::shared_ptr<ComponentType>> FindAll(const std::shared_ptr<graph::ISceneNode>& root, const prev::common::TagSet& tagSet, const prev::scene::graph::LogicOperation operation = prev::scene::graph::LogicOperation::OR)
+    static prev::common::FrameVector<std::shared_ptr<ComponentType>> FindAll(const std::shared_ptr<graph::ISceneNode>& root, const prev::common::TagSet& tagSet, const prev::scene::graph::LogicOperation operation = prev::scene::graph::LogicOperation::OR)
     {
-        std::vector<std::shared_ptr<ComponentType>> resultComponents;
-        const auto nodes{ prev::scene::graph::GraphTraversal::FindAllByTags(root, tagSet, operation) };
+        prev::common::FrameVector<std::shared_ptr<prev::scene::graph::ISceneNode>> nodes;
+        prev::scene::graph::GraphTraversal::FindAllByTags(root, tagSet, operation, nodes);
+
+        prev::common::FrameVector<std::shared_ptr<ComponentType>> resultComponents;
+        resultComponents.reserve(nodes.size());
         for (const auto& node : nodes) {
-            const auto nodeComponents{ node->GetComponentRepository().GetAll<ComponentType>() };
-            resultComponents.insert(resultComponents.end(), nodeComponents.cbegin(), nodeComponents.cend());
+            const auto& componentRepository{ node->GetComponentRepository() };
+            if (!componentRepository.Contains<ComponentType>()) {
+                throw std::runtime_error("Trying to get components with tag = " + std::string(std::type_index(typeid(ComponentType)).name()) + " that does not exist in this repository.");
+            }
+            componentRepository.FindAll<ComponentType>(resultComponents);
         }
         return resultComponents;
     }
@@ -49,6 +60,8 @@ public:
     {
         node->GetComponentRepository().Add(component);
         node->GetTags() += extraTagSet;
+
+        prev::event::EventChannel::Post(ComponentAddedEvent{ node, std::type_index(typeid(ComponentType)) });
     }
 
     template <typename ComponentType>
@@ -56,11 +69,15 @@ public:
     {
         node->GetComponentRepository().Add<ComponentType>(components);
         node->GetTags() += extraTagSet;
+
+        prev::event::EventChannel::Post(ComponentAddedEvent{ node, std::type_index(typeid(ComponentType)) });
     }
 
     template <typename ComponentType>
     static void RemoveComponents(const std::shared_ptr<prev::scene::graph::ISceneNode>& node, const prev::common::TagSet& extraTagSet = {})
     {
+        prev::event::EventChannel::Post(ComponentRemovedEvent{ node->GetId(), std::type_index(typeid(ComponentType)) });
+
         node->GetComponentRepository().Remove<ComponentType>();
         node->GetTags() -= extraTagSet;
     }
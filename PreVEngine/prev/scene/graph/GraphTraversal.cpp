@@ -18,6 +18,11 @@ std::vector<std::shared_ptr<ISceneNode>> GraphTraversal::FindAllByTags(const std
     return result;
 }
 
+void GraphTraversal::FindAllByTags(const std::shared_ptr<ISceneNode>& root, const prev::common::TagSet& tags, const LogicOperation operation, prev::common::FrameVector<std::shared_ptr<ISceneNode>>& outNodes)
+{
+    FindAllByTagsInternal(root, tags, operation, outNodes);
+}
+
 bool GraphTraversal::HasTags(const std::shared_ptr<ISceneNode>& node, const prev::common::TagSet& tagsToCheck, const LogicOperation operation)
 {
     if (operation == LogicOperation::AND) {
@@ -61,7 +66,8 @@ std::shared_ptr<ISceneNode> GraphTraversal::FindByTagsInternal(const std::shared
     return nullptr;
 }
 
-void GraphTraversal::FindAllByTagsInternal(const std::shared_ptr<ISceneNode>& parent, const prev::common::TagSet& tags, const LogicOperation operation, std::vector<std::shared_ptr<ISceneNode>>& result)
+template <typename ContainerType>
+void GraphTraversal::FindAllByTagsInternal(const std::shared_ptr<ISceneNode>& parent, const prev::common::TagSet& tags, const LogicOperation operation, ContainerType& result)
 {
     if (HasTags(parent, tags, operation)) {
         result.push_back(parent);
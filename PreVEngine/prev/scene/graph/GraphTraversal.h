@@ -3,6 +3,8 @@
 
 #include "ISceneNode.h"
 
+#include "../../common/FrameAllocator.h"
+
 namespace prev::scene::graph {
 enum class LogicOperation {
     OR,
@@ -17,6 +19,9 @@ public:
 
     static std::vector<std::shared_ptr<ISceneNode>> FindAllByTags(const std::shared_ptr<ISceneNode>& root, const prev::common::TagSet& tags, const LogicOperation operation = LogicOperation::OR);
 
+    // Appends to outNodes, for per frame lookups that should not touch the heap.
+    static void FindAllByTags(const std::shared_ptr<ISceneNode>& root, const prev::common::TagSet& tags, const LogicOperation operation, prev::common::FrameVector<std::shared_ptr<ISceneNode>>& outNodes);
+
 private:
     static bool HasTags(const std::shared_ptr<ISceneNode>& node, const prev::common::TagSet& tagsToCheck, const LogicOperation operation);
 
@@ -24,7 +29,8 @@ private:
 
     static std::shared_ptr<ISceneNode> FindByTagsInternal(const std::shared_ptr<ISceneNode>& parent, const prev::common::TagSet& tags, const LogicOperation operation);
 
-    static void FindAllByTagsInternal(const std::shared_ptr<ISceneNode>& parent, const prev::common::TagSet& tags, const LogicOperation operation, std::vector<std::shared_ptr<ISceneNode>>& result);
+    template <typename ContainerType>
+    static void FindAllByTagsInternal(const std::shared_ptr<ISceneNode>& parent, const prev::common::TagSet& tags, const LogicOperation operation, ContainerType& result);
 };
 } // namespace prev::scene::graph
 
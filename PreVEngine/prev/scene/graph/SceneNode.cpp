@@ -1,5 +1,8 @@
 #include "SceneNode.h"
 
+#include "../component/ComponentEvents.h"
+
+#include "../../event/EventChannel.h"
 #include "../../util/Utils.h"
 
 namespace prev::scene::graph {
@@ -35,6 +38,9 @@ void SceneNode::ShutDown()
     }
     RemoveAllChildren();
 
+    for (const auto& type : m_componentsRepository.GetTypes()) {
+        prev::event::EventChannel::Post(component::ComponentRemovedEvent{ m_id, type });
+    }
     m_componentsRepository = {};
     m_tags = {};
 }
@@ -0,0 +1,200 @@
+#include "ParticleDepthSorter.h"
+
+#include <algorithm>
+#include <future>
+#include <limits>
+
+namespace prev::scene::particle {
+ParticleDepthSorter::ParticleDepthSorter(const ParticleSortMode mode, const uint32_t bucketCount)
+    : m_mode{ mode }
+    , m_bucketCount{ std::max(bucketCount, 1u) }
+{
+}
+
+template <typename Task>
+void ParticleDepthSorter::ForEachTask(const Task& task)
+{
+    const uint32_t chunkSize{ (m_count + m_taskCount - 1) / m_taskCount };
+    if (m_taskCount == 1 || !m_threadPool) {
+        for (uint32_t i = 0; i < m_taskCount; ++i) {
+            task(i, std::min(i * chunkSize, m_count), std::min((i + 1) * chunkSize, m_count));
+        }
+        return;
+    }
+
+    std::vector<std::future<void>> futures;
+    futures.reserve(m_taskCount);
+    for (uint32_t i = 0; i < m_taskCount; ++i) {
+        futures.push_back(m_threadPool->Enqueue([&task, i, chunkSize, this]() { task(i, std::min(i * chunkSize, m_count), std::min((i + 1) * chunkSize, m_count)); }));
+    }
+
+    for (auto& future : futures) {
+        future.get();
+    }
+}
+
+void ParticleDepthSorter::Sort(const glm::vec3& viewPosition, const glm::vec3& viewDirection, const std::vector<ParticleSortSource>& sources, ParticleInstance* outInstances, std::vector<ParticleDrawRun>& outRuns)
+{
+    SortInternal(viewPosition, viewDirection, sources, outInstances, outRuns, nullptr);
+}
+
+void ParticleDepthSorter::Sort(const glm::vec3& viewPosition, const glm::vec3& viewDirection, const std::vector<ParticleSortSource>& sources, ParticleInstance* outInstances, std::vector<ParticleDrawRun>& outRuns, prev::common::ThreadPool& threadPool)
+{
+    SortInternal(viewPosition, viewDirection, sources, outInstances, outRuns, &threadPool);
+}
+
+void ParticleDepthSorter::SetMode(const ParticleSortMode mode)
+{
+    m_mode = mode;
+}
+
+ParticleSortMode ParticleDepthSorter::GetMode() const
+{
+    return m_mode;
+}
+
+uint32_t ParticleDepthSorter::GetBucketCount() const
+{
+    return m_bucketCount;
+}
+
+void ParticleDepthSorter::SortInternal(const glm::vec3& viewPosition, const glm::vec3& viewDirection, const std::vector<ParticleSortSource>& sources, ParticleInstance* outInstances, std::vector<ParticleDrawRun>& outRuns, prev::common::ThreadPool* threadPool)
+{
+    outRuns.clear();
+
+    m_sourceOffsets.resize(sources.size());
+    m_count = 0;
+    for (size_t i = 0; i < sources.size(); ++i) {
+        m_sourceOffsets[i] = m_count;
+        m_count += sources[i].count;
+    }
+
+    if (m_count == 0) {
+        return;
+    }
+
+    m_threadPool = threadPool;
+    m_taskCount = 1;
+    if (threadPool && m_count >= 2 * MIN_PARALLEL_TASK_SIZE) {
+        // a pool without threads (emscripten) leaves a single task run in place
+        const uint32_t threadCount{ static_cast<uint32_t>(threadPool->GetThreadCount()) };
+        m_taskCount = std::max(std::min(threadCount, m_count / MIN_PARALLEL_TASK_SIZE), 1u);
+    }
+
+    if (m_mode == ParticleSortMode::RADIX) {
+        ComputeKeys(viewPosition, viewDirection, sources, 1u << RADIX_KEY_BITS);
+        for (uint32_t shift = 0; shift < RADIX_KEY_BITS; shift += RADIX_BITS) {
+            CountingSortPass(shift, (1u << RADIX_BITS) - 1, 1u << RADIX_BITS);
+        }
+    } else {
+        ComputeKeys(viewPosition, viewDirection, sources, m_bucketCount);
+        CountingSortPass(0, std::numeric_limits<uint32_t>::max(), m_bucketCount);
+    }
+
+    Gather(sources, outInstances, outRuns);
+
+    m_threadPool = nullptr;
+}
+
+void ParticleDepthSorter::ComputeKeys(const glm::vec3& viewPosition, const glm::vec3& viewDirection, const std::vector<ParticleSortSource>& sources, const uint32_t keyLevels)
+{
+    m_sourceIndices.resize(m_count);
+    m_depths.resize(m_count);
+    m_items.resize(m_count);
+    m_scratch.resize(m_count);
+
+    for (uint32_t sourceIndex = 0; sourceIndex < static_cast<uint32_t>(sources.size()); ++sourceIndex) {
+        std::fill_n(m_sourceIndices.begin() + m_sourceOffsets[sourceIndex], sources[sourceIndex].count, sourceIndex);
+    }
+
+    const float viewOffset{ glm::dot(viewPosition, viewDirection) };
+
+    std::vector<glm::vec2> taskRanges(m_taskCount, glm::vec2(std::numeric_limits<float>::max(), std::numeric_limits<float>::lowest()));
+    ForEachTask([&](const uint32_t task, const uint32_t begin, const uint32_t end) {
+        if (begin >= end) {
+            return;
+        }
+
+        glm::vec2 range{ taskRanges[task] };
+        for (uint32_t i = begin; i < end; ++i) {
+            const uint32_t sourceIndex{ m_sourceIndices[i] };
+            const auto& instance{ sources[sourceIndex].instances[i - m_sourceOffsets[sourceIndex]] };
+
+            const float depth{ glm::dot(instance.position, viewDirection) - viewOffset };
+            m_depths[i] = depth;
+            range.x = std::min(range.x, depth);
+            range.y = std::max(range.y, depth);
+        }
+        taskRanges[task] = range;
+    });
+
+    float minDepth{ std::numeric_limits<float>::max() };
+    float maxDepth{ std::numeric_limits<float>::lowest() };
+    for (const auto& range : taskRanges) {
+        minDepth = std::min(minDepth, range.x);
+        maxDepth = std::max(maxDepth, range.y);
+    }
+
+    // the farthest particle gets the smallest key
+    const float depthRange{ maxDepth - minDepth };
+    const float scale{ depthRange > 0.0f ? static_cast<float>(keyLevels - 1) / depthRange : 0.0f };
+    ForEachTask([&](const uint32_t, const uint32_t begin, const uint32_t end) {
+        for (uint32_t i = begin; i < end; ++i) {
+            const float key{ (maxDepth - m_depths[i]) * scale };
+            m_items[i] = SortItem{ std::min(static_cast<uint32_t>(key), keyLevels - 1), i };
+        }
+    });
+}
+
+void ParticleDepthSorter::CountingSortPass(const uint32_t shift, const uint32_t digitMask, const uint32_t digitCount)
+{
+    m_histograms.assign(static_cast<size_t>(m_taskCount) * digitCount, 0);
+
+    ForEachTask([&](const uint32_t task, const uint32_t begin, const uint32_t end) {
+        uint32_t* histogram{ m_histograms.data() + static_cast<size_t>(task) * digitCount };
+        for (uint32_t i = begin; i < end; ++i) {
+            ++histogram[(m_items[i].key >> shift) & digitMask];
+        }
+    });
+
+    // digit major, task minor - keeps the pass stable
+    uint32_t offset{ 0 };
+    for (uint32_t digit = 0; digit < digitCount; ++digit) {
+        for (uint32_t task = 0; task < m_taskCount; ++task) {
+            auto& count{ m_histograms[static_cast<size_t>(task) * digitCount + digit] };
+            const uint32_t digitTaskCount{ count };
+            count = offset;
+            offset += digitTaskCount;
+        }
+    }
+
+    ForEachTask([&](const uint32_t task, const uint32_t begin, const uint32_t end) {
+        uint32_t* offsets{ m_histograms.data() + static_cast<size_t>(task) * digitCount };
+        for (uint32_t i = begin; i < end; ++i) {
+            const auto& item{ m_items[i] };
+            m_scratch[offsets[(item.key >> shift) & digitMask]++] = item;
+        }
+    });
+
+    m_items.swap(m_scratch);
+}
+
+void ParticleDepthSorter::Gather(const std::vector<ParticleSortSource>& sources, ParticleInstance* outInstances, std::vector<ParticleDrawRun>& outRuns)
+{
+    ForEachTask([&](const uint32_t, const uint32_t begin, const uint32_t end) {
+        for (uint32_t i = begin; i < end; ++i) {
+            const uint32_t index{ m_items[i].index };
+            const uint32_t sourceIndex{ m_sourceIndices[index] };
+            outInstances[i] = sources[sourceIndex].instances[index - m_sourceOffsets[sourceIndex]];
+        }
+    });
+
+    for (uint32_t i = 0; i < m_count; ++i) {
+        const uint32_t sourceIndex{ m_sourceIndices[m_items[i].index] };
+        if (outRuns.empty() || outRuns.back().sourceIndex != sourceIndex) {
+            outRuns.push_back(ParticleDrawRun{ sourceIndex, i, 0 });
+        }
+        ++outRuns.back().instanceCount;
+    }
+}
+} // namespace prev::scene::particle
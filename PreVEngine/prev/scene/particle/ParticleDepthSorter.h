@@ -0,0 +1,109 @@
+#ifndef __PARTICLE_DEPTH_SORTER_H__
+#define __PARTICLE_DEPTH_SORTER_H__
+
+#include "ParticlePool.h"
+
+#include "../../common/Common.h"
+#include "../../common/ThreadPool.h"
+
+#include <vector>
+
+namespace prev::scene::particle {
+enum class ParticleSortMode {
+    RADIX, // exact order of the depths quantized to 16 bits, two 8 bit counting passes
+    BUCKET // single counting pass over coarse depth slices, particles within a slice keep their order
+};
+
+struct ParticleSortSource {
+    const ParticleInstance* instances{};
+
+    uint32_t count{};
+};
+
+// Consecutive instances of the merged output coming from the same source - one instanced draw each.
+struct ParticleDrawRun {
+    uint32_t sourceIndex{};
+
+    uint32_t firstInstance{};
+
+    uint32_t instanceCount{};
+};
+
+// Orders the instances of any number of particle systems back to front along the view direction and merges them
+// into one array, so particles of overlapping emitters interleave correctly. Both modes are stable counting sorts.
+class ParticleDepthSorter final {
+public:
+    static const inline uint32_t DEFAULT_BUCKET_COUNT{ 1024 };
+
+public:
+    explicit ParticleDepthSorter(const ParticleSortMode mode = ParticleSortMode::RADIX, const uint32_t bucketCount = DEFAULT_BUCKET_COUNT);
+
+    ~ParticleDepthSorter() = default;
+
+public:
+    // outInstances has to hold the sum of all source counts.
+    void Sort(const glm::vec3& viewPosition, const glm::vec3& viewDirection, const std::vector<ParticleSortSource>& sources, ParticleInstance* outInstances, std::vector<ParticleDrawRun>& outRuns);
+
+    // Histograms, scatters and the gather are split over the pool for large inputs.
+    void Sort(const glm::vec3& viewPosition, const glm::vec3& viewDirection, const std::vector<ParticleSortSource>& sources, ParticleInstance* outInstances, std::vector<ParticleDrawRun>& outRuns, prev::common::ThreadPool& threadPool);
+
+    void SetMode(const ParticleSortMode mode);
+
+    ParticleSortMode GetMode() const;
+
+    uint32_t GetBucketCount() const;
+
+private:
+    struct SortItem {
+        uint32_t key{};
+
+        uint32_t index{};
+    };
+
+private:
+    void SortInternal(const glm::vec3& viewPosition, const glm::vec3& viewDirection, const std::vector<ParticleSortSource>& sources, ParticleInstance* outInstances, std::vector<ParticleDrawRun>& outRuns, prev::common::ThreadPool* threadPool);
+
+    void ComputeKeys(const glm::vec3& viewPosition, const glm::vec3& viewDirection, const std::vector<ParticleSortSource>& sources, const uint32_t keyLevels);
+
+    // Stable counting sort of m_items by (key >> shift) & digitMask.
+    void CountingSortPass(const uint32_t shift, const uint32_t digitMask, const uint32_t digitCount);
+
+    void Gather(const std::vector<ParticleSortSource>& sources, ParticleInstance* outInstances, std::vector<ParticleDrawRun>& outRuns);
+
+    template <typename Task>
+    void ForEachTask(const Task& task);
+
+private:
+    static const inline uint32_t MIN_PARALLEL_TASK_SIZE{ 16 * 1024 };
+
+    static const inline uint32_t RADIX_BITS{ 8 };
+
+    static const inline uint32_t RADIX_KEY_BITS{ 16 };
+
+private:
+    ParticleSortMode m_mode;
+
+    uint32_t m_bucketCount;
+
+    // per sort state, kept to reuse the storage
+    prev::common::ThreadPool* m_threadPool{};
+
+    uint32_t m_count{};
+
+    uint32_t m_taskCount{ 1 };
+
+    std::vector<uint32_t> m_sourceOffsets;
+
+    std::vector<uint32_t> m_sourceIndices;
+
+    std::vector<float> m_depths;
+
+    std::vector<SortItem> m_items;
+
+    std::vector<SortItem> m_scratch;
+
+    std::vector<uint32_t> m_histograms;
+};
+} // namespace prev::scene::particle
+
+#endif // !__PARTICLE_DEPTH_SORTER_H__
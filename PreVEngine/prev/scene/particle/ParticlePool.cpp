@@ -0,0 +1,274 @@
+#include "ParticlePool.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define PREV_PARTICLES_SSE
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) && (defined(__aarch64__) || defined(_M_ARM64))
+#define PREV_PARTICLES_NEON
+#include <arm_neon.h>
+#endif
+
+namespace prev::scene::particle {
+static_assert(sizeof(ParticleInstance) == 11 * sizeof(float), "ParticleInstance has to be tightly packed.");
+
+namespace {
+    constexpr uint32_t BATCH_SIZE{ 4 };
+
+    glm::vec2 GetTextureOffset(const int index, const int atlasNumberOfRows)
+    {
+        const int column{ index % atlasNumberOfRows };
+        const int row{ index / atlasNumberOfRows };
+        return glm::vec2(static_cast<float>(column), static_cast<float>(row)) / static_cast<float>(atlasNumberOfRows);
+    }
+} // namespace
+
+ParticlePool::ParticlePool(const uint32_t capacity)
+    : m_capacity{ capacity }
+    , m_positionsX(capacity)
+    , m_positionsY(capacity)
+    , m_positionsZ(capacity)
+    , m_velocitiesX(capacity)
+    , m_velocitiesY(capacity)
+    , m_velocitiesZ(capacity)
+    , m_gravityEffects(capacity)
+    , m_lifeLengths(capacity)
+    , m_elapsedTimes(capacity)
+    , m_rotations(capacity)
+    , m_scales(capacity)
+{
+}
+
+bool ParticlePool::Emit(const glm::vec3& position, const glm::vec3& velocity, const float gravityEffect, const float lifeLength, const float rotation, const float scale)
+{
+    if (m_count >= m_capacity) {
+        return false;
+    }
+
+    const uint32_t index{ m_count++ };
+    m_positionsX[index] = position.x;
+    m_positionsY[index] = position.y;
+    m_positionsZ[index] = position.z;
+    m_velocitiesX[index] = velocity.x;
+    m_velocitiesY[index] = velocity.y;
+    m_velocitiesZ[index] = velocity.z;
+    m_gravityEffects[index] = gravityEffect;
+    m_lifeLengths[index] = lifeLength;
+    m_elapsedTimes[index] = 0.0f;
+    m_rotations[index] = rotation;
+    m_scales[index] = scale;
+    return true;
+}
+
+void ParticlePool::Update(const float deltaTime)
+{
+    Integrate(deltaTime);
+    RemoveExpired();
+    UpdateBoundingBox();
+}
+
+void ParticlePool::WriteInstances(const uint32_t atlasNumberOfRows, ParticleInstance* outInstances) const
+{
+    const int rows{ static_cast<int>(std::max(atlasNumberOfRows, 1u)) };
+    const int stageCount{ rows * rows };
+    const float stageCountFactor{ static_cast<float>(stageCount) };
+
+    for (uint32_t i = 0; i < m_count; ++i) {
+        const float atlasProgression{ std::min(m_elapsedTimes[i] / m_lifeLengths[i], 1.0f) * stageCountFactor };
+        const int currentStage{ std::min(static_cast<int>(atlasProgression), stageCount - 1) };
+        const int nextStage{ std::min(currentStage + 1, stageCount - 1) };
+
+        auto& instance{ outInstances[i] };
+        instance.position = glm::vec3(m_positionsX[i], m_positionsY[i], m_positionsZ[i]);
+        instance.scale = glm::vec2(m_scales[i]);
+        instance.rotation = m_rotations[i];
+        instance.currentStageTextureOffset = GetTextureOffset(currentStage, rows);
+        instance.nextStageTextureOffset = GetTextureOffset(nextStage, rows);
+        instance.stagesBlendFactor = atlasProgression - static_cast<float>(static_cast<int>(atlasProgression));
+    }
+}
+
+void ParticlePool::Clear()
+{
+    m_count = 0;
+    m_boundingBox = {};
+}
+
+uint32_t ParticlePool::GetCount() const
+{
+    return m_count;
+}
+
+uint32_t ParticlePool::GetCapacity() const
+{
+    return m_capacity;
+}
+
+glm::vec3 ParticlePool::GetPosition(const uint32_t index) const
+{
+    assert(index < m_count);
+    return { m_positionsX[index], m_positionsY[index], m_positionsZ[index] };
+}
+
+glm::vec3 ParticlePool::GetVelocity(const uint32_t index) const
+{
+    assert(index < m_count);
+    return { m_velocitiesX[index], m_velocitiesY[index], m_velocitiesZ[index] };
+}
+
+float ParticlePool::GetElapsedTime(const uint32_t index) const
+{
+    assert(index < m_count);
+    return m_elapsedTimes[index];
+}
+
+float ParticlePool::GetGravityEffect(const uint32_t index) const
+{
+    assert(index < m_count);
+    return m_gravityEffects[index];
+}
+
+float ParticlePool::GetLifeLength(const uint32_t index) const
+{
+    assert(index < m_count);
+    return m_lifeLengths[index];
+}
+
+float ParticlePool::GetRotation(const uint32_t index) const
+{
+    assert(index < m_count);
+    return m_rotations[index];
+}
+
+float ParticlePool::GetScale(const uint32_t index) const
+{
+    assert(index < m_count);
+    return m_scales[index];
+}
+
+const prev::util::intersection::AABB& ParticlePool::GetBoundingBox() const
+{
+    return m_boundingBox;
+}
+
+void ParticlePool::Integrate(const float deltaTime)
+{
+    float* px{ m_positionsX.data() };
+    float* py{ m_positionsY.data() };
+    float* pz{ m_positionsZ.data() };
+    const float* vx{ m_velocitiesX.data() };
+    float* vy{ m_velocitiesY.data() };
+    const float* vz{ m_velocitiesZ.data() };
+    const float* gravityEffects{ m_gravityEffects.data() };
+    float* elapsedTimes{ m_elapsedTimes.data() };
+
+    uint32_t i{ 0 };
+#if defined(PREV_PARTICLES_SSE)
+    const __m128 dt{ _mm_set1_ps(deltaTime) };
+    const __m128 gravityDt{ _mm_set1_ps(GRAVITY_Y * deltaTime) };
+    for (; i + BATCH_SIZE <= m_count; i += BATCH_SIZE) {
+        const __m128 newVy{ _mm_add_ps(_mm_loadu_ps(vy + i), _mm_mul_ps(_mm_loadu_ps(gravityEffects + i), gravityDt)) };
+        _mm_storeu_ps(vy + i, newVy);
+        _mm_storeu_ps(px + i, _mm_add_ps(_mm_loadu_ps(px + i), _mm_mul_ps(_mm_loadu_ps(vx + i), dt)));
+        _mm_storeu_ps(py + i, _mm_add_ps(_mm_loadu_ps(py + i), _mm_mul_ps(newVy, dt)));
+        _mm_storeu_ps(pz + i, _mm_add_ps(_mm_loadu_ps(pz + i), _mm_mul_ps(_mm_loadu_ps(vz + i), dt)));
+        _mm_storeu_ps(elapsedTimes + i, _mm_add_ps(_mm_loadu_ps(elapsedTimes + i), dt));
+    }
+#elif defined(PREV_PARTICLES_NEON)
+    const float32x4_t dt{ vdupq_n_f32(deltaTime) };
+    const float32x4_t gravityDt{ vdupq_n_f32(GRAVITY_Y * deltaTime) };
+    for (; i + BATCH_SIZE <= m_count; i += BATCH_SIZE) {
+        const float32x4_t newVy{ vmlaq_f32(vld1q_f32(vy + i), vld1q_f32(gravityEffects + i), gravityDt) };
+        vst1q_f32(vy + i, newVy);
+        vst1q_f32(px + i, vmlaq_f32(vld1q_f32(px + i), vld1q_f32(vx + i), dt));
+        vst1q_f32(py + i, vmlaq_f32(vld1q_f32(py + i), newVy, dt));
+        vst1q_f32(pz + i, vmlaq_f32(vld1q_f32(pz + i), vld1q_f32(vz + i), dt));
+        vst1q_f32(elapsedTimes + i, vaddq_f32(vld1q_f32(elapsedTimes + i), dt));
+    }
+#endif
+    for (; i < m_count; ++i) {
+        vy[i] += gravityEffects[i] * GRAVITY_Y * deltaTime;
+        px[i] += vx[i] * deltaTime;
+        py[i] += vy[i] * deltaTime;
+        pz[i] += vz[i] * deltaTime;
+        elapsedTimes[i] += deltaTime;
+    }
+}
+
+void ParticlePool::RemoveExpired()
+{
+    for (uint32_t i = 0; i < m_count;) {
+        if (m_elapsedTimes[i] < m_lifeLengths[i]) {
+            ++i;
+            continue;
+        }
+
+        // swap and pop - the last particle is moved here and checked in the next iteration
+        const uint32_t last{ --m_count };
+        m_positionsX[i] = m_positionsX[last];
+        m_positionsY[i] = m_positionsY[last];
+        m_positionsZ[i] = m_positionsZ[last];
+        m_velocitiesX[i] = m_velocitiesX[last];
+        m_velocitiesY[i] = m_velocitiesY[last];
+        m_velocitiesZ[i] = m_velocitiesZ[last];
+        m_gravityEffects[i] = m_gravityEffects[last];
+        m_lifeLengths[i] = m_lifeLengths[last];
+        m_elapsedTimes[i] = m_elapsedTimes[last];
+        m_rotations[i] = m_rotations[last];
+        m_scales[i] = m_scales[last];
+    }
+}
+
+void ParticlePool::UpdateBoundingBox()
+{
+    const float* positions[3]{ m_positionsX.data(), m_positionsY.data(), m_positionsZ.data() };
+
+    prev::util::intersection::AABB boundingBox{};
+    for (int axis = 0; axis < 3; ++axis) {
+        const float* values{ positions[axis] };
+        float minValue{ boundingBox.minExtents[axis] };
+        float maxValue{ boundingBox.maxExtents[axis] };
+
+        uint32_t i{ 0 };
+#if defined(PREV_PARTICLES_SSE)
+        if (m_count >= BATCH_SIZE) {
+            __m128 minValues{ _mm_set1_ps(minValue) };
+            __m128 maxValues{ _mm_set1_ps(maxValue) };
+            for (; i + BATCH_SIZE <= m_count; i += BATCH_SIZE) {
+                const __m128 v{ _mm_loadu_ps(values + i) };
+                minValues = _mm_min_ps(minValues, v);
+                maxValues = _mm_max_ps(maxValues, v);
+            }
+            alignas(16) float minLanes[BATCH_SIZE];
+            alignas(16) float maxLanes[BATCH_SIZE];
+            _mm_store_ps(minLanes, minValues);
+            _mm_store_ps(maxLanes, maxValues);
+            minValue = std::min({ minLanes[0], minLanes[1], minLanes[2], minLanes[3] });
+            maxValue = std::max({ maxLanes[0], maxLanes[1], maxLanes[2], maxLanes[3] });
+        }
+#elif defined(PREV_PARTICLES_NEON)
+        if (m_count >= BATCH_SIZE) {
+            float32x4_t minValues{ vdupq_n_f32(minValue) };
+            float32x4_t maxValues{ vdupq_n_f32(maxValue) };
+            for (; i + BATCH_SIZE <= m_count; i += BATCH_SIZE) {
+                const float32x4_t v{ vld1q_f32(values + i) };
+                minValues = vminq_f32(minValues, v);
+                maxValues = vmaxq_f32(maxValues, v);
+            }
+            minValue = vminvq_f32(minValues);
+            maxValue = vmaxvq_f32(maxValues);
+        }
+#endif
+        for (; i < m_count; ++i) {
+            minValue = std::min(minValue, values[i]);
+            maxValue = std::max(maxValue, values[i]);
+        }
+        boundingBox.minExtents[axis] = minValue;
+        boundingBox.maxExtents[axis] = maxValue;
+    }
+    m_boundingBox = boundingBox;
+}
+} // namespace prev::scene::particle
@@ -0,0 +1,107 @@
+#ifndef __PARTICLE_POOL_H__
+#define __PARTICLE_POOL_H__
+
+#include "../../common/Common.h"
+#include "../../util/intersection/AABB.h"
+
+#include <vector>
+
+namespace prev::scene::particle {
+// Per instance vertex data of one particle, tightly packed as the particle shaders expect it.
+struct ParticleInstance {
+    glm::vec3 position;
+
+    glm::vec2 scale;
+
+    float rotation;
+
+    glm::vec2 currentStageTextureOffset;
+
+    glm::vec2 nextStageTextureOffset;
+
+    float stagesBlendFactor;
+};
+
+// Fixed capacity particle storage with one array per attribute. Expired particles are replaced by the last one,
+// so the particles do not keep their emission order.
+class ParticlePool final {
+public:
+    static const inline float GRAVITY_Y{ -9.81f };
+
+public:
+    explicit ParticlePool(const uint32_t capacity);
+
+    ~ParticlePool() = default;
+
+public:
+    // Returns false when the pool is full.
+    bool Emit(const glm::vec3& position, const glm::vec3& velocity, const float gravityEffect, const float lifeLength, const float rotation, const float scale);
+
+    // Integrates all particles, removes the expired ones and recomputes the bounding box.
+    void Update(const float deltaTime);
+
+    // Writes GetCount() instances, texture atlas stages are derived from the particle age.
+    void WriteInstances(const uint32_t atlasNumberOfRows, ParticleInstance* outInstances) const;
+
+    void Clear();
+
+public:
+    uint32_t GetCount() const;
+
+    uint32_t GetCapacity() const;
+
+    glm::vec3 GetPosition(const uint32_t index) const;
+
+    glm::vec3 GetVelocity(const uint32_t index) const;
+
+    float GetElapsedTime(const uint32_t index) const;
+
+    float GetGravityEffect(const uint32_t index) const;
+
+    float GetLifeLength(const uint32_t index) const;
+
+    float GetRotation(const uint32_t index) const;
+
+    float GetScale(const uint32_t index) const;
+
+    const prev::util::intersection::AABB& GetBoundingBox() const;
+
+private:
+    void Integrate(const float deltaTime);
+
+    void RemoveExpired();
+
+    void UpdateBoundingBox();
+
+private:
+    uint32_t m_capacity;
+
+    uint32_t m_count{};
+
+    std::vector<float> m_positionsX;
+
+    std::vector<float> m_positionsY;
+
+    std::vector<float> m_positionsZ;
+
+    std::vector<float> m_velocitiesX;
+
+    std::vector<float> m_velocitiesY;
+
+    std::vector<float> m_velocitiesZ;
+
+    std::vector<float> m_gravityEffects;
+
+    std::vector<float> m_lifeLengths;
+
+    std::vector<float> m_elapsedTimes;
+
+    std::vector<float> m_rotations;
+
+    std::vector<float> m_scales;
+
+    prev::util::intersection::AABB m_boundingBox{};
+};
+} // namespace prev::scene::particle
+
+#endif // !__PARTICLE_POOL_H__
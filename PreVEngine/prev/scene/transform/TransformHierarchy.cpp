@@ -0,0 +1,406 @@
+#include "TransformHierarchy.h"
+
+#include "../../util/MathUtils.h"
+
+#include <algorithm>
+#include <cassert>
+#include <future>
+
+namespace prev::scene::transform {
+namespace {
+    template <typename T>
+    void Permute(std::vector<T>& values, const std::vector<uint32_t>& newToOldIndex)
+    {
+        std::vector<T> permuted;
+        permuted.reserve(newToOldIndex.size());
+        for (const auto oldIndex : newToOldIndex) {
+            permuted.push_back(values[oldIndex]);
+        }
+        values = std::move(permuted);
+    }
+} // namespace
+
+uint32_t TransformHierarchy::Create(const glm::vec3& position, const glm::quat& orientation, const glm::vec3& scale, const uint32_t parent)
+{
+    uint32_t handle{};
+    if (m_freeHandles.empty()) {
+        handle = static_cast<uint32_t>(m_indices.size());
+        m_indices.push_back(INVALID_HANDLE);
+        m_parentHandles.push_back(INVALID_HANDLE);
+        m_firstChildHandles.push_back(INVALID_HANDLE);
+        m_nextSiblingHandles.push_back(INVALID_HANDLE);
+    } else {
+        handle = m_freeHandles.back();
+        m_freeHandles.pop_back();
+    }
+
+    const uint32_t index{ static_cast<uint32_t>(m_handles.size()) };
+    m_indices[handle] = index;
+    m_handles.push_back(handle);
+    m_parents.push_back(INVALID_HANDLE);
+    m_subtreeSizes.push_back(1);
+    m_positions.push_back(position);
+    m_orientations.push_back(orientation);
+    m_scales.push_back(scale);
+    m_worldTransforms.push_back(glm::mat4(1.0f));
+    m_worldTransformsScaled.push_back(glm::mat4(1.0f));
+    m_normalMatrices.push_back(glm::mat4(1.0f));
+    m_versions.push_back(0);
+    m_parentVersions.push_back(0);
+    m_dirty.push_back(0);
+    ++m_count;
+
+    // roots are appended in a valid order, children need the order to be rebuilt
+    if (parent != INVALID_HANDLE) {
+        Link(handle, parent);
+    }
+    MarkDirty(index);
+    return handle;
+}
+
+void TransformHierarchy::Destroy(const uint32_t handle)
+{
+    const uint32_t index{ m_indices[handle] };
+    assert(index != INVALID_HANDLE);
+
+    for (uint32_t child = m_firstChildHandles[handle]; child != INVALID_HANDLE;) {
+        const uint32_t nextChild{ m_nextSiblingHandles[child] };
+        m_parentHandles[child] = INVALID_HANDLE;
+        m_nextSiblingHandles[child] = INVALID_HANDLE;
+        m_parents[m_indices[child]] = INVALID_HANDLE;
+        MarkDirty(m_indices[child]);
+        child = nextChild;
+    }
+    m_firstChildHandles[handle] = INVALID_HANDLE;
+    Unlink(handle);
+
+    // the slot stays in the arrays until the order is rebuilt
+    m_handles[index] = INVALID_HANDLE;
+    m_dirty[index] = 0;
+    m_indices[handle] = INVALID_HANDLE;
+    m_freeHandles.push_back(handle);
+    m_orderDirty = true;
+    --m_count;
+}
+
+void TransformHierarchy::SetParent(const uint32_t handle, const uint32_t parent)
+{
+    assert(handle != parent);
+    if (m_parentHandles[handle] == parent) {
+        return;
+    }
+
+    Unlink(handle);
+    if (parent != INVALID_HANDLE) {
+        Link(handle, parent);
+    }
+    MarkDirty(m_indices[handle]);
+}
+
+uint32_t TransformHierarchy::GetParent(const uint32_t handle) const
+{
+    return m_parentHandles[handle];
+}
+
+void TransformHierarchy::SetPosition(const uint32_t handle, const glm::vec3& position)
+{
+    const uint32_t index{ m_indices[handle] };
+    if (m_positions[index] != position) {
+        m_positions[index] = position;
+        MarkDirty(index);
+    }
+}
+
+void TransformHierarchy::SetOrientation(const uint32_t handle, const glm::quat& orientation)
+{
+    const uint32_t index{ m_indices[handle] };
+    if (m_orientations[index] != orientation) {
+        m_orientations[index] = orientation;
+        MarkDirty(index);
+    }
+}
+
+void TransformHierarchy::SetScale(const uint32_t handle, const glm::vec3& scale)
+{
+    const uint32_t index{ m_indices[handle] };
+    if (m_scales[index] != scale) {
+        m_scales[index] = scale;
+        MarkDirty(index);
+    }
+}
+
+const glm::vec3& TransformHierarchy::GetPosition(const uint32_t handle) const
+{
+    return m_positions[m_indices[handle]];
+}
+
+const glm::quat& TransformHierarchy::GetOrientation(const uint32_t handle) const
+{
+    return m_orientations[m_indices[handle]];
+}
+
+const glm::vec3& TransformHierarchy::GetScale(const uint32_t handle) const
+{
+    return m_scales[m_indices[handle]];
+}
+
+const glm::mat4& TransformHierarchy::GetWorldTransform(const uint32_t handle) const
+{
+    return m_worldTransforms[m_indices[handle]];
+}
+
+const glm::mat4& TransformHierarchy::GetWorldTransformScaled(const uint32_t handle) const
+{
+    return m_worldTransformsScaled[m_indices[handle]];
+}
+
+const glm::mat4& TransformHierarchy::GetNormalMatrix(const uint32_t handle) const
+{
+    return m_normalMatrices[m_indices[handle]];
+}
+
+uint64_t TransformHierarchy::GetVersion(const uint32_t handle) const
+{
+    return m_versions[m_indices[handle]];
+}
+
+uint32_t TransformHierarchy::GetCount() const
+{
+    return m_count;
+}
+
+bool TransformHierarchy::UpdateNode(const uint32_t handle)
+{
+    return UpdateIndex(m_indices[handle]);
+}
+
+void TransformHierarchy::Update()
+{
+    for (const auto& range : CollectDirtyRanges()) {
+        UpdateRange(range);
+    }
+}
+
+void TransformHierarchy::Update(prev::common::ThreadPool& threadPool)
+{
+    const auto ranges{ CollectDirtyRanges() };
+
+    uint32_t totalSize{};
+    for (const auto& range : ranges) {
+        totalSize += range.end - range.begin;
+    }
+
+    const uint32_t threadCount{ static_cast<uint32_t>(threadPool.GetThreadCount()) };
+    if (totalSize < 2 * MIN_PARALLEL_TASK_SIZE || threadCount == 0) {
+        for (const auto& range : ranges) {
+            UpdateRange(range);
+        }
+        return;
+    }
+
+    const uint32_t maxTaskSize{ std::max(totalSize / threadCount, MIN_PARALLEL_TASK_SIZE) };
+
+    std::vector<Range> tasks;
+    for (const auto& range : ranges) {
+        SplitRange(range, maxTaskSize, tasks);
+    }
+
+    // small neighbouring subtrees are merged into one job
+    std::vector<std::future<void>> futures;
+    for (size_t first = 0; first < tasks.size();) {
+        size_t last{ first };
+        uint32_t jobSize{};
+        while (last < tasks.size() && (jobSize == 0 || jobSize + tasks[last].end - tasks[last].begin <= maxTaskSize)) {
+            jobSize += tasks[last].end - tasks[last].begin;
+            ++last;
+        }
+
+        futures.push_back(threadPool.Enqueue([this, &tasks, first, last]() {
+            for (size_t i = first; i < last; ++i) {
+                UpdateRange(tasks[i]);
+            }
+        }));
+        first = last;
+    }
+
+    for (auto& future : futures) {
+        future.get();
+    }
+}
+
+void TransformHierarchy::MarkDirty(const uint32_t index)
+{
+    if (!m_dirty[index]) {
+        m_dirty[index] = 1;
+        m_dirtyHandles.push_back(m_handles[index]);
+    }
+}
+
+bool TransformHierarchy::UpdateIndex(const uint32_t index)
+{
+    const uint32_t parent{ m_parents[index] };
+    const uint64_t parentVersion{ parent != INVALID_HANDLE ? m_versions[parent] : 0 };
+    if (!m_dirty[index] && parentVersion == m_parentVersions[index]) {
+        return false;
+    }
+
+    const auto localTransform{ prev::util::math::CreateTransformationMatrix(m_positions[index], m_orientations[index], glm::vec3(1.0f)) };
+    m_worldTransforms[index] = parent != INVALID_HANDLE ? m_worldTransforms[parent] * localTransform : localTransform;
+    m_worldTransformsScaled[index] = glm::scale(m_worldTransforms[index], m_scales[index]);
+    m_normalMatrices[index] = glm::transpose(glm::inverse(m_worldTransformsScaled[index]));
+
+    m_dirty[index] = 0;
+    m_parentVersions[index] = parentVersion;
+    ++m_versions[index];
+    return true;
+}
+
+void TransformHierarchy::UpdateRange(const Range& range)
+{
+    // parents precede their children within a subtree range
+    for (uint32_t index = range.begin; index < range.end; ++index) {
+        UpdateIndex(index);
+    }
+}
+
+std::vector<TransformHierarchy::Range> TransformHierarchy::CollectDirtyRanges()
+{
+    std::vector<Range> ranges;
+    if (m_dirtyHandles.empty()) {
+        return ranges;
+    }
+
+    if (m_orderDirty) {
+        RebuildOrder();
+    }
+
+    std::vector<uint32_t> dirtyIndices;
+    dirtyIndices.reserve(m_dirtyHandles.size());
+    for (const auto handle : m_dirtyHandles) {
+        if (handle < m_indices.size() && m_indices[handle] != INVALID_HANDLE) {
+            dirtyIndices.push_back(m_indices[handle]);
+        }
+    }
+    m_dirtyHandles.clear();
+
+    std::sort(dirtyIndices.begin(), dirtyIndices.end());
+
+    // a dirty node inside an already collected subtree is covered by it
+    uint32_t coveredEnd{ 0 };
+    for (const auto index : dirtyIndices) {
+        if (index < coveredEnd) {
+            continue;
+        }
+        coveredEnd = index + m_subtreeSizes[index];
+        ranges.push_back({ index, coveredEnd });
+    }
+    return ranges;
+}
+
+void TransformHierarchy::SplitRange(const Range& range, const uint32_t maxTaskSize, std::vector<Range>& outTasks)
+{
+    if (range.end - range.begin <= maxTaskSize) {
+        outTasks.push_back(range);
+        return;
+    }
+
+    // the subtree root is updated right away, its children subtrees become independent tasks
+    UpdateIndex(range.begin);
+    for (uint32_t child = range.begin + 1; child < range.end; child += m_subtreeSizes[child]) {
+        SplitRange({ child, child + m_subtreeSizes[child] }, maxTaskSize, outTasks);
+    }
+}
+
+void TransformHierarchy::Link(const uint32_t handle, const uint32_t parent)
+{
+    m_parentHandles[handle] = parent;
+    m_nextSiblingHandles[handle] = m_firstChildHandles[parent];
+    m_firstChildHandles[parent] = handle;
+    m_parents[m_indices[handle]] = m_indices[parent];
+    m_orderDirty = true;
+}
+
+void TransformHierarchy::Unlink(const uint32_t handle)
+{
+    const uint32_t parent{ m_parentHandles[handle] };
+    if (parent == INVALID_HANDLE) {
+        return;
+    }
+
+    if (m_firstChildHandles[parent] == handle) {
+        m_firstChildHandles[parent] = m_nextSiblingHandles[handle];
+    } else {
+        uint32_t sibling{ m_firstChildHandles[parent] };
+        while (m_nextSiblingHandles[sibling] != handle) {
+            sibling = m_nextSiblingHandles[sibling];
+        }
+        m_nextSiblingHandles[sibling] = m_nextSiblingHandles[handle];
+    }
+
+    m_parentHandles[handle] = INVALID_HANDLE;
+    m_nextSiblingHandles[handle] = INVALID_HANDLE;
+    m_parents[m_indices[handle]] = INVALID_HANDLE;
+    m_orderDirty = true;
+}
+
+void TransformHierarchy::RebuildOrder()
+{
+    // depth first from every root, keeping the current relative order of the roots
+    std::vector<uint32_t> orderedHandles;
+    orderedHandles.reserve(m_count);
+
+    std::vector<uint32_t> stack;
+    for (const auto rootHandle : m_handles) {
+        if (rootHandle == INVALID_HANDLE || m_parentHandles[rootHandle] != INVALID_HANDLE) {
+            continue;
+        }
+
+        stack.push_back(rootHandle);
+        while (!stack.empty()) {
+            const uint32_t handle{ stack.back() };
+            stack.pop_back();
+
+            orderedHandles.push_back(handle);
+            for (uint32_t child = m_firstChildHandles[handle]; child != INVALID_HANDLE; child = m_nextSiblingHandles[child]) {
+                stack.push_back(child);
+            }
+        }
+    }
+    assert(orderedHandles.size() == m_count);
+
+    std::vector<uint32_t> newToOldIndex(orderedHandles.size());
+    for (uint32_t newIndex = 0; newIndex < orderedHandles.size(); ++newIndex) {
+        newToOldIndex[newIndex] = m_indices[orderedHandles[newIndex]];
+        m_indices[orderedHandles[newIndex]] = newIndex;
+    }
+
+    Permute(m_positions, newToOldIndex);
+    Permute(m_orientations, newToOldIndex);
+    Permute(m_scales, newToOldIndex);
+    Permute(m_worldTransforms, newToOldIndex);
+    Permute(m_worldTransformsScaled, newToOldIndex);
+    Permute(m_normalMatrices, newToOldIndex);
+    Permute(m_versions, newToOldIndex);
+    Permute(m_parentVersions, newToOldIndex);
+    Permute(m_dirty, newToOldIndex);
+    m_handles = orderedHandles;
+
+    m_parents.assign(orderedHandles.size(), INVALID_HANDLE);
+    m_subtreeSizes.assign(orderedHandles.size(), 1);
+    for (uint32_t index = 0; index < orderedHandles.size(); ++index) {
+        const uint32_t parentHandle{ m_parentHandles[orderedHandles[index]] };
+        if (parentHandle != INVALID_HANDLE) {
+            m_parents[index] = m_indices[parentHandle];
+        }
+    }
+
+    // children follow their parents, so sizes accumulate in a single reverse pass
+    for (uint32_t index = static_cast<uint32_t>(orderedHandles.size()); index-- > 0;) {
+        if (m_parents[index] != INVALID_HANDLE) {
+            m_subtreeSizes[m_parents[index]] += m_subtreeSizes[index];
+        }
+    }
+
+    m_orderDirty = false;
+}
+} // namespace prev::scene::transform
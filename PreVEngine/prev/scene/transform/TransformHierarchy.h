@@ -0,0 +1,144 @@
+#ifndef __TRANSFORM_HIERARCHY_H__
+#define __TRANSFORM_HIERARCHY_H__
+
+#include "../../common/Common.h"
+#include "../../common/ThreadPool.h"
+
+#include <limits>
+#include <vector>
+
+namespace prev::scene::transform {
+// Local and world transforms stored in flat arrays kept in parent-before-child (depth first) order,
+// so every subtree is a contiguous range. Update recomputes only the subtrees of changed transforms,
+// world, scaled world and normal matrices are cached until the next change.
+class TransformHierarchy final {
+public:
+    static constexpr uint32_t INVALID_HANDLE{ std::numeric_limits<uint32_t>::max() };
+
+public:
+    TransformHierarchy() = default;
+
+    ~TransformHierarchy() = default;
+
+public:
+    uint32_t Create(const glm::vec3& position, const glm::quat& orientation, const glm::vec3& scale, const uint32_t parent = INVALID_HANDLE);
+
+    // Children of the destroyed transform become roots.
+    void Destroy(const uint32_t handle);
+
+    void SetParent(const uint32_t handle, const uint32_t parent);
+
+    uint32_t GetParent(const uint32_t handle) const;
+
+    // Setters mark the transform dirty only when the value really changes.
+    void SetPosition(const uint32_t handle, const glm::vec3& position);
+
+    void SetOrientation(const uint32_t handle, const glm::quat& orientation);
+
+    void SetScale(const uint32_t handle, const glm::vec3& scale);
+
+    const glm::vec3& GetPosition(const uint32_t handle) const;
+
+    const glm::quat& GetOrientation(const uint32_t handle) const;
+
+    const glm::vec3& GetScale(const uint32_t handle) const;
+
+    // World transform without the node's own scale, children are attached to this one.
+    const glm::mat4& GetWorldTransform(const uint32_t handle) const;
+
+    const glm::mat4& GetWorldTransformScaled(const uint32_t handle) const;
+
+    // Inverse transpose of the scaled world transform.
+    const glm::mat4& GetNormalMatrix(const uint32_t handle) const;
+
+    // Incremented on every recomputation of the world transform.
+    uint64_t GetVersion(const uint32_t handle) const;
+
+    uint32_t GetCount() const;
+
+public:
+    // Brings a single transform up to date - expects its parent to be up to date already.
+    // Returns true when the world transform was recomputed.
+    bool UpdateNode(const uint32_t handle);
+
+    void Update();
+
+    // Independent dirty subtrees are spread over the pool, large subtrees are split at their children.
+    void Update(prev::common::ThreadPool& threadPool);
+
+private:
+    struct Range {
+        uint32_t begin{};
+
+        uint32_t end{};
+    };
+
+private:
+    void MarkDirty(const uint32_t index);
+
+    bool UpdateIndex(const uint32_t index);
+
+    void UpdateRange(const Range& range);
+
+    std::vector<Range> CollectDirtyRanges();
+
+    void SplitRange(const Range& range, const uint32_t maxTaskSize, std::vector<Range>& outTasks);
+
+    void Link(const uint32_t handle, const uint32_t parent);
+
+    void Unlink(const uint32_t handle);
+
+    void RebuildOrder();
+
+private:
+    static const inline uint32_t MIN_PARALLEL_TASK_SIZE{ 1024 };
+
+private:
+    // handle -> index and back, indices change when the order is rebuilt
+    std::vector<uint32_t> m_indices;
+
+    std::vector<uint32_t> m_handles;
+
+    std::vector<uint32_t> m_freeHandles;
+
+    // structure by handle, survives reordering
+    std::vector<uint32_t> m_parentHandles;
+
+    std::vector<uint32_t> m_firstChildHandles;
+
+    std::vector<uint32_t> m_nextSiblingHandles;
+
+    // data by index
+    std::vector<uint32_t> m_parents;
+
+    std::vector<uint32_t> m_subtreeSizes;
+
+    std::vector<glm::vec3> m_positions;
+
+    std::vector<glm::quat> m_orientations;
+
+    std::vector<glm::vec3> m_scales;
+
+    std::vector<glm::mat4> m_worldTransforms;
+
+    std::vector<glm::mat4> m_worldTransformsScaled;
+
+    std::vector<glm::mat4> m_normalMatrices;
+
+    std::vector<uint64_t> m_versions;
+
+    // parent version the world transform was computed from
+    std::vector<uint64_t> m_parentVersions;
+
+    std::vector<uint8_t> m_dirty;
+
+    // handles changed since the last Update, may contain duplicates
+    std::vector<uint32_t> m_dirtyHandles;
+
+    uint32_t m_count{};
+
+    bool m_orderDirty{ false };
+};
+} // namespace prev::scene::transform
+
+#endif // !__TRANSFORM_HIERARCHY_H__
@@ -2,6 +2,7 @@
 #define __GFX_UTILS_H__
 
 #include "../core/Core.h"
+#include "../render/image/CompressedImage.h"
 
 #include <stdexcept>
 #include <string>
@@ -35,6 +36,30 @@ inline GfxFormat ToImageFormat(const uint32_t channels, const uint32_t bitDepth,
         }
     }
 }
+
+inline GfxFormat ToImageFormat(const prev::render::image::CompressedImageFormat format, const bool srgb = false)
+{
+    switch (format) {
+    case prev::render::image::CompressedImageFormat::BC1_RGBA:
+        return srgb ? GFX_FORMAT_BC1_RGBA_UNORM_SRGB : GFX_FORMAT_BC1_RGBA_UNORM;
+    case prev::render::image::CompressedImageFormat::BC3_RGBA:
+        return srgb ? GFX_FORMAT_BC3_RGBA_UNORM_SRGB : GFX_FORMAT_BC3_RGBA_UNORM;
+    case prev::render::image::CompressedImageFormat::BC4_R:
+        return GFX_FORMAT_BC4_R_UNORM;
+    case prev::render::image::CompressedImageFormat::BC5_RG:
+        return GFX_FORMAT_BC5_RG_UNORM;
+    case prev::render::image::CompressedImageFormat::BC7_RGBA:
+        return srgb ? GFX_FORMAT_BC7_RGBA_UNORM_SRGB : GFX_FORMAT_BC7_RGBA_UNORM;
+    case prev::render::image::CompressedImageFormat::ETC2_RGB8:
+        return srgb ? GFX_FORMAT_ETC2_R8G8B8_UNORM_SRGB : GFX_FORMAT_ETC2_R8G8B8_UNORM;
+    case prev::render::image::CompressedImageFormat::ETC2_RGBA8:
+        return srgb ? GFX_FORMAT_ETC2_R8G8B8A8_UNORM_SRGB : GFX_FORMAT_ETC2_R8G8B8A8_UNORM;
+    case prev::render::image::CompressedImageFormat::ASTC_4x4_RGBA:
+        return srgb ? GFX_FORMAT_ASTC_4x4_UNORM_SRGB : GFX_FORMAT_ASTC_4x4_UNORM;
+    default:
+        throw std::invalid_argument("Unsupported compressed image format: " + std::to_string(static_cast<int>(format)));
+    }
+}
 } // namespace prev::util::gfx
 
 #endif // !__GFX_UTILS_H__
@@ -38,6 +38,11 @@ namespace file {
         return true;
     }
 
+    uint64_t GetLastWriteTime(const std::string& filePath)
+    {
+        return 0;
+    }
+
     std::string ReadTextFile(const std::string& filePath)
     {
         AAsset* file = android_open_asset(filePath.c_str(), AASSET_MODE_BUFFER);
@@ -70,6 +75,16 @@ namespace file {
         return std::filesystem::exists(filePath);
     }
 
+    uint64_t GetLastWriteTime(const std::string& filePath)
+    {
+        std::error_code errorCode;
+        const auto lastWriteTime{ std::filesystem::last_write_time(filePath, errorCode) };
+        if (errorCode) {
+            return 0;
+        }
+        return static_cast<uint64_t>(lastWriteTime.time_since_epoch().count());
+    }
+
     std::string ReadTextFile(const std::string& filePath)
     {
         std::ifstream stream(filePath, std::fstream::in);
@@ -27,6 +27,9 @@ namespace file {
 
     bool Exists(const std::string& filePath);
 
+    // Changes whenever the file is written, 0 when unknown - packaged assets never change.
+    uint64_t GetLastWriteTime(const std::string& filePath);
+
     std::string ReadTextFile(const std::string& filePath);
 
     std::vector<char> ReadBinaryFile(const std::string& filePath);
@@ -229,7 +232,7 @@ private:
 class RandomNumberGenerator {
 public:
     RandomNumberGenerator()
-        : m_gen(std::random_device()())
+        : m_gen(GenerateDefaultSeed())
     {
     }
 
@@ -243,6 +246,29 @@ public:
         return m_gen;
     }
 
+    // Makes the default constructed generators reproducible: each gets the seed plus the count of those created
+    // before it, the sequence repeats as long as they are created in the same order. 0 restores random seeds.
+    static void SetDefaultSeed(unsigned long seed)
+    {
+        m_defaultSeed = seed;
+        m_defaultSeedSequence = 0;
+    }
+
+private:
+    static unsigned long GenerateDefaultSeed()
+    {
+        const unsigned long defaultSeed{ m_defaultSeed };
+        if (defaultSeed == 0) {
+            return std::random_device()();
+        }
+        return defaultSeed + m_defaultSeedSequence++;
+    }
+
+private:
+    static inline std::atomic<unsigned long> m_defaultSeed{ 0 };
+
+    static inline std::atomic<unsigned long> m_defaultSeedSequence{ 0 };
+
 private:
     std::default_random_engine m_gen;
 };
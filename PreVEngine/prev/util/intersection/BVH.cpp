@@ -0,0 +1,598 @@
+#include "BVH.h"
+#include "IntersectionTester.h"
+
+#include <algorithm>
+#include <cassert>
+#include <queue>
+
+namespace prev::util::intersection {
+namespace {
+    constexpr float EPSILON{ 1e-4f };
+
+    constexpr float MIN_DIRECTION{ 1e-8f };
+
+    AABB Combine(const AABB& box1, const AABB& box2)
+    {
+        return AABB{ glm::min(box1.minExtents, box2.minExtents), glm::max(box1.maxExtents, box2.maxExtents) };
+    }
+
+    bool Contains(const AABB& outer, const AABB& inner)
+    {
+        return outer.minExtents.x <= inner.minExtents.x && outer.minExtents.y <= inner.minExtents.y && outer.minExtents.z <= inner.minExtents.z
+            && outer.maxExtents.x >= inner.maxExtents.x && outer.maxExtents.y >= inner.maxExtents.y && outer.maxExtents.z >= inner.maxExtents.z;
+    }
+
+    float GetSurfaceArea(const AABB& box)
+    {
+        const glm::vec3 size{ box.GetSize() };
+        return 2.0f * (size.x * size.y + size.y * size.z + size.z * size.x);
+    }
+
+    float GetDistanceSquared(const AABB& box, const glm::vec3& point)
+    {
+        const glm::vec3 closestPoint{ glm::clamp(point, box.minExtents, box.maxExtents) };
+        const glm::vec3 diff{ closestPoint - point };
+        return glm::dot(diff, diff);
+    }
+
+    // Slab test with precomputed inverse direction - entry distance is clamped to the ray origin.
+    bool IntersectsSlabs(const glm::vec3& origin, const glm::vec3& inverseDirection, const AABB& box, const float maxDistance, float& outEntryDistance)
+    {
+        const glm::vec3 t1{ (box.minExtents - origin) * inverseDirection };
+        const glm::vec3 t2{ (box.maxExtents - origin) * inverseDirection };
+        const glm::vec3 tNear{ glm::min(t1, t2) };
+        const glm::vec3 tFar{ glm::max(t1, t2) };
+
+        const float tMin{ std::max(std::max(tNear.x, tNear.y), std::max(tNear.z, 0.0f)) };
+        const float tMax{ std::min(std::min(tFar.x, tFar.y), std::min(tFar.z, maxDistance)) };
+
+        outEntryDistance = tMin;
+        return tMin <= tMax;
+    }
+
+    // Conservative box vs. frustum test (positive vertex per plane), no separating axis tests.
+    bool IntersectsPlanes(const Frustum& frustum, const AABB& box)
+    {
+        for (const auto& plane : frustum.planes) {
+            const glm::vec3 positiveVertex{
+                plane.normal.x >= 0.0f ? box.maxExtents.x : box.minExtents.x,
+                plane.normal.y >= 0.0f ? box.maxExtents.y : box.minExtents.y,
+                plane.normal.z >= 0.0f ? box.maxExtents.z : box.minExtents.z
+            };
+            if (glm::dot(plane.normal, positiveVertex) < plane.distance - EPSILON) {
+                return false;
+            }
+        }
+        return true;
+    }
+} // namespace
+
+BVH::BVH(const float fatMargin)
+    : m_fatMargin{ fatMargin }
+{
+}
+
+uint32_t BVH::Insert(const AABB& box, const uint64_t userData)
+{
+    const uint32_t proxyId{ AllocateNode() };
+    auto& node{ m_nodes[proxyId] };
+    node.box = AABB{ box.minExtents - glm::vec3(m_fatMargin), box.maxExtents + glm::vec3(m_fatMargin) };
+    node.userData = userData;
+    node.height = 0;
+
+    InsertLeaf(proxyId);
+    ++m_proxyCount;
+    return proxyId;
+}
+
+void BVH::Remove(const uint32_t proxyId)
+{
+    assert(proxyId < m_nodes.size() && m_nodes[proxyId].IsLeaf());
+
+    RemoveLeaf(proxyId);
+    FreeNode(proxyId);
+    --m_proxyCount;
+}
+
+bool BVH::Update(const uint32_t proxyId, const AABB& box)
+{
+    assert(proxyId < m_nodes.size() && m_nodes[proxyId].IsLeaf());
+
+    if (Contains(m_nodes[proxyId].box, box)) {
+        return false;
+    }
+
+    RemoveLeaf(proxyId);
+    m_nodes[proxyId].box = AABB{ box.minExtents - glm::vec3(m_fatMargin), box.maxExtents + glm::vec3(m_fatMargin) };
+    InsertLeaf(proxyId);
+    return true;
+}
+
+void BVH::Clear()
+{
+    m_root = INVALID_ID;
+    m_proxyCount = 0;
+    m_nodes.clear();
+    m_freeNodes.clear();
+}
+
+uint64_t BVH::GetUserData(const uint32_t proxyId) const
+{
+    assert(proxyId < m_nodes.size());
+    return m_nodes[proxyId].userData;
+}
+
+const AABB& BVH::GetFatAABB(const uint32_t proxyId) const
+{
+    assert(proxyId < m_nodes.size());
+    return m_nodes[proxyId].box;
+}
+
+uint32_t BVH::GetProxyCount() const
+{
+    return m_proxyCount;
+}
+
+uint32_t BVH::GetCapacity() const
+{
+    return static_cast<uint32_t>(m_nodes.size());
+}
+
+uint32_t BVH::GetHeight() const
+{
+    if (m_root == INVALID_ID) {
+        return 0;
+    }
+    return static_cast<uint32_t>(m_nodes[m_root].height);
+}
+
+bool BVH::RayCastClosest(const Ray& ray, const RayCastCallback& callback, uint64_t& outUserData, RayCastResult& outResult) const
+{
+    return RayCast(ray, callback, false, outUserData, outResult);
+}
+
+bool BVH::RayCastAny(const Ray& ray, const RayCastCallback& callback, uint64_t& outUserData, RayCastResult& outResult) const
+{
+    return RayCast(ray, callback, true, outUserData, outResult);
+}
+
+void BVH::Query(const AABB& box, const QueryCallback& callback) const
+{
+    Traverse([&box](const AABB& nodeBox) { return tester::Intersects(box, nodeBox); }, callback);
+}
+
+void BVH::Query(const Sphere& sphere, const QueryCallback& callback) const
+{
+    Traverse([&sphere](const AABB& nodeBox) { return tester::Intersects(sphere, nodeBox); }, callback);
+}
+
+void BVH::Query(const Frustum& frustum, const QueryCallback& callback) const
+{
+    Traverse([&frustum](const AABB& nodeBox) { return IntersectsPlanes(frustum, nodeBox); }, callback);
+}
+
+void BVH::Cull(const Frustum& frustum, PlaneCache& planeCache, const CullCallback& callback, CullingStats* outStats) const
+{
+    constexpr uint32_t PLANE_COUNT{ 6 };
+    constexpr uint8_t ALL_PLANES_MASK{ (1 << PLANE_COUNT) - 1 };
+
+    struct StackItem {
+        uint32_t nodeId{};
+
+        uint8_t planeMask{};
+    };
+
+    if (planeCache.size() < m_nodes.size()) {
+        planeCache.resize(m_nodes.size(), 0);
+    }
+
+    CullingStats stats{};
+    if (m_root == INVALID_ID) {
+        if (outStats) {
+            *outStats = stats;
+        }
+        return;
+    }
+
+    std::vector<StackItem> stack;
+    stack.reserve(64);
+    stack.push_back({ m_root, ALL_PLANES_MASK });
+    while (!stack.empty()) {
+        const auto item{ stack.back() };
+        stack.pop_back();
+
+        const auto& node{ m_nodes[item.nodeId] };
+        ++stats.nodeTests;
+
+        uint8_t planeMask{ item.planeMask };
+        if (planeMask != 0) {
+            const glm::vec3 center{ node.box.GetCenter() };
+            const glm::vec3 halfSize{ node.box.GetSize() * 0.5f };
+
+            auto& lastRejectingPlane{ planeCache[item.nodeId] };
+            bool rejected{ false };
+            for (uint32_t i = 0; i < PLANE_COUNT && !rejected; ++i) {
+                const uint32_t planeIndex{ (lastRejectingPlane + i) % PLANE_COUNT };
+                if ((planeMask & (1 << planeIndex)) == 0) {
+                    continue;
+                }
+
+                const auto& plane{ frustum.planes[planeIndex] };
+                const float distance{ glm::dot(plane.normal, center) - plane.distance };
+                const float radius{ glm::dot(glm::abs(plane.normal), halfSize) };
+                ++stats.planeTests;
+
+                if (distance + radius < -EPSILON) {
+                    lastRejectingPlane = static_cast<uint8_t>(planeIndex);
+                    rejected = true;
+                } else if (distance - radius >= 0.0f) {
+                    planeMask &= ~(1 << planeIndex); // the whole subtree is on the inner side
+                }
+            }
+
+            if (rejected) {
+                continue;
+            }
+        }
+
+        if (node.IsLeaf()) {
+            callback(item.nodeId);
+        } else {
+            stack.push_back({ node.left, planeMask });
+            stack.push_back({ node.right, planeMask });
+        }
+    }
+
+    if (outStats) {
+        *outStats = stats;
+    }
+}
+
+std::vector<BVH::NearestResult> BVH::FindNearest(const glm::vec3& point, const uint32_t count, const DistanceCallback& distanceCallback) const
+{
+    struct Candidate {
+        float distance{};
+
+        uint32_t nodeId{};
+
+        bool resolved{};
+
+        bool operator>(const Candidate& other) const
+        {
+            return distance > other.distance;
+        }
+    };
+
+    std::vector<NearestResult> result;
+    if (m_root == INVALID_ID || count == 0) {
+        return result;
+    }
+
+    std::priority_queue<Candidate, std::vector<Candidate>, std::greater<Candidate>> candidates;
+    candidates.push({ std::sqrt(GetDistanceSquared(m_nodes[m_root].box, point)), m_root, false });
+
+    while (!candidates.empty() && result.size() < count) {
+        const auto candidate{ candidates.top() };
+        candidates.pop();
+
+        const auto& node{ m_nodes[candidate.nodeId] };
+        if (candidate.resolved) {
+            result.push_back({ node.userData, candidate.distance });
+        } else if (node.IsLeaf()) {
+            // the exact distance is never smaller than the fat box distance, so it can go back to the queue
+            const float exactDistance{ distanceCallback ? distanceCallback(node.userData, point) : candidate.distance };
+            candidates.push({ exactDistance, candidate.nodeId, true });
+        } else {
+            candidates.push({ std::sqrt(GetDistanceSquared(m_nodes[node.left].box, point)), node.left, false });
+            candidates.push({ std::sqrt(GetDistanceSquared(m_nodes[node.right].box, point)), node.right, false });
+        }
+    }
+    return result;
+}
+
+uint32_t BVH::AllocateNode()
+{
+    if (m_freeNodes.empty()) {
+        m_nodes.emplace_back();
+        return static_cast<uint32_t>(m_nodes.size() - 1);
+    }
+
+    const uint32_t nodeId{ m_freeNodes.back() };
+    m_freeNodes.pop_back();
+    m_nodes[nodeId] = {};
+    return nodeId;
+}
+
+void BVH::FreeNode(const uint32_t nodeId)
+{
+    m_nodes[nodeId].height = -1;
+    m_freeNodes.push_back(nodeId);
+}
+
+void BVH::InsertLeaf(const uint32_t leafId)
+{
+    if (m_root == INVALID_ID) {
+        m_root = leafId;
+        m_nodes[leafId].parent = INVALID_ID;
+        return;
+    }
+
+    // descend to the sibling with the smallest surface area heuristic cost
+    const AABB leafBox{ m_nodes[leafId].box };
+    uint32_t index{ m_root };
+    while (!m_nodes[index].IsLeaf()) {
+        const auto& node{ m_nodes[index] };
+
+        const float area{ GetSurfaceArea(node.box) };
+        const float combinedArea{ GetSurfaceArea(Combine(node.box, leafBox)) };
+
+        // cost of creating a new parent for this node and the new leaf
+        const float cost{ 2.0f * combinedArea };
+
+        // minimum cost of pushing the leaf further down the tree
+        const float inheritanceCost{ 2.0f * (combinedArea - area) };
+
+        const auto GetDescendCost = [&](const uint32_t childId) {
+            const auto& child{ m_nodes[childId] };
+            const float newArea{ GetSurfaceArea(Combine(child.box, leafBox)) };
+            return (child.IsLeaf() ? newArea : newArea - GetSurfaceArea(child.box)) + inheritanceCost;
+        };
+
+        const float leftCost{ GetDescendCost(node.left) };
+        const float rightCost{ GetDescendCost(node.right) };
+        if (cost < leftCost && cost < rightCost) {
+            break;
+        }
+
+        index = leftCost < rightCost ? node.left : node.right;
+    }
+
+    const uint32_t siblingId{ index };
+    const uint32_t oldParentId{ m_nodes[siblingId].parent };
+    const uint32_t newParentId{ AllocateNode() };
+
+    auto& newParent{ m_nodes[newParentId] };
+    newParent.parent = oldParentId;
+    newParent.box = Combine(leafBox, m_nodes[siblingId].box);
+    newParent.height = m_nodes[siblingId].height + 1;
+    newParent.left = siblingId;
+    newParent.right = leafId;
+
+    if (oldParentId != INVALID_ID) {
+        auto& oldParent{ m_nodes[oldParentId] };
+        if (oldParent.left == siblingId) {
+            oldParent.left = newParentId;
+        } else {
+            oldParent.right = newParentId;
+        }
+    } else {
+        m_root = newParentId;
+    }
+
+    m_nodes[siblingId].parent = newParentId;
+    m_nodes[leafId].parent = newParentId;
+
+    Refit(newParentId);
+}
+
+void BVH::RemoveLeaf(const uint32_t leafId)
+{
+    if (leafId == m_root) {
+        m_root = INVALID_ID;
+        return;
+    }
+
+    const uint32_t parentId{ m_nodes[leafId].parent };
+    const uint32_t grandParentId{ m_nodes[parentId].parent };
+    const uint32_t siblingId{ m_nodes[parentId].left == leafId ? m_nodes[parentId].right : m_nodes[parentId].left };
+
+    if (grandParentId != INVALID_ID) {
+        auto& grandParent{ m_nodes[grandParentId] };
+        if (grandParent.left == parentId) {
+            grandParent.left = siblingId;
+        } else {
+            grandParent.right = siblingId;
+        }
+        m_nodes[siblingId].parent = grandParentId;
+        FreeNode(parentId);
+
+        Refit(grandParentId);
+    } else {
+        m_root = siblingId;
+        m_nodes[siblingId].parent = INVALID_ID;
+        FreeNode(parentId);
+    }
+}
+
+void BVH::Refit(uint32_t nodeId)
+{
+    while (nodeId != INVALID_ID) {
+        nodeId = Balance(nodeId);
+
+        auto& node{ m_nodes[nodeId] };
+        const auto& left{ m_nodes[node.left] };
+        const auto& right{ m_nodes[node.right] };
+        node.height = 1 + std::max(left.height, right.height);
+        node.box = Combine(left.box, right.box);
+
+        nodeId = node.parent;
+    }
+}
+
+uint32_t BVH::Balance(const uint32_t nodeId)
+{
+    auto& a{ m_nodes[nodeId] };
+    if (a.IsLeaf() || a.height < 2) {
+        return nodeId;
+    }
+
+    const uint32_t bId{ a.left };
+    const uint32_t cId{ a.right };
+    auto& b{ m_nodes[bId] };
+    auto& c{ m_nodes[cId] };
+
+    const auto ReplaceInParent = [this](const uint32_t parentId, const uint32_t oldChildId, const uint32_t newChildId) {
+        if (parentId == INVALID_ID) {
+            m_root = newChildId;
+        } else if (m_nodes[parentId].left == oldChildId) {
+            m_nodes[parentId].left = newChildId;
+        } else {
+            m_nodes[parentId].right = newChildId;
+        }
+    };
+
+    const int32_t balance{ c.height - b.height };
+    if (balance > 1) { // rotate C up
+        const uint32_t fId{ c.left };
+        const uint32_t gId{ c.right };
+        auto& f{ m_nodes[fId] };
+        auto& g{ m_nodes[gId] };
+
+        c.left = nodeId;
+        c.parent = a.parent;
+        a.parent = cId;
+        ReplaceInParent(c.parent, nodeId, cId);
+
+        if (f.height > g.height) {
+            c.right = fId;
+            a.right = gId;
+            g.parent = nodeId;
+            a.box = Combine(b.box, g.box);
+            c.box = Combine(a.box, f.box);
+            a.height = 1 + std::max(b.height, g.height);
+            c.height = 1 + std::max(a.height, f.height);
+        } else {
+            c.right = gId;
+            a.right = fId;
+            f.parent = nodeId;
+            a.box = Combine(b.box, f.box);
+            c.box = Combine(a.box, g.box);
+            a.height = 1 + std::max(b.height, f.height);
+            c.height = 1 + std::max(a.height, g.height);
+        }
+        return cId;
+    }
+
+    if (balance < -1) { // rotate B up
+        const uint32_t dId{ b.left };
+        const uint32_t eId{ b.right };
+        auto& d{ m_nodes[dId] };
+        auto& e{ m_nodes[eId] };
+
+        b.left = nodeId;
+        b.parent = a.parent;
+        a.parent = bId;
+        ReplaceInParent(b.parent, nodeId, bId);
+
+        if (d.height > e.height) {
+            b.right = dId;
+            a.left = eId;
+            e.parent = nodeId;
+            a.box = Combine(c.box, e.box);
+            b.box = Combine(a.box, d.box);
+            a.height = 1 + std::max(c.height, e.height);
+            b.height = 1 + std::max(a.height, d.height);
+        } else {
+            b.right = eId;
+            a.left = dId;
+            d.parent = nodeId;
+            a.box = Combine(c.box, d.box);
+            b.box = Combine(a.box, e.box);
+            a.height = 1 + std::max(c.height, d.height);
+            b.height = 1 + std::max(a.height, e.height);
+        }
+        return bId;
+    }
+    return nodeId;
+}
+
+template <typename NodeTest>
+void BVH::Traverse(const NodeTest& nodeTest, const QueryCallback& callback) const
+{
+    if (m_root == INVALID_ID) {
+        return;
+    }
+
+    std::vector<uint32_t> stack;
+    stack.reserve(64);
+    stack.push_back(m_root);
+    while (!stack.empty()) {
+        const auto& node{ m_nodes[stack.back()] };
+        stack.pop_back();
+
+        if (!nodeTest(node.box)) {
+            continue;
+        }
+
+        if (node.IsLeaf()) {
+            if (!callback(node.userData)) {
+                return;
+            }
+        } else {
+            stack.push_back(node.left);
+            stack.push_back(node.right);
+        }
+    }
+}
+
+bool BVH::RayCast(const Ray& ray, const RayCastCallback& callback, const bool anyHit, uint64_t& outUserData, RayCastResult& outResult) const
+{
+    if (m_root == INVALID_ID) {
+        return false;
+    }
+
+    glm::vec3 inverseDirection;
+    for (glm::length_t i = 0; i < inverseDirection.length(); ++i) {
+        inverseDirection[i] = 1.0f / (std::abs(ray.direction[i]) < MIN_DIRECTION ? MIN_DIRECTION : ray.direction[i]);
+    }
+
+    // the ray length is not a limit here - the same as for tester::Intersects(ray, ...)
+    float closestDistance{ std::numeric_limits<float>::max() };
+    bool hit{ false };
+
+    std::vector<uint32_t> stack;
+    stack.reserve(64);
+    stack.push_back(m_root);
+    while (!stack.empty()) {
+        const auto& node{ m_nodes[stack.back()] };
+        stack.pop_back();
+
+        float entryDistance{};
+        if (!IntersectsSlabs(ray.origin, inverseDirection, node.box, closestDistance, entryDistance)) {
+            continue;
+        }
+
+        if (node.IsLeaf()) {
+            RayCastResult result{};
+            if (callback(node.userData, result) && result.t < closestDistance) {
+                closestDistance = result.t;
+                outUserData = node.userData;
+                outResult = result;
+                hit = true;
+                if (anyHit) {
+                    return true;
+                }
+            }
+        } else {
+            // visit the nearer child first so the closest hit shrinks the search early
+            float leftDistance{}, rightDistance{};
+            const bool leftHit{ IntersectsSlabs(ray.origin, inverseDirection, m_nodes[node.left].box, closestDistance, leftDistance) };
+            const bool rightHit{ IntersectsSlabs(ray.origin, inverseDirection, m_nodes[node.right].box, closestDistance, rightDistance) };
+            if (leftHit && rightHit) {
+                if (leftDistance < rightDistance) {
+                    stack.push_back(node.right);
+                    stack.push_back(node.left);
+                } else {
+                    stack.push_back(node.left);
+                    stack.push_back(node.right);
+                }
+            } else if (leftHit) {
+                stack.push_back(node.left);
+            } else if (rightHit) {
+                stack.push_back(node.right);
+            }
+        }
+    }
+    return hit;
+}
+} // namespace prev::util::intersection
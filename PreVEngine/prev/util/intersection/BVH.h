@@ -0,0 +1,143 @@
+#ifndef __BVH_H__
+#define __BVH_H__
+
+#include "AABB.h"
+#include "Frustum.h"
+#include "Ray.h"
+#include "RayCastResult.h"
+#include "Sphere.h"
+
+#include <functional>
+#include <limits>
+#include <vector>
+
+namespace prev::util::intersection {
+// Dynamic AABB tree - leaves hold fattened boxes so small movements do not touch the tree structure.
+// The tree only knows the boxes, exact tests against the enclosed volumes are done by the query callbacks.
+class BVH final {
+public:
+    static constexpr uint32_t INVALID_ID{ std::numeric_limits<uint32_t>::max() };
+
+    struct NearestResult {
+        uint64_t userData{};
+
+        float distance{};
+    };
+
+    // Exact ray test against the volume behind userData, fills result on hit.
+    using RayCastCallback = std::function<bool(const uint64_t userData, prev::util::intersection::RayCastResult& result)>;
+
+    // Called per overlapping leaf, returning false stops the query.
+    using QueryCallback = std::function<bool(const uint64_t userData)>;
+
+    // Exact distance from point to the volume behind userData.
+    using DistanceCallback = std::function<float(const uint64_t userData, const glm::vec3& point)>;
+
+    // Called per visible leaf with its proxy id.
+    using CullCallback = std::function<void(const uint32_t proxyId)>;
+
+    // Frame to frame state of Cull for one frustum - the plane that rejected each node last time.
+    using PlaneCache = std::vector<uint8_t>;
+
+    struct CullingStats {
+        uint32_t nodeTests{};
+
+        uint32_t planeTests{};
+    };
+
+public:
+    BVH(const float fatMargin = 0.1f);
+
+    ~BVH() = default;
+
+public:
+    uint32_t Insert(const AABB& box, const uint64_t userData);
+
+    void Remove(const uint32_t proxyId);
+
+    // Returns true when the proxy left its fat box and had to be reinserted.
+    bool Update(const uint32_t proxyId, const AABB& box);
+
+    void Clear();
+
+    uint64_t GetUserData(const uint32_t proxyId) const;
+
+    const AABB& GetFatAABB(const uint32_t proxyId) const;
+
+    uint32_t GetProxyCount() const;
+
+    uint32_t GetHeight() const;
+
+    // Proxy ids are always below this value.
+    uint32_t GetCapacity() const;
+
+public:
+    bool RayCastClosest(const Ray& ray, const RayCastCallback& callback, uint64_t& outUserData, RayCastResult& outResult) const;
+
+    bool RayCastAny(const Ray& ray, const RayCastCallback& callback, uint64_t& outUserData, RayCastResult& outResult) const;
+
+    void Query(const AABB& box, const QueryCallback& callback) const;
+
+    void Query(const Sphere& sphere, const QueryCallback& callback) const;
+
+    void Query(const Frustum& frustum, const QueryCallback& callback) const;
+
+    // Best-first search - without distanceCallback the distance to the leaf fat box is used.
+    std::vector<NearestResult> FindNearest(const glm::vec3& point, const uint32_t count, const DistanceCallback& distanceCallback = {}) const;
+
+    // Hierarchical culling by the frustum planes - planes a node lies fully inside of are not tested for its subtree
+    // and the plane that rejected a node in the previous call is tested first. Leaves are culled by their fat box.
+    void Cull(const Frustum& frustum, PlaneCache& planeCache, const CullCallback& callback, CullingStats* outStats = nullptr) const;
+
+private:
+    struct Node {
+        AABB box{};
+
+        uint64_t userData{};
+
+        uint32_t parent{ INVALID_ID };
+
+        uint32_t left{ INVALID_ID };
+
+        uint32_t right{ INVALID_ID };
+
+        int32_t height{ -1 };
+
+        bool IsLeaf() const
+        {
+            return left == INVALID_ID;
+        }
+    };
+
+private:
+    uint32_t AllocateNode();
+
+    void FreeNode(const uint32_t nodeId);
+
+    void InsertLeaf(const uint32_t leafId);
+
+    void RemoveLeaf(const uint32_t leafId);
+
+    void Refit(uint32_t nodeId);
+
+    uint32_t Balance(const uint32_t nodeId);
+
+    template <typename NodeTest>
+    void Traverse(const NodeTest& nodeTest, const QueryCallback& callback) const;
+
+    bool RayCast(const Ray& ray, const RayCastCallback& callback, const bool anyHit, uint64_t& outUserData, RayCastResult& outResult) const;
+
+private:
+    float m_fatMargin{};
+
+    uint32_t m_root{ INVALID_ID };
+
+    uint32_t m_proxyCount{};
+
+    std::vector<Node> m_nodes;
+
+    std::vector<uint32_t> m_freeNodes;
+};
+} // namespace prev::util::intersection
+
+#endif // !__BVH_H__
@@ -0,0 +1,354 @@
+#include "FrustumCuller.h"
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+
+#if defined(__AVX__)
+#define PREV_CULLING_AVX
+#include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define PREV_CULLING_SSE
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) && (defined(__aarch64__) || defined(_M_ARM64))
+#define PREV_CULLING_NEON
+#include <arm_neon.h>
+#endif
+
+namespace prev::util::intersection {
+namespace {
+    constexpr uint32_t BATCH_SIZE{ 8 };
+
+    constexpr uint32_t BITS_PER_WORD{ 64 };
+
+    constexpr float EPSILON{ 1e-4f };
+
+    // plane with precomputed |n| for the box extent projection, box is outside when dot(n, c) + dot(|n|, e) < d
+    struct CullingPlane {
+        float nx, ny, nz;
+
+        float ax, ay, az;
+
+        float d;
+    };
+
+    // planes plus the box around frustum corners - the same separating axes as tester::Intersects(frustum, box)
+    struct CullingFrustum {
+        std::array<CullingPlane, 6> planes;
+
+        float minX, minY, minZ;
+
+        float maxX, maxY, maxZ;
+    };
+
+    CullingFrustum ToCullingFrustum(const Frustum& frustum)
+    {
+        CullingFrustum result{};
+        for (size_t i = 0; i < frustum.planes.size(); ++i) {
+            const auto& plane{ frustum.planes[i] };
+            result.planes[i] = { plane.normal.x, plane.normal.y, plane.normal.z, std::abs(plane.normal.x), std::abs(plane.normal.y), std::abs(plane.normal.z), plane.distance - EPSILON };
+        }
+
+        glm::vec3 minBound{ std::numeric_limits<float>::max() };
+        glm::vec3 maxBound{ -std::numeric_limits<float>::max() };
+        for (const auto& point : frustum.points) {
+            minBound = glm::min(minBound, point.position);
+            maxBound = glm::max(maxBound, point.position);
+        }
+        result.minX = minBound.x - EPSILON;
+        result.minY = minBound.y - EPSILON;
+        result.minZ = minBound.z - EPSILON;
+        result.maxX = maxBound.x + EPSILON;
+        result.maxY = maxBound.y + EPSILON;
+        result.maxZ = maxBound.z + EPSILON;
+        return result;
+    }
+
+    struct BoxBatch {
+        const float* cx;
+
+        const float* cy;
+
+        const float* cz;
+
+        const float* ex;
+
+        const float* ey;
+
+        const float* ez;
+    };
+
+#if defined(PREV_CULLING_AVX)
+    uint32_t TestBatch(const BoxBatch& boxes, const CullingFrustum& frustum)
+    {
+        const __m256 cx{ _mm256_loadu_ps(boxes.cx) };
+        const __m256 cy{ _mm256_loadu_ps(boxes.cy) };
+        const __m256 cz{ _mm256_loadu_ps(boxes.cz) };
+        const __m256 ex{ _mm256_loadu_ps(boxes.ex) };
+        const __m256 ey{ _mm256_loadu_ps(boxes.ey) };
+        const __m256 ez{ _mm256_loadu_ps(boxes.ez) };
+
+        __m256 inside{ _mm256_cmp_ps(_mm256_add_ps(cx, ex), _mm256_set1_ps(frustum.minX), _CMP_GE_OQ) };
+        inside = _mm256_and_ps(inside, _mm256_cmp_ps(_mm256_add_ps(cy, ey), _mm256_set1_ps(frustum.minY), _CMP_GE_OQ));
+        inside = _mm256_and_ps(inside, _mm256_cmp_ps(_mm256_add_ps(cz, ez), _mm256_set1_ps(frustum.minZ), _CMP_GE_OQ));
+        inside = _mm256_and_ps(inside, _mm256_cmp_ps(_mm256_sub_ps(cx, ex), _mm256_set1_ps(frustum.maxX), _CMP_LE_OQ));
+        inside = _mm256_and_ps(inside, _mm256_cmp_ps(_mm256_sub_ps(cy, ey), _mm256_set1_ps(frustum.maxY), _CMP_LE_OQ));
+        inside = _mm256_and_ps(inside, _mm256_cmp_ps(_mm256_sub_ps(cz, ez), _mm256_set1_ps(frustum.maxZ), _CMP_LE_OQ));
+        for (const auto& plane : frustum.planes) {
+            __m256 distance{ _mm256_mul_ps(cx, _mm256_set1_ps(plane.nx)) };
+            distance = _mm256_add_ps(distance, _mm256_mul_ps(cy, _mm256_set1_ps(plane.ny)));
+            distance = _mm256_add_ps(distance, _mm256_mul_ps(cz, _mm256_set1_ps(plane.nz)));
+            distance = _mm256_add_ps(distance, _mm256_mul_ps(ex, _mm256_set1_ps(plane.ax)));
+            distance = _mm256_add_ps(distance, _mm256_mul_ps(ey, _mm256_set1_ps(plane.ay)));
+            distance = _mm256_add_ps(distance, _mm256_mul_ps(ez, _mm256_set1_ps(plane.az)));
+            inside = _mm256_and_ps(inside, _mm256_cmp_ps(distance, _mm256_set1_ps(plane.d), _CMP_GE_OQ));
+        }
+        return static_cast<uint32_t>(_mm256_movemask_ps(inside));
+    }
+#elif defined(PREV_CULLING_SSE)
+    uint32_t TestHalfBatch(const BoxBatch& boxes, const uint32_t offset, const CullingFrustum& frustum)
+    {
+        const __m128 cx{ _mm_loadu_ps(boxes.cx + offset) };
+        const __m128 cy{ _mm_loadu_ps(boxes.cy + offset) };
+        const __m128 cz{ _mm_loadu_ps(boxes.cz + offset) };
+        const __m128 ex{ _mm_loadu_ps(boxes.ex + offset) };
+        const __m128 ey{ _mm_loadu_ps(boxes.ey + offset) };
+        const __m128 ez{ _mm_loadu_ps(boxes.ez + offset) };
+
+        __m128 inside{ _mm_cmpge_ps(_mm_add_ps(cx, ex), _mm_set1_ps(frustum.minX)) };
+        inside = _mm_and_ps(inside, _mm_cmpge_ps(_mm_add_ps(cy, ey), _mm_set1_ps(frustum.minY)));
+        inside = _mm_and_ps(inside, _mm_cmpge_ps(_mm_add_ps(cz, ez), _mm_set1_ps(frustum.minZ)));
+        inside = _mm_and_ps(inside, _mm_cmple_ps(_mm_sub_ps(cx, ex), _mm_set1_ps(frustum.maxX)));
+        inside = _mm_and_ps(inside, _mm_cmple_ps(_mm_sub_ps(cy, ey), _mm_set1_ps(frustum.maxY)));
+        inside = _mm_and_ps(inside, _mm_cmple_ps(_mm_sub_ps(cz, ez), _mm_set1_ps(frustum.maxZ)));
+        for (const auto& plane : frustum.planes) {
+            __m128 distance{ _mm_mul_ps(cx, _mm_set1_ps(plane.nx)) };
+            distance = _mm_add_ps(distance, _mm_mul_ps(cy, _mm_set1_ps(plane.ny)));
+            distance = _mm_add_ps(distance, _mm_mul_ps(cz, _mm_set1_ps(plane.nz)));
+            distance = _mm_add_ps(distance, _mm_mul_ps(ex, _mm_set1_ps(plane.ax)));
+            distance = _mm_add_ps(distance, _mm_mul_ps(ey, _mm_set1_ps(plane.ay)));
+            distance = _mm_add_ps(distance, _mm_mul_ps(ez, _mm_set1_ps(plane.az)));
+            inside = _mm_and_ps(inside, _mm_cmpge_ps(distance, _mm_set1_ps(plane.d)));
+        }
+        return static_cast<uint32_t>(_mm_movemask_ps(inside));
+    }
+
+    uint32_t TestBatch(const BoxBatch& boxes, const CullingFrustum& frustum)
+    {
+        return TestHalfBatch(boxes, 0, frustum) | (TestHalfBatch(boxes, 4, frustum) << 4);
+    }
+#elif defined(PREV_CULLING_NEON)
+    uint32_t TestHalfBatch(const BoxBatch& boxes, const uint32_t offset, const CullingFrustum& frustum)
+    {
+        const float32x4_t cx{ vld1q_f32(boxes.cx + offset) };
+        const float32x4_t cy{ vld1q_f32(boxes.cy + offset) };
+        const float32x4_t cz{ vld1q_f32(boxes.cz + offset) };
+        const float32x4_t ex{ vld1q_f32(boxes.ex + offset) };
+        const float32x4_t ey{ vld1q_f32(boxes.ey + offset) };
+        const float32x4_t ez{ vld1q_f32(boxes.ez + offset) };
+
+        uint32x4_t inside{ vcgeq_f32(vaddq_f32(cx, ex), vdupq_n_f32(frustum.minX)) };
+        inside = vandq_u32(inside, vcgeq_f32(vaddq_f32(cy, ey), vdupq_n_f32(frustum.minY)));
+        inside = vandq_u32(inside, vcgeq_f32(vaddq_f32(cz, ez), vdupq_n_f32(frustum.minZ)));
+        inside = vandq_u32(inside, vcleq_f32(vsubq_f32(cx, ex), vdupq_n_f32(frustum.maxX)));
+        inside = vandq_u32(inside, vcleq_f32(vsubq_f32(cy, ey), vdupq_n_f32(frustum.maxY)));
+        inside = vandq_u32(inside, vcleq_f32(vsubq_f32(cz, ez), vdupq_n_f32(frustum.maxZ)));
+        for (const auto& plane : frustum.planes) {
+            float32x4_t distance{ vmulq_n_f32(cx, plane.nx) };
+            distance = vmlaq_n_f32(distance, cy, plane.ny);
+            distance = vmlaq_n_f32(distance, cz, plane.nz);
+            distance = vmlaq_n_f32(distance, ex, plane.ax);
+            distance = vmlaq_n_f32(distance, ey, plane.ay);
+            distance = vmlaq_n_f32(distance, ez, plane.az);
+            inside = vandq_u32(inside, vcgeq_f32(distance, vdupq_n_f32(plane.d)));
+        }
+
+        const uint32_t laneBits[4]{ 1, 2, 4, 8 };
+        return vaddvq_u32(vandq_u32(inside, vld1q_u32(laneBits)));
+    }
+
+    uint32_t TestBatch(const BoxBatch& boxes, const CullingFrustum& frustum)
+    {
+        return TestHalfBatch(boxes, 0, frustum) | (TestHalfBatch(boxes, 4, frustum) << 4);
+    }
+#else
+    uint32_t TestBatch(const BoxBatch& boxes, const CullingFrustum& frustum)
+    {
+        uint32_t mask{ 0 };
+        for (uint32_t i = 0; i < BATCH_SIZE; ++i) {
+            bool inside{ boxes.cx[i] + boxes.ex[i] >= frustum.minX && boxes.cy[i] + boxes.ey[i] >= frustum.minY && boxes.cz[i] + boxes.ez[i] >= frustum.minZ
+                && boxes.cx[i] - boxes.ex[i] <= frustum.maxX && boxes.cy[i] - boxes.ey[i] <= frustum.maxY && boxes.cz[i] - boxes.ez[i] <= frustum.maxZ };
+            for (const auto& plane : frustum.planes) {
+                if (!inside) {
+                    break;
+                }
+                const float distance{ boxes.cx[i] * plane.nx + boxes.cy[i] * plane.ny + boxes.cz[i] * plane.nz + boxes.ex[i] * plane.ax + boxes.ey[i] * plane.ay + boxes.ez[i] * plane.az };
+                inside = distance >= plane.d;
+            }
+            mask |= inside ? (1u << i) : 0u;
+        }
+        return mask;
+    }
+#endif
+} // namespace
+
+void VisibilityBitset::Reset(const uint32_t viewCount, const uint32_t objectCount)
+{
+    m_viewCount = viewCount;
+    m_objectCount = objectCount;
+    m_wordsPerView = (objectCount + BITS_PER_WORD - 1) / BITS_PER_WORD;
+    m_words.assign(static_cast<size_t>(m_wordsPerView) * viewCount, 0);
+}
+
+bool VisibilityBitset::IsVisible(const uint32_t view, const uint32_t index) const
+{
+    assert(view < m_viewCount && index < m_objectCount);
+    return (GetWords(view)[index / BITS_PER_WORD] >> (index % BITS_PER_WORD)) & 1;
+}
+
+bool VisibilityBitset::IsVisibleInAny(const uint32_t firstView, const uint32_t viewCount, const uint32_t index) const
+{
+    for (uint32_t view = firstView; view < firstView + viewCount; ++view) {
+        if (IsVisible(view, index)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+uint32_t VisibilityBitset::GetVisibleCount(const uint32_t view) const
+{
+    uint32_t count{ 0 };
+    const auto words{ GetWords(view) };
+    for (uint32_t i = 0; i < m_wordsPerView; ++i) {
+        for (uint64_t word = words[i]; word != 0; word &= word - 1) {
+            ++count;
+        }
+    }
+    return count;
+}
+
+uint32_t VisibilityBitset::GetViewCount() const
+{
+    return m_viewCount;
+}
+
+uint32_t VisibilityBitset::GetObjectCount() const
+{
+    return m_objectCount;
+}
+
+uint64_t* VisibilityBitset::GetWords(const uint32_t view)
+{
+    return m_words.data() + static_cast<size_t>(view) * m_wordsPerView;
+}
+
+const uint64_t* VisibilityBitset::GetWords(const uint32_t view) const
+{
+    return m_words.data() + static_cast<size_t>(view) * m_wordsPerView;
+}
+
+uint32_t FrustumCuller::Add(const AABB& box)
+{
+    uint32_t slot{};
+    if (m_freeSlots.empty()) {
+        slot = m_slotCount++;
+        Reserve(m_slotCount);
+    } else {
+        slot = m_freeSlots.back();
+        m_freeSlots.pop_back();
+    }
+    Set(slot, box);
+    return slot;
+}
+
+void FrustumCuller::Remove(const uint32_t slot)
+{
+    assert(slot < m_slotCount);
+    SetEmpty(slot);
+    m_freeSlots.push_back(slot);
+
+    // drop trailing free slots so batches cover only the live range
+    if (slot + 1 == m_slotCount) {
+        while (m_slotCount > 0 && m_extentX[m_slotCount - 1] < 0.0f) {
+            --m_slotCount;
+        }
+        m_freeSlots.erase(std::remove_if(m_freeSlots.begin(), m_freeSlots.end(), [this](const uint32_t freeSlot) { return freeSlot >= m_slotCount; }), m_freeSlots.end());
+    }
+}
+
+void FrustumCuller::Set(const uint32_t slot, const AABB& box)
+{
+    assert(slot < m_slotCount);
+    const auto center{ box.GetCenter() };
+    const auto extent{ box.GetHalfSize() };
+    m_centerX[slot] = center.x;
+    m_centerY[slot] = center.y;
+    m_centerZ[slot] = center.z;
+    m_extentX[slot] = extent.x;
+    m_extentY[slot] = extent.y;
+    m_extentZ[slot] = extent.z;
+}
+
+void FrustumCuller::Clear()
+{
+    m_slotCount = 0;
+    m_centerX.clear();
+    m_centerY.clear();
+    m_centerZ.clear();
+    m_extentX.clear();
+    m_extentY.clear();
+    m_extentZ.clear();
+    m_freeSlots.clear();
+}
+
+uint32_t FrustumCuller::GetSlotCount() const
+{
+    return m_slotCount;
+}
+
+void FrustumCuller::Cull(const Frustum* frustums, const uint32_t frustumCount, VisibilityBitset& outVisibility) const
+{
+    outVisibility.Reset(frustumCount, m_slotCount);
+
+    std::vector<CullingFrustum> cullingFrustums(frustumCount);
+    for (uint32_t view = 0; view < frustumCount; ++view) {
+        cullingFrustums[view] = ToCullingFrustum(frustums[view]);
+    }
+
+    // boxes are loaded once per batch and tested against all views
+    for (uint32_t i = 0; i < m_slotCount; i += BATCH_SIZE) {
+        const BoxBatch batch{ &m_centerX[i], &m_centerY[i], &m_centerZ[i], &m_extentX[i], &m_extentY[i], &m_extentZ[i] };
+        for (uint32_t view = 0; view < frustumCount; ++view) {
+            const uint64_t mask{ TestBatch(batch, cullingFrustums[view]) };
+            outVisibility.GetWords(view)[i / BITS_PER_WORD] |= mask << (i % BITS_PER_WORD);
+        }
+    }
+}
+
+void FrustumCuller::SetEmpty(const uint32_t slot)
+{
+    // negative extents never pass the plane test
+    m_centerX[slot] = m_centerY[slot] = m_centerZ[slot] = 0.0f;
+    m_extentX[slot] = m_extentY[slot] = m_extentZ[slot] = -std::numeric_limits<float>::max();
+}
+
+void FrustumCuller::Reserve(const uint32_t slotCount)
+{
+    const size_t paddedCount{ ((slotCount + BATCH_SIZE - 1) / BATCH_SIZE) * BATCH_SIZE };
+    if (paddedCount <= m_centerX.size()) {
+        return;
+    }
+
+    const uint32_t oldSize{ static_cast<uint32_t>(m_centerX.size()) };
+    m_centerX.resize(paddedCount);
+    m_centerY.resize(paddedCount);
+    m_centerZ.resize(paddedCount);
+    m_extentX.resize(paddedCount);
+    m_extentY.resize(paddedCount);
+    m_extentZ.resize(paddedCount);
+    for (uint32_t i = oldSize; i < paddedCount; ++i) {
+        SetEmpty(i);
+    }
+}
+} // namespace prev::util::intersection
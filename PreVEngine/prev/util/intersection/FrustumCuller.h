@@ -0,0 +1,96 @@
+#ifndef __FRUSTUM_CULLER_H__
+#define __FRUSTUM_CULLER_H__
+
+#include "AABB.h"
+#include "Frustum.h"
+
+#include <limits>
+#include <vector>
+
+namespace prev::util::intersection {
+// One bit per culled object for each view.
+class VisibilityBitset final {
+public:
+    VisibilityBitset() = default;
+
+    ~VisibilityBitset() = default;
+
+public:
+    void Reset(const uint32_t viewCount, const uint32_t objectCount);
+
+    bool IsVisible(const uint32_t view, const uint32_t index) const;
+
+    // Visible in at least one of views [firstView, firstView + viewCount).
+    bool IsVisibleInAny(const uint32_t firstView, const uint32_t viewCount, const uint32_t index) const;
+
+    uint32_t GetVisibleCount(const uint32_t view) const;
+
+    uint32_t GetViewCount() const;
+
+    uint32_t GetObjectCount() const;
+
+    uint64_t* GetWords(const uint32_t view);
+
+    const uint64_t* GetWords(const uint32_t view) const;
+
+private:
+    uint32_t m_viewCount{};
+
+    uint32_t m_objectCount{};
+
+    uint32_t m_wordsPerView{};
+
+    std::vector<uint64_t> m_words;
+};
+
+// Keeps world boxes as center/extent SoA arrays and tests them in batches against frustum planes (SSE/AVX/NEON when available).
+// The test is conservative - boxes crossing a frustum corner outside all planes are reported visible.
+class FrustumCuller final {
+public:
+    static constexpr uint32_t INVALID_SLOT{ std::numeric_limits<uint32_t>::max() };
+
+public:
+    FrustumCuller() = default;
+
+    ~FrustumCuller() = default;
+
+public:
+    uint32_t Add(const AABB& box);
+
+    void Remove(const uint32_t slot);
+
+    void Set(const uint32_t slot, const AABB& box);
+
+    void Clear();
+
+    // Number of slots up to the last live one including removed ones in between, the bitset is sized by this.
+    uint32_t GetSlotCount() const;
+
+    void Cull(const Frustum* frustums, const uint32_t frustumCount, VisibilityBitset& outVisibility) const;
+
+private:
+    void SetEmpty(const uint32_t slot);
+
+    void Reserve(const uint32_t slotCount);
+
+private:
+    uint32_t m_slotCount{};
+
+    // padded to the widest batch so the loops do not need a scalar tail
+    std::vector<float> m_centerX;
+
+    std::vector<float> m_centerY;
+
+    std::vector<float> m_centerZ;
+
+    std::vector<float> m_extentX;
+
+    std::vector<float> m_extentY;
+
+    std::vector<float> m_extentZ;
+
+    std::vector<uint32_t> m_freeSlots;
+};
+} // namespace prev::util::intersection
+
+#endif // !__FRUSTUM_CULLER_H__
@@ -101,10 +101,12 @@ bool Window::ProcessEvents(bool waitForEvent)
     impl::Event evt{};
     while (m_windowImpl->PollEvent(waitForEvent, evt)) {
         if (!ProcessEvent(evt)) {
+            PostPendingMouseMove();
             return false;
         }
         waitForEvent = false;
     }
+    PostPendingMouseMove();
     return true;
 }
 
@@ -123,32 +125,47 @@ void Window::operator()(const prev::window::WindowCloseRequest& windowCloseReque
     Close();
 }
 
+// Input goes through the EventQueue, so that its handlers run at the engine's dispatch point of the frame. The
+// window's life cycle events stay synchronous, the swapchain follows them right away.
 bool Window::ProcessEvent(const impl::Event& e)
 {
+    auto& eventQueue{ prev::event::EventQueue::Instance() };
+
+    const bool mouseMove{ e.tag == impl::Event::EventType::MOUSE && InputConvertor::GetMouseActionType(e.body.mouse.action) == prev::input::mouse::MouseActionType::MOVE };
+    if (!mouseMove) {
+        PostPendingMouseMove();
+    }
+
     switch (e.tag) {
-    case impl::Event::EventType::MOUSE:
-        prev::event::EventChannel::Post(prev::input::mouse::MouseEvent{ InputConvertor::GetMouseActionType(e.body.mouse.action), InputConvertor::GetMouseButtonType(e.body.mouse.btn), glm::vec2(e.body.mouse.x, e.body.mouse.y), glm::vec2(e.body.mouse.w, e.body.mouse.h) });
+    case impl::Event::EventType::MOUSE: {
+        const prev::input::mouse::MouseEvent mouseEvent{ InputConvertor::GetMouseActionType(e.body.mouse.action), InputConvertor::GetMouseButtonType(e.body.mouse.btn), glm::vec2(e.body.mouse.x, e.body.mouse.y), glm::vec2(e.body.mouse.w, e.body.mouse.h) };
+        if (mouseMove) {
+            CoalesceMouseMove(mouseEvent);
+        } else {
+            eventQueue.Post(mouseEvent);
+        }
         break;
+    }
     case impl::Event::EventType::MOUSE_SCROLL:
-        prev::event::EventChannel::Post(prev::input::mouse::MouseScrollEvent{ e.body.scroll.delta, glm::vec2(e.body.scroll.x, e.body.scroll.y) });
+        eventQueue.Post(prev::input::mouse::MouseScrollEvent{ e.body.scroll.delta, glm::vec2(e.body.scroll.x, e.body.scroll.y) });
         break;
     case impl::Event::EventType::KEY:
-        prev::event::EventChannel::Post(prev::input::keyboard::KeyEvent{ InputConvertor::GetKeyActionType(e.body.key.action), e.body.key.keyCode });
+        eventQueue.Post(prev::input::keyboard::KeyEvent{ InputConvertor::GetKeyActionType(e.body.key.action), e.body.key.keyCode });
         break;
     case impl::Event::EventType::TEXT:
-        prev::event::EventChannel::Post(prev::input::keyboard::TextEvent{ e.body.text.unicode });
+        eventQueue.Post(prev::input::keyboard::TextEvent{ e.body.text.unicode });
         break;
     case impl::Event::EventType::MOVE:
-        prev::event::EventChannel::Post(WindowMovedEvent{ this, glm::vec2(e.body.move.x, e.body.move.y) });
+        eventQueue.Post(WindowMovedEvent{ this, glm::vec2(e.body.move.x, e.body.move.y) });
         break;
     case impl::Event::EventType::RESIZE:
         prev::event::EventChannel::Post(WindowResizeEvent{ this, e.body.resize.width, e.body.resize.height });
         break;
     case impl::Event::EventType::FOCUS:
-        prev::event::EventChannel::Post(WindowFocusChangeEvent{ this, e.body.focus.hasFocus });
+        eventQueue.Post(WindowFocusChangeEvent{ this, e.body.focus.hasFocus });
         break;
     case impl::Event::EventType::TOUCH:
-        prev::event::EventChannel::Post(prev::input::touch::TouchEvent{ InputConvertor::GetTouchActionType(e.body.touch.action), e.body.touch.id, glm::vec2(e.body.touch.x, e.body.touch.y), glm::vec2(e.body.touch.w, e.body.touch.h) });
+        eventQueue.Post(prev::input::touch::TouchEvent{ InputConvertor::GetTouchActionType(e.body.touch.action), e.body.touch.id, glm::vec2(e.body.touch.x, e.body.touch.y), glm::vec2(e.body.touch.w, e.body.touch.h) });
         break;
     case impl::Event::EventType::INIT:
         prev::event::EventChannel::Post(WindowCreatedEvent{ this });
@@ -164,4 +181,27 @@ bool Window::ProcessEvent(const impl::Event& e)
     }
     return true;
 }
+
+void Window::CoalesceMouseMove(const prev::input::mouse::MouseEvent& mouseEvent)
+{
+    // moves of one poll collapse into one per button held, a locked mouse reports each relative to the last
+    if (m_pendingMouseMove && m_pendingMouseMove->button == mouseEvent.button) {
+        const bool relative{ m_windowImpl->IsMouseLocked() && m_windowImpl->HasFocus() };
+        const auto position{ relative ? m_pendingMouseMove->position + mouseEvent.position : mouseEvent.position };
+        m_pendingMouseMove = mouseEvent;
+        m_pendingMouseMove->position = position;
+        return;
+    }
+
+    PostPendingMouseMove();
+    m_pendingMouseMove = mouseEvent;
+}
+
+void Window::PostPendingMouseMove()
+{
+    if (m_pendingMouseMove) {
+        prev::event::EventQueue::Instance().Post(*m_pendingMouseMove);
+        m_pendingMouseMove.reset();
+    }
+}
 } // namespace prev::window
\ No newline at end of file
@@ -7,11 +7,13 @@
 #include "impl/WindowImpl.h"
 
 #include "../event/EventHandler.h"
+#include "../event/EventQueue.h"
 #include "../input/keyboard/KeyboardEvents.h"
 #include "../input/mouse/MouseEvents.h"
 #include "../input/touch/TouchEvents.h"
 
 #include <memory>
+#include <optional>
 
 namespace prev::window {
 class Window final : public IWindow, public impl::ISurfaceObserver {
@@ -68,9 +70,15 @@ public:
 private:
     bool ProcessEvent(const impl::Event& e);
 
+    void CoalesceMouseMove(const prev::input::mouse::MouseEvent& mouseEvent);
+
+    void PostPendingMouseMove();
+
 private:
     std::unique_ptr<impl::WindowImpl> m_windowImpl{};
 
+    std::optional<prev::input::mouse::MouseEvent> m_pendingMouseMove{};
+
 private:
     prev::event::EventHandler<Window, prev::input::mouse::MouseLockRequest> m_mouseLockHandler{ *this };
 
@@ -6,7 +6,7 @@
 
 #include "../util/OpenXrUtils.h"
 
-#include "../../../event/EventChannel.h"
+#include "../../../event/EventQueue.h"
 #include "../../../util/MathUtils.h"
 
 #include <vector>
@@ -37,6 +37,10 @@ OpenXrInput::OpenXrInput(XrInstance instance, XrSystemId systemId, bool handTrac
     CreateActionSet();
 
     SuggestControllerBindings();
+
+    // poses of a frame that did not get dispatched are stale already
+    prev::event::EventQueue::Instance().SetCoalescingToLatest<HandControllersEvent>();
+    prev::event::EventQueue::Instance().SetCoalescingToLatest<HandsEvent>();
 }
 
 OpenXrInput::~OpenXrInput()
@@ -318,7 +322,7 @@ void OpenXrInput::HandleControllerActions(const XrTime time)
         handControllerEvent.flags |= trigger ? HandEventFlags::TRIGGER : HandEventFlags::NONE;
         handControllerEvent.squeeze = squeeze ? *squeeze : 1.0f;
     }
-    prev::event::EventChannel::Post(handControllersEvent);
+    prev::event::EventQueue::Instance().Post(handControllersEvent);
 
     const auto quit{ open_xr::input::util::GetBoolState(m_session, m_quitAction, true, XR_NULL_PATH) };
     if (quit) {
@@ -384,7 +388,7 @@ void OpenXrInput::HandleHandTrackingActions(const XrTime time)
             handJoint.radius = jointLocation.radius;
         }
     }
-    prev::event::EventChannel::Post(handsEvent);
+    prev::event::EventQueue::Instance().Post(handsEvent);
 }
 } // namespace prev::xr::open_xr::input
 
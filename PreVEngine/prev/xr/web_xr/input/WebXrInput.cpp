@@ -6,7 +6,7 @@
 
 #include "../../XrEvents.h"
 
-#include "../../../event/EventChannel.h"
+#include "../../../event/EventQueue.h"
 
 // clang-format off
 EM_JS(int, prev_webxr_get_hand, (int handIndex, float* out), {
@@ -108,6 +108,13 @@ EM_JS(int, prev_webxr_get_controller, (int handIndex, float* out), {
 // clang-format on
 
 namespace prev::xr::web_xr::input {
+WebXrInput::WebXrInput()
+{
+    // poses of a frame that did not get dispatched are stale already
+    prev::event::EventQueue::Instance().SetCoalescingToLatest<HandControllersEvent>();
+    prev::event::EventQueue::Instance().SetCoalescingToLatest<HandsEvent>();
+}
+
 void WebXrInput::PollActions()
 {
     HandleControllerActions();
@@ -131,7 +138,7 @@ void WebXrInput::HandleControllerActions()
         ctrl.flags |= (c[8] != 0.0f) ? HandEventFlags::TRIGGER : HandEventFlags::NONE;
         ctrl.flags |= (c[9] != 0.0f) ? HandEventFlags::SQUEEZE : HandEventFlags::NONE;
     }
-    prev::event::EventChannel::Post(controllersEvent);
+    prev::event::EventQueue::Instance().Post(controllersEvent);
 }
 
 void WebXrInput::HandleHandTrackingActions()
@@ -155,7 +162,7 @@ void WebXrInput::HandleHandTrackingActions()
         }
         hand.pose = hand.joints[1].pose; // wrist
     }
-    prev::event::EventChannel::Post(handsEvent);
+    prev::event::EventQueue::Instance().Post(handsEvent);
 }
 } // namespace prev::xr::web_xr::input
 
@@ -6,7 +6,7 @@
 namespace prev::xr::web_xr::input {
 class WebXrInput final {
 public:
-    WebXrInput() = default;
+    WebXrInput();
 
     ~WebXrInput() = default;
 
@@ -0,0 +1,19 @@
+
+#include "prev/common/LoggerBenchmarks.h"
+#include "prev/common/TagSetBenchmarks.h"
+#include "prev/common/ThreadPoolBenchmarks.h"
+#include "prev/render/image/ImageBenchmarks.h"
+#include "prev/scene/component/ComponentRepositoryBenchmarks.h"
+#include "prev/scene/graph/GraphTraversalBenchmarks.h"
+#include "prev/scene/particle/ParticleDepthSorterBenchmarks.h"
+#include "prev/scene/particle/ParticlePoolBenchmarks.h"
+#include "prev/scene/transform/TransformHierarchyBenchmarks.h"
+#include "prev/util/MathUtilsBenchmarks.h"
+#include "prev/util/intersection/BVHBenchmarks.h"
+#include "prev/util/intersection/FrustumBenchmarks.h"
+#include "prev/util/intersection/FrustumCullerBenchmarks.h"
+#include "prev/util/intersection/IntersectionTesterBenchmarks.h"
+#include "prev_test/render/animation/AnimationClipBenchmarks.h"
+#include "prev_test/render/mesh/MeshUtilBenchmarks.h"
+
+BENCHMARK_MAIN();
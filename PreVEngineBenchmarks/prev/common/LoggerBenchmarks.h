@@ -0,0 +1,49 @@
+#ifndef __LOGGER_BENCHMARKS_H__
+#define __LOGGER_BENCHMARKS_H__
+
+#include <prev/common/Logger.h>
+
+#include <benchmark/benchmark.h>
+
+#include <string>
+
+namespace prev::common {
+// cost on the logging thread only, the sink drops the messages
+static void BM_Logger_Write(benchmark::State& state)
+{
+    auto& logger{ Logger::Instance() };
+    logger.SetSink([](const LogEntry&) {});
+
+    const std::string path{ "textures/terrain/grass_diffuse.ktx2" };
+    for (auto _ : state) {
+        Logger::Write(LogLevel::INFO, false, __FILE__, "Loading image: %s (%u x %u) took %.2f ms", path.c_str(), 1024u, 1024u, 3.25);
+        // keeps the ring from filling up
+        if ((state.iterations() & 255) == 0) {
+            state.PauseTiming();
+            Logger::Flush();
+            state.ResumeTiming();
+        }
+    }
+    state.SetItemsProcessed(state.iterations());
+
+    Logger::Flush();
+    logger.ResetSink();
+}
+BENCHMARK(BM_Logger_Write);
+
+static void BM_Logger_WriteFilteredOut(benchmark::State& state)
+{
+    Logger::SetLevel(LogLevel::WARNING);
+    Logger::SetModuleLevel("render/image", LogLevel::ERR);
+    for (auto _ : state) {
+        Logger::Write(LogLevel::INFO, false, __FILE__, "Frame %u", 1u);
+    }
+    state.SetItemsProcessed(state.iterations());
+
+    Logger::SetLevel(LogLevel::VERBOSE);
+    Logger::ClearModuleLevels();
+}
+BENCHMARK(BM_Logger_WriteFilteredOut);
+} // namespace prev::common
+
+#endif // !__LOGGER_BENCHMARKS_H__
@@ -0,0 +1,57 @@
+#ifndef __TAG_SET_BENCHMARKS_H__
+#define __TAG_SET_BENCHMARKS_H__
+
+#include <prev/common/TagSet.h>
+
+#include <benchmark/benchmark.h>
+
+#include <string>
+
+namespace prev::common {
+namespace {
+    // roughly what scene nodes carry
+    TagSet CreateNodeTags(const uint32_t count)
+    {
+        TagSet tags{};
+        for (uint32_t i = 0; i < count; ++i) {
+            tags.Add("Tag_" + std::to_string(i));
+        }
+        return tags;
+    }
+} // namespace
+
+static void BM_TagSet_Has(benchmark::State& state)
+{
+    const auto tags{ CreateNodeTags(static_cast<uint32_t>(state.range(0))) };
+    const std::string tag{ "Tag_" + std::to_string(state.range(0) / 2) };
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(tags.Has(tag));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_TagSet_Has)->Arg(1)->Arg(4)->Arg(16);
+
+static void BM_TagSet_HasAny(benchmark::State& state)
+{
+    const auto tags{ CreateNodeTags(static_cast<uint32_t>(state.range(0))) };
+    const TagSet query{ "Missing_0", "Missing_1", "Tag_0" };
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(tags.HasAny(query));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_TagSet_HasAny)->Arg(1)->Arg(4)->Arg(16);
+
+static void BM_TagSet_HasAll(benchmark::State& state)
+{
+    const auto tags{ CreateNodeTags(static_cast<uint32_t>(state.range(0))) };
+    const auto query{ CreateNodeTags(static_cast<uint32_t>(state.range(0))) };
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(tags.HasAll(query));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_TagSet_HasAll)->Arg(1)->Arg(4)->Arg(16);
+} // namespace prev::common
+
+#endif // !__TAG_SET_BENCHMARKS_H__
@@ -0,0 +1,34 @@
+#ifndef __THREAD_POOL_BENCHMARKS_H__
+#define __THREAD_POOL_BENCHMARKS_H__
+
+#include <prev/common/ThreadPool.h>
+
+#include <benchmark/benchmark.h>
+
+#include <future>
+#include <vector>
+
+namespace prev::common {
+// the enqueue/complete round trip of tiny jobs - the pool overhead, not the work
+static void BM_ThreadPool_Enqueue(benchmark::State& state)
+{
+    constexpr uint32_t JOB_COUNT{ 1024 };
+
+    ThreadPool pool{ static_cast<size_t>(state.range(0)) };
+    std::vector<std::future<uint32_t>> futures;
+    futures.reserve(JOB_COUNT);
+    for (auto _ : state) {
+        futures.clear();
+        for (uint32_t i = 0; i < JOB_COUNT; ++i) {
+            futures.push_back(pool.Enqueue([i]() { return i * 3; }));
+        }
+        for (auto& future : futures) {
+            benchmark::DoNotOptimize(future.get());
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * JOB_COUNT);
+}
+BENCHMARK(BM_ThreadPool_Enqueue)->Arg(1)->Arg(4)->UseRealTime();
+} // namespace prev::common
+
+#endif // !__THREAD_POOL_BENCHMARKS_H__
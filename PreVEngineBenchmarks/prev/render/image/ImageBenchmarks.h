@@ -0,0 +1,92 @@
+#ifndef __IMAGE_BENCHMARKS_H__
+#define __IMAGE_BENCHMARKS_H__
+
+#include <prev/render/image/Image.h>
+#include <prev/render/image/ImageFactory.h>
+
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+namespace prev::render::image {
+namespace {
+    constexpr uint32_t IMAGE_4K_WIDTH{ 3840 };
+
+    constexpr uint32_t IMAGE_4K_HEIGHT{ 2160 };
+
+    constexpr size_t IMAGE_4K_BYTE_SIZE{ static_cast<size_t>(IMAGE_4K_WIDTH) * IMAGE_4K_HEIGHT * 4 };
+
+    std::vector<uint8_t> CreateDecodedData()
+    {
+        std::vector<uint8_t> data(IMAGE_4K_BYTE_SIZE);
+        for (size_t i = 0; i < data.size(); ++i) {
+            data[i] = static_cast<uint8_t>(i * 7);
+        }
+        return data;
+    }
+} // namespace
+
+// what a loader pays when it keeps its own decoded buffer
+static void BM_Image_CreateFromData4K(benchmark::State& state)
+{
+    const auto data{ CreateDecodedData() };
+    for (auto _ : state) {
+        Image<uint8_t, 4> image{ IMAGE_4K_WIDTH, IMAGE_4K_HEIGHT, data.data() };
+        benchmark::DoNotOptimize(image.GetRawData());
+    }
+    state.SetBytesProcessed(state.iterations() * IMAGE_4K_BYTE_SIZE);
+}
+BENCHMARK(BM_Image_CreateFromData4K);
+
+// what ImageFactory pays for a decoded stb buffer
+static void BM_Image_AdoptData4K(benchmark::State& state)
+{
+    for (auto _ : state) {
+        uint8_t* data{ new uint8_t[IMAGE_4K_BYTE_SIZE] };
+        Image<uint8_t, 4> image{ IMAGE_4K_WIDTH, IMAGE_4K_HEIGHT, data, [](uint8_t* pixels) { delete[] pixels; } };
+        benchmark::DoNotOptimize(image.GetRawData());
+    }
+    state.SetBytesProcessed(state.iterations() * IMAGE_4K_BYTE_SIZE);
+}
+BENCHMARK(BM_Image_AdoptData4K);
+
+static void BM_Image_ConvertToFloat4K(benchmark::State& state)
+{
+    const auto data{ CreateDecodedData() };
+    const Image<uint8_t, 4> image{ IMAGE_4K_WIDTH, IMAGE_4K_HEIGHT, data.data() };
+    for (auto _ : state) {
+        const auto converted{ image.Convert<float>() };
+        benchmark::DoNotOptimize(converted.GetRawData());
+    }
+    state.SetBytesProcessed(state.iterations() * IMAGE_4K_BYTE_SIZE);
+}
+BENCHMARK(BM_Image_ConvertToFloat4K);
+
+static void BM_Image_ConvertToRgb4K(benchmark::State& state)
+{
+    const auto data{ CreateDecodedData() };
+    const Image<uint8_t, 4> image{ IMAGE_4K_WIDTH, IMAGE_4K_HEIGHT, data.data() };
+    for (auto _ : state) {
+        const auto converted{ image.Convert<uint8_t, 3>() };
+        benchmark::DoNotOptimize(converted.GetRawData());
+    }
+    state.SetBytesProcessed(state.iterations() * IMAGE_4K_BYTE_SIZE);
+}
+BENCHMARK(BM_Image_ConvertToRgb4K);
+
+// mip chain and thumbnail generation, bilinear
+static void BM_ImageFactory_CreateResizedImage4K(benchmark::State& state)
+{
+    const auto data{ CreateDecodedData() };
+    const Image<uint8_t, 4> image{ IMAGE_4K_WIDTH, IMAGE_4K_HEIGHT, data.data() };
+    const ImageFactory imageFactory{};
+    for (auto _ : state) {
+        const auto resized{ imageFactory.CreateResizedImage(image, IMAGE_4K_WIDTH / 2, IMAGE_4K_HEIGHT / 2) };
+        benchmark::DoNotOptimize(resized->GetRawDataPtr());
+    }
+    state.SetBytesProcessed(state.iterations() * IMAGE_4K_BYTE_SIZE);
+}
+BENCHMARK(BM_ImageFactory_CreateResizedImage4K);
+} // namespace prev::render::image
+
+#endif // !__IMAGE_BENCHMARKS_H__
@@ -0,0 +1,62 @@
+#ifndef __COMPONENT_REPOSITORY_BENCHMARKS_H__
+#define __COMPONENT_REPOSITORY_BENCHMARKS_H__
+
+#include <prev/scene/component/ComponentRepository.h>
+
+#include <benchmark/benchmark.h>
+
+namespace prev::scene::component {
+namespace {
+    template <uint32_t Index>
+    struct BenchComponent : IComponent {
+        uint32_t value{ Index };
+    };
+
+    // a node with a handful of components of distinct types, like a typical renderable
+    ComponentRepository CreateRepository()
+    {
+        ComponentRepository repository{};
+        repository.Add(std::make_shared<BenchComponent<0>>());
+        repository.Add(std::make_shared<BenchComponent<1>>());
+        repository.Add(std::make_shared<BenchComponent<2>>());
+        repository.Add(std::make_shared<BenchComponent<3>>());
+        repository.Add(std::make_shared<BenchComponent<4>>());
+        repository.Add(std::make_shared<BenchComponent<5>>());
+        repository.Add(std::make_shared<BenchComponent<6>>());
+        repository.Add(std::make_shared<BenchComponent<7>>());
+        return repository;
+    }
+} // namespace
+
+static void BM_ComponentRepository_Find(benchmark::State& state)
+{
+    const auto repository{ CreateRepository() };
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(repository.Find<BenchComponent<5>>());
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_ComponentRepository_Find);
+
+static void BM_ComponentRepository_FindMissing(benchmark::State& state)
+{
+    const auto repository{ CreateRepository() };
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(repository.Find<BenchComponent<42>>());
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_ComponentRepository_FindMissing);
+
+static void BM_ComponentRepository_Contains(benchmark::State& state)
+{
+    const auto repository{ CreateRepository() };
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(repository.Contains<BenchComponent<3>>());
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_ComponentRepository_Contains);
+} // namespace prev::scene::component
+
+#endif // !__COMPONENT_REPOSITORY_BENCHMARKS_H__
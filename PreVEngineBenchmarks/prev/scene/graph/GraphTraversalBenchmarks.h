@@ -0,0 +1,72 @@
+#ifndef __GRAPH_TRAVERSAL_BENCHMARKS_H__
+#define __GRAPH_TRAVERSAL_BENCHMARKS_H__
+
+#include <prev/scene/graph/GraphTraversal.h>
+#include <prev/scene/graph/SceneNode.h>
+
+#include <benchmark/benchmark.h>
+
+#include <memory>
+
+namespace prev::scene::graph {
+namespace {
+    constexpr uint32_t GRAPH_FAN_OUT{ 8 };
+
+    // a tree of nodeCount nodes, GRAPH_FAN_OUT children each, the last one added is the only one tagged "Target"
+    std::shared_ptr<ISceneNode> CreateGraph(const uint32_t nodeCount, uint64_t& lastNodeId)
+    {
+        const auto root{ std::make_shared<SceneNode>(prev::common::TagSet{ "Root" }) };
+        std::vector<std::shared_ptr<ISceneNode>> parents{ root };
+        std::shared_ptr<ISceneNode> lastNode{ root };
+        for (uint32_t i = 1, parentIndex = 0; i < nodeCount; ++i) {
+            const bool isLast{ i + 1 == nodeCount };
+            const auto node{ std::make_shared<SceneNode>(isLast ? prev::common::TagSet{ "Node", "Target" } : prev::common::TagSet{ "Node" }) };
+            parents[parentIndex]->AddChild(node);
+            parents.push_back(node);
+            lastNode = node;
+            if (i % GRAPH_FAN_OUT == 0) {
+                ++parentIndex;
+            }
+        }
+        lastNodeId = lastNode->GetId();
+        return root;
+    }
+} // namespace
+
+static void BM_GraphTraversal_FindById(benchmark::State& state)
+{
+    uint64_t lastNodeId{};
+    const auto root{ CreateGraph(static_cast<uint32_t>(state.range(0)), lastNodeId) };
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(GraphTraversal::FindById(root, lastNodeId));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_GraphTraversal_FindById)->Arg(1'000)->Arg(10'000);
+
+static void BM_GraphTraversal_FindByTags(benchmark::State& state)
+{
+    uint64_t lastNodeId{};
+    const auto root{ CreateGraph(static_cast<uint32_t>(state.range(0)), lastNodeId) };
+    const prev::common::TagSet tags{ "Target" };
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(GraphTraversal::FindByTags(root, tags));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_GraphTraversal_FindByTags)->Arg(1'000)->Arg(10'000);
+
+static void BM_GraphTraversal_FindAllByTags(benchmark::State& state)
+{
+    uint64_t lastNodeId{};
+    const auto root{ CreateGraph(static_cast<uint32_t>(state.range(0)), lastNodeId) };
+    const prev::common::TagSet tags{ "Node" };
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(GraphTraversal::FindAllByTags(root, tags));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_GraphTraversal_FindAllByTags)->Arg(1'000)->Arg(10'000);
+} // namespace prev::scene::graph
+
+#endif // !__GRAPH_TRAVERSAL_BENCHMARKS_H__
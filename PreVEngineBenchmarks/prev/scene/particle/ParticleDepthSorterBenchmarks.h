@@ -0,0 +1,85 @@
+#ifndef __PARTICLE_DEPTH_SORTER_BENCHMARKS_H__
+#define __PARTICLE_DEPTH_SORTER_BENCHMARKS_H__
+
+#include <prev/common/Common.h>
+#include <prev/common/ThreadPool.h>
+#include <prev/scene/particle/ParticleDepthSorter.h>
+#include <prev/util/Utils.h>
+
+#include <benchmark/benchmark.h>
+
+namespace prev::scene::particle {
+namespace {
+    // four overlapping emitters sharing the particle count
+    std::vector<std::vector<ParticleInstance>> CreateSortSystems(const uint32_t particleCount, const uint32_t seed)
+    {
+        prev::util::RandomNumberGenerator rng{ seed };
+        std::uniform_real_distribution<float> dist{ -50.0f, 50.0f };
+
+        std::vector<std::vector<ParticleInstance>> systems(4);
+        for (size_t s = 0; s < systems.size(); ++s) {
+            systems[s].resize(particleCount / systems.size());
+            for (auto& instance : systems[s]) {
+                instance.position = glm::vec3(static_cast<float>(s) * 10.0f) + glm::vec3(dist(rng.GetRandomEngine()), dist(rng.GetRandomEngine()), dist(rng.GetRandomEngine()));
+            }
+        }
+        return systems;
+    }
+
+    void RunSortBenchmark(benchmark::State& state, const ParticleSortMode mode, prev::common::ThreadPool* threadPool)
+    {
+        const auto systems{ CreateSortSystems(static_cast<uint32_t>(state.range(0)), 17) };
+
+        std::vector<ParticleSortSource> sources;
+        uint32_t totalCount{ 0 };
+        for (const auto& system : systems) {
+            sources.push_back({ system.data(), static_cast<uint32_t>(system.size()) });
+            totalCount += sources.back().count;
+        }
+
+        ParticleDepthSorter sorter{ mode };
+        std::vector<ParticleInstance> sorted(totalCount);
+        std::vector<ParticleDrawRun> runs;
+
+        const glm::vec3 viewPosition{ 0.0f, 20.0f, -200.0f };
+        const glm::vec3 viewDirection{ glm::normalize(glm::vec3(0.0f, -0.1f, 1.0f)) };
+        for (auto _ : state) {
+            if (threadPool) {
+                sorter.Sort(viewPosition, viewDirection, sources, sorted.data(), runs, *threadPool);
+            } else {
+                sorter.Sort(viewPosition, viewDirection, sources, sorted.data(), runs);
+            }
+            benchmark::DoNotOptimize(sorted.data());
+        }
+        state.SetItemsProcessed(state.iterations() * totalCount);
+    }
+} // namespace
+
+static void BM_ParticleDepthSorter_Radix(benchmark::State& state)
+{
+    RunSortBenchmark(state, ParticleSortMode::RADIX, nullptr);
+}
+BENCHMARK(BM_ParticleDepthSorter_Radix)->Arg(100000)->Arg(1000000);
+
+static void BM_ParticleDepthSorter_RadixParallel(benchmark::State& state)
+{
+    prev::common::ThreadPool threadPool{ std::thread::hardware_concurrency() };
+    RunSortBenchmark(state, ParticleSortMode::RADIX, &threadPool);
+}
+BENCHMARK(BM_ParticleDepthSorter_RadixParallel)->Arg(100000)->Arg(1000000)->UseRealTime();
+
+static void BM_ParticleDepthSorter_Bucket(benchmark::State& state)
+{
+    RunSortBenchmark(state, ParticleSortMode::BUCKET, nullptr);
+}
+BENCHMARK(BM_ParticleDepthSorter_Bucket)->Arg(100000)->Arg(1000000);
+
+static void BM_ParticleDepthSorter_BucketParallel(benchmark::State& state)
+{
+    prev::common::ThreadPool threadPool{ std::thread::hardware_concurrency() };
+    RunSortBenchmark(state, ParticleSortMode::BUCKET, &threadPool);
+}
+BENCHMARK(BM_ParticleDepthSorter_BucketParallel)->Arg(100000)->Arg(1000000)->UseRealTime();
+} // namespace prev::scene::particle
+
+#endif // !__PARTICLE_DEPTH_SORTER_BENCHMARKS_H__
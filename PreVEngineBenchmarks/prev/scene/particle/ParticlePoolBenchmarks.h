@@ -0,0 +1,53 @@
+#ifndef __PARTICLE_POOL_BENCHMARKS_H__
+#define __PARTICLE_POOL_BENCHMARKS_H__
+
+#include <prev/common/Common.h>
+#include <prev/scene/particle/ParticlePool.h>
+#include <prev/util/Utils.h>
+
+#include <benchmark/benchmark.h>
+
+namespace prev::scene::particle {
+namespace {
+    // long lived particles so the pool stays full for the whole run
+    void FillPool(ParticlePool& pool, const uint32_t seed)
+    {
+        prev::util::RandomNumberGenerator rng{ seed };
+        std::uniform_real_distribution<float> dist{ -1.0f, 1.0f };
+        while (pool.GetCount() < pool.GetCapacity()) {
+            const glm::vec3 velocity{ dist(rng.GetRandomEngine()), dist(rng.GetRandomEngine()), dist(rng.GetRandomEngine()) };
+            pool.Emit(glm::vec3(0.0f), velocity, 0.1f, 1000000.0f, 0.0f, 1.0f);
+        }
+    }
+} // namespace
+
+static void BM_ParticlePool_Update(benchmark::State& state)
+{
+    ParticlePool pool{ static_cast<uint32_t>(state.range(0)) };
+    FillPool(pool, 13);
+
+    for (auto _ : state) {
+        pool.Update(1.0f / 60.0f);
+        benchmark::DoNotOptimize(pool.GetBoundingBox());
+    }
+    state.SetItemsProcessed(state.iterations() * pool.GetCount());
+}
+BENCHMARK(BM_ParticlePool_Update)->Arg(100000)->Arg(1000000);
+
+static void BM_ParticlePool_WriteInstances(benchmark::State& state)
+{
+    ParticlePool pool{ static_cast<uint32_t>(state.range(0)) };
+    FillPool(pool, 13);
+    pool.Update(1.0f / 60.0f);
+
+    std::vector<ParticleInstance> instances(pool.GetCapacity());
+    for (auto _ : state) {
+        pool.WriteInstances(8, instances.data());
+        benchmark::DoNotOptimize(instances.data());
+    }
+    state.SetItemsProcessed(state.iterations() * pool.GetCount());
+}
+BENCHMARK(BM_ParticlePool_WriteInstances)->Arg(100000)->Arg(1000000);
+} // namespace prev::scene::particle
+
+#endif // !__PARTICLE_POOL_BENCHMARKS_H__
@@ -0,0 +1,115 @@
+#ifndef __TRANSFORM_HIERARCHY_BENCHMARKS_H__
+#define __TRANSFORM_HIERARCHY_BENCHMARKS_H__
+
+#include <prev/common/Common.h>
+#include <prev/common/ThreadPool.h>
+#include <prev/scene/transform/TransformHierarchy.h>
+#include <prev/util/MathUtils.h>
+#include <prev/util/Utils.h>
+
+#include <benchmark/benchmark.h>
+
+namespace prev::scene::transform {
+namespace {
+    // a few deep objects with many parts plus lots of flat static props
+    std::vector<uint32_t> BuildScene(TransformHierarchy& hierarchy, const uint32_t count, const uint32_t seed)
+    {
+        prev::util::RandomNumberGenerator rng{ seed };
+        std::uniform_real_distribution<float> positionDist{ -100.0f, 100.0f };
+
+        std::vector<uint32_t> handles;
+        handles.reserve(count);
+        for (uint32_t i = 0; i < count; ++i) {
+            const glm::vec3 position{ positionDist(rng.GetRandomEngine()), 0.0f, positionDist(rng.GetRandomEngine()) };
+            const uint32_t parent{ (i % 10 != 0) ? handles[i - i % 10] : TransformHierarchy::INVALID_HANDLE };
+            handles.push_back(hierarchy.Create(position, glm::quat(1.0f, 0.0f, 0.0f, 0.0f), glm::vec3(1.0f), parent));
+        }
+        hierarchy.Update();
+        return handles;
+    }
+
+    void MoveEvery(TransformHierarchy& hierarchy, const std::vector<uint32_t>& handles, const uint32_t step, const float offset)
+    {
+        for (size_t i = 0; i < handles.size(); i += step) {
+            hierarchy.SetPosition(handles[i], glm::vec3(offset, 0.0f, static_cast<float>(i)));
+        }
+    }
+} // namespace
+
+// what a per node component does - every world matrix is rebuilt every frame
+static void BM_Transforms_RecomputeAll(benchmark::State& state)
+{
+    const uint32_t count{ static_cast<uint32_t>(state.range(0)) };
+
+    std::vector<glm::vec3> positions(count, glm::vec3(1.0f));
+    std::vector<glm::quat> orientations(count, glm::quat(1.0f, 0.0f, 0.0f, 0.0f));
+    std::vector<glm::mat4> worldTransforms(count, glm::mat4(1.0f));
+    for (auto _ : state) {
+        for (uint32_t i = 0; i < count; ++i) {
+            const auto localTransform{ prev::util::math::CreateTransformationMatrix(positions[i], orientations[i], glm::vec3(1.0f)) };
+            worldTransforms[i] = (i % 10 != 0) ? worldTransforms[i - i % 10] * localTransform : localTransform;
+        }
+        benchmark::DoNotOptimize(worldTransforms.data());
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(BM_Transforms_RecomputeAll)->Arg(1000)->Arg(100000);
+
+static void BM_TransformHierarchy_UpdateStatic(benchmark::State& state)
+{
+    TransformHierarchy hierarchy{};
+    BuildScene(hierarchy, static_cast<uint32_t>(state.range(0)), 1);
+
+    for (auto _ : state) {
+        hierarchy.Update();
+    }
+    state.SetItemsProcessed(state.iterations() * hierarchy.GetCount());
+}
+BENCHMARK(BM_TransformHierarchy_UpdateStatic)->Arg(1000)->Arg(100000);
+
+// one object in hundred moves each frame
+static void BM_TransformHierarchy_UpdateMostlyStatic(benchmark::State& state)
+{
+    TransformHierarchy hierarchy{};
+    const auto handles{ BuildScene(hierarchy, static_cast<uint32_t>(state.range(0)), 1) };
+
+    float offset{ 0.0f };
+    for (auto _ : state) {
+        MoveEvery(hierarchy, handles, 100, offset += 1.0f);
+        hierarchy.Update();
+    }
+    state.SetItemsProcessed(state.iterations() * hierarchy.GetCount());
+}
+BENCHMARK(BM_TransformHierarchy_UpdateMostlyStatic)->Arg(1000)->Arg(100000);
+
+static void BM_TransformHierarchy_UpdateAllMoving(benchmark::State& state)
+{
+    TransformHierarchy hierarchy{};
+    const auto handles{ BuildScene(hierarchy, static_cast<uint32_t>(state.range(0)), 1) };
+
+    float offset{ 0.0f };
+    for (auto _ : state) {
+        MoveEvery(hierarchy, handles, 10, offset += 1.0f);
+        hierarchy.Update();
+    }
+    state.SetItemsProcessed(state.iterations() * hierarchy.GetCount());
+}
+BENCHMARK(BM_TransformHierarchy_UpdateAllMoving)->Arg(1000)->Arg(100000);
+
+static void BM_TransformHierarchy_UpdateAllMovingParallel(benchmark::State& state)
+{
+    TransformHierarchy hierarchy{};
+    const auto handles{ BuildScene(hierarchy, static_cast<uint32_t>(state.range(0)), 1) };
+
+    prev::common::ThreadPool threadPool{ std::thread::hardware_concurrency() };
+    float offset{ 0.0f };
+    for (auto _ : state) {
+        MoveEvery(hierarchy, handles, 10, offset += 1.0f);
+        hierarchy.Update(threadPool);
+    }
+    state.SetItemsProcessed(state.iterations() * hierarchy.GetCount());
+}
+BENCHMARK(BM_TransformHierarchy_UpdateAllMovingParallel)->Arg(1000)->Arg(100000);
+} // namespace prev::scene::transform
+
+#endif // !__TRANSFORM_HIERARCHY_BENCHMARKS_H__
@@ -0,0 +1,43 @@
+#ifndef __MATH_UTILS_BENCHMARKS_H__
+#define __MATH_UTILS_BENCHMARKS_H__
+
+#include <prev/common/Common.h>
+#include <prev/util/MathUtils.h>
+#include <prev/util/Utils.h>
+
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+namespace prev::util::math {
+static void BM_MathUtils_DecomposeTransform(benchmark::State& state)
+{
+    constexpr uint32_t TRANSFORM_COUNT{ 1024 };
+
+    prev::util::RandomNumberGenerator rng{ 11 };
+    std::uniform_real_distribution<float> dist{ -1.0f, 1.0f };
+    std::uniform_real_distribution<float> scaleDist{ 0.5f, 2.0f };
+    std::vector<glm::mat4> transforms;
+    transforms.reserve(TRANSFORM_COUNT);
+    for (uint32_t i = 0; i < TRANSFORM_COUNT; ++i) {
+        const glm::vec3 translation{ dist(rng.GetRandomEngine()) * 100.0f, dist(rng.GetRandomEngine()) * 100.0f, dist(rng.GetRandomEngine()) * 100.0f };
+        const glm::quat rotation{ glm::normalize(glm::quat(dist(rng.GetRandomEngine()), dist(rng.GetRandomEngine()), dist(rng.GetRandomEngine()), dist(rng.GetRandomEngine()) + 2.0f)) };
+        const glm::vec3 scale{ scaleDist(rng.GetRandomEngine()), scaleDist(rng.GetRandomEngine()), scaleDist(rng.GetRandomEngine()) };
+        transforms.push_back(glm::translate(glm::mat4(1.0f), translation) * glm::mat4_cast(rotation) * glm::scale(glm::mat4(1.0f), scale));
+    }
+
+    glm::quat rotation{};
+    glm::vec3 translation{};
+    glm::vec3 scale{};
+    for (auto _ : state) {
+        for (const auto& transform : transforms) {
+            benchmark::DoNotOptimize(DecomposeTransform(transform, rotation, translation, scale));
+        }
+        benchmark::DoNotOptimize(rotation);
+    }
+    state.SetItemsProcessed(state.iterations() * TRANSFORM_COUNT);
+}
+BENCHMARK(BM_MathUtils_DecomposeTransform);
+} // namespace prev::util::math
+
+#endif // !__MATH_UTILS_BENCHMARKS_H__
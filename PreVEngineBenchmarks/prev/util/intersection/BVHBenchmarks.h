@@ -0,0 +1,190 @@
+#ifndef __BVH_BENCHMARKS_H__
+#define __BVH_BENCHMARKS_H__
+
+#include <prev/common/Common.h>
+#include <prev/util/Utils.h>
+#include <prev/util/intersection/BVH.h>
+#include <prev/util/intersection/IntersectionTester.h>
+
+#include <benchmark/benchmark.h>
+
+namespace prev::util::intersection {
+namespace {
+    // keeps density constant so both 1k and 100k scenes have similar hit rates
+    std::vector<AABB> GenerateSceneBoxes(const uint32_t count, const uint32_t seed)
+    {
+        const float extent{ 2.0f * std::cbrt(static_cast<float>(count)) };
+
+        prev::util::RandomNumberGenerator rng{ seed };
+        std::uniform_real_distribution<float> positionDist{ -extent, extent };
+        std::uniform_real_distribution<float> sizeDist{ 0.1f, 1.0f };
+
+        std::vector<AABB> boxes;
+        boxes.reserve(count);
+        for (uint32_t i = 0; i < count; ++i) {
+            const glm::vec3 position{ positionDist(rng.GetRandomEngine()), positionDist(rng.GetRandomEngine()), positionDist(rng.GetRandomEngine()) };
+            const glm::vec3 halfSize{ sizeDist(rng.GetRandomEngine()), sizeDist(rng.GetRandomEngine()), sizeDist(rng.GetRandomEngine()) };
+            boxes.emplace_back(position - halfSize, position + halfSize);
+        }
+        return boxes;
+    }
+
+    std::vector<Ray> GenerateRays(const uint32_t count, const float extent, const uint32_t seed)
+    {
+        prev::util::RandomNumberGenerator rng{ seed };
+        std::uniform_real_distribution<float> dist{ -1.0f, 1.0f };
+
+        std::vector<Ray> rays;
+        rays.reserve(count);
+        for (uint32_t i = 0; i < count; ++i) {
+            const glm::vec3 origin{ dist(rng.GetRandomEngine()) * extent, dist(rng.GetRandomEngine()) * extent, dist(rng.GetRandomEngine()) * extent };
+            const glm::vec3 direction{ glm::normalize(glm::vec3(dist(rng.GetRandomEngine()), dist(rng.GetRandomEngine()), dist(rng.GetRandomEngine())) + glm::vec3(0.0f, 0.0f, 0.001f)) };
+            rays.emplace_back(origin, direction, 2.0f * extent);
+        }
+        return rays;
+    }
+} // namespace
+
+static void BM_BVHBuild(benchmark::State& state)
+{
+    const auto boxes{ GenerateSceneBoxes(static_cast<uint32_t>(state.range(0)), 1) };
+    for (auto _ : state) {
+        BVH bvh{};
+        for (size_t i = 0; i < boxes.size(); ++i) {
+            bvh.Insert(boxes[i], i);
+        }
+        benchmark::DoNotOptimize(bvh.GetHeight());
+    }
+}
+BENCHMARK(BM_BVHBuild)->Arg(1000)->Arg(10000)->Arg(100000)->Unit(benchmark::kMillisecond);
+
+static void BM_BVHRefit(benchmark::State& state)
+{
+    auto boxes{ GenerateSceneBoxes(static_cast<uint32_t>(state.range(0)), 2) };
+
+    BVH bvh{};
+    std::vector<uint32_t> proxies;
+    for (size_t i = 0; i < boxes.size(); ++i) {
+        proxies.push_back(bvh.Insert(boxes[i], i));
+    }
+
+    // every object moves a little each frame, roughly what animated scenes do
+    float phase{ 0.0f };
+    for (auto _ : state) {
+        phase += 0.1f;
+        const glm::vec3 offset{ 0.05f * std::sin(phase), 0.0f, 0.05f * std::cos(phase) };
+        for (size_t i = 0; i < boxes.size(); ++i) {
+            boxes[i].minExtents += offset;
+            boxes[i].maxExtents += offset;
+            bvh.Update(proxies[i], boxes[i]);
+        }
+    }
+}
+BENCHMARK(BM_BVHRefit)->Arg(1000)->Arg(10000)->Arg(100000)->Unit(benchmark::kMillisecond);
+
+static void BM_RayCastClosest_Linear(benchmark::State& state)
+{
+    const auto count{ static_cast<uint32_t>(state.range(0)) };
+    const auto boxes{ GenerateSceneBoxes(count, 3) };
+    const auto rays{ GenerateRays(256, 2.0f * std::cbrt(static_cast<float>(count)), 4) };
+
+    size_t rayIndex{ 0 };
+    for (auto _ : state) {
+        const auto& ray{ rays[rayIndex++ % rays.size()] };
+
+        float closestDistance{ std::numeric_limits<float>::max() };
+        for (const auto& box : boxes) {
+            RayCastResult result{};
+            if (tester::Intersects(ray, box, result) && result.t < closestDistance) {
+                closestDistance = result.t;
+            }
+        }
+        benchmark::DoNotOptimize(closestDistance);
+    }
+}
+BENCHMARK(BM_RayCastClosest_Linear)->Arg(1000)->Arg(10000)->Arg(100000);
+
+static void BM_RayCastClosest_BVH(benchmark::State& state)
+{
+    const auto count{ static_cast<uint32_t>(state.range(0)) };
+    const auto boxes{ GenerateSceneBoxes(count, 3) };
+    const auto rays{ GenerateRays(256, 2.0f * std::cbrt(static_cast<float>(count)), 4) };
+
+    BVH bvh{};
+    for (size_t i = 0; i < boxes.size(); ++i) {
+        bvh.Insert(boxes[i], i);
+    }
+
+    size_t rayIndex{ 0 };
+    for (auto _ : state) {
+        const auto& ray{ rays[rayIndex++ % rays.size()] };
+
+        uint64_t userData{};
+        RayCastResult result{};
+        const bool hit{ bvh.RayCastClosest(ray, [&](const uint64_t userData, RayCastResult& outResult) { return tester::Intersects(ray, boxes[userData], outResult); }, userData, result) };
+        benchmark::DoNotOptimize(hit);
+    }
+}
+BENCHMARK(BM_RayCastClosest_BVH)->Arg(1000)->Arg(10000)->Arg(100000);
+
+static void BM_QuerySphere_Linear(benchmark::State& state)
+{
+    const auto count{ static_cast<uint32_t>(state.range(0)) };
+    const auto boxes{ GenerateSceneBoxes(count, 5) };
+    const Sphere sphere{ glm::vec3(0.0f), 5.0f };
+
+    for (auto _ : state) {
+        uint32_t overlapCount{ 0 };
+        for (const auto& box : boxes) {
+            if (tester::Intersects(sphere, box)) {
+                ++overlapCount;
+            }
+        }
+        benchmark::DoNotOptimize(overlapCount);
+    }
+}
+BENCHMARK(BM_QuerySphere_Linear)->Arg(1000)->Arg(10000)->Arg(100000);
+
+static void BM_QuerySphere_BVH(benchmark::State& state)
+{
+    const auto count{ static_cast<uint32_t>(state.range(0)) };
+    const auto boxes{ GenerateSceneBoxes(count, 5) };
+    const Sphere sphere{ glm::vec3(0.0f), 5.0f };
+
+    BVH bvh{};
+    for (size_t i = 0; i < boxes.size(); ++i) {
+        bvh.Insert(boxes[i], i);
+    }
+
+    for (auto _ : state) {
+        uint32_t overlapCount{ 0 };
+        bvh.Query(sphere, [&](const uint64_t userData) {
+            if (tester::Intersects(sphere, boxes[userData])) {
+                ++overlapCount;
+            }
+            return true;
+        });
+        benchmark::DoNotOptimize(overlapCount);
+    }
+}
+BENCHMARK(BM_QuerySphere_BVH)->Arg(1000)->Arg(10000)->Arg(100000);
+
+static void BM_FindNearest_BVH(benchmark::State& state)
+{
+    const auto count{ static_cast<uint32_t>(state.range(0)) };
+    const auto boxes{ GenerateSceneBoxes(count, 6) };
+
+    BVH bvh{};
+    for (size_t i = 0; i < boxes.size(); ++i) {
+        bvh.Insert(boxes[i], i);
+    }
+
+    for (auto _ : state) {
+        const auto nearest{ bvh.FindNearest(glm::vec3(0.0f), 16) };
+        benchmark::DoNotOptimize(nearest.data());
+    }
+}
+BENCHMARK(BM_FindNearest_BVH)->Arg(1000)->Arg(10000)->Arg(100000);
+} // namespace prev::util::intersection
+
+#endif // !__BVH_BENCHMARKS_H__
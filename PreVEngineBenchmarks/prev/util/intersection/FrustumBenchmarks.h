@@ -0,0 +1,35 @@
+#ifndef __FRUSTUM_BENCHMARKS_H__
+#define __FRUSTUM_BENCHMARKS_H__
+
+#include <prev/common/Common.h>
+#include <prev/util/intersection/Frustum.h>
+
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+namespace prev::util::intersection {
+// every view, shadow cascade and light volume builds one each frame
+static void BM_Frustum_Construct(benchmark::State& state)
+{
+    constexpr uint32_t VIEW_COUNT{ 64 };
+
+    const auto projection{ glm::perspective(glm::radians(70.0f), 16.0f / 9.0f, 0.1f, 500.0f) };
+    std::vector<glm::mat4> views;
+    for (uint32_t i = 0; i < VIEW_COUNT; ++i) {
+        const glm::vec3 eye{ static_cast<float>(i), 2.0f, -static_cast<float>(i) };
+        views.push_back(glm::lookAt(eye, eye + glm::vec3(0.3f, -0.1f, -1.0f), glm::vec3(0.0f, 1.0f, 0.0f)));
+    }
+
+    for (auto _ : state) {
+        for (const auto& view : views) {
+            const Frustum frustum{ projection, view };
+            benchmark::DoNotOptimize(frustum);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * VIEW_COUNT);
+}
+BENCHMARK(BM_Frustum_Construct);
+} // namespace prev::util::intersection
+
+#endif // !__FRUSTUM_BENCHMARKS_H__
@@ -0,0 +1,112 @@
+#ifndef __FRUSTUM_CULLER_BENCHMARKS_H__
+#define __FRUSTUM_CULLER_BENCHMARKS_H__
+
+#include <prev/common/Common.h>
+#include <prev/util/Utils.h>
+#include <prev/util/intersection/BVH.h>
+#include <prev/util/intersection/FrustumCuller.h>
+#include <prev/util/intersection/IntersectionTester.h>
+
+#include <benchmark/benchmark.h>
+
+namespace prev::util::intersection {
+namespace {
+    std::vector<AABB> GenerateCullingBoxes(const uint32_t count, const uint32_t seed)
+    {
+        prev::util::RandomNumberGenerator rng{ seed };
+        std::uniform_real_distribution<float> positionDist{ -200.0f, 200.0f };
+        std::uniform_real_distribution<float> sizeDist{ 0.5f, 3.0f };
+
+        std::vector<AABB> boxes;
+        boxes.reserve(count);
+        for (uint32_t i = 0; i < count; ++i) {
+            const glm::vec3 position{ positionDist(rng.GetRandomEngine()), positionDist(rng.GetRandomEngine()), positionDist(rng.GetRandomEngine()) };
+            const glm::vec3 halfSize{ sizeDist(rng.GetRandomEngine()), sizeDist(rng.GetRandomEngine()), sizeDist(rng.GetRandomEngine()) };
+            boxes.emplace_back(position - halfSize, position + halfSize);
+        }
+        return boxes;
+    }
+
+    // stereo pair plus four shadow cascades - the views one frame typically culls against
+    std::vector<Frustum> GenerateViewFrustums(const uint32_t count)
+    {
+        std::vector<Frustum> frustums;
+        for (uint32_t i = 0; i < count; ++i) {
+            const glm::vec3 eye{ 0.06f * static_cast<float>(i), 2.0f, 0.0f };
+            frustums.emplace_back(glm::perspective(glm::radians(70.0f), 16.0f / 9.0f, 0.1f, 150.0f + 50.0f * static_cast<float>(i)), glm::lookAt(eye, eye + glm::vec3(0.3f, -0.1f, -1.0f), glm::vec3(0.0f, 1.0f, 0.0f)));
+        }
+        return frustums;
+    }
+} // namespace
+
+static void BM_FrustumCull_Tester(benchmark::State& state)
+{
+    const auto boxes{ GenerateCullingBoxes(static_cast<uint32_t>(state.range(0)), 1) };
+    const auto frustums{ GenerateViewFrustums(static_cast<uint32_t>(state.range(1))) };
+
+    std::vector<uint8_t> visibility(boxes.size() * frustums.size());
+    for (auto _ : state) {
+        for (size_t view = 0; view < frustums.size(); ++view) {
+            for (size_t i = 0; i < boxes.size(); ++i) {
+                visibility[view * boxes.size() + i] = tester::Intersects(frustums[view], boxes[i]);
+            }
+        }
+        benchmark::DoNotOptimize(visibility.data());
+    }
+    state.SetItemsProcessed(state.iterations() * boxes.size() * frustums.size());
+}
+BENCHMARK(BM_FrustumCull_Tester)->Args({ 1000, 1 })->Args({ 10000, 1 })->Args({ 10000, 2 })->Args({ 10000, 6 })->Args({ 100000, 6 });
+
+static void BM_FrustumCull_Batched(benchmark::State& state)
+{
+    const auto boxes{ GenerateCullingBoxes(static_cast<uint32_t>(state.range(0)), 1) };
+    const auto frustums{ GenerateViewFrustums(static_cast<uint32_t>(state.range(1))) };
+
+    FrustumCuller culler{};
+    for (const auto& box : boxes) {
+        culler.Add(box);
+    }
+
+    VisibilityBitset visibility{};
+    for (auto _ : state) {
+        culler.Cull(frustums.data(), static_cast<uint32_t>(frustums.size()), visibility);
+        benchmark::DoNotOptimize(visibility.GetWords(0));
+    }
+    state.SetItemsProcessed(state.iterations() * boxes.size() * frustums.size());
+    state.counters["planeTests"] = static_cast<double>(culler.GetSlotCount() * 6 * frustums.size());
+}
+BENCHMARK(BM_FrustumCull_Batched)->Args({ 1000, 1 })->Args({ 10000, 1 })->Args({ 10000, 2 })->Args({ 10000, 6 })->Args({ 100000, 6 });
+
+// static scene parts - hierarchical culling with the rejecting planes remembered from the previous frame
+static void BM_FrustumCull_StaticTree(benchmark::State& state)
+{
+    const auto boxes{ GenerateCullingBoxes(static_cast<uint32_t>(state.range(0)), 1) };
+    const auto frustums{ GenerateViewFrustums(static_cast<uint32_t>(state.range(1))) };
+
+    BVH bvh{ 0.0f };
+    for (size_t i = 0; i < boxes.size(); ++i) {
+        bvh.Insert(boxes[i], i);
+    }
+
+    std::vector<BVH::PlaneCache> planeCaches(frustums.size());
+    VisibilityBitset visibility{};
+    BVH::CullingStats frameStats{};
+    for (auto _ : state) {
+        visibility.Reset(static_cast<uint32_t>(frustums.size()), bvh.GetCapacity());
+        frameStats = {};
+        for (uint32_t view = 0; view < static_cast<uint32_t>(frustums.size()); ++view) {
+            auto words{ visibility.GetWords(view) };
+
+            BVH::CullingStats stats{};
+            bvh.Cull(frustums[view], planeCaches[view], [words](const uint32_t proxyId) { words[proxyId / 64] |= uint64_t{ 1 } << (proxyId % 64); }, &stats);
+            frameStats.planeTests += stats.planeTests;
+        }
+        benchmark::DoNotOptimize(visibility.GetWords(0));
+    }
+    state.SetItemsProcessed(state.iterations() * boxes.size() * frustums.size());
+    state.counters["planeTests"] = static_cast<double>(frameStats.planeTests);
+}
+BENCHMARK(BM_FrustumCull_StaticTree)->Args({ 1000, 1 })->Args({ 10000, 1 })->Args({ 10000, 2 })->Args({ 10000, 6 })->Args({ 100000, 6 });
+} // namespace prev::util::intersection
+
+#endif // !__FRUSTUM_CULLER_BENCHMARKS_H__
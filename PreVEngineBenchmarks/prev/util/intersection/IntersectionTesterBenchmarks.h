@@ -0,0 +1,272 @@
+#ifndef __INTERSECTION_TESTER_BENCHMARKS_H__
+#define __INTERSECTION_TESTER_BENCHMARKS_H__
+
+#include <prev/common/Common.h>
+#include <prev/util/Utils.h>
+#include <prev/util/intersection/IntersectionTester.h>
+
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+namespace prev::util::intersection {
+namespace {
+    // primitives scattered around the origin densely enough to mix hits and misses, the hitRatio counter shows the split
+    constexpr uint32_t PRIMITIVE_COUNT{ 1024 };
+
+    constexpr float PRIMITIVE_SPREAD{ 5.0f };
+
+    struct PrimitiveGenerator {
+        PrimitiveGenerator(const uint32_t seed)
+            : rng{ seed }
+        {
+        }
+
+        glm::vec3 NextPosition()
+        {
+            return { positionDist(rng.GetRandomEngine()), positionDist(rng.GetRandomEngine()), positionDist(rng.GetRandomEngine()) };
+        }
+
+        glm::vec3 NextDirection()
+        {
+            const glm::vec3 direction{ NextPosition() };
+            return glm::length(direction) > 0.0f ? glm::normalize(direction) : glm::vec3(0.0f, 1.0f, 0.0f);
+        }
+
+        glm::quat NextOrientation()
+        {
+            return glm::normalize(glm::quat(sizeDist(rng.GetRandomEngine()), NextDirection()));
+        }
+
+        float NextSize()
+        {
+            return sizeDist(rng.GetRandomEngine());
+        }
+
+        prev::util::RandomNumberGenerator rng;
+
+        std::uniform_real_distribution<float> positionDist{ -PRIMITIVE_SPREAD, PRIMITIVE_SPREAD };
+
+        std::uniform_real_distribution<float> sizeDist{ 0.5f, 4.0f };
+    };
+
+    template <typename Primitive, typename Create>
+    std::vector<Primitive> GeneratePrimitives(const uint32_t seed, Create create)
+    {
+        PrimitiveGenerator generator{ seed };
+        std::vector<Primitive> primitives;
+        primitives.reserve(PRIMITIVE_COUNT);
+        for (uint32_t i = 0; i < PRIMITIVE_COUNT; ++i) {
+            primitives.push_back(create(generator));
+        }
+        return primitives;
+    }
+
+    std::vector<Point> GeneratePoints(const uint32_t seed)
+    {
+        return GeneratePrimitives<Point>(seed, [](PrimitiveGenerator& g) { return Point{ g.NextPosition() }; });
+    }
+
+    std::vector<Plane> GeneratePlanes(const uint32_t seed)
+    {
+        return GeneratePrimitives<Plane>(seed, [](PrimitiveGenerator& g) { return Plane{ g.NextDirection(), g.NextSize() }; });
+    }
+
+    std::vector<Sphere> GenerateSpheres(const uint32_t seed)
+    {
+        return GeneratePrimitives<Sphere>(seed, [](PrimitiveGenerator& g) { return Sphere{ g.NextPosition(), g.NextSize() }; });
+    }
+
+    std::vector<AABB> GenerateBoxes(const uint32_t seed)
+    {
+        return GeneratePrimitives<AABB>(seed, [](PrimitiveGenerator& g) {
+            const auto center{ g.NextPosition() };
+            const glm::vec3 halfSize{ g.NextSize(), g.NextSize(), g.NextSize() };
+            return AABB{ center - halfSize, center + halfSize };
+        });
+    }
+
+    std::vector<OBB> GenerateOrientedBoxes(const uint32_t seed)
+    {
+        return GeneratePrimitives<OBB>(seed, [](PrimitiveGenerator& g) { return OBB{ g.NextOrientation(), g.NextPosition(), glm::vec3(g.NextSize(), g.NextSize(), g.NextSize()) }; });
+    }
+
+    std::vector<Ray> GenerateAimedRays(const uint32_t seed)
+    {
+        // from outside of the cloud towards a point inside of it
+        return GeneratePrimitives<Ray>(seed, [](PrimitiveGenerator& g) {
+            const auto origin{ g.NextPosition() * 2.0f };
+            const auto target{ g.NextPosition() };
+            return Ray{ origin, glm::normalize(target - origin), 4.0f * PRIMITIVE_SPREAD };
+        });
+    }
+
+    std::vector<Frustum> GenerateFrustums(const uint32_t seed)
+    {
+        return GeneratePrimitives<Frustum>(seed, [](PrimitiveGenerator& g) {
+            const auto eye{ g.NextPosition() };
+            return Frustum{ glm::perspective(glm::radians(60.0f), 16.0f / 9.0f, 0.1f, 2.0f * PRIMITIVE_SPREAD), glm::lookAt(eye, eye + g.NextDirection(), glm::vec3(0.0f, 1.0f, 0.0f)) };
+        });
+    }
+
+    template <typename A, typename B>
+    void RunIntersects(benchmark::State& state, const std::vector<A>& as, const std::vector<B>& bs)
+    {
+        uint32_t hitCount{};
+        for (auto _ : state) {
+            hitCount = 0;
+            for (uint32_t i = 0; i < PRIMITIVE_COUNT; ++i) {
+                hitCount += tester::Intersects(as[i], bs[i]) ? 1 : 0;
+            }
+            benchmark::DoNotOptimize(hitCount);
+        }
+        state.SetItemsProcessed(state.iterations() * PRIMITIVE_COUNT);
+        state.counters["hitRatio"] = static_cast<double>(hitCount) / PRIMITIVE_COUNT;
+    }
+
+    template <typename B>
+    void RunRayIntersects(benchmark::State& state, const std::vector<Ray>& rays, const std::vector<B>& bs)
+    {
+        uint32_t hitCount{};
+        RayCastResult result{};
+        for (auto _ : state) {
+            hitCount = 0;
+            for (uint32_t i = 0; i < PRIMITIVE_COUNT; ++i) {
+                hitCount += tester::Intersects(rays[i], bs[i], result) ? 1 : 0;
+            }
+            benchmark::DoNotOptimize(hitCount);
+            benchmark::DoNotOptimize(result);
+        }
+        state.SetItemsProcessed(state.iterations() * PRIMITIVE_COUNT);
+        state.counters["hitRatio"] = static_cast<double>(hitCount) / PRIMITIVE_COUNT;
+    }
+} // namespace
+
+static void BM_Intersects_SpherePlane(benchmark::State& state)
+{
+    RunIntersects(state, GenerateSpheres(1), GeneratePlanes(2));
+}
+BENCHMARK(BM_Intersects_SpherePlane);
+
+static void BM_Intersects_AABBPlane(benchmark::State& state)
+{
+    RunIntersects(state, GenerateBoxes(1), GeneratePlanes(2));
+}
+BENCHMARK(BM_Intersects_AABBPlane);
+
+static void BM_Intersects_PlanePoint(benchmark::State& state)
+{
+    RunIntersects(state, GeneratePlanes(1), GeneratePoints(2));
+}
+BENCHMARK(BM_Intersects_PlanePoint);
+
+static void BM_Intersects_AABBPoint(benchmark::State& state)
+{
+    RunIntersects(state, GenerateBoxes(1), GeneratePoints(2));
+}
+BENCHMARK(BM_Intersects_AABBPoint);
+
+static void BM_Intersects_SpherePoint(benchmark::State& state)
+{
+    RunIntersects(state, GenerateSpheres(1), GeneratePoints(2));
+}
+BENCHMARK(BM_Intersects_SpherePoint);
+
+static void BM_Intersects_AABBAABB(benchmark::State& state)
+{
+    RunIntersects(state, GenerateBoxes(1), GenerateBoxes(2));
+}
+BENCHMARK(BM_Intersects_AABBAABB);
+
+static void BM_Intersects_SphereSphere(benchmark::State& state)
+{
+    RunIntersects(state, GenerateSpheres(1), GenerateSpheres(2));
+}
+BENCHMARK(BM_Intersects_SphereSphere);
+
+static void BM_Intersects_SphereAABB(benchmark::State& state)
+{
+    RunIntersects(state, GenerateSpheres(1), GenerateBoxes(2));
+}
+BENCHMARK(BM_Intersects_SphereAABB);
+
+static void BM_Intersects_FrustumPoint(benchmark::State& state)
+{
+    RunIntersects(state, GenerateFrustums(1), GeneratePoints(2));
+}
+BENCHMARK(BM_Intersects_FrustumPoint);
+
+static void BM_Intersects_FrustumSphere(benchmark::State& state)
+{
+    RunIntersects(state, GenerateFrustums(1), GenerateSpheres(2));
+}
+BENCHMARK(BM_Intersects_FrustumSphere);
+
+static void BM_Intersects_FrustumAABB(benchmark::State& state)
+{
+    RunIntersects(state, GenerateFrustums(1), GenerateBoxes(2));
+}
+BENCHMARK(BM_Intersects_FrustumAABB);
+
+static void BM_Intersects_OBBOBB(benchmark::State& state)
+{
+    RunIntersects(state, GenerateOrientedBoxes(1), GenerateOrientedBoxes(2));
+}
+BENCHMARK(BM_Intersects_OBBOBB);
+
+static void BM_Intersects_OBBAABB(benchmark::State& state)
+{
+    RunIntersects(state, GenerateOrientedBoxes(1), GenerateBoxes(2));
+}
+BENCHMARK(BM_Intersects_OBBAABB);
+
+static void BM_Intersects_OBBSphere(benchmark::State& state)
+{
+    RunIntersects(state, GenerateOrientedBoxes(1), GenerateSpheres(2));
+}
+BENCHMARK(BM_Intersects_OBBSphere);
+
+static void BM_Intersects_OBBPoint(benchmark::State& state)
+{
+    RunIntersects(state, GenerateOrientedBoxes(1), GeneratePoints(2));
+}
+BENCHMARK(BM_Intersects_OBBPoint);
+
+static void BM_Intersects_OBBFrustum(benchmark::State& state)
+{
+    RunIntersects(state, GenerateOrientedBoxes(1), GenerateFrustums(2));
+}
+BENCHMARK(BM_Intersects_OBBFrustum);
+
+static void BM_Intersects_OBBPlane(benchmark::State& state)
+{
+    RunIntersects(state, GenerateOrientedBoxes(1), GeneratePlanes(2));
+}
+BENCHMARK(BM_Intersects_OBBPlane);
+
+static void BM_Intersects_RayAABB(benchmark::State& state)
+{
+    RunRayIntersects(state, GenerateAimedRays(1), GenerateBoxes(2));
+}
+BENCHMARK(BM_Intersects_RayAABB);
+
+static void BM_Intersects_RaySphere(benchmark::State& state)
+{
+    RunRayIntersects(state, GenerateAimedRays(1), GenerateSpheres(2));
+}
+BENCHMARK(BM_Intersects_RaySphere);
+
+static void BM_Intersects_RayPlane(benchmark::State& state)
+{
+    RunRayIntersects(state, GenerateAimedRays(1), GeneratePlanes(2));
+}
+BENCHMARK(BM_Intersects_RayPlane);
+
+static void BM_Intersects_RayOBB(benchmark::State& state)
+{
+    RunRayIntersects(state, GenerateAimedRays(1), GenerateOrientedBoxes(2));
+}
+BENCHMARK(BM_Intersects_RayOBB);
+} // namespace prev::util::intersection
+
+#endif // !__INTERSECTION_TESTER_BENCHMARKS_H__
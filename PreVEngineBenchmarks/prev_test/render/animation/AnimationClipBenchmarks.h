@@ -0,0 +1,63 @@
+#ifndef __ANIMATION_CLIP_BENCHMARKS_H__
+#define __ANIMATION_CLIP_BENCHMARKS_H__
+
+#include <prev_test/render/animation/AnimationClip.h>
+
+#include <benchmark/benchmark.h>
+
+#include <string>
+#include <vector>
+
+namespace prev_test::render::animation {
+namespace {
+    constexpr float CLIP_DURATION{ 100.0f };
+
+    constexpr uint32_t CLIP_KEY_FRAME_COUNT{ 30 };
+
+    // a binary tree of bones in heap order, each one animated by its own key frames
+    void AddBone(AnimationNode& parent, const uint32_t index, const uint32_t boneCount, std::vector<AnimationNodeKeyFrames>& keyFrames, std::vector<BoneInfo>& bones)
+    {
+        if (index >= boneCount) {
+            return;
+        }
+
+        AnimationNode node{ "Bone_" + std::to_string(index), glm::translate(glm::mat4(1.0f), glm::vec3(0.0f, 0.1f, 0.0f)) };
+        AnimationNodeKeyFrames nodeKeyFrames{ node.name };
+        for (uint32_t i = 0; i < CLIP_KEY_FRAME_COUNT; ++i) {
+            const float time{ CLIP_DURATION * static_cast<float>(i) / static_cast<float>(CLIP_KEY_FRAME_COUNT - 1) };
+            nodeKeyFrames.positions.push_back(VectorKey{ glm::vec3(0.0f, 0.1f, 0.01f * static_cast<float>(i)), time });
+            nodeKeyFrames.rotations.push_back(QuaternionKey{ glm::angleAxis(0.05f * static_cast<float>(i + index), glm::vec3(0.0f, 0.0f, 1.0f)), time });
+            nodeKeyFrames.scales.push_back(VectorKey{ glm::vec3(1.0f), time });
+        }
+        keyFrames.push_back(nodeKeyFrames);
+        bones.push_back(BoneInfo{ node.name, glm::mat4(1.0f) });
+
+        AddBone(node, 2 * index + 1, boneCount, keyFrames, bones);
+        AddBone(node, 2 * index + 2, boneCount, keyFrames, bones);
+        parent.children.push_back(node);
+    }
+
+    AnimationClip CreateClip(const uint32_t boneCount)
+    {
+        AnimationNode root{ "Root" };
+        std::vector<AnimationNodeKeyFrames> keyFrames;
+        std::vector<BoneInfo> bones;
+        AddBone(root, 0, boneCount, keyFrames, bones);
+        return AnimationClip{ glm::mat4(1.0f), root, keyFrames, bones, 25.0f, CLIP_DURATION };
+    }
+} // namespace
+
+// one skinned character's per frame animation update
+static void BM_AnimationClip_Update(benchmark::State& state)
+{
+    auto clip{ CreateClip(static_cast<uint32_t>(state.range(0))) };
+    for (auto _ : state) {
+        clip.Update(1.0f / 60.0f);
+        benchmark::DoNotOptimize(clip.GetBoneTransforms().data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_AnimationClip_Update)->Arg(32)->Arg(64);
+} // namespace prev_test::render::animation
+
+#endif // !__ANIMATION_CLIP_BENCHMARKS_H__
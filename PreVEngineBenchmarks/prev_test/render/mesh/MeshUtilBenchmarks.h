@@ -0,0 +1,48 @@
+#ifndef __MESH_UTIL_BENCHMARKS_H__
+#define __MESH_UTIL_BENCHMARKS_H__
+
+#include <prev_test/render/mesh/MeshUtil.h>
+
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+#include <vector>
+
+namespace prev_test::render::mesh {
+namespace {
+    // a gridSize x gridSize wavy plane, the shape of a terrain chunk
+    void CreateGridMesh(const uint32_t gridSize, std::vector<glm::vec3>& vertices, std::vector<uint32_t>& indices)
+    {
+        vertices.clear();
+        indices.clear();
+        for (uint32_t z = 0; z < gridSize; ++z) {
+            for (uint32_t x = 0; x < gridSize; ++x) {
+                vertices.emplace_back(static_cast<float>(x), std::sin(static_cast<float>(x) * 0.3f) * std::cos(static_cast<float>(z) * 0.2f), static_cast<float>(z));
+            }
+        }
+        for (uint32_t z = 0; z < gridSize - 1; ++z) {
+            for (uint32_t x = 0; x < gridSize - 1; ++x) {
+                const uint32_t topLeft{ z * gridSize + x };
+                const uint32_t bottomLeft{ (z + 1) * gridSize + x };
+                indices.insert(indices.end(), { topLeft, bottomLeft, topLeft + 1, topLeft + 1, bottomLeft, bottomLeft + 1 });
+            }
+        }
+    }
+} // namespace
+
+static void BM_MeshUtil_GenerateNormals(benchmark::State& state)
+{
+    std::vector<glm::vec3> vertices;
+    std::vector<uint32_t> indices;
+    CreateGridMesh(static_cast<uint32_t>(state.range(0)), vertices, indices);
+    const bool smooth{ state.range(1) != 0 };
+    for (auto _ : state) {
+        const auto normals{ MeshUtil::GenerateNormals(vertices, indices, smooth) };
+        benchmark::DoNotOptimize(normals.data());
+    }
+    state.SetItemsProcessed(state.iterations() * indices.size() / 3);
+}
+BENCHMARK(BM_MeshUtil_GenerateNormals)->Args({ 64, 0 })->Args({ 64, 1 })->Args({ 256, 1 });
+} // namespace prev_test::render::mesh
+
+#endif // !__MESH_UTIL_BENCHMARKS_H__
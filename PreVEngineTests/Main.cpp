@@ -1,5 +1,27 @@
 
+#include "prev/common/CacheTests.h"
+#include "prev/common/FrameAllocatorTests.h"
+#include "prev/common/LoggerTests.h"
+#include "prev/common/SmallVectorTests.h"
+#include "prev/core/AssetLoaderTests.h"
+#include "prev/core/memory/RingAllocatorTests.h"
+#include "prev/core/memory/TlsfAllocatorTests.h"
+#include "prev/event/EventQueueTests.h"
+#include "prev/input/InputSnapshotTests.h"
+#include "prev/profile/AllocationTrackerTests.h"
+#include "prev/profile/FrameStatisticsTests.h"
+#include "prev/profile/ProfilerTests.h"
+#include "prev/render/image/ImageTests.h"
+#include "prev/render/image/Ktx2SerializerTests.h"
+#include "prev/render/image/TextureCookerTests.h"
+#include "prev/render/pipeline/PipelineCacheTests.h"
+#include "prev/scene/particle/ParticleDepthSorterTests.h"
+#include "prev/scene/particle/ParticlePoolTests.h"
+#include "prev/scene/particle/ParticleSimulationTests.h"
+#include "prev/scene/transform/TransformHierarchyTests.h"
 #include "prev/util/MathUtilsTests.h"
+#include "prev/util/intersection/BVHTests.h"
+#include "prev/util/intersection/FrustumCullerTests.h"
 #include "prev/util/intersection/IntersectionTesterTests.h"
 
 TEST(SampleTest, BasicAssertions)
@@ -0,0 +1,138 @@
+#ifndef __CACHE_TESTS_H__
+#define __CACHE_TESTS_H__
+
+#include <prev/common/Cache.h>
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace prev::common {
+TEST(CacheTests, Find_ReturnsAddedValue)
+{
+    Cache<std::string, int> cache{};
+    cache.Add("a", 1);
+
+    EXPECT_TRUE(cache.Contains("a"));
+    EXPECT_FALSE(cache.Contains("b"));
+    EXPECT_EQ(1, cache.Find("a").value_or(0));
+    EXPECT_FALSE(cache.Find("b").has_value());
+
+    cache.Remove("a");
+    EXPECT_FALSE(cache.Contains("a"));
+
+    const auto statistics{ cache.GetStatistics() };
+    EXPECT_EQ(1u, statistics.hitCount);
+    EXPECT_EQ(1u, statistics.missCount);
+    EXPECT_EQ(0u, statistics.size);
+}
+
+TEST(CacheTests, Add_EvictsLeastRecentlyUsed)
+{
+    Cache<int, int> cache{ 3, {}, 1 };
+    cache.Add(1, 1);
+    cache.Add(2, 2);
+    cache.Add(3, 3);
+
+    // 1 becomes the most recently used one, so 2 goes first
+    cache.Find(1);
+    cache.Add(4, 4);
+
+    EXPECT_TRUE(cache.Contains(1));
+    EXPECT_FALSE(cache.Contains(2));
+    EXPECT_TRUE(cache.Contains(3));
+    EXPECT_TRUE(cache.Contains(4));
+    EXPECT_EQ(1u, cache.GetStatistics().evictionCount);
+}
+
+TEST(CacheTests, Add_KeepsWithinCostBudget)
+{
+    Cache<int, std::vector<char>> cache{ 100, [](const std::vector<char>& value) { return value.size(); }, 1 };
+    cache.Add(1, std::vector<char>(40));
+    cache.Add(2, std::vector<char>(40));
+    cache.Add(3, std::vector<char>(40));
+
+    auto statistics{ cache.GetStatistics() };
+    EXPECT_EQ(2u, statistics.size);
+    EXPECT_EQ(80u, statistics.cost);
+    EXPECT_FALSE(cache.Contains(1));
+
+    // replacing a value updates its cost
+    cache.Add(3, std::vector<char>(10));
+    EXPECT_EQ(50u, cache.GetStatistics().cost);
+
+    // a single value over the budget still gets in, alone
+    cache.Add(4, std::vector<char>(200));
+    statistics = cache.GetStatistics();
+    EXPECT_EQ(1u, statistics.size);
+    EXPECT_TRUE(cache.Contains(4));
+}
+
+TEST(CacheTests, Add_SharesCostBudgetAcrossShards)
+{
+    Cache<int, std::vector<char>> cache{ 100, [](const std::vector<char>& value) { return value.size(); }, 8 };
+    for (int i = 0; i < 64; ++i) {
+        cache.Add(i, std::vector<char>(20));
+        EXPECT_LE(cache.GetStatistics().cost, 100u);
+    }
+
+    const auto statistics{ cache.GetStatistics() };
+    EXPECT_EQ(5u, statistics.size);
+    EXPECT_EQ(59u, statistics.evictionCount);
+    EXPECT_TRUE(cache.Contains(63));
+}
+
+TEST(CacheTests, GetOrCreate_CreatesOnceForConcurrentMisses)
+{
+    Cache<std::string, int> cache{};
+    std::atomic<int> createCount{ 0 };
+
+    std::vector<std::thread> threads;
+    std::vector<int> results(8);
+    for (size_t i = 0; i < results.size(); ++i) {
+        threads.emplace_back([&, i]() {
+            results[i] = cache.GetOrCreate("key", [&]() {
+                ++createCount;
+                std::this_thread::sleep_for(std::chrono::milliseconds(20));
+                return 42;
+            });
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    EXPECT_EQ(1, createCount.load());
+    for (const auto result : results) {
+        EXPECT_EQ(42, result);
+    }
+    EXPECT_EQ(1u, cache.GetStatistics().missCount);
+}
+
+TEST(CacheTests, GetOrCreate_DoesNotCacheFailures)
+{
+    Cache<std::string, int> cache{};
+    EXPECT_THROW(cache.GetOrCreate("key", []() -> int { throw std::runtime_error{ "failed" }; }), std::runtime_error);
+    EXPECT_FALSE(cache.Contains("key"));
+    EXPECT_EQ(7, cache.GetOrCreate("key", []() { return 7; }));
+}
+
+TEST(CacheTests, GetOrCreate_DoesNotCacheNull)
+{
+    Cache<std::string, std::shared_ptr<int>> cache{};
+    EXPECT_TRUE(cache.GetOrCreate("key", []() { return std::shared_ptr<int>{}; }) == nullptr);
+    EXPECT_FALSE(cache.Contains("key"));
+    EXPECT_EQ(0u, cache.GetStatistics().size);
+
+    EXPECT_EQ(7, *cache.GetOrCreate("key", []() { return std::make_shared<int>(7); }));
+    EXPECT_TRUE(cache.Contains("key"));
+}
+} // namespace prev::common
+
+#endif // !__CACHE_TESTS_H__
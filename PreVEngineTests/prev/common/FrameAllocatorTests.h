@@ -0,0 +1,98 @@
+#ifndef __FRAME_ALLOCATOR_TESTS_H__
+#define __FRAME_ALLOCATOR_TESTS_H__
+
+#include <prev/common/FrameAllocator.h>
+#include <prev/profile/AllocationTracker.h>
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <thread>
+
+namespace prev::common {
+TEST(FrameAllocatorTests, Allocate_ReturnsAlignedDistinctMemory)
+{
+    auto& allocator{ FrameAllocator::Instance() };
+    allocator.BeginFrame();
+
+    auto first{ static_cast<uint8_t*>(allocator.Allocate(3, 1)) };
+    auto second{ static_cast<uint8_t*>(allocator.Allocate(64, 64)) };
+    auto third{ allocator.Allocate<double>(4) };
+    ASSERT_NE(nullptr, first);
+    ASSERT_NE(nullptr, second);
+    ASSERT_NE(nullptr, third);
+    EXPECT_EQ(0u, reinterpret_cast<uintptr_t>(second) % 64);
+    EXPECT_EQ(0u, reinterpret_cast<uintptr_t>(third) % alignof(double));
+    EXPECT_GE(second, first + 3);
+    EXPECT_GE(reinterpret_cast<uint8_t*>(third), second + 64);
+    EXPECT_GE(allocator.GetThreadUsedSize(), 3u + 64u + 4 * sizeof(double));
+}
+
+TEST(FrameAllocatorTests, BeginFrame_ReusesMemoryOfLastFrame)
+{
+    auto& allocator{ FrameAllocator::Instance() };
+    allocator.BeginFrame();
+    const auto first{ allocator.Allocate(128) };
+    const auto capacity{ allocator.GetThreadCapacity() };
+
+    allocator.BeginFrame();
+    EXPECT_EQ(0u, allocator.GetThreadUsedSize());
+    EXPECT_EQ(first, allocator.Allocate(128));
+    EXPECT_EQ(capacity, allocator.GetThreadCapacity());
+}
+
+TEST(FrameAllocatorTests, Allocate_GrowsOverBlockSize)
+{
+    auto& allocator{ FrameAllocator::Instance() };
+    allocator.BeginFrame();
+
+    constexpr size_t LARGE_SIZE{ 1024 * 1024 };
+    auto memory{ static_cast<uint8_t*>(allocator.Allocate(LARGE_SIZE)) };
+    ASSERT_NE(nullptr, memory);
+    memory[0] = 1;
+    memory[LARGE_SIZE - 1] = 2;
+    EXPECT_GE(allocator.GetThreadCapacity(), LARGE_SIZE);
+}
+
+TEST(FrameAllocatorTests, Allocate_UsesRegionPerThread)
+{
+    auto& allocator{ FrameAllocator::Instance() };
+    allocator.BeginFrame();
+    const auto mainMemory{ allocator.Allocate(16) };
+
+    void* workerMemory{};
+    size_t workerUsedSize{};
+    std::thread worker{ [&]() {
+        workerMemory = allocator.Allocate(16);
+        workerUsedSize = allocator.GetThreadUsedSize();
+    } };
+    worker.join();
+
+    EXPECT_NE(mainMemory, workerMemory);
+    EXPECT_EQ(16u, workerUsedSize);
+}
+
+TEST(FrameAllocatorTests, FrameVector_DoesNotAllocateFromHeapInSteadyState)
+{
+    if (!prev::profile::AllocationTracker::IsAvailable()) {
+        GTEST_SKIP() << "Built without ENABLE_ALLOCATION_TRACKING";
+    }
+
+    auto& allocator{ FrameAllocator::Instance() };
+    for (uint32_t frame = 0; frame < 3; ++frame) {
+        allocator.BeginFrame();
+        const prev::profile::AllocationCounter counter{};
+        FrameVector<uint32_t> values;
+        for (uint32_t i = 0; i < 1000; ++i) {
+            values.push_back(i);
+        }
+        EXPECT_EQ(999u, values.back());
+        // the first frame gets the region its blocks
+        if (frame > 0) {
+            EXPECT_EQ(0u, counter.GetCount());
+        }
+    }
+}
+} // namespace prev::common
+
+#endif // !__FRAME_ALLOCATOR_TESTS_H__
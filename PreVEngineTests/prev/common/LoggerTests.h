@@ -0,0 +1,162 @@
+#ifndef __LOGGER_TESTS_H__
+#define __LOGGER_TESTS_H__
+
+#include <prev/common/Logger.h>
+
+#include <gtest/gtest.h>
+
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace prev::common {
+// Collects the logged messages instead of the console while alive.
+class LogCapture final {
+public:
+    LogCapture()
+    {
+        Logger::Flush();
+        Logger::Instance().SetSink([this](const LogEntry& entry) {
+            std::scoped_lock lock{ m_mutex };
+            m_entries.push_back(entry);
+        });
+    }
+
+    ~LogCapture()
+    {
+        Logger::Instance().ResetSink();
+        Logger::SetLevel(LogLevel::VERBOSE);
+        Logger::ClearModuleLevels();
+    }
+
+public:
+    std::vector<LogEntry> GetEntries()
+    {
+        Logger::Flush();
+        std::scoped_lock lock{ m_mutex };
+        return m_entries;
+    }
+
+private:
+    std::mutex m_mutex;
+
+    std::vector<LogEntry> m_entries;
+};
+
+TEST(LoggerTests, Write_FormatsArgumentsLikePrintf)
+{
+    LogCapture capture{};
+
+    const std::string name{ "long enough not to fit in a small string buffer" };
+    Logger::Write(LogLevel::INFO, false, __FILE__, "%s|%u|%d|%.2f|%zu|%llu|%-6s|%X|%c|%*d|100%%", name.c_str(), 7u, -3, 1.005f, size_t{ 42 }, 1ull << 40, "ab", 255, 'z', 4, 9);
+
+    const auto entries{ capture.GetEntries() };
+    ASSERT_EQ(1u, entries.size());
+    EXPECT_EQ(LogLevel::INFO, entries[0].level);
+    EXPECT_FALSE(entries[0].plain);
+    EXPECT_EQ(name + "|7|-3|1.00|42|1099511627776|ab    |FF|z|   9|100%", entries[0].message);
+}
+
+TEST(LoggerTests, Write_CopiesStringArguments)
+{
+    LogCapture capture{};
+    {
+        std::string temporary{ "gone after the call" };
+        Logger::Write(LogLevel::WARNING, false, __FILE__, "%s", temporary.c_str());
+        temporary.assign(temporary.size(), 'x');
+    }
+
+    const char* missing{};
+    Logger::Write(LogLevel::WARNING, false, __FILE__, "%s", missing);
+
+    const auto entries{ capture.GetEntries() };
+    ASSERT_EQ(2u, entries.size());
+    EXPECT_EQ("gone after the call", entries[0].message);
+    EXPECT_EQ("(null)", entries[1].message);
+}
+
+TEST(LoggerTests, Write_CutsTooLongMessage)
+{
+    LogCapture capture{};
+
+    const std::string text(LogRecord::MAX_SIZE * 2, 'a');
+    Logger::Write(LogLevel::INFO, false, __FILE__, "%s %d", text.c_str(), 1);
+
+    const auto entries{ capture.GetEntries() };
+    ASSERT_EQ(1u, entries.size());
+    EXPECT_LT(entries[0].message.size(), LogRecord::MAX_SIZE);
+    EXPECT_EQ(std::string(32, 'a'), entries[0].message.substr(0, 32));
+}
+
+TEST(LoggerTests, SetLevel_FiltersLowerLevels)
+{
+    LogCapture capture{};
+
+    Logger::SetLevel(LogLevel::WARNING);
+    Logger::Write(LogLevel::INFO, false, __FILE__, "info");
+    Logger::Write(LogLevel::ERR, false, __FILE__, "error");
+
+    const auto entries{ capture.GetEntries() };
+    ASSERT_EQ(1u, entries.size());
+    EXPECT_EQ("error", entries[0].message);
+}
+
+TEST(LoggerTests, SetModuleLevel_OverridesGlobalLevelForMatchingFiles)
+{
+    LogCapture capture{};
+
+    Logger::SetLevel(LogLevel::ERR);
+    ASSERT_TRUE(Logger::SetModuleLevel("render/image", LogLevel::DEBUG));
+    ASSERT_TRUE(Logger::SetModuleLevel("render/image/cooker", LogLevel::OFF));
+
+    Logger::Write(LogLevel::INFO, false, "prev/render/image/ImageFactory.cpp", "image");
+    Logger::Write(LogLevel::ERR, false, "prev/render/image/cooker/Cooker.cpp", "cooker");
+    Logger::Write(LogLevel::INFO, false, "prev/scene/Scene.cpp", "scene");
+
+    const auto entries{ capture.GetEntries() };
+    ASSERT_EQ(1u, entries.size());
+    EXPECT_EQ("image", entries[0].message);
+
+    Logger::ClearModuleLevels();
+    EXPECT_FALSE(Logger::IsEnabled(LogLevel::INFO, "prev/render/image/ImageFactory.cpp"));
+    EXPECT_TRUE(Logger::IsEnabled(LogLevel::ERR, "prev/render/image/cooker/Cooker.cpp"));
+}
+
+TEST(LoggerTests, Write_KeepsAllMessagesOfAllThreadsInOrder)
+{
+    LogCapture capture{};
+
+    constexpr uint32_t THREAD_COUNT{ 4 };
+    constexpr uint32_t MESSAGE_COUNT{ 200 };
+
+    std::vector<std::thread> threads;
+    for (uint32_t t = 0; t < THREAD_COUNT; ++t) {
+        threads.emplace_back([t]() {
+            for (uint32_t i = 0; i < MESSAGE_COUNT; ++i) {
+                Logger::Write(LogLevel::DEBUG, false, __FILE__, "%u %u", t, i);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    const auto entries{ capture.GetEntries() };
+    ASSERT_EQ(THREAD_COUNT * MESSAGE_COUNT, entries.size() + Logger::Instance().GetDroppedCount());
+
+    std::vector<uint32_t> nextIndices(THREAD_COUNT);
+    for (size_t i = 0; i < entries.size(); ++i) {
+        if (i > 0) {
+            EXPECT_LE(entries[i - 1].timestamp, entries[i].timestamp);
+        }
+        uint32_t thread{}, index{};
+        ASSERT_EQ(2, std::sscanf(entries[i].message.c_str(), "%u %u", &thread, &index));
+        ASSERT_LT(thread, THREAD_COUNT);
+        EXPECT_LE(nextIndices[thread], index);
+        nextIndices[thread] = index + 1;
+    }
+}
+} // namespace prev::common
+
+#endif // !__LOGGER_TESTS_H__
@@ -0,0 +1,90 @@
+#ifndef __SMALL_VECTOR_TESTS_H__
+#define __SMALL_VECTOR_TESTS_H__
+
+#include <prev/common/SmallVector.h>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <memory>
+#include <string>
+
+namespace prev::common {
+TEST(SmallVectorTests, PushBack_StaysInlineUpToInlineCapacity)
+{
+    SmallVector<int, 4> values;
+    for (int i = 0; i < 4; ++i) {
+        values.push_back(i);
+    }
+    EXPECT_TRUE(values.is_inline());
+    EXPECT_EQ(4u, values.size());
+
+    values.push_back(4);
+    EXPECT_FALSE(values.is_inline());
+    EXPECT_EQ(5u, values.size());
+    for (int i = 0; i < 5; ++i) {
+        EXPECT_EQ(i, values[i]);
+    }
+}
+
+TEST(SmallVectorTests, PushBack_OwnElementWhileGrowing)
+{
+    SmallVector<std::string, 2> values{ "first", "second" };
+    values.push_back(values[0]);
+    ASSERT_EQ(3u, values.size());
+    EXPECT_EQ("first", values[2]);
+}
+
+TEST(SmallVectorTests, CopyAndMove_KeepElements)
+{
+    SmallVector<std::string, 2> inlineValues{ "a" };
+    SmallVector<std::string, 2> heapValues{ "a", "b", "c" };
+
+    const auto inlineCopy{ inlineValues };
+    const auto heapCopy{ heapValues };
+    EXPECT_EQ(1u, inlineCopy.size());
+    EXPECT_EQ(3u, heapCopy.size());
+    EXPECT_EQ("c", heapCopy.back());
+
+    auto inlineMoved{ std::move(inlineValues) };
+    auto heapMoved{ std::move(heapValues) };
+    EXPECT_EQ("a", inlineMoved.front());
+    EXPECT_EQ("c", heapMoved.back());
+    EXPECT_TRUE(inlineValues.empty());
+    EXPECT_TRUE(heapValues.empty());
+    EXPECT_TRUE(heapValues.is_inline());
+
+    heapMoved = inlineMoved;
+    EXPECT_EQ(1u, heapMoved.size());
+}
+
+TEST(SmallVectorTests, Destructor_DestroysElements)
+{
+    const auto counter{ std::make_shared<int>(0) };
+    {
+        SmallVector<std::shared_ptr<int>, 2> values;
+        for (int i = 0; i < 5; ++i) {
+            values.push_back(counter);
+        }
+        EXPECT_EQ(6, counter.use_count());
+        values.pop_back();
+        EXPECT_EQ(5, counter.use_count());
+    }
+    EXPECT_EQ(1, counter.use_count());
+}
+
+TEST(SmallVectorTests, Iterators_WorkWithAlgorithms)
+{
+    SmallVector<int, 8> values{ 5, 3, 9, 1 };
+    std::sort(values.begin(), values.end());
+    EXPECT_EQ(1, values.front());
+    EXPECT_EQ(9, values.back());
+
+    values.resize(6);
+    EXPECT_EQ(0, values[5]);
+    values.resize(2);
+    EXPECT_EQ(2u, values.size());
+}
+} // namespace prev::common
+
+#endif // !__SMALL_VECTOR_TESTS_H__
@@ -0,0 +1,177 @@
+#ifndef __ASSET_LOADER_TESTS_H__
+#define __ASSET_LOADER_TESTS_H__
+
+#include <prev/core/AssetLoader.h>
+
+#include <gtest/gtest.h>
+
+#include <thread>
+
+namespace prev::core {
+TEST(AssetLoaderTests, Load_ResolvesOnLoaderThread)
+{
+    AssetLoader loader{ 2 };
+    const auto callerThreadId{ std::this_thread::get_id() };
+
+    auto handle{ loader.Load<int>("value", AssetPriority::NORMAL, [&](AssetLoadContext& context) {
+        EXPECT_NE(callerThreadId, std::this_thread::get_id());
+        return context.Measure(AssetLoadStage::Decode, []() { return std::make_shared<int>(42); });
+    }) };
+
+    ASSERT_TRUE(handle.GetFuture().get() != nullptr);
+    EXPECT_TRUE(handle.IsReady());
+    EXPECT_EQ(42, *handle.Get());
+    EXPECT_EQ(1u, loader.GetStatistics().loadedCount);
+    EXPECT_EQ(0u, loader.GetPendingCount());
+}
+
+TEST(AssetLoaderTests, Load_SharesConcurrentRequests)
+{
+    AssetLoader loader{ 4 };
+    std::atomic<uint32_t> loadCount{ 0 };
+    std::promise<void> release;
+    auto releaseFuture{ release.get_future().share() };
+
+    const auto load{ [&](AssetLoadContext&) {
+        ++loadCount;
+        releaseFuture.wait();
+        return std::make_shared<int>(7);
+    } };
+
+    auto handleA{ loader.Load<int>("shared", AssetPriority::NORMAL, load) };
+    auto handleB{ loader.Load<int>("shared", AssetPriority::HIGH, load) };
+    auto handleOther{ loader.Load<int>("other", AssetPriority::NORMAL, load) };
+    release.set_value();
+
+    EXPECT_EQ(7, *handleA.GetFuture().get());
+    EXPECT_EQ(handleA.Get(), handleB.GetFuture().get());
+    EXPECT_NE(handleA.Get(), handleOther.GetFuture().get());
+    EXPECT_EQ(2u, loadCount.load());
+
+    // a finished load is shared too while a handle keeps it alive
+    auto handleC{ loader.Load<int>("shared", AssetPriority::NORMAL, load) };
+    EXPECT_EQ(handleA.Get(), handleC.Get());
+    EXPECT_EQ(2u, loadCount.load());
+}
+
+TEST(AssetLoaderTests, Load_StagesOnUpdate)
+{
+    AssetLoader loader{ 1 };
+    const auto callerThreadId{ std::this_thread::get_id() };
+
+    auto handle{ loader.Load<std::string, int>(
+        "staged", AssetPriority::NORMAL, [](AssetLoadContext&) { return std::make_shared<int>(3); },
+        [&](int& loaded, AssetLoadContext&) {
+            EXPECT_EQ(callerThreadId, std::this_thread::get_id());
+            return std::make_shared<std::string>(std::to_string(loaded));
+        }) };
+
+    while (handle.GetState() == AssetState::Loading) {
+        std::this_thread::yield();
+    }
+    EXPECT_EQ(AssetState::Staging, handle.GetState());
+    EXPECT_TRUE(handle.Get() == nullptr);
+
+    loader.Update();
+    ASSERT_TRUE(handle.IsReady());
+    EXPECT_EQ("3", *handle.Get());
+}
+
+TEST(AssetLoaderTests, Load_HigherPriorityStartsFirst)
+{
+    // without threads Update runs one load per call
+    AssetLoader loader{ 0 };
+    std::vector<std::string> order;
+    const auto load{ [&order](const std::string& name) {
+        return [&order, name](AssetLoadContext&) {
+            order.push_back(name);
+            return std::make_shared<int>(0);
+        };
+    } };
+
+    auto low{ loader.Load<int>("low", AssetPriority::LOW, load("low")) };
+    auto normal{ loader.Load<int>("normal", AssetPriority::NORMAL, load("normal")) };
+    auto high{ loader.Load<int>("high", AssetPriority::HIGH, load("high")) };
+    auto visible{ loader.Load<int>("visible", AssetPriority::LOW, load("visible")) };
+    auto shown{ loader.Load<int>("shown", AssetPriority::LOW, load("shown")) };
+    loader.SetPriority("visible", AssetPriority::HIGH);
+    shown.RaisePriority(AssetPriority::NORMAL);
+
+    EXPECT_EQ(5u, loader.GetPendingCount());
+    for (uint32_t i = 0; i < 5; ++i) {
+        loader.Update();
+    }
+
+    const std::vector<std::string> expectedOrder{ "high", "visible", "normal", "shown", "low" };
+    EXPECT_TRUE(expectedOrder == order);
+    EXPECT_TRUE(low.IsReady());
+}
+
+TEST(AssetLoaderTests, Wait_RunsPendingLoadAndStage)
+{
+    // nothing would run the load without the Update calls
+    AssetLoader loader{ 0 };
+    auto first{ loader.Load<int>("first", AssetPriority::NORMAL, [](AssetLoadContext&) { return std::make_shared<int>(1); }) };
+    auto staged{ loader.Load<std::string, int>(
+        "staged", AssetPriority::LOW, [](AssetLoadContext&) { return std::make_shared<int>(2); },
+        [](int& loaded, AssetLoadContext&) { return std::make_shared<std::string>(std::to_string(loaded)); }) };
+
+    EXPECT_EQ("2", *loader.Wait(staged));
+    EXPECT_TRUE(staged.IsReady());
+    EXPECT_FALSE(first.IsDone());
+    EXPECT_EQ(1u, loader.GetPendingCount());
+}
+
+TEST(AssetLoaderTests, Wait_BlocksForRunningLoad)
+{
+    AssetLoader loader{ 1 };
+    std::promise<void> started;
+    std::promise<void> release;
+    auto releaseFuture{ release.get_future().share() };
+    auto handle{ loader.Load<std::string, int>(
+        "running", AssetPriority::NORMAL, [&](AssetLoadContext&) {
+            started.set_value();
+            releaseFuture.wait();
+            return std::make_shared<int>(3);
+        },
+        [](int& loaded, AssetLoadContext&) { return std::make_shared<std::string>(std::to_string(loaded)); }) };
+
+    started.get_future().wait();
+    std::thread releaser{ [&]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        release.set_value();
+    } };
+
+    // the staging step runs here once the loader thread is done
+    EXPECT_EQ("3", *loader.Wait(handle));
+    releaser.join();
+    EXPECT_EQ(0u, loader.GetPendingCount());
+}
+
+TEST(AssetLoaderTests, Load_ReportsFailures)
+{
+    AssetLoader loader{ 1 };
+    auto missing{ loader.Load<int>("missing", AssetPriority::NORMAL, [](AssetLoadContext&) { return std::shared_ptr<int>{}; }) };
+    auto throwing{ loader.Load<int>("throwing", AssetPriority::NORMAL, [](AssetLoadContext&) -> std::shared_ptr<int> { throw std::runtime_error("corrupt"); }) };
+
+    EXPECT_TRUE(missing.GetFuture().get() == nullptr);
+    EXPECT_TRUE(throwing.GetFuture().get() == nullptr);
+    EXPECT_EQ(AssetState::Failed, missing.GetState());
+    EXPECT_TRUE(throwing.IsDone());
+    EXPECT_EQ(2u, loader.GetStatistics().failedCount);
+
+    // failed loads are retried
+    auto retried{ loader.Load<int>("missing", AssetPriority::NORMAL, [](AssetLoadContext&) { return std::make_shared<int>(1); }) };
+    EXPECT_EQ(1, *retried.GetFuture().get());
+}
+
+TEST(AssetLoaderTests, FromValue_IsReady)
+{
+    const auto handle{ AssetHandle<int>::FromValue(std::make_shared<int>(5)) };
+    EXPECT_TRUE(handle.IsReady());
+    EXPECT_EQ(5, *handle.Get());
+    EXPECT_FALSE(AssetHandle<int>{}.IsReady());
+}
+} // namespace prev::core
+
+#endif // !__ASSET_LOADER_TESTS_H__
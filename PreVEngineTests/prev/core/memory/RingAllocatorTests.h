@@ -0,0 +1,67 @@
+#ifndef __RING_ALLOCATOR_TESTS_H__
+#define __RING_ALLOCATOR_TESTS_H__
+
+#include <prev/core/memory/RingAllocator.h>
+
+#include <gtest/gtest.h>
+
+namespace prev::core::memory {
+TEST(RingAllocatorTests, Allocate_FollowsNewestRange)
+{
+    RingAllocator allocator{ 1024 };
+
+    EXPECT_EQ(0u, allocator.Allocate(100).value_or(~0ull));
+    EXPECT_EQ(112u, allocator.Allocate(100, 16).value_or(~0ull));
+    EXPECT_EQ(212u, allocator.GetUsedSize());
+    EXPECT_EQ(2u, allocator.GetAllocationCount());
+
+    EXPECT_FALSE(allocator.Allocate(0).has_value());
+    EXPECT_FALSE(allocator.Allocate(2048).has_value());
+}
+
+TEST(RingAllocatorTests, Allocate_WrapsOnceOldestRangesAreFreed)
+{
+    RingAllocator allocator{ 1024 };
+
+    const auto first{ *allocator.Allocate(400) };
+    const auto second{ *allocator.Allocate(400) };
+
+    // neither at the end nor at the start - the oldest range is still there
+    EXPECT_FALSE(allocator.Allocate(400).has_value());
+
+    allocator.Free(first);
+    const auto third{ allocator.Allocate(400) };
+    ASSERT_TRUE(third.has_value());
+    EXPECT_EQ(0u, *third);
+
+    // wrapped: the free space ends at the oldest range
+    EXPECT_FALSE(allocator.Allocate(100).has_value());
+
+    allocator.Free(second);
+    allocator.Free(*third);
+    EXPECT_EQ(0u, allocator.GetUsedSize());
+    EXPECT_EQ(0u, allocator.GetAllocationCount());
+    EXPECT_EQ(0u, allocator.Allocate(1024).value_or(~0ull));
+}
+
+TEST(RingAllocatorTests, Free_OutOfOrderWaitsForOldest)
+{
+    RingAllocator allocator{ 1024 };
+
+    const auto first{ *allocator.Allocate(256) };
+    const auto second{ *allocator.Allocate(256) };
+    const auto third{ *allocator.Allocate(256) };
+
+    allocator.Free(second);
+    allocator.Free(third);
+    EXPECT_EQ(1u, allocator.GetAllocationCount());
+    EXPECT_EQ(768u, allocator.GetUsedSize());
+    EXPECT_FALSE(allocator.Allocate(512).has_value());
+
+    allocator.Free(first);
+    EXPECT_EQ(0u, allocator.GetUsedSize());
+    EXPECT_TRUE(allocator.Allocate(512).has_value());
+}
+} // namespace prev::core::memory
+
+#endif // !__RING_ALLOCATOR_TESTS_H__
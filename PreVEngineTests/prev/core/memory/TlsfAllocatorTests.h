@@ -0,0 +1,98 @@
+#ifndef __TLSF_ALLOCATOR_TESTS_H__
+#define __TLSF_ALLOCATOR_TESTS_H__
+
+#include <prev/core/memory/TlsfAllocator.h>
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+namespace prev::core::memory {
+TEST(TlsfAllocatorTests, Allocate_RoundsUpToGranularity)
+{
+    TlsfAllocator allocator{ 4096, 256 };
+
+    const auto first{ allocator.Allocate(100) };
+    const auto second{ allocator.Allocate(300) };
+    ASSERT_TRUE(first.has_value());
+    ASSERT_TRUE(second.has_value());
+
+    EXPECT_EQ(256u, first->size);
+    EXPECT_EQ(512u, second->size);
+    EXPECT_EQ(0u, first->offset % 256);
+    EXPECT_EQ(0u, second->offset % 256);
+    EXPECT_NE(first->offset, second->offset);
+    EXPECT_EQ(768u, allocator.GetUsedSize());
+    EXPECT_EQ(2u, allocator.GetAllocationCount());
+}
+
+TEST(TlsfAllocatorTests, Allocate_FailsWhenOutOfSpace)
+{
+    TlsfAllocator allocator{ 1024, 256 };
+
+    EXPECT_FALSE(allocator.Allocate(0).has_value());
+    EXPECT_FALSE(allocator.Allocate(2048).has_value());
+
+    std::vector<TlsfAllocation> allocations{};
+    for (int i = 0; i < 4; ++i) {
+        const auto allocation{ allocator.Allocate(256) };
+        ASSERT_TRUE(allocation.has_value());
+        allocations.push_back(*allocation);
+    }
+    EXPECT_FALSE(allocator.Allocate(1).has_value());
+    EXPECT_EQ(0u, allocator.GetLargestFreeSize());
+
+    allocator.Free(allocations[2]);
+    const auto reused{ allocator.Allocate(256) };
+    ASSERT_TRUE(reused.has_value());
+    EXPECT_EQ(allocations[2].offset, reused->offset);
+}
+
+TEST(TlsfAllocatorTests, Allocate_RespectsAlignment)
+{
+    TlsfAllocator allocator{ 64 * 1024, 256 };
+
+    ASSERT_TRUE(allocator.Allocate(256).has_value());
+    const auto aligned{ allocator.Allocate(256, 4096) };
+    ASSERT_TRUE(aligned.has_value());
+    EXPECT_EQ(0u, aligned->offset % 4096);
+
+    // the padding in front stays usable
+    const auto small{ allocator.Allocate(256) };
+    ASSERT_TRUE(small.has_value());
+    EXPECT_LT(small->offset, aligned->offset);
+}
+
+TEST(TlsfAllocatorTests, Free_MergesNeighbours)
+{
+    TlsfAllocator allocator{ 8192, 256 };
+
+    std::vector<TlsfAllocation> allocations{};
+    for (int i = 0; i < 16; ++i) {
+        allocations.push_back(*allocator.Allocate(512));
+    }
+    EXPECT_EQ(0u, allocator.GetLargestFreeSize());
+
+    // every other one - the free memory is split into ranges
+    for (size_t i = 0; i < allocations.size(); i += 2) {
+        allocator.Free(allocations[i]);
+    }
+    EXPECT_EQ(512u, allocator.GetLargestFreeSize());
+    EXPECT_GT(allocator.GetFragmentation(), 0.5f);
+    EXPECT_FALSE(allocator.Allocate(1024).has_value());
+
+    for (size_t i = 1; i < allocations.size(); i += 2) {
+        allocator.Free(allocations[i]);
+    }
+    EXPECT_TRUE(allocator.IsEmpty());
+    EXPECT_EQ(0u, allocator.GetUsedSize());
+    EXPECT_EQ(8192u, allocator.GetLargestFreeSize());
+    EXPECT_FLOAT_EQ(0.0f, allocator.GetFragmentation());
+
+    const auto whole{ allocator.Allocate(8192) };
+    ASSERT_TRUE(whole.has_value());
+    EXPECT_EQ(0u, whole->offset);
+}
+} // namespace prev::core::memory
+
+#endif // !__TLSF_ALLOCATOR_TESTS_H__
@@ -0,0 +1,173 @@
+#ifndef __EVENT_QUEUE_TESTS_H__
+#define __EVENT_QUEUE_TESTS_H__
+
+#include <prev/event/EventHandler.h>
+#include <prev/event/EventQueue.h>
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <thread>
+#include <vector>
+
+namespace prev::event {
+struct QueuedTestEvent {
+    int value{};
+};
+
+struct OtherQueuedTestEvent {
+    int value{};
+};
+
+struct QueuedTestEventRecorder {
+    void operator()(const QueuedTestEvent& event)
+    {
+        received.push_back(event.value);
+        if (onEvent) {
+            onEvent(event);
+        }
+    }
+
+    void operator()(const OtherQueuedTestEvent& event)
+    {
+        received.push_back(-event.value);
+    }
+
+    std::vector<int> received;
+
+    std::function<void(const QueuedTestEvent&)> onEvent;
+
+    EventHandler<QueuedTestEventRecorder, QueuedTestEvent> eventHandler{ *this };
+
+    EventHandler<QueuedTestEventRecorder, OtherQueuedTestEvent> otherEventHandler{ *this };
+};
+
+TEST(EventQueueTests, Post_DeliversOnDispatchAll)
+{
+    auto& eventQueue{ EventQueue::Instance() };
+    eventQueue.DispatchAll();
+
+    QueuedTestEventRecorder recorder{};
+    eventQueue.Post(QueuedTestEvent{ 1 });
+    EXPECT_TRUE(recorder.received.empty());
+
+    eventQueue.DispatchAll();
+    ASSERT_EQ(1u, recorder.received.size());
+    EXPECT_EQ(1, recorder.received[0]);
+
+    eventQueue.DispatchAll();
+    EXPECT_EQ(1u, recorder.received.size());
+}
+
+TEST(EventQueueTests, DispatchAll_KeepsPostOrderAcrossTypes)
+{
+    auto& eventQueue{ EventQueue::Instance() };
+    QueuedTestEventRecorder recorder{};
+    eventQueue.Post(QueuedTestEvent{ 1 });
+    eventQueue.Post(OtherQueuedTestEvent{ 2 });
+    eventQueue.Post(QueuedTestEvent{ 3 });
+    eventQueue.Post(OtherQueuedTestEvent{ 4 });
+    eventQueue.DispatchAll();
+
+    EXPECT_EQ((std::vector<int>{ 1, -2, 3, -4 }), recorder.received);
+}
+
+TEST(EventQueueTests, DispatchAll_DefersEventsPostedByHandlers)
+{
+    auto& eventQueue{ EventQueue::Instance() };
+    QueuedTestEventRecorder recorder{};
+    recorder.onEvent = [&](const QueuedTestEvent& event) {
+        if (event.value < 3) {
+            eventQueue.Post(QueuedTestEvent{ event.value + 1 });
+        }
+    };
+
+    eventQueue.Post(QueuedTestEvent{ 1 });
+    eventQueue.DispatchAll();
+    EXPECT_EQ((std::vector<int>{ 1 }), recorder.received);
+
+    eventQueue.DispatchAll();
+    eventQueue.DispatchAll();
+    EXPECT_EQ((std::vector<int>{ 1, 2, 3 }), recorder.received);
+}
+
+TEST(EventQueueTests, SetCoalescing_MergesWaitingEvents)
+{
+    auto& eventQueue{ EventQueue::Instance() };
+    eventQueue.SetCoalescing<QueuedTestEvent>([](QueuedTestEvent& queued, const QueuedTestEvent& incoming) {
+        // odd values stand for moves here
+        if (queued.value % 2 == 0 || incoming.value % 2 == 0) {
+            return false;
+        }
+        queued.value = incoming.value;
+        return true;
+    });
+
+    QueuedTestEventRecorder recorder{};
+    for (const int value : { 1, 3, 5, 6, 7, 9 }) {
+        eventQueue.Post(QueuedTestEvent{ value });
+    }
+    eventQueue.Post(OtherQueuedTestEvent{ 10 });
+    eventQueue.DispatchAll();
+    eventQueue.ClearCoalescing<QueuedTestEvent>();
+
+    EXPECT_EQ((std::vector<int>{ 5, 6, 9, -10 }), recorder.received);
+}
+
+TEST(EventQueueTests, Post_FromManyThreads_DeliversAllInOrderOfEachThread)
+{
+    constexpr int THREAD_COUNT{ 4 };
+    constexpr int EVENT_COUNT{ 1000 };
+
+    auto& eventQueue{ EventQueue::Instance() };
+    QueuedTestEventRecorder recorder{};
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < THREAD_COUNT; ++t) {
+        threads.emplace_back([&eventQueue, t]() {
+            for (int i = 0; i < EVENT_COUNT; ++i) {
+                eventQueue.Post(QueuedTestEvent{ t * EVENT_COUNT + i });
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    eventQueue.DispatchAll();
+
+    ASSERT_EQ(static_cast<size_t>(THREAD_COUNT * EVENT_COUNT), recorder.received.size());
+    std::vector<int> lastValues(THREAD_COUNT, -1);
+    for (const auto value : recorder.received) {
+        auto& lastValue{ lastValues[value / EVENT_COUNT] };
+        EXPECT_LT(lastValue, value);
+        lastValue = value;
+    }
+}
+
+TEST(EventQueueTests, GetStatistics_CountsEventsAndLatency)
+{
+    auto& eventQueue{ EventQueue::Instance() };
+    eventQueue.DispatchAll();
+    eventQueue.ResetStatistics();
+    eventQueue.SetCoalescingToLatest<OtherQueuedTestEvent>();
+
+    QueuedTestEventRecorder recorder{};
+    eventQueue.Post(OtherQueuedTestEvent{ 1 });
+    eventQueue.Post(OtherQueuedTestEvent{ 2 });
+    eventQueue.Post(OtherQueuedTestEvent{ 3 });
+    eventQueue.DispatchAll();
+    eventQueue.ClearCoalescing<OtherQueuedTestEvent>();
+
+    const auto statistics{ eventQueue.GetStatistics() };
+    ASSERT_EQ(1u, statistics.size());
+    EXPECT_EQ(0, std::strcmp(typeid(OtherQueuedTestEvent).name(), statistics[0].typeName));
+    EXPECT_EQ(3u, statistics[0].postedCount);
+    EXPECT_EQ(2u, statistics[0].coalescedCount);
+    EXPECT_EQ(1u, statistics[0].dispatchedCount);
+    EXPECT_GE(statistics[0].maxLatency, statistics[0].averageLatency);
+    EXPECT_GE(statistics[0].averageLatency, 0.0);
+    EXPECT_EQ((std::vector<int>{ -3 }), recorder.received);
+}
+} // namespace prev::event
+
+#endif // !__EVENT_QUEUE_TESTS_H__
@@ -0,0 +1,151 @@
+#ifndef __INPUT_SNAPSHOT_TESTS_H__
+#define __INPUT_SNAPSHOT_TESTS_H__
+
+#include <prev/event/EventChannel.h>
+#include <prev/input/InputSnapshotTracker.h>
+
+#include <gtest/gtest.h>
+
+namespace prev::input {
+namespace {
+    // starts from a snapshot without any edges or deltas left from before
+    const InputSnapshot& PublishTwice()
+    {
+        auto& tracker{ InputSnapshotTracker::Instance() };
+        tracker.Publish();
+        tracker.Publish();
+        return tracker.GetSnapshot();
+    }
+} // namespace
+
+TEST(InputSnapshotTests, KeyEdges_LastOneFrame)
+{
+    PublishTwice();
+    auto& tracker{ InputSnapshotTracker::Instance() };
+
+    prev::event::EventChannel::Post(keyboard::KeyEvent{ keyboard::KeyActionType::PRESS, keyboard::KeyCode::KEY_W });
+    tracker.Publish();
+    EXPECT_TRUE(tracker.GetSnapshot().IsKeyPressed(keyboard::KeyCode::KEY_W));
+    EXPECT_TRUE(tracker.GetSnapshot().WasKeyPressed(keyboard::KeyCode::KEY_W));
+    EXPECT_FALSE(tracker.GetSnapshot().WasKeyReleased(keyboard::KeyCode::KEY_W));
+
+    // a repeated press of a held key
+    prev::event::EventChannel::Post(keyboard::KeyEvent{ keyboard::KeyActionType::PRESS, keyboard::KeyCode::KEY_W });
+    tracker.Publish();
+    EXPECT_TRUE(tracker.GetSnapshot().IsKeyPressed(keyboard::KeyCode::KEY_W));
+    EXPECT_FALSE(tracker.GetSnapshot().WasKeyPressed(keyboard::KeyCode::KEY_W));
+
+    prev::event::EventChannel::Post(keyboard::KeyEvent{ keyboard::KeyActionType::RELEASE, keyboard::KeyCode::KEY_W });
+    tracker.Publish();
+    EXPECT_FALSE(tracker.GetSnapshot().IsKeyPressed(keyboard::KeyCode::KEY_W));
+    EXPECT_TRUE(tracker.GetSnapshot().WasKeyReleased(keyboard::KeyCode::KEY_W));
+
+    tracker.Publish();
+    EXPECT_FALSE(tracker.GetSnapshot().WasKeyReleased(keyboard::KeyCode::KEY_W));
+}
+
+TEST(InputSnapshotTests, KeyTappedWithinFrame_IsNotLost)
+{
+    PublishTwice();
+    auto& tracker{ InputSnapshotTracker::Instance() };
+
+    prev::event::EventChannel::Post(keyboard::KeyEvent{ keyboard::KeyActionType::PRESS, keyboard::KeyCode::KEY_Space });
+    prev::event::EventChannel::Post(keyboard::KeyEvent{ keyboard::KeyActionType::RELEASE, keyboard::KeyCode::KEY_Space });
+    tracker.Publish();
+
+    const auto& snapshot{ tracker.GetSnapshot() };
+    EXPECT_FALSE(snapshot.IsKeyPressed(keyboard::KeyCode::KEY_Space));
+    EXPECT_TRUE(snapshot.WasKeyPressed(keyboard::KeyCode::KEY_Space));
+    EXPECT_TRUE(snapshot.WasKeyReleased(keyboard::KeyCode::KEY_Space));
+}
+
+TEST(InputSnapshotTests, MouseMoves_AccumulateIntoDelta)
+{
+    PublishTwice();
+    auto& tracker{ InputSnapshotTracker::Instance() };
+
+    prev::event::EventChannel::Post(mouse::MouseEvent{ mouse::MouseActionType::MOVE, mouse::MouseButtonType::NONE, glm::vec2(10.0f, 10.0f), glm::vec2(100.0f, 100.0f) });
+    prev::event::EventChannel::Post(mouse::MouseEvent{ mouse::MouseActionType::PRESS, mouse::MouseButtonType::LEFT, glm::vec2(10.0f, 10.0f), glm::vec2(100.0f, 100.0f) });
+    tracker.Publish();
+    prev::event::EventChannel::Post(mouse::MouseEvent{ mouse::MouseActionType::MOVE, mouse::MouseButtonType::LEFT, glm::vec2(15.0f, 12.0f), glm::vec2(100.0f, 100.0f) });
+    prev::event::EventChannel::Post(mouse::MouseEvent{ mouse::MouseActionType::MOVE, mouse::MouseButtonType::LEFT, glm::vec2(20.0f, 8.0f), glm::vec2(100.0f, 100.0f) });
+    prev::event::EventChannel::Post(mouse::MouseScrollEvent{ 2, glm::vec2(20.0f, 8.0f) });
+    prev::event::EventChannel::Post(mouse::MouseScrollEvent{ -1, glm::vec2(20.0f, 8.0f) });
+    tracker.Publish();
+
+    const auto& snapshot{ tracker.GetSnapshot() };
+    EXPECT_TRUE(snapshot.IsButtonPressed(mouse::MouseButtonType::LEFT));
+    EXPECT_FALSE(snapshot.WasButtonPressed(mouse::MouseButtonType::LEFT));
+    EXPECT_EQ(glm::vec2(20.0f, 8.0f), snapshot.GetMousePosition());
+    EXPECT_EQ(glm::vec2(10.0f, -2.0f), snapshot.GetMouseDelta());
+    EXPECT_EQ(1, snapshot.GetScrollDelta());
+
+    prev::event::EventChannel::Post(mouse::MouseEvent{ mouse::MouseActionType::RELEASE, mouse::MouseButtonType::LEFT, glm::vec2(20.0f, 8.0f), glm::vec2(100.0f, 100.0f) });
+    tracker.Publish();
+    EXPECT_FALSE(tracker.GetSnapshot().IsButtonPressed(mouse::MouseButtonType::LEFT));
+    EXPECT_TRUE(tracker.GetSnapshot().WasButtonReleased(mouse::MouseButtonType::LEFT));
+    EXPECT_EQ(glm::vec2(0.0f, 0.0f), tracker.GetSnapshot().GetMouseDelta());
+    EXPECT_EQ(0, tracker.GetSnapshot().GetScrollDelta());
+}
+
+TEST(InputSnapshotTests, LockedMouseMoves_AreRelative)
+{
+    PublishTwice();
+    auto& tracker{ InputSnapshotTracker::Instance() };
+
+    prev::event::EventChannel::Post(mouse::MouseLockRequest{ true });
+    prev::event::EventChannel::Post(mouse::MouseEvent{ mouse::MouseActionType::MOVE, mouse::MouseButtonType::NONE, glm::vec2(3.0f, -1.0f), glm::vec2(100.0f, 100.0f) });
+    prev::event::EventChannel::Post(mouse::MouseEvent{ mouse::MouseActionType::MOVE, mouse::MouseButtonType::NONE, glm::vec2(2.0f, 4.0f), glm::vec2(100.0f, 100.0f) });
+    tracker.Publish();
+    prev::event::EventChannel::Post(mouse::MouseLockRequest{ false });
+
+    const auto& snapshot{ tracker.GetSnapshot() };
+    EXPECT_TRUE(snapshot.IsMouseLocked());
+    EXPECT_EQ(glm::vec2(5.0f, 3.0f), snapshot.GetMouseDelta());
+}
+
+TEST(InputSnapshotTests, Touches_FollowPointers)
+{
+    PublishTwice();
+    auto& tracker{ InputSnapshotTracker::Instance() };
+
+    prev::event::EventChannel::Post(touch::TouchEvent{ touch::TouchActionType::DOWN, 1, glm::vec2(10.0f, 10.0f), glm::vec2(100.0f, 100.0f) });
+    prev::event::EventChannel::Post(touch::TouchEvent{ touch::TouchActionType::DOWN, 2, glm::vec2(50.0f, 50.0f), glm::vec2(100.0f, 100.0f) });
+    prev::event::EventChannel::Post(touch::TouchEvent{ touch::TouchActionType::MOVE, 1, glm::vec2(14.0f, 7.0f), glm::vec2(100.0f, 100.0f) });
+    tracker.Publish();
+
+    const auto& snapshot{ tracker.GetSnapshot() };
+    ASSERT_EQ(2u, snapshot.GetTouches().size());
+    const auto touch{ snapshot.FindTouch(1) };
+    ASSERT_NE(nullptr, touch);
+    EXPECT_EQ(glm::vec2(14.0f, 7.0f), touch->position);
+    EXPECT_EQ(glm::vec2(4.0f, -3.0f), touch->delta);
+
+    prev::event::EventChannel::Post(touch::TouchEvent{ touch::TouchActionType::UP, 1, glm::vec2(14.0f, 7.0f), glm::vec2(100.0f, 100.0f) });
+    prev::event::EventChannel::Post(touch::TouchEvent{ touch::TouchActionType::UP, 2, glm::vec2(50.0f, 50.0f), glm::vec2(100.0f, 100.0f) });
+    tracker.Publish();
+    EXPECT_TRUE(tracker.GetSnapshot().GetTouches().empty());
+}
+
+TEST(InputSnapshotTests, Publish_KeepsPreviousSnapshotIntact)
+{
+    const auto& previous{ PublishTwice() };
+    auto& tracker{ InputSnapshotTracker::Instance() };
+    const auto previousFrameIndex{ previous.GetFrameIndex() };
+
+    prev::event::EventChannel::Post(keyboard::KeyEvent{ keyboard::KeyActionType::PRESS, keyboard::KeyCode::KEY_Q });
+    tracker.Publish();
+    prev::event::EventChannel::Post(keyboard::KeyEvent{ keyboard::KeyActionType::RELEASE, keyboard::KeyCode::KEY_Q });
+
+    const auto& current{ tracker.GetSnapshot() };
+    EXPECT_NE(&previous, &current);
+    EXPECT_EQ(previousFrameIndex + 1, current.GetFrameIndex());
+    EXPECT_EQ(previousFrameIndex, previous.GetFrameIndex());
+    EXPECT_FALSE(previous.IsKeyPressed(keyboard::KeyCode::KEY_Q));
+    EXPECT_TRUE(current.IsKeyPressed(keyboard::KeyCode::KEY_Q));
+
+    tracker.Publish();
+}
+} // namespace prev::input
+
+#endif // !__INPUT_SNAPSHOT_TESTS_H__
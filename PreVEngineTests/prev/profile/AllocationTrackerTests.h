@@ -0,0 +1,93 @@
+#ifndef __ALLOCATION_TRACKER_TESTS_H__
+#define __ALLOCATION_TRACKER_TESTS_H__
+
+#include <prev/profile/AllocationTracker.h>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+namespace prev::profile {
+namespace {
+    const AllocationScopeStatistics* FindScope(const AllocationFrame& frame, const char* name)
+    {
+        const auto iter{ std::find_if(frame.scopes.cbegin(), frame.scopes.cend(), [&](const auto& scope) { return std::strcmp(scope.name, name) == 0; }) };
+        return iter != frame.scopes.cend() ? &*iter : nullptr;
+    }
+} // namespace
+
+TEST(AllocationTrackerTests, EndFrame_AttributesAllocationsToInnermostScope)
+{
+    auto& tracker{ AllocationTracker::Instance() };
+    tracker.EndFrame();
+
+    {
+        const AllocationScope outer{ "AllocationOuter" };
+        AllocationTracker::RecordAllocation(16);
+        {
+            const AllocationScope inner{ "AllocationInner" };
+            AllocationTracker::RecordAllocation(32);
+            AllocationTracker::RecordAllocation(64);
+        }
+    }
+
+    tracker.EndFrame();
+    const auto frame{ tracker.GetLastFrame() };
+
+    const auto outer{ FindScope(frame, "AllocationOuter") };
+    const auto inner{ FindScope(frame, "AllocationInner") };
+    ASSERT_NE(nullptr, outer);
+    ASSERT_NE(nullptr, inner);
+    EXPECT_EQ(1u, outer->count);
+    EXPECT_EQ(16u, outer->bytes);
+    EXPECT_EQ(2u, inner->count);
+    EXPECT_EQ(96u, inner->bytes);
+    EXPECT_GE(frame.count, 3u);
+    EXPECT_GE(frame.bytes, 112u);
+
+    // nothing is reported twice
+    tracker.EndFrame();
+    EXPECT_EQ(nullptr, FindScope(tracker.GetLastFrame(), "AllocationInner"));
+}
+
+TEST(AllocationTrackerTests, SetFrameBudget_MarksFramesOverBudget)
+{
+    auto& tracker{ AllocationTracker::Instance() };
+    tracker.EndFrame();
+
+    tracker.SetFrameBudget(0);
+    AllocationTracker::RecordAllocation(8);
+    tracker.EndFrame();
+    EXPECT_TRUE(tracker.GetLastFrame().overBudget);
+
+    tracker.ClearFrameBudget();
+    AllocationTracker::RecordAllocation(8);
+    tracker.EndFrame();
+    EXPECT_FALSE(tracker.GetLastFrame().overBudget);
+}
+
+TEST(AllocationTrackerTests, AllocationCounter_CountsHeapAllocationsOfThread)
+{
+    if (!AllocationTracker::IsAvailable()) {
+        GTEST_SKIP() << "Built without ENABLE_ALLOCATION_TRACKING";
+    }
+
+    const AllocationCounter allocatingCounter{};
+    const auto value{ std::make_unique<int>(42) };
+    EXPECT_EQ(1u, allocatingCounter.GetCount());
+
+    // steady state - the capacity is there already
+    std::vector<int> values;
+    values.reserve(64);
+    const AllocationCounter steadyCounter{};
+    for (int i = 0; i < 64; ++i) {
+        values.push_back(i * *value);
+    }
+    EXPECT_EQ(0u, steadyCounter.GetCount());
+}
+} // namespace prev::profile
+
+#endif // !__ALLOCATION_TRACKER_TESTS_H__
@@ -0,0 +1,92 @@
+#ifndef __FRAME_STATISTICS_TESTS_H__
+#define __FRAME_STATISTICS_TESTS_H__
+
+#include <prev/profile/FrameStatistics.h>
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+
+namespace prev::profile {
+TEST(FrameStatisticsTests, ComputePercentiles_NearestRank)
+{
+    std::vector<float> values;
+    for (int i = 100; i > 0; --i) {
+        values.push_back(static_cast<float>(i));
+    }
+
+    const auto percentiles{ FrameStatistics::ComputePercentiles(values) };
+
+    EXPECT_FLOAT_EQ(50.0f, percentiles.p50);
+    EXPECT_FLOAT_EQ(90.0f, percentiles.p90);
+    EXPECT_FLOAT_EQ(99.0f, percentiles.p99);
+    EXPECT_FLOAT_EQ(100.0f, percentiles.max);
+    EXPECT_EQ(100u, percentiles.count);
+}
+
+TEST(FrameStatisticsTests, ComputeReport_CountsFramesOverBudgetAndSkipsUnmeasured)
+{
+    FrameStatistics statistics{ 16, 0.010f };
+    for (int i = 0; i < 10; ++i) {
+        statistics.Record(FrameSample{ 0.004f, -1.0f, i % 5 == 0 ? 0.030f : 0.008f });
+    }
+
+    const auto report{ statistics.ComputeReport() };
+
+    EXPECT_EQ(10u, report.frameCount);
+    EXPECT_EQ(2u, report.overBudgetCount);
+    EXPECT_EQ(10u, report.cpuTime.count);
+    EXPECT_EQ(0u, report.gpuTime.count);
+    EXPECT_FLOAT_EQ(0.030f, report.presentInterval.max);
+    EXPECT_FLOAT_EQ(0.008f, report.presentInterval.p50);
+}
+
+TEST(FrameStatisticsTests, GetSamples_KeepsLastFramesAfterWrap)
+{
+    FrameStatistics statistics{ 4 };
+    for (int i = 0; i < 10; ++i) {
+        statistics.Record(FrameSample{ static_cast<float>(i) });
+    }
+
+    const auto samples{ statistics.GetSamples() };
+    ASSERT_EQ(4u, samples.size());
+    EXPECT_FLOAT_EQ(6.0f, samples.front().cpuTime);
+    EXPECT_FLOAT_EQ(9.0f, samples.back().cpuTime);
+
+    const auto lastSamples{ statistics.GetSamples(2) };
+    ASSERT_EQ(2u, lastSamples.size());
+    EXPECT_FLOAT_EQ(8.0f, lastSamples.front().cpuTime);
+    EXPECT_EQ(10u, statistics.GetRecordedCount());
+}
+
+TEST(FrameStatisticsTests, AppendCsv_WritesHeaderOnce)
+{
+    const std::string path{ "frame_statistics_test.csv" };
+    std::remove(path.c_str());
+
+    FrameStatistics statistics{};
+    statistics.Record(FrameSample{ 0.005f, 0.004f, 0.016f });
+    EXPECT_TRUE(FrameStatistics::AppendCsv(path, statistics.ComputeReport()));
+    EXPECT_TRUE(FrameStatistics::AppendCsv(path, statistics.ComputeReport()));
+
+    std::ifstream file{ path };
+    std::string line;
+    uint32_t lineCount{};
+    uint32_t headerCount{};
+    while (std::getline(file, line)) {
+        ++lineCount;
+        if (line.rfind("frames,", 0) == 0) {
+            ++headerCount;
+        }
+    }
+    file.close();
+    std::remove(path.c_str());
+
+    EXPECT_EQ(3u, lineCount);
+    EXPECT_EQ(1u, headerCount);
+}
+} // namespace prev::profile
+
+#endif // !__FRAME_STATISTICS_TESTS_H__
@@ -0,0 +1,105 @@
+#ifndef __PROFILER_TESTS_H__
+#define __PROFILER_TESTS_H__
+
+#include <prev/profile/Profiler.h>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstring>
+#include <thread>
+
+namespace prev::profile {
+namespace {
+    const ProfileZone* FindZone(const std::vector<ProfileZone>& zones, const char* name)
+    {
+        const auto iter{ std::find_if(zones.cbegin(), zones.cend(), [&](const auto& zone) { return std::strcmp(zone.name, name) == 0; }) };
+        return iter != zones.cend() ? &*iter : nullptr;
+    }
+} // namespace
+
+TEST(ProfilerTests, EndFrame_CollectsNestedZonesOfAllThreads)
+{
+    auto& profiler{ Profiler::Instance() };
+    profiler.EndFrame();
+
+    {
+        const ProfileScope outer{ "Outer" };
+        for (int i = 0; i < 3; ++i) {
+            const ProfileScope inner{ "Inner" };
+        }
+    }
+    std::thread worker{ []() {
+        const ProfileScope workerScope{ "Worker" };
+    } };
+    worker.join();
+
+    profiler.EndFrame();
+    const auto frame{ profiler.GetLastFrame() };
+
+    const auto outer{ FindZone(frame.cpuZones, "Outer") };
+    const auto inner{ FindZone(frame.cpuZones, "Inner") };
+    const auto workerZone{ FindZone(frame.cpuZones, "Worker") };
+    ASSERT_NE(nullptr, outer);
+    ASSERT_NE(nullptr, inner);
+    ASSERT_NE(nullptr, workerZone);
+    EXPECT_EQ(0u, outer->depth);
+    EXPECT_EQ(1u, inner->depth);
+    EXPECT_LE(outer->startTime, inner->startTime);
+    EXPECT_GE(outer->endTime, inner->endTime);
+    EXPECT_NE(outer->threadId, workerZone->threadId);
+
+    const auto innerStatistics{ std::find_if(frame.cpuStatistics.cbegin(), frame.cpuStatistics.cend(), [](const auto& statistics) { return std::strcmp(statistics.name, "Inner") == 0; }) };
+    ASSERT_NE(frame.cpuStatistics.cend(), innerStatistics);
+    EXPECT_EQ(3u, innerStatistics->count);
+    EXPECT_GE(innerStatistics->totalTime, innerStatistics->maxTime);
+
+    // nothing is reported twice
+    profiler.EndFrame();
+    EXPECT_EQ(nullptr, FindZone(profiler.GetLastFrame().cpuZones, "Outer"));
+}
+
+TEST(ProfilerTests, SetEnabled_SkipsZonesWhileDisabled)
+{
+    auto& profiler{ Profiler::Instance() };
+    profiler.EndFrame();
+
+    profiler.SetEnabled(false);
+    {
+        const ProfileScope scope{ "Disabled" };
+    }
+    profiler.SetEnabled(true);
+
+    profiler.EndFrame();
+    EXPECT_EQ(nullptr, FindZone(profiler.GetLastFrame().cpuZones, "Disabled"));
+}
+
+TEST(ProfilerTests, Capture_KeepsLastFramesForChromeTrace)
+{
+    auto& profiler{ Profiler::Instance() };
+    profiler.EndFrame();
+
+    profiler.BeginCapture(2);
+    {
+        const ProfileScope scope{ "Dropped" };
+    }
+    profiler.EndFrame();
+    profiler.AddCpuZone("Second", Profiler::Now(), Profiler::Now());
+    profiler.AddGpuZones({ ProfileZone{ "GpuPass", Profiler::Now(), Profiler::Now() + 1000 } });
+    profiler.EndFrame();
+    profiler.AddCpuZone("Third \"quoted\"", Profiler::Now(), Profiler::Now());
+    profiler.EndFrame();
+    profiler.EndCapture();
+    EXPECT_FALSE(profiler.IsCapturing());
+
+    const auto trace{ profiler.ToChromeTrace() };
+    EXPECT_NE(std::string::npos, trace.find("\"traceEvents\""));
+    EXPECT_EQ(std::string::npos, trace.find("Dropped"));
+    EXPECT_NE(std::string::npos, trace.find("\"Second\""));
+    EXPECT_NE(std::string::npos, trace.find("\"Third \\\"quoted\\\"\""));
+    EXPECT_NE(std::string::npos, trace.find("\"GpuPass\""));
+    EXPECT_NE(std::string::npos, trace.find("\"GPU\""));
+}
+} // namespace prev::profile
+
+#endif // !__PROFILER_TESTS_H__
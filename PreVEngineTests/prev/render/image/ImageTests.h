@@ -0,0 +1,75 @@
+#ifndef __IMAGE_TESTS_H__
+#define __IMAGE_TESTS_H__
+
+#include <prev/render/image/Image.h>
+
+#include <gtest/gtest.h>
+
+namespace prev::render::image {
+TEST(ImageTests, Constructor_AdoptsDataWithoutCopy)
+{
+    uint32_t deleteCount{ 0 };
+    uint8_t* data{ new uint8_t[2 * 2 * 4]{ 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16 } };
+    {
+        Image<uint8_t, 4> image{ 2, 2, data, [&deleteCount](uint8_t* pixels) { delete[] pixels; ++deleteCount; } };
+        EXPECT_EQ(data, image.GetRawData());
+        EXPECT_EQ(9, image.GetPixel(0, 1)[0]);
+
+        // copies own their pixels, the adopted buffer is released only once
+        const Image<uint8_t, 4> copy{ image };
+        EXPECT_NE(data, copy.GetRawData());
+        EXPECT_EQ(16, copy.GetPixel(1, 1)[3]);
+
+        Image<uint8_t, 4> moved{ std::move(image) };
+        EXPECT_EQ(data, moved.GetRawData());
+        EXPECT_EQ(0u, image.GetSize());
+        EXPECT_EQ(0u, deleteCount);
+    }
+    EXPECT_EQ(1u, deleteCount);
+}
+
+TEST(ImageTests, Constructor_CopiesData)
+{
+    const uint8_t data[]{ 1, 2, 3, 4, 5, 6 };
+    const Image<uint8_t, 3> image{ 2, 1, data };
+    EXPECT_NE(data, image.GetRawData());
+    EXPECT_EQ(4, image.GetPixel(1, 0)[0]);
+    EXPECT_EQ(6u, image.GetSize() * image.GetPixelSize());
+}
+
+TEST(ImageTests, Constructor_ZeroesPixels)
+{
+    const Image<float, 2> image{ 3, 3 };
+    for (uint32_t i = 0; i < image.GetSize() * 2; ++i) {
+        EXPECT_EQ(0.0f, image.GetRawData()[i]);
+    }
+}
+
+TEST(ImageTests, Convert_ChangesComponentTypeAndChannels)
+{
+    Image<uint8_t, 3> image{ 2, 2 };
+    image.Clear({ 10, 20, 30 });
+
+    const auto floatImage{ image.Convert<float>() };
+    EXPECT_FLOAT_EQ(20.0f, floatImage.GetPixel(1, 1)[1]);
+
+    const auto rgbaImage{ image.Convert<uint8_t, 4>() };
+    EXPECT_EQ(30, rgbaImage.GetPixel(0, 1)[2]);
+    EXPECT_EQ(0, rgbaImage.GetPixel(0, 1)[3]);
+
+    const auto grayImage{ image.Convert<uint16_t, 1>() };
+    EXPECT_EQ(10, grayImage.GetPixel(1, 0)[0]);
+}
+
+TEST(ImageTests, Resize_KeepsLeadingPixels)
+{
+    const uint8_t data[]{ 1, 2, 3, 4 };
+    Image<uint8_t, 1> image{ 2, 2, data };
+    image.Resize(3, 2);
+    EXPECT_EQ(3u, image.GetWidth());
+    EXPECT_EQ(4, image.GetRawData()[3]);
+    EXPECT_EQ(0, image.GetRawData()[5]);
+}
+} // namespace prev::render::image
+
+#endif // !__IMAGE_TESTS_H__
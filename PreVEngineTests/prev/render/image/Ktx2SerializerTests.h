@@ -0,0 +1,99 @@
+#ifndef __KTX2_SERIALIZER_TESTS_H__
+#define __KTX2_SERIALIZER_TESTS_H__
+
+#include <prev/render/image/Ktx2Serializer.h>
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+
+namespace prev::render::image {
+namespace {
+    CompressedImage CreateTestCompressedImage(const CompressedImageFormat format, const bool srgb, const uint32_t width, const uint32_t height)
+    {
+        std::vector<CompressedImageLevel> levels;
+        for (uint32_t level = 0; (width >> level) > 0 || (height >> level) > 0; ++level) {
+            CompressedImageLevel compressedLevel{ std::max(width >> level, 1u), std::max(height >> level, 1u) };
+            compressedLevel.data.resize(CompressedImage::GetLevelByteSize(format, compressedLevel.width, compressedLevel.height));
+            for (size_t i = 0; i < compressedLevel.data.size(); ++i) {
+                compressedLevel.data[i] = static_cast<uint8_t>(i * 31 + level);
+            }
+            levels.push_back(std::move(compressedLevel));
+        }
+        return CompressedImage{ format, srgb, std::move(levels) };
+    }
+
+    uint32_t ReadUint32(const std::vector<uint8_t>& data, const size_t offset)
+    {
+        uint32_t value;
+        std::memcpy(&value, data.data() + offset, sizeof(value));
+        return value;
+    }
+} // namespace
+
+TEST(Ktx2SerializerTests, Serialize_RoundTrips)
+{
+    for (const auto format : { CompressedImageFormat::BC1_RGBA, CompressedImageFormat::BC5_RG, CompressedImageFormat::BC7_RGBA, CompressedImageFormat::ETC2_RGBA8, CompressedImageFormat::ASTC_4x4_RGBA }) {
+        const auto image{ CreateTestCompressedImage(format, true, 20, 9) };
+        const auto data{ Ktx2Serializer{}.Serialize(image) };
+
+        const auto loaded{ Ktx2Serializer{}.Deserialize(data.data(), data.size()) };
+        ASSERT_TRUE(loaded != nullptr);
+        EXPECT_EQ(format, loaded->GetFormat());
+        EXPECT_EQ(format != CompressedImageFormat::BC5_RG, loaded->IsSrgb());
+        ASSERT_EQ(image.GetLevelCount(), loaded->GetLevelCount());
+        for (uint32_t level = 0; level < image.GetLevelCount(); ++level) {
+            EXPECT_EQ(image.GetLevel(level).width, loaded->GetLevel(level).width);
+            EXPECT_EQ(image.GetLevel(level).height, loaded->GetLevel(level).height);
+            EXPECT_TRUE(image.GetLevel(level).data == loaded->GetLevel(level).data);
+        }
+    }
+}
+
+TEST(Ktx2SerializerTests, Serialize_WritesKtx2Layout)
+{
+    const auto image{ CreateTestCompressedImage(CompressedImageFormat::BC7_RGBA, true, 16, 16) };
+    const auto data{ Ktx2Serializer{}.Serialize(image) };
+
+    const uint8_t identifier[12]{ 0xAB, 0x4B, 0x54, 0x58, 0x20, 0x32, 0x30, 0xBB, 0x0D, 0x0A, 0x1A, 0x0A };
+    EXPECT_EQ(0, std::memcmp(identifier, data.data(), sizeof(identifier)));
+    // VK_FORMAT_BC7_SRGB_BLOCK
+    EXPECT_EQ(146u, ReadUint32(data, 12));
+    EXPECT_EQ(5u, ReadUint32(data, 40));
+
+    // the smallest level comes first, every level is aligned to the block size
+    const auto firstLevelOffset{ ReadUint32(data, 80) };
+    const auto lastLevelOffset{ ReadUint32(data, 80 + 24 * 4) };
+    EXPECT_LT(lastLevelOffset, firstLevelOffset);
+    EXPECT_EQ(0u, lastLevelOffset % 16);
+    EXPECT_EQ(data.size(), firstLevelOffset + image.GetLevel(0).data.size());
+}
+
+TEST(Ktx2SerializerTests, Deserialize_RejectsInvalidData)
+{
+    const auto image{ CreateTestCompressedImage(CompressedImageFormat::BC4_R, false, 8, 8) };
+    auto data{ Ktx2Serializer{}.Serialize(image) };
+
+    EXPECT_TRUE(Ktx2Serializer{}.Deserialize(data.data(), data.size() - 1) == nullptr);
+    EXPECT_TRUE(Ktx2Serializer{}.Deserialize(data.data(), 40) == nullptr);
+
+    // unknown vkFormat
+    data[12] = 1;
+    EXPECT_TRUE(Ktx2Serializer{}.Deserialize(data.data(), data.size()) == nullptr);
+}
+
+TEST(Ktx2SerializerTests, Deserialize_RejectsLevelCountBeyondMipChain)
+{
+    // 8x8 has 4 levels
+    const auto image{ CreateTestCompressedImage(CompressedImageFormat::BC4_R, false, 8, 8) };
+    auto data{ Ktx2Serializer{}.Serialize(image) };
+    ASSERT_EQ(4u, ReadUint32(data, 40));
+
+    for (const uint32_t levelCount : { 5u, 33u, 0xFFFFFFFFu }) {
+        std::memcpy(data.data() + 40, &levelCount, sizeof(levelCount));
+        EXPECT_TRUE(Ktx2Serializer{}.Deserialize(data.data(), data.size()) == nullptr);
+    }
+}
+} // namespace prev::render::image
+
+#endif // !__KTX2_SERIALIZER_TESTS_H__
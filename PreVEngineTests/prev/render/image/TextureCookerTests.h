@@ -0,0 +1,152 @@
+#ifndef __TEXTURE_COOKER_TESTS_H__
+#define __TEXTURE_COOKER_TESTS_H__
+
+#include <prev/render/image/Image.h>
+#include <prev/render/image/TextureCooker.h>
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+
+namespace prev::render::image {
+namespace {
+    // Smooth gradients with a bit of noise - close to what textures look like at block scale.
+    std::unique_ptr<Image<uint8_t, 4>> CreateTestImage(const uint32_t width, const uint32_t height)
+    {
+        auto image{ std::make_unique<Image<uint8_t, 4>>(width, height) };
+        for (uint32_t y = 0; y < height; ++y) {
+            for (uint32_t x = 0; x < width; ++x) {
+                const uint8_t noise{ static_cast<uint8_t>((x * 7 + y * 13) % 5) };
+                image->GetPixel(x, y) = { static_cast<uint8_t>(x * 255 / width + noise), static_cast<uint8_t>(y * 255 / height), static_cast<uint8_t>(128 + noise), static_cast<uint8_t>((x + y) * 255 / (width + height)) };
+            }
+        }
+        return image;
+    }
+
+    float ComputeChannelRmse(const IImage& a, const IImage& b, const uint32_t channel)
+    {
+        double sum{ 0.0 };
+        for (uint32_t i = 0; i < a.GetSize(); ++i) {
+            const double difference{ static_cast<double>(a.GetRawDataPtr()[i * 4 + channel]) - b.GetRawDataPtr()[i * 4 + channel] };
+            sum += difference * difference;
+        }
+        return static_cast<float>(std::sqrt(sum / a.GetSize()));
+    }
+} // namespace
+
+TEST(TextureCookerTests, Cook_DecodesWithinErrorBounds)
+{
+    struct TestCase {
+        CompressedImageFormat format;
+
+        uint32_t channelCount;
+
+        float maxRmse;
+    };
+
+    const TestCase testCases[]{
+        { CompressedImageFormat::BC1_RGBA, 3, 6.0f },
+        { CompressedImageFormat::BC3_RGBA, 4, 6.0f },
+        { CompressedImageFormat::BC4_R, 1, 2.0f },
+        { CompressedImageFormat::BC5_RG, 2, 2.0f },
+        { CompressedImageFormat::BC7_RGBA, 4, 5.0f },
+        { CompressedImageFormat::ETC2_RGB8, 3, 8.0f },
+        { CompressedImageFormat::ETC2_RGBA8, 4, 8.0f },
+    };
+
+    const auto image{ CreateTestImage(64, 48) };
+    for (const auto& testCase : testCases) {
+        const auto cooked{ TextureCooker{}.Cook(*image, TextureUsage::COLOR, testCase.format, false, false) };
+        ASSERT_TRUE(cooked != nullptr);
+        EXPECT_EQ(1u, cooked->GetLevelCount());
+        EXPECT_EQ(64u * 48u / 16u * CompressedImage::GetBlockByteSize(testCase.format), cooked->GetSize());
+
+        const auto decoded{ TextureCooker{}.Decode(*cooked) };
+        ASSERT_TRUE(decoded != nullptr);
+        for (uint32_t channel = 0; channel < testCase.channelCount; ++channel) {
+            EXPECT_LT(ComputeChannelRmse(*image, *decoded, channel), testCase.maxRmse);
+        }
+    }
+}
+
+TEST(TextureCookerTests, Cook_FlatBlocksAreExact)
+{
+    Image<uint8_t, 4> image{ 8, 8 };
+    image.Clear({ 255, 0, 0, 200 });
+
+    for (const auto format : { CompressedImageFormat::BC1_RGBA, CompressedImageFormat::BC3_RGBA, CompressedImageFormat::BC4_R }) {
+        const auto decoded{ TextureCooker{}.Decode(*TextureCooker{}.Cook(image, TextureUsage::COLOR, format, false, false)) };
+        ASSERT_TRUE(decoded != nullptr);
+        EXPECT_EQ(255, decoded->GetRawDataPtr()[0]);
+        EXPECT_EQ(0, decoded->GetRawDataPtr()[1]);
+    }
+
+    // BC7 mode 6 shares the endpoint p-bit across channels, so odd and even values can not both be hit exactly
+    const auto bc7Decoded{ TextureCooker{}.Decode(*TextureCooker{}.Cook(image, TextureUsage::COLOR, CompressedImageFormat::BC7_RGBA, false, false)) };
+    ASSERT_TRUE(bc7Decoded != nullptr);
+    EXPECT_NEAR(255, bc7Decoded->GetRawDataPtr()[0], 1);
+    EXPECT_NEAR(0, bc7Decoded->GetRawDataPtr()[1], 1);
+    EXPECT_NEAR(200, bc7Decoded->GetRawDataPtr()[3], 1);
+
+    const auto etc2Decoded{ TextureCooker{}.Decode(*TextureCooker{}.Cook(image, TextureUsage::COLOR, CompressedImageFormat::ETC2_RGBA8, false, false)) };
+    ASSERT_TRUE(etc2Decoded != nullptr);
+    EXPECT_EQ(200, etc2Decoded->GetRawDataPtr()[3]);
+}
+
+TEST(TextureCookerTests, Cook_GeneratesFullMipChain)
+{
+    const auto image{ CreateTestImage(37, 20) };
+
+    prev::common::ThreadPool threadPool{ 2 };
+    const auto cooked{ TextureCooker{}.Cook(*image, TextureUsage::COLOR, CompressedImageFormat::BC7_RGBA, true, true, threadPool) };
+    ASSERT_TRUE(cooked != nullptr);
+
+    const uint32_t expectedSizes[][2]{ { 37, 20 }, { 18, 10 }, { 9, 5 }, { 4, 2 }, { 2, 1 }, { 1, 1 } };
+    ASSERT_EQ(6u, cooked->GetLevelCount());
+    for (uint32_t level = 0; level < cooked->GetLevelCount(); ++level) {
+        EXPECT_EQ(expectedSizes[level][0], cooked->GetLevel(level).width);
+        EXPECT_EQ(expectedSizes[level][1], cooked->GetLevel(level).height);
+        EXPECT_EQ(CompressedImage::GetLevelByteSize(CompressedImageFormat::BC7_RGBA, expectedSizes[level][0], expectedSizes[level][1]), cooked->GetLevel(level).data.size());
+    }
+
+    // the parallel path encodes the same blocks
+    const auto serialCooked{ TextureCooker{}.Cook(*image, TextureUsage::COLOR, CompressedImageFormat::BC7_RGBA, true, true) };
+    EXPECT_TRUE(serialCooked->GetLevel(0).data == cooked->GetLevel(0).data);
+}
+
+TEST(TextureCookerTests, Cook_RenormalizesNormalMapMips)
+{
+    // alternating normals tilted 45 degrees left and right average to a short up vector
+    Image<uint8_t, 4> image{ 2, 2 };
+    const uint8_t tilt{ static_cast<uint8_t>(std::lround((std::sqrt(0.5f) * 0.5f + 0.5f) * 255.0f)) };
+    image.GetPixel(0, 0) = image.GetPixel(1, 1) = { tilt, 128, tilt, 255 };
+    image.GetPixel(1, 0) = image.GetPixel(0, 1) = { static_cast<uint8_t>(255 - tilt), 128, tilt, 255 };
+
+    const auto cooked{ TextureCooker{}.Cook(image, TextureUsage::NORMAL_MAP, CompressedImageFormat::BC7_RGBA, false, true) };
+    ASSERT_EQ(2u, cooked->GetLevelCount());
+
+    const auto decoded{ TextureCooker{}.Decode(*cooked, 1) };
+    EXPECT_NEAR(128, decoded->GetRawDataPtr()[0], 2);
+    EXPECT_NEAR(128, decoded->GetRawDataPtr()[1], 2);
+    EXPECT_NEAR(255, decoded->GetRawDataPtr()[2], 2);
+}
+
+TEST(TextureCookerTests, Cook_AstcIsNotEncodable)
+{
+    const auto image{ CreateTestImage(8, 8) };
+    EXPECT_TRUE(TextureCooker{}.Cook(*image, TextureUsage::COLOR, CompressedImageFormat::ASTC_4x4_RGBA, false) == nullptr);
+}
+
+TEST(TextureCookerTests, SelectFormat_MatchesUsage)
+{
+    EXPECT_EQ(CompressedImageFormat::BC5_RG, TextureCooker::SelectFormat(TextureCompressionFamily::BC, TextureUsage::NORMAL_MAP, false));
+    EXPECT_EQ(CompressedImageFormat::BC5_RG, TextureCooker::SelectFormat(TextureCompressionFamily::BC, TextureUsage::CONE_MAP, false));
+    EXPECT_EQ(CompressedImageFormat::BC4_R, TextureCooker::SelectFormat(TextureCompressionFamily::BC, TextureUsage::HEIGHT_MAP, false));
+    EXPECT_EQ(CompressedImageFormat::BC1_RGBA, TextureCooker::SelectFormat(TextureCompressionFamily::BC, TextureUsage::COLOR, false));
+    EXPECT_EQ(CompressedImageFormat::BC7_RGBA, TextureCooker::SelectFormat(TextureCompressionFamily::BC, TextureUsage::COLOR, true));
+    EXPECT_EQ(CompressedImageFormat::ETC2_RGBA8, TextureCooker::SelectFormat(TextureCompressionFamily::ETC2, TextureUsage::COLOR, true));
+    EXPECT_EQ(CompressedImageFormat::ETC2_RGB8, TextureCooker::SelectFormat(TextureCompressionFamily::ETC2, TextureUsage::NORMAL_MAP, true));
+}
+} // namespace prev::render::image
+
+#endif // !__TEXTURE_COOKER_TESTS_H__
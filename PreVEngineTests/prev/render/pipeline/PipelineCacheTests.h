@@ -0,0 +1,104 @@
+#ifndef __PIPELINE_CACHE_TESTS_H__
+#define __PIPELINE_CACHE_TESTS_H__
+
+#include <prev/render/pipeline/PipelineCache.h>
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace prev::render::pipeline {
+TEST(PipelineCacheTests, PipelineKey_LengthPrefixSeparatesStrings)
+{
+    PipelineKey first{};
+    first.Add(std::string{ "ab" }).Add(std::string{ "c" });
+
+    PipelineKey second{};
+    second.Add(std::string{ "a" }).Add(std::string{ "bc" });
+
+    PipelineKey third{};
+    third.Add(std::string{ "ab" }).Add(std::string{ "c" });
+
+    EXPECT_NE(first.GetData(), second.GetData());
+    EXPECT_EQ(first.GetData(), third.GetData());
+}
+
+TEST(PipelineCacheTests, SharedGfxObject_DestroyedWithLastOwner)
+{
+    uint32_t destroyedHandle{};
+    auto object{ std::make_shared<SharedGfxObject<uint32_t>>(7u, [&](const uint32_t handle) { destroyedHandle = handle; }) };
+    auto otherOwner{ object };
+
+    object.reset();
+    EXPECT_EQ(0u, destroyedHandle);
+
+    otherOwner.reset();
+    EXPECT_EQ(7u, destroyedHandle);
+}
+
+TEST(PipelineCacheTests, SharedGfxObject_IdsAreUnique)
+{
+    const SharedGfxObject<uint32_t> first{ 1u, {} };
+    const SharedGfxObject<uint32_t> second{ 1u, {} };
+
+    EXPECT_NE(first.GetId(), second.GetId());
+}
+
+TEST(PipelineCacheTests, GetOrCreate_SharesObjectOfSameKey)
+{
+    PipelineCache cache{};
+
+    uint32_t createCount{};
+    const auto create = [&]() -> std::shared_ptr<const SharedShaderModule> {
+        ++createCount;
+        return std::make_shared<SharedShaderModule>(GfxShader{}, nullptr);
+    };
+
+    PipelineKey key{};
+    key.Add(std::string{ "shaders/default_vert.spv" });
+
+    PipelineKey otherKey{};
+    otherKey.Add(std::string{ "shaders/default_frag.spv" });
+
+    const auto first{ cache.GetOrCreateShaderModule(key, create) };
+    const auto second{ cache.GetOrCreateShaderModule(key, create) };
+    const auto other{ cache.GetOrCreateShaderModule(otherKey, create) };
+
+    EXPECT_EQ(first, second);
+    EXPECT_NE(first, other);
+    EXPECT_EQ(2u, createCount);
+
+    const auto statistics{ cache.GetStatistics() };
+    EXPECT_EQ(1u, statistics.shaderModules.hitCount);
+    EXPECT_EQ(2u, statistics.shaderModules.missCount);
+    EXPECT_EQ(2u, statistics.shaderModules.size);
+    EXPECT_EQ(0u, statistics.renderPipelines.missCount);
+}
+
+TEST(PipelineCacheTests, Clear_KeepsObjectsInUse)
+{
+    PipelineCache cache{};
+
+    uint32_t destroyCount{};
+    const auto create = [&]() -> std::shared_ptr<const SharedComputePipeline> {
+        return std::make_shared<SharedComputePipeline>(reinterpret_cast<GfxComputePipeline>(uintptr_t{ 1 }), [&](GfxComputePipeline) { ++destroyCount; });
+    };
+
+    PipelineKey key{};
+    key.Add(1u);
+
+    auto pipeline{ cache.GetOrCreateComputePipeline(key, create) };
+    cache.GetOrCreateComputePipeline(PipelineKey{}.Add(2u), create);
+
+    cache.Clear();
+    EXPECT_EQ(1u, destroyCount);
+    EXPECT_EQ(0u, cache.GetStatistics().computePipelines.size);
+
+    pipeline.reset();
+    EXPECT_EQ(2u, destroyCount);
+}
+} // namespace prev::render::pipeline
+
+#endif // !__PIPELINE_CACHE_TESTS_H__
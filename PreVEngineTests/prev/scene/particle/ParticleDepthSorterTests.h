@@ -0,0 +1,121 @@
+#ifndef __PARTICLE_DEPTH_SORTER_TESTS_H__
+#define __PARTICLE_DEPTH_SORTER_TESTS_H__
+
+#include <prev/common/Common.h>
+#include <prev/common/ThreadPool.h>
+#include <prev/scene/particle/ParticleDepthSorter.h>
+#include <prev/util/Utils.h>
+
+#include <gtest/gtest.h>
+
+namespace prev::scene::particle {
+namespace {
+    std::vector<ParticleInstance> CreateInstances(const std::vector<float>& depths, const float tag)
+    {
+        std::vector<ParticleInstance> instances(depths.size());
+        for (size_t i = 0; i < depths.size(); ++i) {
+            instances[i].position = glm::vec3(tag, 0.0f, depths[i]);
+        }
+        return instances;
+    }
+} // namespace
+
+TEST(ParticleDepthSorterTests, Sort_Radix_MergesSourcesBackToFront)
+{
+    const auto first{ CreateInstances({ 1.0f, 9.0f, 5.0f }, 0.0f) };
+    const auto second{ CreateInstances({ 7.0f, 3.0f }, 1.0f) };
+
+    ParticleDepthSorter sorter{ ParticleSortMode::RADIX };
+    std::vector<ParticleInstance> sorted(5);
+    std::vector<ParticleDrawRun> runs;
+    sorter.Sort(glm::vec3(0.0f), glm::vec3(0.0f, 0.0f, 1.0f), { { first.data(), 3 }, { second.data(), 2 } }, sorted.data(), runs);
+
+    const std::vector<float> expectedDepths{ 9.0f, 7.0f, 5.0f, 3.0f, 1.0f };
+    for (size_t i = 0; i < expectedDepths.size(); ++i) {
+        EXPECT_FLOAT_EQ(expectedDepths[i], sorted[i].position.z);
+    }
+
+    ASSERT_EQ(5u, runs.size());
+    const std::vector<uint32_t> expectedSources{ 0, 1, 0, 1, 0 };
+    for (size_t i = 0; i < runs.size(); ++i) {
+        EXPECT_EQ(expectedSources[i], runs[i].sourceIndex);
+        EXPECT_EQ(static_cast<uint32_t>(i), runs[i].firstInstance);
+        EXPECT_EQ(1u, runs[i].instanceCount);
+        EXPECT_FLOAT_EQ(static_cast<float>(runs[i].sourceIndex), sorted[runs[i].firstInstance].position.x);
+    }
+}
+
+TEST(ParticleDepthSorterTests, Sort_Bucket_OrdersSlicesAndKeepsOrderWithinSlice)
+{
+    // 4 slices over depths 0..30, slice = floor((30 - depth) / 10) -> 25, 30 and 26 share the farthest one
+    const auto instances{ CreateInstances({ 1.0f, 25.0f, 2.0f, 0.0f, 30.0f, 26.0f }, 0.0f) };
+
+    ParticleDepthSorter sorter{ ParticleSortMode::BUCKET, 4 };
+    std::vector<ParticleInstance> sorted(instances.size());
+    std::vector<ParticleDrawRun> runs;
+    sorter.Sort(glm::vec3(0.0f), glm::vec3(0.0f, 0.0f, 1.0f), { { instances.data(), static_cast<uint32_t>(instances.size()) } }, sorted.data(), runs);
+
+    const std::vector<float> expectedDepths{ 25.0f, 30.0f, 26.0f, 1.0f, 2.0f, 0.0f };
+    for (size_t i = 0; i < expectedDepths.size(); ++i) {
+        EXPECT_FLOAT_EQ(expectedDepths[i], sorted[i].position.z);
+    }
+
+    ASSERT_EQ(1u, runs.size());
+    EXPECT_EQ(6u, runs[0].instanceCount);
+}
+
+TEST(ParticleDepthSorterTests, Sort_Parallel_MatchesSerial)
+{
+    prev::util::RandomNumberGenerator rng{ 7 };
+    std::uniform_real_distribution<float> dist{ -100.0f, 100.0f };
+
+    std::vector<std::vector<ParticleInstance>> systems(3);
+    std::vector<ParticleSortSource> sources;
+    uint32_t totalCount{ 0 };
+    for (size_t s = 0; s < systems.size(); ++s) {
+        systems[s].resize(40000 + s * 1000);
+        for (auto& instance : systems[s]) {
+            instance.position = glm::vec3(dist(rng.GetRandomEngine()), dist(rng.GetRandomEngine()), dist(rng.GetRandomEngine()));
+        }
+        sources.push_back({ systems[s].data(), static_cast<uint32_t>(systems[s].size()) });
+        totalCount += sources.back().count;
+    }
+
+    const glm::vec3 viewPosition{ 10.0f, 20.0f, -300.0f };
+    const glm::vec3 viewDirection{ glm::normalize(glm::vec3(0.1f, -0.2f, 1.0f)) };
+
+    prev::common::ThreadPool threadPool{ 4 };
+    // no workers, as on emscripten - the sort has to run in place instead of waiting on the pool
+    prev::common::ThreadPool emptyThreadPool{ 0 };
+    for (const auto mode : { ParticleSortMode::RADIX, ParticleSortMode::BUCKET }) {
+        ParticleDepthSorter sorter{ mode };
+
+        std::vector<ParticleInstance> serial(totalCount);
+        std::vector<ParticleDrawRun> serialRuns;
+        sorter.Sort(viewPosition, viewDirection, sources, serial.data(), serialRuns);
+
+        std::vector<ParticleInstance> parallel(totalCount);
+        std::vector<ParticleDrawRun> parallelRuns;
+        sorter.Sort(viewPosition, viewDirection, sources, parallel.data(), parallelRuns, threadPool);
+
+        std::vector<ParticleInstance> inPlace(totalCount);
+        std::vector<ParticleDrawRun> inPlaceRuns;
+        sorter.Sort(viewPosition, viewDirection, sources, inPlace.data(), inPlaceRuns, emptyThreadPool);
+
+        ASSERT_EQ(serialRuns.size(), parallelRuns.size());
+        ASSERT_EQ(serialRuns.size(), inPlaceRuns.size());
+        for (uint32_t i = 0; i < totalCount; ++i) {
+            ASSERT_EQ(serial[i].position, parallel[i].position);
+            ASSERT_EQ(serial[i].position, inPlace[i].position);
+        }
+
+        // back to front up to the key quantization
+        const float tolerance{ mode == ParticleSortMode::RADIX ? 0.01f : 0.5f };
+        for (uint32_t i = 1; i < totalCount; ++i) {
+            ASSERT_GE(glm::dot(serial[i - 1].position - viewPosition, viewDirection) + tolerance, glm::dot(serial[i].position - viewPosition, viewDirection));
+        }
+    }
+}
+} // namespace prev::scene::particle
+
+#endif // !__PARTICLE_DEPTH_SORTER_TESTS_H__
@@ -0,0 +1,72 @@
+#ifndef __PARTICLE_POOL_TESTS_H__
+#define __PARTICLE_POOL_TESTS_H__
+
+#include <prev/common/Common.h>
+#include <prev/scene/particle/ParticlePool.h>
+
+#include <gtest/gtest.h>
+
+namespace prev::scene::particle {
+TEST(ParticlePoolTests, Update_IntegratesVelocityAndGravity)
+{
+    ParticlePool pool{ 16 };
+    for (uint32_t i = 0; i < 7; ++i) { // SIMD batch plus a scalar tail
+        ASSERT_TRUE(pool.Emit(glm::vec3(static_cast<float>(i), 0.0f, 0.0f), glm::vec3(1.0f, 2.0f, 3.0f), 1.0f, 10.0f, 0.0f, 1.0f));
+    }
+
+    pool.Update(0.5f);
+
+    ASSERT_EQ(7u, pool.GetCount());
+    for (uint32_t i = 0; i < pool.GetCount(); ++i) {
+        const float velocityY{ 2.0f - 9.81f * 0.5f };
+        EXPECT_NEAR(velocityY, pool.GetVelocity(i).y, 1e-5f);
+        EXPECT_NEAR(static_cast<float>(i) + 0.5f, pool.GetPosition(i).x, 1e-5f);
+        EXPECT_NEAR(velocityY * 0.5f, pool.GetPosition(i).y, 1e-5f);
+        EXPECT_NEAR(1.5f, pool.GetPosition(i).z, 1e-5f);
+        EXPECT_FLOAT_EQ(0.5f, pool.GetElapsedTime(i));
+    }
+
+    const auto& box{ pool.GetBoundingBox() };
+    EXPECT_NEAR(0.5f, box.minExtents.x, 1e-5f);
+    EXPECT_NEAR(6.5f, box.maxExtents.x, 1e-5f);
+}
+
+TEST(ParticlePoolTests, Update_SwapRemovesExpired)
+{
+    ParticlePool pool{ 8 };
+    for (uint32_t i = 0; i < 8; ++i) {
+        ASSERT_TRUE(pool.Emit(glm::vec3(static_cast<float>(i)), glm::vec3(0.0f), 0.0f, (i % 2 == 0) ? 0.5f : 5.0f, 0.0f, 1.0f));
+    }
+    EXPECT_FALSE(pool.Emit(glm::vec3(0.0f), glm::vec3(0.0f), 0.0f, 1.0f, 0.0f, 1.0f));
+
+    pool.Update(1.0f);
+
+    ASSERT_EQ(4u, pool.GetCount());
+    for (uint32_t i = 0; i < pool.GetCount(); ++i) {
+        EXPECT_FLOAT_EQ(5.0f, pool.GetLifeLength(i));
+        EXPECT_EQ(1, static_cast<int>(pool.GetPosition(i).x) % 2);
+    }
+
+    EXPECT_TRUE(pool.Emit(glm::vec3(0.0f), glm::vec3(0.0f), 0.0f, 1.0f, 0.0f, 1.0f));
+    EXPECT_EQ(5u, pool.GetCount());
+}
+
+TEST(ParticlePoolTests, WriteInstances_ComputesAtlasStages)
+{
+    ParticlePool pool{ 4 };
+    pool.Emit(glm::vec3(1.0f, 2.0f, 3.0f), glm::vec3(0.0f), 0.0f, 4.0f, 45.0f, 2.0f);
+    pool.Update(2.5f); // 62.5% of life, 4 stages in a 2x2 atlas -> stage 2.5
+
+    ParticleInstance instance{};
+    pool.WriteInstances(2, &instance);
+
+    EXPECT_EQ(glm::vec3(1.0f, 2.0f, 3.0f), instance.position);
+    EXPECT_EQ(glm::vec2(2.0f), instance.scale);
+    EXPECT_FLOAT_EQ(45.0f, instance.rotation);
+    EXPECT_EQ(glm::vec2(0.0f, 0.5f), instance.currentStageTextureOffset);
+    EXPECT_EQ(glm::vec2(0.5f, 0.5f), instance.nextStageTextureOffset);
+    EXPECT_NEAR(0.5f, instance.stagesBlendFactor, 1e-5f);
+}
+} // namespace prev::scene::particle
+
+#endif // !__PARTICLE_POOL_TESTS_H__
@@ -0,0 +1,320 @@
+#ifndef __PARTICLE_SIMULATION_TESTS_H__
+#define __PARTICLE_SIMULATION_TESTS_H__
+
+#include <prev/core/CommandsExecutor.h>
+#include <prev/core/device/Adapters.h>
+#include <prev/core/device/DeviceFactory.h>
+#include <prev/core/instance/InstanceFactory.h>
+#include <prev/render/buffer/BufferBuilder.h>
+#include <prev/render/particle/ParticleSimulation.h>
+#include <prev/scene/particle/ParticlePool.h>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstring>
+#include <filesystem>
+#include <map>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace prev::scene::particle {
+namespace {
+    const uint32_t INSTANCE_FLOAT_COUNT{ 11 };
+
+    struct GpuContext {
+        std::unique_ptr<prev::core::instance::Instance> instance;
+
+        std::unique_ptr<prev::core::device::Device> device;
+
+        std::unique_ptr<prev::render::particle::ParticleSimulation> simulation;
+    };
+
+    // The pipelines of ParticlesSimulationRenderer on whatever Vulkan adapter there is, machines without a GPU
+    // run them on lavapipe or SwiftShader. Null when there is no device or the shaders were not compiled.
+    std::unique_ptr<GpuContext> CreateGpuContext()
+    {
+#ifdef PREV_TESTS_SHADERS_DIR
+        const std::string simulateShaderPath{ PREV_TESTS_SHADERS_DIR "/spirv/particle/particles_simulate_comp.spv" };
+        const std::string finalizeShaderPath{ PREV_TESTS_SHADERS_DIR "/spirv/particle/particles_finalize_comp.spv" };
+        if (!std::filesystem::exists(simulateShaderPath) || !std::filesystem::exists(finalizeShaderPath)) {
+            return nullptr;
+        }
+
+        try {
+            auto context{ std::make_unique<GpuContext>() };
+            context->instance = prev::core::instance::InstanceFactory{}.Create("PreVEngineTests", false, prev::core::engine::RenderBackend::Vulkan);
+
+            const prev::core::device::Adapters adapters{ context->instance->GetHandle() };
+            const auto adapter{ adapters.Find(nullptr) };
+            if (!adapter) {
+                return nullptr;
+            }
+
+            context->device = prev::core::device::DeviceFactory{}.Create(*adapter);
+            if (!context->device) {
+                return nullptr;
+            }
+
+            context->simulation = std::make_unique<prev::render::particle::ParticleSimulation>(*context->device, simulateShaderPath, finalizeShaderPath, 1);
+            return context;
+        } catch (const std::exception&) {
+            return nullptr;
+        }
+#else
+        return nullptr;
+#endif
+    }
+
+    struct SimulationBuffers {
+        prev::render::particle::ParticleSimulationState state{};
+
+        std::shared_ptr<prev::render::buffer::Buffer> instances{};
+    };
+
+    // as ParticleSystemComponentFactory creates them, copyable to be read back
+    SimulationBuffers CreateSimulationBuffers(const prev::core::device::Device& device, const uint32_t capacity, const uint32_t maxEmittedCount, const std::vector<prev::render::particle::GpuParticle>& initialParticles, const std::array<uint32_t, 2>& initialCounters)
+    {
+        auto& queue{ device.GetQueue(prev::core::device::QueueType::GRAPHICS) };
+
+        SimulationBuffers buffers{};
+        buffers.instances = prev::render::buffer::BufferBuilder{ device, queue }
+                                .SetSize(sizeof(ParticleInstance) * capacity)
+                                .SetUsageFlags(GFX_BUFFER_USAGE_VERTEX | GFX_BUFFER_USAGE_STORAGE | GFX_BUFFER_USAGE_COPY_SRC)
+                                .SetMemoryProperties(GFX_MEMORY_PROPERTY_DEVICE_LOCAL)
+                                .Build();
+
+        std::vector<prev::render::particle::GpuParticle> particles(capacity);
+        std::copy(initialParticles.begin(), initialParticles.end(), particles.begin());
+        for (auto& particlesBuffer : buffers.state.particles) {
+            particlesBuffer = prev::render::buffer::BufferBuilder{ device, queue }
+                                  .SetSize(sizeof(prev::render::particle::GpuParticle) * capacity)
+                                  .SetUsageFlags(GFX_BUFFER_USAGE_STORAGE | GFX_BUFFER_USAGE_COPY_SRC | GFX_BUFFER_USAGE_COPY_DST)
+                                  .SetMemoryProperties(GFX_MEMORY_PROPERTY_DEVICE_LOCAL)
+                                  .SetData(particles.data(), sizeof(prev::render::particle::GpuParticle) * capacity)
+                                  .Build();
+        }
+
+        buffers.state.counters = prev::render::buffer::BufferBuilder{ device, queue }
+                                     .SetSize(sizeof(initialCounters))
+                                     .SetUsageFlags(GFX_BUFFER_USAGE_STORAGE | GFX_BUFFER_USAGE_COPY_SRC | GFX_BUFFER_USAGE_COPY_DST)
+                                     .SetMemoryProperties(GFX_MEMORY_PROPERTY_DEVICE_LOCAL)
+                                     .SetData(initialCounters.data(), sizeof(initialCounters))
+                                     .Build();
+
+        const std::array<uint32_t, 5> drawArgs{ 6, 0, 0, 0, 0 };
+        buffers.state.indirectDraw = prev::render::buffer::BufferBuilder{ device, queue }
+                                         .SetSize(sizeof(drawArgs))
+                                         .SetUsageFlags(GFX_BUFFER_USAGE_STORAGE | GFX_BUFFER_USAGE_INDIRECT | GFX_BUFFER_USAGE_COPY_SRC | GFX_BUFFER_USAGE_COPY_DST)
+                                         .SetMemoryProperties(GFX_MEMORY_PROPERTY_DEVICE_LOCAL)
+                                         .SetData(drawArgs.data(), sizeof(drawArgs))
+                                         .Build();
+
+        buffers.state.emittedParticles = prev::render::buffer::BufferBuilder{ device, queue }
+                                             .SetSize(sizeof(prev::render::particle::GpuParticle) * maxEmittedCount)
+                                             .SetUsageFlags(GFX_BUFFER_USAGE_STORAGE | GFX_BUFFER_USAGE_MAP_WRITE)
+                                             .SetMemoryProperties(GFX_MEMORY_PROPERTY_HOST_VISIBLE | GFX_MEMORY_PROPERTY_HOST_COHERENT)
+                                             .Build();
+        buffers.state.capacity = capacity;
+        return buffers;
+    }
+
+    // one frame as GpuParticleSystemComponent and ParticlesSimulationRenderer drive it, waits for the GPU
+    void DispatchFrame(GpuContext& context, SimulationBuffers& buffers, const std::vector<prev::render::particle::GpuParticle>& emittedParticles, const float deltaTime, const uint32_t atlasNumberOfRows)
+    {
+        if (!emittedParticles.empty()) {
+            buffers.state.emittedParticles->Write(emittedParticles.data(), sizeof(prev::render::particle::GpuParticle) * emittedParticles.size());
+        }
+        buffers.state.emittedCount = static_cast<uint32_t>(emittedParticles.size());
+        buffers.state.deltaTime = deltaTime;
+
+        context.simulation->BeginFrame(0);
+        prev::core::CommandsExecutor{ *context.device, context.device->GetQueue(prev::core::device::QueueType::GRAPHICS) }.ExecuteImmediate([&](GfxCommandEncoder commandEncoder) {
+            context.simulation->Record(commandEncoder, buffers.state, *buffers.instances, atlasNumberOfRows);
+        });
+        context.simulation->EndFrame();
+
+        buffers.state.inputIndex = 1 - buffers.state.inputIndex;
+    }
+
+    template <typename T>
+    std::vector<T> ReadBack(const prev::core::device::Device& device, const prev::render::buffer::Buffer& buffer, const size_t count)
+    {
+        auto& queue{ device.GetQueue(prev::core::device::QueueType::GRAPHICS) };
+        const uint64_t size{ sizeof(T) * count };
+
+        const auto stagingBuffer{ prev::render::buffer::BufferBuilder{ device, queue }
+                                      .SetSize(size)
+                                      .SetUsageFlags(GFX_BUFFER_USAGE_COPY_DST | GFX_BUFFER_USAGE_MAP_READ)
+                                      .SetMemoryProperties(GFX_MEMORY_PROPERTY_HOST_VISIBLE | GFX_MEMORY_PROPERTY_HOST_COHERENT)
+                                      .SetSubAllocation(false)
+                                      .Build() };
+
+        prev::core::CommandsExecutor{ device, queue }.ExecuteImmediate([&](GfxCommandEncoder commandEncoder) {
+            GfxCopyBufferToBufferDescriptor copyDesc{};
+            copyDesc.source = buffer;
+            copyDesc.sourceOffset = buffer.GetOffset();
+            copyDesc.destination = *stagingBuffer;
+            copyDesc.destinationOffset = 0;
+            copyDesc.size = size;
+            gfxCommandEncoderCopyBufferToBuffer(commandEncoder, &copyDesc);
+        });
+
+        void* pointer{ nullptr };
+        if (gfxBufferMapAsync(*stagingBuffer, 0, size, &pointer) != GFX_RESULT_SUCCESS || !pointer) {
+            throw std::runtime_error("Could not map the read back buffer");
+        }
+
+        std::vector<T> result(count);
+        std::memcpy(result.data(), pointer, size);
+        gfxBufferUnmap(*stagingBuffer);
+        return result;
+    }
+
+    prev::render::particle::GpuParticle CreateGpuParticle(const glm::vec3& position, const glm::vec3& velocity, const float gravityEffect, const float lifeLength, const float rotation, const float scale)
+    {
+        return prev::render::particle::GpuParticle{ glm::vec4(position, gravityEffect), glm::vec4(velocity, lifeLength), glm::vec4(0.0f, rotation, scale, 0.0f) };
+    }
+} // namespace
+
+TEST(ParticleSimulationTests, InstanceLayout_MatchesShaderStride)
+{
+    EXPECT_EQ(INSTANCE_FLOAT_COUNT * sizeof(float), sizeof(ParticleInstance));
+    EXPECT_EQ(3 * sizeof(glm::vec4), sizeof(prev::render::particle::GpuParticle));
+}
+
+TEST(ParticleSimulationTests, Simulate_MatchesParticlePool)
+{
+    const auto context{ CreateGpuContext() };
+    if (!context) {
+        GTEST_SKIP() << "No Vulkan device or compiled particle shaders";
+    }
+
+    const uint32_t capacity{ 64 };
+    const uint32_t maxEmittedCount{ 3 };
+    const uint32_t atlasNumberOfRows{ 4 };
+    const float deltaTime{ 1.0f / 60.0f };
+
+    ParticlePool pool{ capacity };
+    auto buffers{ CreateSimulationBuffers(*context->device, capacity, maxEmittedCount, {}, { 0, 0 }) };
+
+    // the rotation is unique per particle and identifies it in both, the order of alive particles differs
+    uint32_t emittedTotal{ 0 };
+    for (uint32_t frame = 0; frame < 120; ++frame) {
+        std::vector<prev::render::particle::GpuParticle> emittedParticles;
+        for (uint32_t i = 0; i < maxEmittedCount; ++i, ++emittedTotal) {
+            const float value{ static_cast<float>(emittedTotal) };
+            const glm::vec3 position{ value * 0.1f, 0.0f, -value * 0.2f };
+            const glm::vec3 velocity{ std::sin(value), 5.0f + std::cos(value), 0.5f };
+            const float gravityEffect{ 0.1f * static_cast<float>(emittedTotal % 5) };
+            const float lifeLength{ 0.2f + 0.05f * static_cast<float>(emittedTotal % 13) };
+            const float scale{ 1.0f + 0.01f * value };
+            if (pool.Emit(position, velocity, gravityEffect, lifeLength, value, scale)) {
+                emittedParticles.push_back(CreateGpuParticle(position, velocity, gravityEffect, lifeLength, value, scale));
+            }
+        }
+
+        DispatchFrame(*context, buffers, emittedParticles, deltaTime, atlasNumberOfRows);
+        pool.Update(deltaTime);
+
+        const auto counters{ ReadBack<uint32_t>(*context->device, *buffers.state.counters, 2) };
+        const auto drawArgs{ ReadBack<uint32_t>(*context->device, *buffers.state.indirectDraw, 5) };
+        ASSERT_EQ(pool.GetCount(), drawArgs[1]);
+        ASSERT_EQ(pool.GetCount(), counters[buffers.state.inputIndex]);
+        ASSERT_EQ(0u, counters[1 - buffers.state.inputIndex]);
+        ASSERT_EQ(6u, drawArgs[0]);
+    }
+    ASSERT_GT(pool.GetCount(), 0u);
+
+    std::vector<ParticleInstance> poolInstances(pool.GetCount());
+    pool.WriteInstances(atlasNumberOfRows, poolInstances.data());
+
+    const auto gpuParticles{ ReadBack<prev::render::particle::GpuParticle>(*context->device, *buffers.state.particles[buffers.state.inputIndex], pool.GetCount()) };
+    const auto gpuInstances{ ReadBack<ParticleInstance>(*context->device, *buffers.instances, pool.GetCount()) };
+
+    std::map<int, uint32_t> gpuSlots;
+    for (uint32_t slot = 0; slot < pool.GetCount(); ++slot) {
+        gpuSlots[static_cast<int>(gpuInstances[slot].rotation)] = slot;
+    }
+    ASSERT_EQ(poolInstances.size(), gpuSlots.size());
+
+    for (uint32_t i = 0; i < pool.GetCount(); ++i) {
+        const auto it{ gpuSlots.find(static_cast<int>(pool.GetRotation(i))) };
+        ASSERT_NE(gpuSlots.end(), it);
+
+        const auto& gpuParticle{ gpuParticles[it->second] };
+        EXPECT_FLOAT_EQ(pool.GetRotation(i), gpuParticle.elapsedTimeRotationScale.y);
+        EXPECT_NEAR(pool.GetElapsedTime(i), gpuParticle.elapsedTimeRotationScale.x, 1e-4f);
+        for (int c = 0; c < 3; ++c) {
+            EXPECT_NEAR(pool.GetPosition(i)[c], gpuParticle.positionAndGravityEffect[c], 1e-3f) << "particle " << pool.GetRotation(i);
+            EXPECT_NEAR(pool.GetVelocity(i)[c], gpuParticle.velocityAndLifeLength[c], 1e-3f) << "particle " << pool.GetRotation(i);
+        }
+    }
+
+    for (const auto& expected : poolInstances) {
+        const auto& actual{ gpuInstances[gpuSlots.at(static_cast<int>(expected.rotation))] };
+        const float* expectedFloats{ reinterpret_cast<const float*>(&expected) };
+        const float* actualFloats{ reinterpret_cast<const float*>(&actual) };
+        for (uint32_t f = 0; f < INSTANCE_FLOAT_COUNT; ++f) {
+            EXPECT_NEAR(expectedFloats[f], actualFloats[f], 1e-3f) << "particle " << expected.rotation << ", float " << f;
+        }
+    }
+}
+
+TEST(ParticleSimulationTests, Simulate_ClampsOverflowAndResetsInputCounter)
+{
+    const auto context{ CreateGpuContext() };
+    if (!context) {
+        GTEST_SKIP() << "No Vulkan device or compiled particle shaders";
+    }
+
+    const uint32_t capacity{ 4 };
+
+    std::vector<prev::render::particle::GpuParticle> particles;
+    for (uint32_t i = 0; i < 3; ++i) {
+        particles.push_back(CreateGpuParticle(glm::vec3(0.0f), glm::vec3(0.0f), 0.0f, 10.0f, static_cast<float>(i), 1.0f));
+    }
+    particles.push_back(CreateGpuParticle(glm::vec3(0.0f), glm::vec3(0.0f), 0.0f, 0.01f, 3.0f, 1.0f));
+
+    const std::vector<prev::render::particle::GpuParticle> emittedParticles{
+        CreateGpuParticle(glm::vec3(0.0f), glm::vec3(0.0f), 0.0f, 10.0f, 10.0f, 1.0f),
+        CreateGpuParticle(glm::vec3(0.0f), glm::vec3(0.0f), 0.0f, 10.0f, 11.0f, 1.0f),
+        CreateGpuParticle(glm::vec3(0.0f), glm::vec3(0.0f), 0.0f, 10.0f, 12.0f, 1.0f)
+    };
+
+    // a stale count above the capacity is clamped on read as well
+    auto buffers{ CreateSimulationBuffers(*context->device, capacity, static_cast<uint32_t>(emittedParticles.size()), particles, { 7, 0 }) };
+
+    DispatchFrame(*context, buffers, emittedParticles, 0.1f, 1);
+
+    const auto counters{ ReadBack<uint32_t>(*context->device, *buffers.state.counters, 2) };
+    const auto drawArgs{ ReadBack<uint32_t>(*context->device, *buffers.state.indirectDraw, 5) };
+
+    // 3 alive + 3 emitted survive, one expired, only 4 of them fit - which ones depends on the thread order
+    EXPECT_EQ(1u, buffers.state.inputIndex);
+    EXPECT_EQ(capacity, counters[1]);
+    EXPECT_EQ(0u, counters[0]);
+    EXPECT_EQ(capacity, drawArgs[1]);
+    EXPECT_EQ(6u, drawArgs[0]);
+
+    const auto outParticles{ ReadBack<prev::render::particle::GpuParticle>(*context->device, *buffers.state.particles[1], capacity) };
+    const auto outInstances{ ReadBack<ParticleInstance>(*context->device, *buffers.instances, capacity) };
+
+    const std::vector<float> survivorRotations{ 0.0f, 1.0f, 2.0f, 10.0f, 11.0f, 12.0f };
+    std::map<float, uint32_t> seenRotations;
+    for (uint32_t slot = 0; slot < capacity; ++slot) {
+        const float rotation{ outParticles[slot].elapsedTimeRotationScale.y };
+        EXPECT_NE(survivorRotations.end(), std::find(survivorRotations.begin(), survivorRotations.end(), rotation));
+        EXPECT_FLOAT_EQ(rotation, outInstances[slot].rotation);
+        EXPECT_FLOAT_EQ(0.1f, outParticles[slot].elapsedTimeRotationScale.x);
+        ++seenRotations[rotation];
+    }
+    EXPECT_EQ(capacity, seenRotations.size());
+}
+} // namespace prev::scene::particle
+
+#endif // !__PARTICLE_SIMULATION_TESTS_H__
@@ -0,0 +1,123 @@
+#ifndef __TRANSFORM_HIERARCHY_TESTS_H__
+#define __TRANSFORM_HIERARCHY_TESTS_H__
+
+#include <prev/common/Common.h>
+#include <prev/common/ThreadPool.h>
+#include <prev/scene/transform/TransformHierarchy.h>
+#include <prev/util/MathUtils.h>
+#include <prev/util/Utils.h>
+
+#include <gtest/gtest.h>
+
+namespace prev::scene::transform {
+namespace {
+    // random forest, every node is created after its parent
+    void BuildRandomForest(TransformHierarchy& hierarchy, const uint32_t count, const uint32_t seed, std::vector<uint32_t>& outHandles)
+    {
+        prev::util::RandomNumberGenerator rng{ seed };
+        std::uniform_real_distribution<float> positionDist{ -10.0f, 10.0f };
+        std::uniform_real_distribution<float> angleDist{ 0.0f, 6.28f };
+        std::uniform_real_distribution<float> parentDist{ 0.0f, 1.0f };
+
+        for (uint32_t i = 0; i < count; ++i) {
+            const glm::vec3 position{ positionDist(rng.GetRandomEngine()), positionDist(rng.GetRandomEngine()), positionDist(rng.GetRandomEngine()) };
+            const glm::quat orientation{ glm::vec3(0.0f, angleDist(rng.GetRandomEngine()), 0.0f) };
+            const float parentValue{ parentDist(rng.GetRandomEngine()) };
+            const uint32_t parent{ (i > 0 && parentValue > 0.1f) ? outHandles[static_cast<uint32_t>(parentValue * i) % i] : TransformHierarchy::INVALID_HANDLE };
+            outHandles.push_back(hierarchy.Create(position, orientation, glm::vec3(1.5f), parent));
+        }
+    }
+} // namespace
+
+TEST(TransformHierarchyTests, Update_ComputesWorldFromParents)
+{
+    TransformHierarchy hierarchy{};
+    const auto root{ hierarchy.Create(glm::vec3(1.0f, 0.0f, 0.0f), glm::quat(glm::vec3(0.0f, glm::radians(90.0f), 0.0f)), glm::vec3(2.0f)) };
+    const auto child{ hierarchy.Create(glm::vec3(0.0f, 2.0f, 3.0f), glm::quat(1.0f, 0.0f, 0.0f, 0.0f), glm::vec3(3.0f), root) };
+
+    hierarchy.Update();
+
+    const glm::mat4 rootWorld{ prev::util::math::CreateTransformationMatrix(glm::vec3(1.0f, 0.0f, 0.0f), glm::quat(glm::vec3(0.0f, glm::radians(90.0f), 0.0f)), glm::vec3(1.0f)) };
+    const glm::mat4 childWorld{ rootWorld * prev::util::math::CreateTransformationMatrix(glm::vec3(0.0f, 2.0f, 3.0f), glm::quat(1.0f, 0.0f, 0.0f, 0.0f), glm::vec3(1.0f)) };
+
+    EXPECT_EQ(rootWorld, hierarchy.GetWorldTransform(root));
+    EXPECT_EQ(childWorld, hierarchy.GetWorldTransform(child));
+    EXPECT_EQ(glm::scale(childWorld, glm::vec3(3.0f)), hierarchy.GetWorldTransformScaled(child));
+    EXPECT_EQ(glm::transpose(glm::inverse(glm::scale(childWorld, glm::vec3(3.0f)))), hierarchy.GetNormalMatrix(child));
+}
+
+TEST(TransformHierarchyTests, Update_RecomputesOnlyChangedSubtrees)
+{
+    TransformHierarchy hierarchy{};
+    const auto root1{ hierarchy.Create(glm::vec3(1.0f), glm::quat(1.0f, 0.0f, 0.0f, 0.0f), glm::vec3(1.0f)) };
+    const auto child1{ hierarchy.Create(glm::vec3(1.0f), glm::quat(1.0f, 0.0f, 0.0f, 0.0f), glm::vec3(1.0f), root1) };
+    const auto root2{ hierarchy.Create(glm::vec3(2.0f), glm::quat(1.0f, 0.0f, 0.0f, 0.0f), glm::vec3(1.0f)) };
+    const auto child2{ hierarchy.Create(glm::vec3(2.0f), glm::quat(1.0f, 0.0f, 0.0f, 0.0f), glm::vec3(1.0f), root2) };
+    hierarchy.Update();
+
+    const auto child1Version{ hierarchy.GetVersion(child1) };
+    const auto root2Version{ hierarchy.GetVersion(root2) };
+    const auto child2Version{ hierarchy.GetVersion(child2) };
+
+    hierarchy.SetPosition(root1, glm::vec3(5.0f));
+    hierarchy.SetPosition(root2, glm::vec3(2.0f)); // same value
+    hierarchy.Update();
+
+    EXPECT_EQ(child1Version + 1, hierarchy.GetVersion(child1));
+    EXPECT_EQ(root2Version, hierarchy.GetVersion(root2));
+    EXPECT_EQ(child2Version, hierarchy.GetVersion(child2));
+    EXPECT_EQ(glm::vec3(6.0f), glm::vec3(hierarchy.GetWorldTransform(child1)[3]));
+}
+
+TEST(TransformHierarchyTests, SetParentAndDestroy_KeepHierarchyConsistent)
+{
+    TransformHierarchy hierarchy{};
+    const auto child{ hierarchy.Create(glm::vec3(1.0f, 0.0f, 0.0f), glm::quat(1.0f, 0.0f, 0.0f, 0.0f), glm::vec3(1.0f)) };
+    const auto parent{ hierarchy.Create(glm::vec3(0.0f, 1.0f, 0.0f), glm::quat(1.0f, 0.0f, 0.0f, 0.0f), glm::vec3(1.0f)) };
+    const auto grandParent{ hierarchy.Create(glm::vec3(0.0f, 0.0f, 1.0f), glm::quat(1.0f, 0.0f, 0.0f, 0.0f), glm::vec3(1.0f)) };
+
+    // children created before their parents
+    hierarchy.SetParent(child, parent);
+    hierarchy.SetParent(parent, grandParent);
+    hierarchy.Update();
+
+    EXPECT_EQ(parent, hierarchy.GetParent(child));
+    EXPECT_EQ(glm::vec3(1.0f), glm::vec3(hierarchy.GetWorldTransform(child)[3]));
+
+    hierarchy.Destroy(parent);
+    hierarchy.Update();
+
+    EXPECT_EQ(2u, hierarchy.GetCount());
+    EXPECT_EQ(TransformHierarchy::INVALID_HANDLE, hierarchy.GetParent(child));
+    EXPECT_EQ(glm::vec3(1.0f, 0.0f, 0.0f), glm::vec3(hierarchy.GetWorldTransform(child)[3]));
+    EXPECT_EQ(glm::vec3(0.0f, 0.0f, 1.0f), glm::vec3(hierarchy.GetWorldTransform(grandParent)[3]));
+}
+
+TEST(TransformHierarchyTests, UpdateParallel_MatchesSerial)
+{
+    TransformHierarchy serial{};
+    TransformHierarchy parallel{};
+    std::vector<uint32_t> serialHandles;
+    std::vector<uint32_t> parallelHandles;
+    BuildRandomForest(serial, 20000, 1, serialHandles);
+    BuildRandomForest(parallel, 20000, 1, parallelHandles);
+
+    prev::common::ThreadPool threadPool{ 4 };
+    serial.Update();
+    parallel.Update(threadPool);
+
+    for (size_t i = 0; i < serialHandles.size(); i += 7) {
+        serial.SetPosition(serialHandles[i], glm::vec3(static_cast<float>(i)));
+        parallel.SetPosition(parallelHandles[i], glm::vec3(static_cast<float>(i)));
+    }
+    serial.Update();
+    parallel.Update(threadPool);
+
+    for (size_t i = 0; i < serialHandles.size(); ++i) {
+        EXPECT_EQ(serial.GetWorldTransformScaled(serialHandles[i]), parallel.GetWorldTransformScaled(parallelHandles[i]));
+        EXPECT_EQ(serial.GetVersion(serialHandles[i]), parallel.GetVersion(parallelHandles[i]));
+    }
+}
+} // namespace prev::scene::transform
+
+#endif // !__TRANSFORM_HIERARCHY_TESTS_H__
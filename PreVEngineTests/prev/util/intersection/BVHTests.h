@@ -0,0 +1,261 @@
+#ifndef __BVH_TESTS_H__
+#define __BVH_TESTS_H__
+
+#include <prev/common/Common.h>
+#include <prev/util/Utils.h>
+#include <prev/util/intersection/BVH.h>
+#include <prev/util/intersection/IntersectionTester.h>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <set>
+
+namespace prev::util::intersection {
+namespace {
+    std::vector<AABB> GenerateBoxes(const uint32_t count, const float extent, const uint32_t seed)
+    {
+        prev::util::RandomNumberGenerator rng{ seed };
+        std::uniform_real_distribution<float> positionDist{ -extent, extent };
+        std::uniform_real_distribution<float> sizeDist{ 0.1f, 2.0f };
+
+        std::vector<AABB> boxes;
+        boxes.reserve(count);
+        for (uint32_t i = 0; i < count; ++i) {
+            const glm::vec3 position{ positionDist(rng.GetRandomEngine()), positionDist(rng.GetRandomEngine()), positionDist(rng.GetRandomEngine()) };
+            const glm::vec3 halfSize{ sizeDist(rng.GetRandomEngine()), sizeDist(rng.GetRandomEngine()), sizeDist(rng.GetRandomEngine()) };
+            boxes.emplace_back(position - halfSize, position + halfSize);
+        }
+        return boxes;
+    }
+
+    BVH BuildBVH(const std::vector<AABB>& boxes)
+    {
+        BVH bvh{};
+        for (size_t i = 0; i < boxes.size(); ++i) {
+            bvh.Insert(boxes[i], i);
+        }
+        return bvh;
+    }
+} // namespace
+
+TEST(BVHTests, InsertRemove_KeepsBalancedTree)
+{
+    const auto boxes{ GenerateBoxes(1000, 100.0f, 1) };
+
+    BVH bvh{};
+    std::vector<uint32_t> proxies;
+    for (size_t i = 0; i < boxes.size(); ++i) {
+        proxies.push_back(bvh.Insert(boxes[i], i));
+    }
+
+    EXPECT_EQ(1000u, bvh.GetProxyCount());
+    EXPECT_LE(bvh.GetHeight(), 20u);
+
+    for (size_t i = 0; i < proxies.size(); i += 2) {
+        bvh.Remove(proxies[i]);
+    }
+
+    EXPECT_EQ(500u, bvh.GetProxyCount());
+
+    bvh.Clear();
+
+    EXPECT_EQ(0u, bvh.GetProxyCount());
+    EXPECT_EQ(0u, bvh.GetHeight());
+}
+
+TEST(BVHTests, Update_SmallMoveStaysInFatBox)
+{
+    BVH bvh{ 0.5f };
+    const auto proxy{ bvh.Insert(AABB{ glm::vec3(-1.0f), glm::vec3(1.0f) }, 0) };
+
+    EXPECT_FALSE(bvh.Update(proxy, AABB{ glm::vec3(-0.8f), glm::vec3(1.2f) }));
+    EXPECT_TRUE(bvh.Update(proxy, AABB{ glm::vec3(4.0f), glm::vec3(6.0f) }));
+    EXPECT_TRUE(tester::Intersects(bvh.GetFatAABB(proxy), Point{ glm::vec3(5.0f) }));
+}
+
+TEST(BVHTests, QueryAABB_MatchesLinearSearch)
+{
+    const auto boxes{ GenerateBoxes(2000, 100.0f, 2) };
+    const auto bvh{ BuildBVH(boxes) };
+
+    const AABB queryBox{ glm::vec3(-20.0f), glm::vec3(15.0f) };
+
+    std::set<uint64_t> expected;
+    for (size_t i = 0; i < boxes.size(); ++i) {
+        if (tester::Intersects(queryBox, boxes[i])) {
+            expected.insert(i);
+        }
+    }
+
+    std::set<uint64_t> found;
+    bvh.Query(queryBox, [&](const uint64_t userData) {
+        if (tester::Intersects(queryBox, boxes[userData])) {
+            found.insert(userData);
+        }
+        return true;
+    });
+
+    EXPECT_FALSE(expected.empty());
+    EXPECT_EQ(expected, found);
+}
+
+TEST(BVHTests, QuerySphere_MatchesLinearSearch)
+{
+    const auto boxes{ GenerateBoxes(2000, 100.0f, 3) };
+    const auto bvh{ BuildBVH(boxes) };
+
+    const Sphere querySphere{ glm::vec3(10.0f, -5.0f, 3.0f), 25.0f };
+
+    std::set<uint64_t> expected;
+    for (size_t i = 0; i < boxes.size(); ++i) {
+        if (tester::Intersects(querySphere, boxes[i])) {
+            expected.insert(i);
+        }
+    }
+
+    std::set<uint64_t> found;
+    bvh.Query(querySphere, [&](const uint64_t userData) {
+        if (tester::Intersects(querySphere, boxes[userData])) {
+            found.insert(userData);
+        }
+        return true;
+    });
+
+    EXPECT_FALSE(expected.empty());
+    EXPECT_EQ(expected, found);
+}
+
+TEST(BVHTests, QueryFrustum_ContainsAllVisible)
+{
+    const auto boxes{ GenerateBoxes(2000, 100.0f, 4) };
+    const auto bvh{ BuildBVH(boxes) };
+
+    const Frustum frustum{ glm::perspective(glm::radians(60.0f), 1.0f, 0.1f, 50.0f), glm::lookAt(glm::vec3(0.0f), glm::vec3(0.0f, 0.0f, -1.0f), glm::vec3(0.0f, 1.0f, 0.0f)) };
+
+    std::set<uint64_t> found;
+    bvh.Query(frustum, [&](const uint64_t userData) {
+        found.insert(userData);
+        return true;
+    });
+
+    for (size_t i = 0; i < boxes.size(); ++i) {
+        if (tester::Intersects(frustum, boxes[i])) {
+            EXPECT_TRUE(found.find(i) != found.end());
+        }
+    }
+}
+
+TEST(BVHTests, Cull_ContainsAllVisible)
+{
+    const auto boxes{ GenerateBoxes(2000, 100.0f, 4) };
+
+    BVH bvh{ 0.0f };
+    for (size_t i = 0; i < boxes.size(); ++i) {
+        bvh.Insert(boxes[i], i);
+    }
+
+    const Frustum frustum{ glm::perspective(glm::radians(60.0f), 1.0f, 0.1f, 50.0f), glm::lookAt(glm::vec3(0.0f), glm::vec3(0.0f, 0.0f, -1.0f), glm::vec3(0.0f, 1.0f, 0.0f)) };
+
+    BVH::PlaneCache planeCache{};
+    std::set<uint64_t> found;
+    bvh.Cull(frustum, planeCache, [&](const uint32_t proxyId) { found.insert(bvh.GetUserData(proxyId)); });
+
+    EXPECT_FALSE(found.empty());
+    for (size_t i = 0; i < boxes.size(); ++i) {
+        if (tester::Intersects(frustum, boxes[i])) {
+            EXPECT_TRUE(found.find(i) != found.end());
+        }
+    }
+}
+
+TEST(BVHTests, Cull_PlaneCoherencyReducesPlaneTests)
+{
+    const auto boxes{ GenerateBoxes(5000, 200.0f, 5) };
+
+    BVH bvh{ 0.0f };
+    for (size_t i = 0; i < boxes.size(); ++i) {
+        bvh.Insert(boxes[i], i);
+    }
+
+    const Frustum frustum{ glm::perspective(glm::radians(60.0f), 1.0f, 0.1f, 80.0f), glm::lookAt(glm::vec3(0.0f), glm::vec3(1.0f, 0.0f, -1.0f), glm::vec3(0.0f, 1.0f, 0.0f)) };
+
+    BVH::PlaneCache planeCache{};
+    std::set<uint32_t> firstVisible;
+    BVH::CullingStats firstStats{};
+    bvh.Cull(frustum, planeCache, [&](const uint32_t proxyId) { firstVisible.insert(proxyId); }, &firstStats);
+
+    std::set<uint32_t> secondVisible;
+    BVH::CullingStats secondStats{};
+    bvh.Cull(frustum, planeCache, [&](const uint32_t proxyId) { secondVisible.insert(proxyId); }, &secondStats);
+
+    EXPECT_EQ(firstVisible, secondVisible);
+    EXPECT_EQ(firstStats.nodeTests, secondStats.nodeTests);
+    EXPECT_LT(secondStats.planeTests, firstStats.planeTests);
+}
+
+TEST(BVHTests, RayCastClosest_MatchesLinearSearch)
+{
+    const auto boxes{ GenerateBoxes(2000, 100.0f, 5) };
+    const auto bvh{ BuildBVH(boxes) };
+
+    const glm::vec3 origin{ -150.0f, 1.0f, 2.0f };
+    const Ray ray{ origin, glm::normalize(boxes[0].GetCenter() - origin), 500.0f };
+
+    float expectedDistance{ std::numeric_limits<float>::max() };
+    uint64_t expectedUserData{ BVH::INVALID_ID };
+    for (size_t i = 0; i < boxes.size(); ++i) {
+        RayCastResult result{};
+        if (tester::Intersects(ray, boxes[i], result) && result.t < expectedDistance) {
+            expectedDistance = result.t;
+            expectedUserData = i;
+        }
+    }
+
+    uint64_t userData{ BVH::INVALID_ID };
+    RayCastResult result{};
+    const bool hit{ bvh.RayCastClosest(ray, [&](const uint64_t userData, RayCastResult& outResult) { return tester::Intersects(ray, boxes[userData], outResult); }, userData, result) };
+
+    ASSERT_TRUE(hit);
+    EXPECT_EQ(expectedUserData, userData);
+    EXPECT_FLOAT_EQ(expectedDistance, result.t);
+}
+
+TEST(BVHTests, RayCastAny_Negative)
+{
+    const auto boxes{ GenerateBoxes(500, 10.0f, 6) };
+    const auto bvh{ BuildBVH(boxes) };
+
+    const Ray ray{ glm::vec3(0.0f, 50.0f, 0.0f), glm::vec3(0.0f, 1.0f, 0.0f), 100.0f };
+
+    uint64_t userData{};
+    RayCastResult result{};
+    EXPECT_FALSE(bvh.RayCastAny(ray, [&](const uint64_t userData, RayCastResult& outResult) { return tester::Intersects(ray, boxes[userData], outResult); }, userData, result));
+}
+
+TEST(BVHTests, FindNearest_MatchesLinearSearch)
+{
+    const auto boxes{ GenerateBoxes(2000, 100.0f, 7) };
+    const auto bvh{ BuildBVH(boxes) };
+
+    const glm::vec3 point{ 3.0f, -7.0f, 12.0f };
+    const auto GetDistance = [&](const uint64_t userData, const glm::vec3& p) {
+        return glm::distance(glm::clamp(p, boxes[userData].minExtents, boxes[userData].maxExtents), p);
+    };
+
+    std::vector<std::pair<float, uint64_t>> expected;
+    for (size_t i = 0; i < boxes.size(); ++i) {
+        expected.emplace_back(GetDistance(i, point), i);
+    }
+    std::sort(expected.begin(), expected.end());
+
+    const auto nearest{ bvh.FindNearest(point, 8, GetDistance) };
+
+    ASSERT_EQ(8u, nearest.size());
+    for (size_t i = 0; i < nearest.size(); ++i) {
+        EXPECT_FLOAT_EQ(expected[i].first, nearest[i].distance);
+    }
+}
+} // namespace prev::util::intersection
+
+#endif // !__BVH_TESTS_H__
\ No newline at end of file
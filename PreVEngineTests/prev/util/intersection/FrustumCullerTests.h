@@ -0,0 +1,104 @@
+#ifndef __FRUSTUM_CULLER_TESTS_H__
+#define __FRUSTUM_CULLER_TESTS_H__
+
+#include <prev/common/Common.h>
+#include <prev/util/Utils.h>
+#include <prev/util/intersection/FrustumCuller.h>
+#include <prev/util/intersection/IntersectionTester.h>
+
+#include <gtest/gtest.h>
+
+namespace prev::util::intersection {
+namespace {
+    std::vector<AABB> GenerateCullingBoxes(const uint32_t count, const float extent, const uint32_t seed)
+    {
+        prev::util::RandomNumberGenerator rng{ seed };
+        std::uniform_real_distribution<float> positionDist{ -extent, extent };
+        std::uniform_real_distribution<float> sizeDist{ 0.1f, 2.0f };
+
+        std::vector<AABB> boxes;
+        boxes.reserve(count);
+        for (uint32_t i = 0; i < count; ++i) {
+            const glm::vec3 position{ positionDist(rng.GetRandomEngine()), positionDist(rng.GetRandomEngine()), positionDist(rng.GetRandomEngine()) };
+            const glm::vec3 halfSize{ sizeDist(rng.GetRandomEngine()), sizeDist(rng.GetRandomEngine()), sizeDist(rng.GetRandomEngine()) };
+            boxes.emplace_back(position - halfSize, position + halfSize);
+        }
+        return boxes;
+    }
+
+    Frustum CreateTestFrustum(const glm::vec3& eye, const glm::vec3& target)
+    {
+        return Frustum{ glm::perspective(glm::radians(60.0f), 1.5f, 0.1f, 60.0f), glm::lookAt(eye, target, glm::vec3(0.0f, 1.0f, 0.0f)) };
+    }
+} // namespace
+
+TEST(FrustumCullerTests, Cull_MatchesTester)
+{
+    const auto boxes{ GenerateCullingBoxes(1003, 80.0f, 11) };
+
+    FrustumCuller culler{};
+    for (const auto& box : boxes) {
+        culler.Add(box);
+    }
+
+    const Frustum frustums[]{ CreateTestFrustum(glm::vec3(0.0f), glm::vec3(0.0f, 0.0f, -1.0f)), CreateTestFrustum(glm::vec3(10.0f, 5.0f, 0.0f), glm::vec3(30.0f, 0.0f, 20.0f)) };
+
+    VisibilityBitset visibility{};
+    culler.Cull(frustums, 2, visibility);
+
+    ASSERT_EQ(2u, visibility.GetViewCount());
+    ASSERT_EQ(1003u, visibility.GetObjectCount());
+
+    for (uint32_t view = 0; view < 2; ++view) {
+        uint32_t expectedCount{ 0 };
+        for (uint32_t i = 0; i < boxes.size(); ++i) {
+            const bool expected{ tester::Intersects(frustums[view], boxes[i]) };
+            EXPECT_EQ(expected, visibility.IsVisible(view, i));
+            expectedCount += expected ? 1 : 0;
+        }
+        EXPECT_EQ(expectedCount, visibility.GetVisibleCount(view));
+    }
+}
+
+TEST(FrustumCullerTests, Remove_SlotIsNeverVisible)
+{
+    FrustumCuller culler{};
+    const auto slot0{ culler.Add(AABB{ glm::vec3(-1.0f, -1.0f, -6.0f), glm::vec3(1.0f, 1.0f, -4.0f) }) };
+    const auto slot1{ culler.Add(AABB{ glm::vec3(-1.0f, -1.0f, -9.0f), glm::vec3(1.0f, 1.0f, -7.0f) }) };
+
+    const Frustum frustum{ CreateTestFrustum(glm::vec3(0.0f), glm::vec3(0.0f, 0.0f, -1.0f)) };
+
+    VisibilityBitset visibility{};
+    culler.Cull(&frustum, 1, visibility);
+    EXPECT_TRUE(visibility.IsVisible(0, slot0));
+    EXPECT_TRUE(visibility.IsVisible(0, slot1));
+
+    culler.Remove(slot0);
+    culler.Cull(&frustum, 1, visibility);
+    EXPECT_FALSE(visibility.IsVisible(0, slot0));
+    EXPECT_TRUE(visibility.IsVisible(0, slot1));
+
+    // freed slot is reused
+    EXPECT_EQ(slot0, culler.Add(AABB{ glm::vec3(-1.0f), glm::vec3(1.0f) }));
+    EXPECT_EQ(2u, culler.GetSlotCount());
+}
+
+TEST(FrustumCullerTests, IsVisibleInAny_Stereo)
+{
+    FrustumCuller culler{};
+    const auto slot{ culler.Add(AABB{ glm::vec3(-0.5f, -0.5f, -10.5f), glm::vec3(0.5f, 0.5f, -9.5f) }) };
+
+    // object visible only through the first eye
+    const Frustum frustums[]{ CreateTestFrustum(glm::vec3(0.0f), glm::vec3(0.0f, 0.0f, -1.0f)), CreateTestFrustum(glm::vec3(0.0f), glm::vec3(0.0f, 0.0f, 1.0f)) };
+
+    VisibilityBitset visibility{};
+    culler.Cull(frustums, 2, visibility);
+
+    EXPECT_TRUE(visibility.IsVisible(0, slot));
+    EXPECT_FALSE(visibility.IsVisible(1, slot));
+    EXPECT_TRUE(visibility.IsVisibleInAny(0, 2, slot));
+    EXPECT_FALSE(visibility.IsVisibleInAny(1, 1, slot));
+}
+} // namespace prev::util::intersection
+
+#endif // !__FRUSTUM_CULLER_TESTS_H__